@@ -0,0 +1,80 @@
+/*
+ * 100,000 coroutines sleeping concurrently on one datetime::Loop: the cost of spawning them, the CPU time
+ * per wake-up, and how late they wake up. Build with `make bench_coro` (needs a C++20 compiler).
+ */
+
+#include "datetime_coro.hpp"
+
+#include <cstdio>
+#include <ctime>
+
+namespace {
+
+const int SLEEPERS = 100000;
+const int ROUNDS = 3;
+
+long resumed = 0;
+int64_t max_late = 0;
+
+double wall_ms() {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+double cpu_ms() {
+    return (double)clock() * 1e3 / CLOCKS_PER_SEC;
+}
+
+/*
+ * Sleep ROUNDS times for 1 ~ 200 ms, recording how late each wake-up is against its deadline. The first deadlines
+ * pass while the other coroutines are spawned, so only the later rounds count.
+ */
+datetime::Task sleeper(int i) {
+    int round;
+
+    for (round = 0; round < ROUNDS; round++) {
+        TimeInterval interval = {0, 0, 0, 0, 1 + (i * 7 + round * 13) % 200};
+        DateTime deadline = datetime_add(datetime_now(), 0, interval.milliseconds);
+        int64_t late;
+
+        co_await datetime::sleep_until(deadline);
+        late = instant_diff(instant_from_datetime_unchecked(datetime_now()), instant_from_datetime_unchecked(deadline));
+        if (round > 0 && late > max_late) {
+            max_late = late;
+        }
+        resumed++;
+    }
+}
+
+} // namespace
+
+int main() {
+    datetime::Loop loop;
+    double start_wall;
+    double start_cpu;
+    double spawn_ms;
+    double run_wall;
+    double run_cpu;
+    int i;
+
+    start_cpu = cpu_ms();
+    for (i = 0; i < SLEEPERS; i++) {
+        sleeper(i);
+    }
+    spawn_ms = cpu_ms() - start_cpu;
+
+    start_wall = wall_ms();
+    start_cpu = cpu_ms();
+    loop.run();
+    run_wall = wall_ms() - start_wall;
+    run_cpu = cpu_ms() - start_cpu;
+
+    printf("%d coroutines x %d sleeps on one thread and one timerfd\n", SLEEPERS, ROUNDS);
+    printf("%-32s %10.1f ns/coroutine\n", "spawn + first co_await", spawn_ms * 1e6 / SLEEPERS);
+    printf("%-32s %10.1f ns/wake-up (CPU)\n", "resume + 2 datetime_now + sleep", run_cpu * 1e6 / resumed);
+    printf("%-32s %10.1f ms wall, %.1f ms CPU, %ld wake-ups\n", "run", run_wall, run_cpu, resumed);
+    printf("%-32s %10lld ms\n", "latest wake-up after round 1", (long long)max_late);
+    return resumed == (long)SLEEPERS * ROUNDS ? 0 : 1;
+}
@@ -0,0 +1,1579 @@
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "datetime.h"
+#include "datetime_thread.h"
+#include "datetime_business.h"
+#include "datetime_recurrence.h"
+#include "datetime_wheel.h"
+#include "datetime_alarm.h"
+#include "datetime_loop.h"
+#include "datetime_clock.h"
+
+#define BENCH_FIRST_YEAR 1
+#define BENCH_LAST_YEAR 9999
+
+static volatile long sink;
+
+/**
+ * @brief Get the elapsed nanoseconds per operation.
+ * @param start The clock() value when the benchmark started.
+ * @param ops The number of operations.
+ * @return Returns the elapsed nanoseconds per operation.
+ */
+static double ns_per_op(clock_t start, long ops) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC * NANOSECONDS_PER_SECOND / ops;
+}
+
+/**
+ * @brief Get the wall-clock nanoseconds, for the benchmarks where clock() would add up the time of every thread.
+ * @return Returns the monotonic clock in nanoseconds.
+ */
+static double wall_ns(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * NANOSECONDS_PER_SECOND + ts.tv_nsec;
+}
+
+/**
+ * @brief The year-by-year datetime_to_ordinal() this library used to ship, kept as the baseline.
+ */
+static int legacy_to_ordinal(DateTime datetime) {
+    int ordinal = 0;
+    int year;
+    int month;
+
+    for (year = 1; year < datetime.date.year; year++) {
+        ordinal += days_in_year(year);
+    }
+    for (month = JAN; month < datetime.date.month; month++) {
+        ordinal += days_in_month(datetime.date.year, month);
+    }
+    return ordinal + datetime.date.day;
+}
+
+/**
+ * @brief The year-by-year datetime_from_ordinal() this library used to ship, kept as the baseline.
+ */
+static DateTime legacy_from_ordinal(int ordinal) {
+    DateTime datetime = {{1, JAN, 1}, {0, 0, 0, 0}};
+    int year = 1;
+    int month = JAN;
+    int days;
+
+    while (ordinal > 0) {
+        days = days_in_year(year);
+        if (ordinal >= days) {
+            ordinal -= days;
+            year++;
+        } else {
+            for (month = JAN; month <= DEC; month++) {
+                days = days_in_month(year, month);
+                if (ordinal >= days) {
+                    ordinal -= days;
+                } else {
+                    break;
+                }
+            }
+            break;
+        }
+    }
+
+    datetime.date.year = year;
+    datetime.date.month = month;
+    datetime.date.day = ordinal;
+    return datetime;
+}
+
+/**
+ * @brief The loop-based datetime_to_timestamp() this library used to ship, kept as the baseline.
+ */
+static time_t legacy_to_timestamp(DateTime datetime) {
+    int leap_years_passed = 0;
+    int year;
+
+    for (year = 1970; year < datetime.date.year; year++) {
+        if (is_leap_year(year)) {
+            leap_years_passed++;
+        }
+    }
+    return ((time_t)(datetime.date.year - 1970) * DAYS_IN_COMMON_YEAR + leap_years_passed +
+            nth_day_of_year(datetime.date.year, datetime.date.month, datetime.date.day) - 1) * SECONDS_PER_DAY +
+           datetime.time.hour * SECONDS_PER_HOUR + datetime.time.minute * SECONDS_PER_MINUTE + datetime.time.second;
+}
+
+/**
+ * @brief The gmtime()-based datetime_from_timestamp() this library used to ship, kept as the baseline.
+ */
+static DateTime legacy_from_timestamp(time_t timestamp) {
+    DateTime datetime;
+    struct tm *tm = gmtime(&timestamp);
+
+    datetime.date.year = tm->tm_year + 1900;
+    datetime.date.month = tm->tm_mon + 1;
+    datetime.date.day = tm->tm_mday;
+    datetime.time.hour = tm->tm_hour;
+    datetime.time.minute = tm->tm_min;
+    datetime.time.second = tm->tm_sec;
+    datetime.time.millisecond = 0;
+    return datetime;
+}
+
+/**
+ * @brief The mktime()-based date_add() this library used to ship, kept as the baseline.
+ */
+static Date legacy_date_add(Date date, int days) {
+    struct tm tm_date = {0};
+
+    tm_date.tm_year = date.year - 1900;
+    tm_date.tm_mon = date.month - 1;
+    tm_date.tm_mday = date.day + days;
+    mktime(&tm_date);
+
+    date.year = tm_date.tm_year + 1900;
+    date.month = tm_date.tm_mon + 1;
+    date.day = tm_date.tm_mday;
+    return date;
+}
+
+/**
+ * @brief The strftime() and weekday-replacing datetime_format_string() this library used to ship, kept as the baseline.
+ */
+static char *legacy_format_string(DateTime datetime, const char *format) {
+    static const char *NAMES[] = {"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday",
+                                  "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+    const char *name = NULL;
+    size_t old_length;
+    size_t new_length;
+    char *str = NULL;
+    char *p = NULL;
+    struct tm tm = {0};
+    int wday;
+    int i;
+
+    tm.tm_year = datetime.date.year - 1900;
+    tm.tm_mon = datetime.date.month - 1;
+    tm.tm_mday = datetime.date.day;
+    tm.tm_hour = datetime.time.hour;
+    tm.tm_min = datetime.time.minute;
+    tm.tm_sec = datetime.time.second;
+
+    str = (char *)malloc(sizeof(char) * 128);
+    strftime(str, 128, format, &tm);
+
+    wday = weekday(datetime.date.year, datetime.date.month, datetime.date.day);
+    for (i = 0; i < 14; i++) {
+        name = NAMES[i < 7 ? wday : wday + 7];
+        old_length = strlen(NAMES[i]);
+        new_length = strlen(name);
+        for (p = str; (p = strstr(p, NAMES[i])) != NULL; p += new_length) {
+            memmove(p + new_length, p + old_length, strlen(p + old_length) + 1);
+            memcpy(p, name, new_length);
+        }
+    }
+    return (char *)realloc(str, sizeof(char) * (strlen(str) + 1));
+}
+
+void bench_datetime_to_ordinal() {
+    const int ROUNDS = 50;
+    DateTime datetime;
+    clock_t start;
+    long ops = 0;
+    int round;
+    int year;
+    int month;
+    double legacy;
+    double current;
+
+    datetime = datetime_create(1, JAN, 1, 0, 0, 0, 0);
+
+    start = clock();
+    for (year = BENCH_FIRST_YEAR; year <= BENCH_LAST_YEAR; year++) {
+        for (month = JAN; month <= DEC; month++) {
+            datetime.date.year = year;
+            datetime.date.month = month;
+            datetime.date.day = 1 + (year + month) % 28;
+            sink += legacy_to_ordinal(datetime);
+            ops++;
+        }
+    }
+    legacy = ns_per_op(start, ops);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (year = BENCH_FIRST_YEAR; year <= BENCH_LAST_YEAR; year++) {
+            for (month = JAN; month <= DEC; month++) {
+                datetime.date.year = year;
+                datetime.date.month = month;
+                datetime.date.day = 1 + (year + month) % 28;
+                sink += datetime_to_ordinal(datetime);
+                ops++;
+            }
+        }
+    }
+    current = ns_per_op(start, ops);
+
+    printf("%-32s legacy %10.1f ns/op    current %8.1f ns/op\n", "datetime_to_ordinal", legacy, current);
+}
+
+void bench_datetime_from_ordinal() {
+    const int ROUNDS = 50;
+    const int STEP = 7;
+    DateTime datetime;
+    clock_t start;
+    long ops = 0;
+    int round;
+    int ordinal;
+    int last_ordinal;
+    double legacy;
+    double current;
+
+    last_ordinal = datetime_to_ordinal(datetime_create(BENCH_LAST_YEAR, DEC, 31, 0, 0, 0, 0));
+
+    start = clock();
+    for (ordinal = 1; ordinal <= last_ordinal; ordinal += STEP * 4) {
+        datetime = legacy_from_ordinal(ordinal);
+        sink += datetime.date.day;
+        ops++;
+    }
+    legacy = ns_per_op(start, ops);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (ordinal = 1 + round; ordinal <= last_ordinal; ordinal += STEP) {
+            datetime = datetime_from_ordinal(ordinal);
+            sink += datetime.date.day;
+            ops++;
+        }
+    }
+    current = ns_per_op(start, ops);
+
+    printf("%-32s legacy %10.1f ns/op    current %8.1f ns/op\n", "datetime_from_ordinal", legacy, current);
+}
+
+void bench_datetime_to_timestamp() {
+    const int ROUNDS = 50;
+    DateTime datetime;
+    clock_t start;
+    long ops = 0;
+    int round;
+    int year;
+    int month;
+    double legacy;
+    double current;
+
+    datetime = datetime_create(1970, JAN, 1, 12, 34, 56, 0);
+
+    start = clock();
+    for (year = 1970; year <= BENCH_LAST_YEAR; year++) {
+        for (month = JAN; month <= DEC; month++) {
+            datetime.date.year = year;
+            datetime.date.month = month;
+            datetime.date.day = 1 + (year + month) % 28;
+            sink += (long)legacy_to_timestamp(datetime);
+            ops++;
+        }
+    }
+    legacy = ns_per_op(start, ops);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (year = 1970; year <= BENCH_LAST_YEAR; year++) {
+            for (month = JAN; month <= DEC; month++) {
+                datetime.date.year = year;
+                datetime.date.month = month;
+                datetime.date.day = 1 + (year + month) % 28;
+                sink += (long)datetime_to_timestamp(datetime);
+                ops++;
+            }
+        }
+    }
+    current = ns_per_op(start, ops);
+
+    printf("%-32s legacy %10.1f ns/op    current %8.1f ns/op\n", "datetime_to_timestamp", legacy, current);
+}
+
+void bench_datetime_from_timestamp() {
+    const int ROUNDS = 20;
+    const time_t STEP = 86399;
+    DateTime datetime;
+    clock_t start;
+    long ops = 0;
+    int round;
+    time_t timestamp;
+    time_t last_timestamp;
+    double legacy;
+    double current;
+
+    last_timestamp = datetime_to_timestamp(datetime_create(BENCH_LAST_YEAR, DEC, 31, 23, 59, 59, 0));
+
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (timestamp = round; timestamp <= last_timestamp; timestamp += STEP) {
+            datetime = legacy_from_timestamp(timestamp);
+            sink += datetime.time.second;
+            ops++;
+        }
+    }
+    legacy = ns_per_op(start, ops);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (timestamp = round; timestamp <= last_timestamp; timestamp += STEP) {
+            datetime = datetime_from_timestamp(timestamp);
+            sink += datetime.time.second;
+            ops++;
+        }
+    }
+    current = ns_per_op(start, ops);
+
+    printf("%-32s legacy %10.1f ns/op    current %8.1f ns/op\n", "datetime_from_timestamp", legacy, current);
+}
+
+void bench_date_add() {
+    const int ROUNDS = 20;
+    Date date;
+    Date new_date;
+    clock_t start;
+    long ops = 0;
+    int round;
+    int days;
+    double legacy;
+    double current;
+
+    date = date_create(2000, JAN, 1);
+
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (days = -10000; days <= 10000; days += 3) {
+            new_date = legacy_date_add(date, days + round);
+            sink += new_date.day;
+            ops++;
+        }
+    }
+    legacy = ns_per_op(start, ops);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (days = -10000; days <= 10000; days += 3) {
+            new_date = date_add(date, days + round);
+            sink += new_date.day;
+            ops++;
+        }
+    }
+    current = ns_per_op(start, ops);
+
+    printf("%-32s legacy %10.1f ns/op    current %8.1f ns/op\n", "date_add", legacy, current);
+}
+
+/**
+ * @brief The sscanf()-based parsing callers used before datetime_parse_iso8601(), kept as the baseline.
+ */
+static DateTime legacy_parse_iso8601(const char *str) {
+    int year, month, day, hour, minute, second, millisecond;
+
+    sscanf(str, "%4d-%2d-%2dT%2d:%2d:%2d.%3dZ", &year, &month, &day, &hour, &minute, &second, &millisecond);
+    return datetime_create(year, month, day, hour, minute, second, millisecond);
+}
+
+void bench_datetime_to_string() {
+    const int ROWS = 10000;
+    const int ROUNDS = 50;
+    DateTime *datetimes;
+    char buffer[DATETIME_STRING_LENGTH + 1];
+    char *str;
+    clock_t start;
+    long ops = 0;
+    int round;
+    int i;
+    double legacy;
+    double current;
+
+    datetimes = (DateTime *)malloc(sizeof(DateTime) * ROWS);
+    if (datetimes == NULL) {
+        return;
+    }
+    for (i = 0; i < ROWS; i++) {
+        datetimes[i] = datetime_add(datetime_create(2000, JAN, 1, 0, 0, 0, 0), i * 37, i * 8641);
+    }
+
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (i = 0; i < ROWS; i++) {
+            sprintf(buffer, "%04d-%02d-%02d", datetimes[i].date.year, datetimes[i].date.month, datetimes[i].date.day);
+            sink += buffer[DATE_STRING_LENGTH - 1];
+            ops++;
+        }
+    }
+    legacy = ns_per_op(start, ops);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (i = 0; i < ROWS; i++) {
+            sink += (long)date_to_string_buffer(datetimes[i].date, buffer, sizeof(buffer));
+            ops++;
+        }
+    }
+    current = ns_per_op(start, ops);
+    printf("%-32s sprintf %9.1f ns/op    current %8.1f ns/op\n", "date_to_string_buffer", legacy, current);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (i = 0; i < ROWS; i++) {
+            sprintf(buffer, "%02d:%02d:%02d.%03d", datetimes[i].time.hour, datetimes[i].time.minute, datetimes[i].time.second,
+                    datetimes[i].time.millisecond);
+            sink += buffer[TIME_STRING_LENGTH - 1];
+            ops++;
+        }
+    }
+    legacy = ns_per_op(start, ops);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (i = 0; i < ROWS; i++) {
+            sink += (long)time_to_string_buffer(datetimes[i].time, buffer, sizeof(buffer));
+            ops++;
+        }
+    }
+    current = ns_per_op(start, ops);
+    printf("%-32s sprintf %9.1f ns/op    current %8.1f ns/op\n", "time_to_string_buffer", legacy, current);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (i = 0; i < ROWS; i++) {
+            sprintf(buffer, "%04d-%02d-%02d %02d:%02d:%02d.%03d", datetimes[i].date.year, datetimes[i].date.month, datetimes[i].date.day,
+                    datetimes[i].time.hour, datetimes[i].time.minute, datetimes[i].time.second, datetimes[i].time.millisecond);
+            sink += buffer[DATETIME_STRING_LENGTH - 1];
+            ops++;
+        }
+    }
+    legacy = ns_per_op(start, ops);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (i = 0; i < ROWS; i++) {
+            sink += (long)datetime_to_string_buffer(datetimes[i], buffer, sizeof(buffer));
+            ops++;
+        }
+    }
+    current = ns_per_op(start, ops);
+    printf("%-32s sprintf %9.1f ns/op    current %8.1f ns/op\n", "datetime_to_string_buffer", legacy, current);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (i = 0; i < ROWS; i++) {
+            str = datetime_to_string(datetimes[i]);
+            sink += str[DATETIME_STRING_LENGTH - 1];
+            free(str);
+            ops++;
+        }
+    }
+    current = ns_per_op(start, ops);
+    printf("%-32s sprintf %9.1f ns/op    current %8.1f ns/op\n", "datetime_to_string (malloc)", legacy, current);
+
+    free(datetimes);
+}
+
+void bench_datetime_format() {
+    const char *FORMAT = "%a, %d %b %Y %H:%M:%S %z";
+    const int ROUNDS = 20;
+    DateTimeFormat *format;
+    DateTime datetime;
+    char buffer[64];
+    char *str;
+    clock_t start;
+    long ops = 0;
+    int round;
+    int day;
+    double legacy;
+    double current;
+
+    format = datetime_format_create(FORMAT);
+    if (format == NULL) {
+        return;
+    }
+
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (day = 0; day < 10000; day++) {
+            datetime = datetime_add(datetime_create(2000, JAN, 1, 0, 0, 0, 0), day, day * 8641);
+            str = legacy_format_string(datetime, FORMAT);
+            sink += str[0];
+            free(str);
+            ops++;
+        }
+    }
+    legacy = ns_per_op(start, ops);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (day = 0; day < 10000; day++) {
+            datetime = datetime_add(datetime_create(2000, JAN, 1, 0, 0, 0, 0), day, day * 8641);
+            sink += (long)datetime_format_render(format, datetime, buffer, sizeof(buffer));
+            ops++;
+        }
+    }
+    current = ns_per_op(start, ops);
+
+    printf("%-32s legacy %10.1f ns/op    current %8.1f ns/op\n", "datetime_format_render", legacy, current);
+    datetime_format_destroy(format);
+}
+
+void bench_datetime_parse_iso8601() {
+    const int ROWS = 4096;
+    const int ROUNDS = 200;
+    char *buffer;
+    DateTime datetime;
+    clock_t start;
+    long ops = 0;
+    int round;
+    int i;
+    double legacy;
+    double current;
+
+    buffer = (char *)malloc((size_t)ROWS * (DATETIME_ISO8601_LENGTH + 1));
+    if (buffer == NULL) {
+        return;
+    }
+    for (i = 0; i < ROWS; i++) {
+        datetime = datetime_from_timestamp((time_t)i * 61000111);
+        sprintf(buffer + i * (DATETIME_ISO8601_LENGTH + 1), "%04d-%02d-%02dT%02d:%02d:%02d.%03dZ", datetime.date.year, datetime.date.month,
+                datetime.date.day, datetime.time.hour, datetime.time.minute, datetime.time.second, i % 1000);
+    }
+
+    start = clock();
+    for (round = 0; round < ROUNDS / 10; round++) {
+        for (i = 0; i < ROWS; i++) {
+            datetime = legacy_parse_iso8601(buffer + i * (DATETIME_ISO8601_LENGTH + 1));
+            sink += datetime.time.millisecond;
+            ops++;
+        }
+    }
+    legacy = ns_per_op(start, ops);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (i = 0; i < ROWS; i++) {
+            datetime_parse_iso8601(buffer + i * (DATETIME_ISO8601_LENGTH + 1), DATETIME_ISO8601_LENGTH, &datetime);
+            sink += datetime.time.millisecond;
+            ops++;
+        }
+    }
+    current = ns_per_op(start, ops);
+
+    printf("%-32s legacy %10.1f ns/op    current %8.1f ns/op\n", "datetime_parse_iso8601", legacy, current);
+    free(buffer);
+}
+
+void bench_datetime_unchecked() {
+    const int ROUNDS = 1000;
+    const int COUNT = 4096;
+    DateTime *datetimes;
+    clock_t start;
+    long ops;
+    int round;
+    int i;
+    int result;
+    time_t timestamp;
+    double exiting;
+    double checked;
+    double unchecked;
+
+    datetimes = (DateTime *)malloc(sizeof(DateTime) * COUNT);
+    if (datetimes == NULL) {
+        return;
+    }
+    for (i = 0; i < COUNT; i++) {
+        datetimes[i] = datetime_from_timestamp((time_t)i * 61000111);
+    }
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (i = 1; i < COUNT; i++) {
+            sink += datetime_compare(datetimes[i - 1], datetimes[i]);
+            ops++;
+        }
+    }
+    exiting = ns_per_op(start, ops);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (i = 1; i < COUNT; i++) {
+            datetime_compare_checked(datetimes[i - 1], datetimes[i], &result);
+            sink += result;
+            ops++;
+        }
+    }
+    checked = ns_per_op(start, ops);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (i = 1; i < COUNT; i++) {
+            sink += datetime_compare_unchecked(datetimes[i - 1], datetimes[i]);
+            ops++;
+        }
+    }
+    unchecked = ns_per_op(start, ops);
+    printf("%-32s exiting %9.1f    checked %7.1f    unchecked %6.1f ns/op\n", "datetime_compare", exiting, checked, unchecked);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (i = 0; i < COUNT; i++) {
+            sink += (long)datetime_to_timestamp(datetimes[i]);
+            ops++;
+        }
+    }
+    exiting = ns_per_op(start, ops);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (i = 0; i < COUNT; i++) {
+            datetime_to_timestamp_checked(datetimes[i], &timestamp);
+            sink += (long)timestamp;
+            ops++;
+        }
+    }
+    checked = ns_per_op(start, ops);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (i = 0; i < COUNT; i++) {
+            sink += (long)datetime_to_timestamp_unchecked(datetimes[i]);
+            ops++;
+        }
+    }
+    unchecked = ns_per_op(start, ops);
+    printf("%-32s exiting %9.1f    checked %7.1f    unchecked %6.1f ns/op\n", "datetime_to_timestamp", exiting, checked, unchecked);
+
+    free(datetimes);
+}
+
+void bench_weekday_many() {
+    const size_t ROWS = 1000000;
+    const int ROUNDS = 10;
+    Date *dates;
+    Weekday *weekdays;
+    clock_t start;
+    long ops = 0;
+    int round;
+    size_t i;
+    double per_row;
+    double batch;
+
+    dates = (Date *)malloc(sizeof(Date) * ROWS);
+    weekdays = (Weekday *)malloc(sizeof(Weekday) * ROWS);
+    if (dates == NULL || weekdays == NULL) {
+        free(dates);
+        free(weekdays);
+        return;
+    }
+    for (i = 0; i < ROWS; i++) {
+        dates[i] = datetime_from_ordinal((int)(i * 3) + 1).date;
+    }
+
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (i = 0; i < ROWS; i++) {
+            weekdays[i] = weekday(dates[i].year, dates[i].month, dates[i].day);
+            ops++;
+        }
+    }
+    per_row = ns_per_op(start, ops);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        weekday_many(dates, weekdays, ROWS);
+        ops += (long)ROWS;
+    }
+    batch = ns_per_op(start, ops);
+    printf("%-32s per-row %9.1f ns/op    batch %10.1f ns/op\n", "weekday_many", per_row, batch);
+
+    sink += (long)weekdays[ROWS - 1];
+    free(dates);
+    free(weekdays);
+}
+
+/* The ISO week date through libc: mktime() fills the weekday and day of the year, strftime() numbers the week. */
+static IsoWeek legacy_iso_week(Date date) {
+    const char *ISO = "%G %V %u";
+    struct tm tm = {0};
+    char buffer[32];
+    IsoWeek iso;
+
+    tm.tm_year = date.year - 1900;
+    tm.tm_mon = date.month - 1;
+    tm.tm_mday = date.day;
+    tm.tm_hour = 12;
+    tm.tm_isdst = -1;
+    mktime(&tm);
+    strftime(buffer, sizeof(buffer), ISO, &tm);
+    sscanf(buffer, "%d %d %d", &iso.year, &iso.week, &iso.weekday);
+    return iso;
+}
+
+void bench_iso_week() {
+    const size_t ROWS = 1000000;
+    const int ROUNDS = 10;
+    Date *dates;
+    IsoWeek *weeks;
+    clock_t start;
+    long ops = 0;
+    int round;
+    size_t i;
+    double legacy;
+    double current;
+
+    dates = (Date *)malloc(sizeof(Date) * ROWS);
+    weeks = (IsoWeek *)malloc(sizeof(IsoWeek) * ROWS);
+    if (dates == NULL || weeks == NULL) {
+        free(dates);
+        free(weeks);
+        return;
+    }
+    /* 1970 ~ 2037, where mktime() is defined everywhere */
+    for (i = 0; i < ROWS; i++) {
+        dates[i] = datetime_from_ordinal(719163 + (int)(i * 7 % 24837)).date;
+    }
+
+    start = clock();
+    for (i = 0; i < ROWS; i++) {
+        weeks[i] = legacy_iso_week(dates[i]);
+        ops++;
+    }
+    legacy = ns_per_op(start, ops);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        iso_week_many(dates, weeks, ROWS);
+        ops += (long)ROWS;
+    }
+    current = ns_per_op(start, ops);
+    printf("%-32s legacy %10.1f ns/op    current %8.1f ns/op\n", "iso_week_many", legacy, current);
+
+    sink += weeks[ROWS - 1].week;
+    free(dates);
+    free(weeks);
+}
+
+void bench_datetime_column() {
+    const size_t ROWS = 1000000;
+    const int ROUNDS = 10;
+    DateTimeColumn *column;
+    DateTime datetime;
+    time_t *timestamps;
+    uint64_t *mask;
+    clock_t start;
+    long ops = 0;
+    int round;
+    size_t i;
+    double per_row;
+    double batch;
+
+    column = datetime_column_create(ROWS);
+    timestamps = (time_t *)malloc(sizeof(time_t) * ROWS);
+    mask = (uint64_t *)malloc(sizeof(uint64_t) * DATETIME_MASK_WORDS(ROWS));
+    if (column == NULL || timestamps == NULL || mask == NULL) {
+        datetime_column_destroy(column);
+        free(timestamps);
+        free(mask);
+        return;
+    }
+    for (i = 0; i < ROWS; i++) {
+        timestamps[i] = (time_t)i * 250111;
+    }
+
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (i = 0; i < ROWS; i++) {
+            datetime_column_set(column, i, datetime_from_timestamp(timestamps[i]));
+            ops++;
+        }
+    }
+    per_row = ns_per_op(start, ops);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        datetime_column_from_timestamp(column, timestamps);
+        ops += (long)ROWS;
+    }
+    batch = ns_per_op(start, ops);
+    printf("%-32s per-row %9.1f ns/op    batch %10.1f ns/op\n", "datetime_column_from_timestamp", per_row, batch);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (i = 0; i < ROWS; i++) {
+            timestamps[i] = datetime_to_timestamp(datetime_column_get(column, i));
+            ops++;
+        }
+    }
+    per_row = ns_per_op(start, ops);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        datetime_column_to_timestamp(column, timestamps);
+        ops += (long)ROWS;
+    }
+    batch = ns_per_op(start, ops);
+    printf("%-32s per-row %9.1f ns/op    batch %10.1f ns/op\n", "datetime_column_to_timestamp", per_row, batch);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        for (i = 0; i < ROWS; i++) {
+            sink += datetime_create_checked(column->years[i], column->months[i], column->days[i], column->hours[i],
+                                            column->minutes[i], column->seconds[i], column->milliseconds[i], &datetime) == DATETIME_OK;
+            ops++;
+        }
+    }
+    per_row = ns_per_op(start, ops);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        sink += (long)datetime_column_validate_mask(column, mask);
+        ops += (long)ROWS;
+    }
+    batch = ns_per_op(start, ops);
+    printf("%-32s per-row %9.1f ns/op    batch %10.1f ns/op\n", "datetime_column_validate_mask", per_row, batch);
+
+    sink += (long)timestamps[ROWS - 1];
+    datetime_column_destroy(column);
+    free(timestamps);
+    free(mask);
+}
+
+void bench_datetime_parallel() {
+    const size_t ROWS = 4000000;
+    const size_t STRIDE = DATETIME_STRING_LENGTH + 1;
+    const int ROUNDS = 3;
+    DateTimeThreadPool *pool;
+    time_t *timestamps;
+    DateTime *datetimes;
+    char *buffer;
+    double start;
+    double elapsed[4];
+    int max_threads;
+    int threads;
+    int round;
+    size_t i;
+
+    timestamps = (time_t *)malloc(sizeof(time_t) * ROWS);
+    datetimes = (DateTime *)malloc(sizeof(DateTime) * ROWS);
+    buffer = (char *)malloc(STRIDE * ROWS);
+    if (timestamps == NULL || datetimes == NULL || buffer == NULL) {
+        free(timestamps);
+        free(datetimes);
+        free(buffer);
+        return;
+    }
+    for (i = 0; i < ROWS; i++) {
+        timestamps[i] = (time_t)i * 62311 + (time_t)(i % 1000);
+    }
+
+    max_threads = datetime_thread_pool_size(NULL);
+    max_threads = max_threads < 4 ? 4 : max_threads;
+    printf("%-32s %11s %11s %11s %11s   (ns/row, %d online CPUs)\n", "datetime_parallel threads", "from_ts", "to_ts", "to_string", "parse",
+           datetime_thread_pool_size(NULL));
+
+    for (threads = 1; threads <= max_threads; threads++) {
+        pool = datetime_thread_pool_create(threads);
+        if (pool == NULL) {
+            break;
+        }
+
+        elapsed[0] = elapsed[1] = elapsed[2] = elapsed[3] = 0;
+        for (round = 0; round < ROUNDS; round++) {
+            start = wall_ns();
+            datetime_parallel_from_timestamp(pool, timestamps, datetimes, ROWS);
+            elapsed[0] += wall_ns() - start;
+
+            start = wall_ns();
+            datetime_parallel_to_timestamp(pool, datetimes, timestamps, ROWS);
+            elapsed[1] += wall_ns() - start;
+
+            start = wall_ns();
+            datetime_parallel_to_string(pool, datetimes, buffer, STRIDE, ROWS);
+            elapsed[2] += wall_ns() - start;
+
+            start = wall_ns();
+            sink += (long)datetime_parallel_parse(pool, buffer, STRIDE, datetimes, NULL, ROWS);
+            elapsed[3] += wall_ns() - start;
+        }
+        datetime_thread_pool_destroy(pool);
+
+        printf("%-32d %11.1f %11.1f %11.1f %11.1f\n", threads, elapsed[0] / ROUNDS / ROWS, elapsed[1] / ROUNDS / ROWS,
+               elapsed[2] / ROUNDS / ROWS, elapsed[3] / ROUNDS / ROWS);
+    }
+
+    free(timestamps);
+    free(datetimes);
+    free(buffer);
+}
+
+/* Settlement the way it used to be done: step one day at a time with the mktime()-based date_add(). */
+static bool legacy_is_business_day(Date date, const Date *holidays, size_t count) {
+    Weekday day = weekday(date.year, date.month, date.day);
+    size_t i;
+
+    if (day == SAT || day == SUN) {
+        return false;
+    }
+    for (i = 0; i < count; i++) {
+        if (date_compare(holidays[i], date) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static Date legacy_business_add(Date date, int days, const Date *holidays, size_t count) {
+    while (days > 0) {
+        date = legacy_date_add(date, 1);
+        days -= legacy_is_business_day(date, holidays, count);
+    }
+    return date;
+}
+
+static int legacy_business_count(Date from, Date to, const Date *holidays, size_t count) {
+    int business_days = 0;
+
+    for (; date_compare(from, to) < 0; from = legacy_date_add(from, 1)) {
+        business_days += legacy_is_business_day(from, holidays, count);
+    }
+    return business_days;
+}
+
+void bench_business_calendar() {
+    const size_t ROWS = 1000000;
+    const size_t LEGACY_ROWS = 20000;
+    const size_t HOLIDAYS = 10;
+    const int ROUNDS = 10;
+    BusinessCalendar *calendar;
+    Date holidays[10];
+    Date *dates;
+    Date *results;
+    clock_t start;
+    long ops = 0;
+    int round;
+    int count;
+    size_t i;
+    double legacy;
+    double current;
+
+    /* 10 holidays in 2024, trades over 2024 */
+    for (i = 0; i < HOLIDAYS; i++) {
+        holidays[i] = date_create(2024, (int)i + 1, 1 + (int)i * 2);
+    }
+    calendar = business_calendar_create(date_create(2000, JAN, 1), date_create(2099, DEC, 31), BUSINESS_WEEKEND_SAT_SUN);
+    dates = (Date *)malloc(sizeof(Date) * ROWS);
+    results = (Date *)malloc(sizeof(Date) * ROWS);
+    if (calendar == NULL || dates == NULL || results == NULL) {
+        business_calendar_destroy(calendar);
+        free(dates);
+        free(results);
+        return;
+    }
+    business_calendar_add_holidays(calendar, holidays, HOLIDAYS);
+    for (i = 0; i < ROWS; i++) {
+        dates[i] = date_add(date_create(2024, JAN, 1), (int)(i * 7 % 360));
+    }
+
+    start = clock();
+    for (i = 0; i < LEGACY_ROWS; i++) {
+        results[i] = legacy_business_add(dates[i], 2, holidays, HOLIDAYS);
+        ops++;
+    }
+    legacy = ns_per_op(start, ops);
+
+    ops = 0;
+    start = clock();
+    for (round = 0; round < ROUNDS; round++) {
+        sink += (long)business_calendar_add_many(calendar, dates, 2, results, NULL, ROWS);
+        ops += (long)ROWS;
+    }
+    current = ns_per_op(start, ops);
+    printf("%-32s legacy %10.1f ns/op    current %8.1f ns/op\n", "business_calendar_add (T+2)", legacy, current);
+
+    /* Business days from every trade to the end of the year */
+    ops = 0;
+    start = clock();
+    for (i = 0; i < LEGACY_ROWS / 100; i++) {
+        sink += legacy_business_count(dates[i], date_create(2024, DEC, 31), holidays, HOLIDAYS);
+        ops++;
+    }
+    legacy = ns_per_op(start, ops);
+
+    ops = 0;
+    start = clock();
+    for (i = 0; i < ROWS; i++) {
+        business_calendar_count(calendar, dates[i], date_create(2024, DEC, 31), &count);
+        sink += count;
+        ops++;
+    }
+    current = ns_per_op(start, ops);
+    printf("%-32s legacy %10.1f ns/op    current %8.1f ns/op\n", "business_calendar_count", legacy, current);
+
+    sink += results[ROWS - 1].day;
+    business_calendar_destroy(calendar);
+    free(dates);
+    free(results);
+}
+
+static bool legacy_next_occurrence(const Recurrence *rule, DateTime after, DateTime *out) {
+    DateTime datetime = after;
+    long minute;
+
+    datetime.time.second = 0;
+    datetime.time.millisecond = 0;
+    for (minute = 0; minute < 60L * 24 * 366 * 8; minute++) {
+        datetime = datetime_add(datetime, 0, MILLISECONDS_PER_MINUTE);
+        if (recurrence_matches(rule, datetime)) {
+            *out = datetime;
+            return true;
+        }
+    }
+    return false;
+}
+
+void bench_recurrence() {
+    const size_t RULES = 200000;
+    const size_t LEGACY_RULES = 200;
+    const int TICKS = 10;
+    const char *CRONS[] = {"*/5 * * * *", "0 9-17 * * MON-FRI", "30 2 1 * *", "0 0 * * SUN", "15 */6 1,15 * *", "0 12 29 2 *"};
+    Recurrence **rules;
+    RecurrenceBatch *batch;
+    DateTime *results;
+    bool *matches;
+    uint64_t *mask;
+    DateTime now = datetime_create(2024, MAR, 1, 12, 1, 0, 0);
+    clock_t start;
+    long ops = 0;
+    int tick;
+    size_t i;
+    double legacy;
+    double current;
+
+    rules = (Recurrence **)calloc(RULES, sizeof(Recurrence *));
+    results = (DateTime *)malloc(sizeof(DateTime) * RULES);
+    matches = (bool *)malloc(sizeof(bool) * RULES);
+    if (rules == NULL || results == NULL || matches == NULL) {
+        free(rules);
+        free(results);
+        free(matches);
+        return;
+    }
+    for (i = 0; i < RULES; i++) {
+        rules[i] = recurrence_compile_cron(CRONS[i % 6]);
+    }
+
+    /* Next occurrence of every rule: stepping one minute at a time vs jumping through the bitsets */
+    start = clock();
+    for (i = 0; i < LEGACY_RULES; i++) {
+        sink += legacy_next_occurrence(rules[i], now, &results[i]);
+        ops++;
+    }
+    legacy = ns_per_op(start, ops);
+
+    ops = 0;
+    start = clock();
+    for (tick = 0; tick < TICKS; tick++) {
+        sink += (long)recurrence_next_occurrence_many((const Recurrence *const *)rules, now, results, NULL, RULES);
+        ops += (long)RULES;
+    }
+    current = ns_per_op(start, ops);
+    printf("%-32s legacy %10.1f ns/op    current %8.1f ns/op\n", "recurrence_next_occurrence", legacy, current);
+
+    /* Every rule on every tick */
+    ops = 0;
+    start = clock();
+    for (tick = 0; tick < TICKS; tick++) {
+        now.time.minute = tick;
+        for (i = 0; i < RULES; i++) {
+            sink += recurrence_matches(rules[i], now);
+        }
+        ops += (long)RULES;
+    }
+    legacy = ns_per_op(start, ops);
+
+    ops = 0;
+    start = clock();
+    for (tick = 0; tick < TICKS * 10; tick++) {
+        now.time.minute = tick % 60;
+        sink += (long)recurrence_matches_many((const Recurrence *const *)rules, now, matches, RULES);
+        ops += (long)RULES;
+    }
+    current = ns_per_op(start, ops);
+    printf("%-32s per-row %9.1f ns/op    batch %10.1f ns/op\n", "recurrence_matches_many", legacy, current);
+    printf("%-32s %.3f ms per tick of %lu rules\n", "", current * (double)RULES / 1e6, (unsigned long)RULES);
+
+    /* The same rules compiled into one struct-of-arrays batch */
+    batch = recurrence_batch_create((const Recurrence *const *)rules, RULES);
+    mask = (uint64_t *)malloc(sizeof(uint64_t) * DATETIME_MASK_WORDS(RULES));
+    if (batch != NULL && mask != NULL) {
+        ops = 0;
+        start = clock();
+        for (tick = 0; tick < TICKS * 10; tick++) {
+            now.time.minute = tick % 60;
+            sink += (long)recurrence_batch_matches(batch, now, mask);
+            ops += (long)RULES;
+        }
+        legacy = current;
+        current = ns_per_op(start, ops);
+        printf("%-32s pointers %8.1f ns/op    batch %10.1f ns/op\n", "recurrence_batch_matches", legacy, current);
+        printf("%-32s %.3f ms per tick of %lu rules\n", "", current * (double)RULES / 1e6, (unsigned long)RULES);
+    }
+    recurrence_batch_destroy(batch);
+    free(mask);
+
+    sink += results[RULES - 1].time.minute;
+    for (i = 0; i < RULES; i++) {
+        recurrence_destroy(rules[i]);
+    }
+    free(rules);
+    free(results);
+    free(matches);
+}
+
+static void legacy_heap_push(DateTime *heap, size_t *size, DateTime deadline) {
+    size_t i = (*size)++;
+    DateTime swap;
+
+    heap[i] = deadline;
+    while (i > 0 && datetime_compare(heap[(i - 1) / 2], heap[i]) > 0) {
+        swap = heap[i];
+        heap[i] = heap[(i - 1) / 2];
+        heap[(i - 1) / 2] = swap;
+        i = (i - 1) / 2;
+    }
+}
+
+static DateTime legacy_heap_pop(DateTime *heap, size_t *size) {
+    DateTime top = heap[0];
+    DateTime swap;
+    size_t i = 0;
+    size_t child;
+
+    heap[0] = heap[--*size];
+    while ((child = 2 * i + 1) < *size) {
+        if (child + 1 < *size && datetime_compare(heap[child + 1], heap[child]) < 0) {
+            child++;
+        }
+        if (datetime_compare(heap[i], heap[child]) <= 0) {
+            break;
+        }
+        swap = heap[i];
+        heap[i] = heap[child];
+        heap[child] = swap;
+        i = child;
+    }
+    return top;
+}
+
+static Instant bench_wheel_now(void *context) {
+    return *(const Instant *)context;
+}
+
+static void bench_wheel_expired(const TimerExpiry *expired, size_t count, void *context) {
+    (void)context;
+    sink += (long)count + (long)(expired[count - 1].deadline & 1);
+}
+
+void bench_timer_wheel() {
+    const size_t TIMERS = 1000000;
+    const int HOUR = MILLISECONDS_PER_HOUR;
+    DateTime start_datetime = datetime_create(2024, JAN, 1, 0, 0, 0, 0);
+    Instant now = instant_from_datetime(start_datetime);
+    Instant end = now + HOUR;
+    DateTime *deadlines;
+    DateTime *heap;
+    TimerWheel *wheel;
+    clock_t start;
+    size_t size = 0;
+    size_t i;
+    double legacy;
+    double current;
+
+    deadlines = (DateTime *)malloc(sizeof(DateTime) * TIMERS);
+    heap = (DateTime *)malloc(sizeof(DateTime) * TIMERS);
+    wheel = timer_wheel_create(1, bench_wheel_now, &now);
+    if (deadlines == NULL || heap == NULL || wheel == NULL) {
+        free(deadlines);
+        free(heap);
+        timer_wheel_destroy(wheel);
+        return;
+    }
+    /* 1M deadlines over the next hour, expired with a tick of 1 ms */
+    srand(20);
+    for (i = 0; i < TIMERS; i++) {
+        deadlines[i] = datetime_add(start_datetime, 0, (int64_t)((unsigned long)rand() * 7919UL % (unsigned long)HOUR));
+    }
+
+    start = clock();
+    for (i = 0; i < TIMERS; i++) {
+        legacy_heap_push(heap, &size, deadlines[i]);
+    }
+    while (size > 0) {
+        sink += legacy_heap_pop(heap, &size).time.millisecond;
+    }
+    legacy = ns_per_op(start, (long)TIMERS);
+
+    start = clock();
+    for (i = 0; i < TIMERS; i++) {
+        timer_wheel_schedule(wheel, deadlines[i], NULL);
+    }
+    for (; now <= end; now++) {
+        timer_wheel_expire(wheel, bench_wheel_expired, NULL);
+    }
+    current = ns_per_op(start, (long)TIMERS);
+    printf("%-32s legacy %10.1f ns/op    current %8.1f ns/op\n", "timer_wheel (schedule + expire)", legacy, current);
+
+    free(deadlines);
+    free(heap);
+    timer_wheel_destroy(wheel);
+}
+
+/* The struct tm round trip daemons used to build a timespec with (timegm() is not standard, so mktime()). */
+static void legacy_datetime_to_timespec(DateTime datetime, struct timespec *out) {
+    struct tm tm;
+
+    memset(&tm, 0, sizeof(tm));
+    tm.tm_year = datetime.date.year - 1900;
+    tm.tm_mon = datetime.date.month - 1;
+    tm.tm_mday = datetime.date.day;
+    tm.tm_hour = datetime.time.hour;
+    tm.tm_min = datetime.time.minute;
+    tm.tm_sec = datetime.time.second;
+    out->tv_sec = mktime(&tm);
+    out->tv_nsec = (long)datetime.time.millisecond * NANOSECONDS_PER_MILLISECOND;
+}
+
+void bench_datetime_alarm() {
+    const long ROWS = 1000000;
+    const int WAIT_MILLISECONDS = 100;
+    DateTimeAlarm *alarm;
+    DateTime datetime = datetime_create(2024, MAR, 1, 12, 0, 0, 0);
+    DateTime deadline;
+    struct timespec ts;
+    clock_t start;
+    long i;
+    double legacy;
+    double current;
+
+    start = clock();
+    for (i = 0; i < ROWS; i++) {
+        datetime.time.millisecond = (int)(i % 1000);
+        legacy_datetime_to_timespec(datetime, &ts);
+        sink += (long)ts.tv_sec + ts.tv_nsec;
+    }
+    legacy = ns_per_op(start, ROWS);
+
+    start = clock();
+    for (i = 0; i < ROWS; i++) {
+        datetime.time.millisecond = (int)(i % 1000);
+        datetime_to_timespec(datetime, &ts);
+        sink += (long)ts.tv_sec + ts.tv_nsec;
+    }
+    current = ns_per_op(start, ROWS);
+    printf("%-32s legacy %10.1f ns/op    current %8.1f ns/op\n", "datetime_to_timespec", legacy, current);
+
+    /* CPU time spent waiting 100 ms for a deadline: polling datetime_now() vs sleeping on the timerfd */
+    alarm = datetime_alarm_create(true);
+    if (alarm == NULL) {
+        return;
+    }
+    deadline = datetime_add(datetime_now(), 0, WAIT_MILLISECONDS);
+    start = clock();
+    while (datetime_compare(datetime_now(), deadline) < 0) {
+        sink++;
+    }
+    legacy = (double)(clock() - start) / CLOCKS_PER_SEC * MILLISECONDS_PER_SECOND;
+
+    deadline = datetime_add(datetime_now(), 0, WAIT_MILLISECONDS);
+    start = clock();
+    datetime_alarm_set(alarm, deadline);
+    sink += datetime_alarm_wait(alarm, -1);
+    current = (double)(clock() - start) / CLOCKS_PER_SEC * MILLISECONDS_PER_SECOND;
+    printf("%-32s polling %7.1f ms CPU     alarm %8.3f ms CPU\n", "wait 100 ms for a deadline", legacy, current);
+    datetime_alarm_destroy(alarm);
+}
+
+/**
+ * @brief The thread-per-sleeper baseline: sleep on the wall clock until the deadline with clock_nanosleep().
+ */
+static void *legacy_sleeper_thread(void *arg) {
+    struct timespec *deadline = (struct timespec *)arg;
+
+    while (clock_nanosleep(CLOCK_REALTIME, TIMER_ABSTIME, deadline, NULL) != 0) {
+    }
+    sink++;
+    return NULL;
+}
+
+static void bench_loop_woken(void *data) {
+    (void)data;
+    sink++;
+}
+
+void bench_datetime_loop() {
+    const long THREADS = 1000;
+    const long SLEEPERS = 100000;
+    const int SPREAD_MILLISECONDS = 200;
+    pthread_t *threads = (pthread_t *)malloc(sizeof(pthread_t) * THREADS);
+    struct timespec *deadlines = (struct timespec *)malloc(sizeof(struct timespec) * THREADS);
+    DateTimeSleeper *sleepers = (DateTimeSleeper *)malloc(sizeof(DateTimeSleeper) * SLEEPERS);
+    DateTimeLoop *loop = datetime_loop_create();
+    TimeInterval interval = {0, 0, 0, 0, 0};
+    struct timespec now;
+    clock_t start;
+    long i;
+    double legacy;
+    double current;
+
+    if (threads == NULL || deadlines == NULL || sleepers == NULL || loop == NULL) {
+        free(threads);
+        free(deadlines);
+        free(sleepers);
+        datetime_loop_destroy(loop);
+        return;
+    }
+
+    /* CPU time per sleeper, from registration to wake-up: a thread each for 1,000 sleepers vs the loop for 100,000 */
+    clock_gettime(CLOCK_REALTIME, &now);
+    start = clock();
+    for (i = 0; i < THREADS; i++) {
+        deadlines[i] = now;
+        deadlines[i].tv_nsec += (long)(1 + i % SPREAD_MILLISECONDS) * NANOSECONDS_PER_MILLISECOND;
+        deadlines[i].tv_sec += deadlines[i].tv_nsec / NANOSECONDS_PER_SECOND;
+        deadlines[i].tv_nsec %= NANOSECONDS_PER_SECOND;
+        if (pthread_create(&threads[i], NULL, legacy_sleeper_thread, &deadlines[i]) != 0) {
+            break;
+        }
+    }
+    while (i > 0) {
+        pthread_join(threads[--i], NULL);
+    }
+    legacy = ns_per_op(start, THREADS);
+
+    start = clock();
+    for (i = 0; i < SLEEPERS; i++) {
+        sleepers[i].callback = bench_loop_woken;
+        sleepers[i].data = NULL;
+        sleepers[i].id = 0;
+        interval.milliseconds = (int)(1 + i % SPREAD_MILLISECONDS);
+        datetime_loop_sleep_for(loop, &sleepers[i], interval);
+    }
+    datetime_loop_run(loop);
+    current = ns_per_op(start, SLEEPERS);
+    printf("%-32s threads %9.1f ns/op    loop %11.1f ns/op\n", "sleep 1 ~ 200 ms (CPU)", legacy, current);
+
+    free(threads);
+    free(deadlines);
+    free(sleepers);
+    datetime_loop_destroy(loop);
+}
+
+void bench_stopwatch() {
+    const long ROWS = 2000000;
+    Stopwatch stopwatch;
+    Time begin;
+    Time end;
+    clock_t start;
+    long i;
+    double legacy;
+    double current;
+
+    start = clock();
+    for (i = 0; i < ROWS; i++) {
+        sink += time_now().millisecond;
+    }
+    legacy = ns_per_op(start, ROWS);
+
+    start = clock();
+    for (i = 0; i < ROWS; i++) {
+        sink += (long)mono_now(MONO_CLOCK_MONOTONIC);
+    }
+    current = ns_per_op(start, ROWS);
+    printf("%-32s legacy %10.1f ns/op    current %8.1f ns/op\n", "read the clock", legacy, current);
+
+    start = clock();
+    for (i = 0; i < ROWS; i++) {
+        sink += (long)mono_now(MONO_CLOCK_RAW);
+    }
+    current = ns_per_op(start, ROWS);
+    printf("%-32s legacy %10.1f ns/op    current %8.1f ns/op\n", "read the clock (raw)", legacy, current);
+
+    /* Timing a request: two time_now() and a millisecond difference vs a stopwatch */
+    start = clock();
+    for (i = 0; i < ROWS; i++) {
+        begin = time_now();
+        end = time_now();
+        sink += ((end.hour * MINUTES_PER_HOUR + end.minute) * SECONDS_PER_MINUTE + end.second) * MILLISECONDS_PER_SECOND + end.millisecond -
+                (((begin.hour * MINUTES_PER_HOUR + begin.minute) * SECONDS_PER_MINUTE + begin.second) * MILLISECONDS_PER_SECOND + begin.millisecond);
+    }
+    legacy = ns_per_op(start, ROWS);
+
+    start = clock();
+    for (i = 0; i < ROWS; i++) {
+        stopwatch = stopwatch_start_new(MONO_CLOCK_MONOTONIC);
+        sink += (long)stopwatch_elapsed(&stopwatch);
+    }
+    current = ns_per_op(start, ROWS);
+    printf("%-32s legacy %10.1f ns/op    current %8.1f ns/op\n", "time a request", legacy, current);
+}
+
+void bench_tsc_clock() {
+    const long ROWS = 5000000;
+    TscClock *tsc = tsc_clock_create(1000, true);
+    struct timespec ts;
+    clock_t start;
+    long i;
+    double legacy;
+    double current;
+
+    if (tsc == NULL) {
+        return;
+    }
+    printf("TSC clock source: %s, %.3f GHz\n", tsc_clock_is_tsc(tsc) ? "invariant TSC" : "CLOCK_REALTIME fallback",
+           tsc_clock_frequency(tsc) / 1e9);
+
+    start = clock();
+    for (i = 0; i < ROWS; i++) {
+        clock_gettime(CLOCK_REALTIME, &ts);
+        sink += ts.tv_nsec;
+    }
+    legacy = ns_per_op(start, ROWS);
+
+    start = clock();
+    for (i = 0; i < ROWS; i++) {
+        sink += (long)tsc_clock_ticks(tsc);
+    }
+    current = ns_per_op(start, ROWS);
+    printf("%-32s legacy %10.1f ns/op    current %8.1f ns/op\n", "timestamp ticks", legacy, current);
+
+    start = clock();
+    for (i = 0; i < ROWS; i++) {
+        sink += (long)tsc_clock_now(tsc);
+    }
+    current = ns_per_op(start, ROWS);
+    printf("%-32s legacy %10.1f ns/op    current %8.1f ns/op\n", "timestamp epoch ns", legacy, current);
+
+    start = clock();
+    for (i = 0; i < ROWS / 10; i++) {
+        sink += datetime_now().time.millisecond;
+    }
+    legacy = ns_per_op(start, ROWS / 10);
+
+    start = clock();
+    for (i = 0; i < ROWS / 10; i++) {
+        sink += tsc_clock_now_datetime(tsc).time.millisecond;
+    }
+    current = ns_per_op(start, ROWS / 10);
+    printf("%-32s legacy %10.1f ns/op    current %8.1f ns/op\n", "DateTime now", legacy, current);
+    tsc_clock_destroy(tsc);
+}
+
+/**
+ * @brief The datetime_now() this library used to ship, kept as the baseline: two clock reads and two localtime().
+ */
+static DateTime legacy_datetime_now(void) {
+    DateTime datetime;
+
+    datetime.date = date_now();
+    datetime.time = time_now();
+    return datetime;
+}
+
+void bench_datetime_now() {
+    const long ROWS = 1000000;
+    DateTimeSnapshot snapshot;
+    clock_t start;
+    long i;
+    double legacy;
+    double current;
+
+    start = clock();
+    for (i = 0; i < ROWS; i++) {
+        sink += legacy_datetime_now().time.millisecond;
+    }
+    legacy = ns_per_op(start, ROWS);
+
+    start = clock();
+    for (i = 0; i < ROWS; i++) {
+        sink += datetime_now().time.millisecond;
+    }
+    current = ns_per_op(start, ROWS);
+    printf("%-32s legacy %10.1f ns/op    current %8.1f ns/op\n", "datetime_now", legacy, current);
+
+    start = clock();
+    for (i = 0; i < ROWS; i++) {
+        snapshot = datetime_now_snapshot(DATETIME_CLOCK_REALTIME);
+        sink += snapshot.local.time.millisecond + snapshot.utc.time.millisecond;
+    }
+    current = ns_per_op(start, ROWS);
+    printf("%-32s legacy %10.1f ns/op    current %8.1f ns/op\n", "snapshot (UTC + local + epoch)", legacy, current);
+
+    start = clock();
+    for (i = 0; i < ROWS; i++) {
+        snapshot = datetime_now_snapshot(DATETIME_CLOCK_REALTIME_COARSE);
+        sink += snapshot.local.time.millisecond + snapshot.utc.time.millisecond;
+    }
+    current = ns_per_op(start, ROWS);
+    printf("%-32s legacy %10.1f ns/op    current %8.1f ns/op\n", "snapshot, coarse clock", legacy, current);
+}
+
+int main() {
+    printf("Years %04d ~ %04d\n", BENCH_FIRST_YEAR, BENCH_LAST_YEAR);
+
+    bench_datetime_to_ordinal();
+    bench_datetime_from_ordinal();
+    bench_datetime_to_timestamp();
+    bench_datetime_from_timestamp();
+    bench_date_add();
+    bench_datetime_to_string();
+    bench_datetime_format();
+    bench_datetime_parse_iso8601();
+    bench_datetime_unchecked();
+    bench_weekday_many();
+    bench_iso_week();
+    bench_datetime_column();
+    bench_datetime_parallel();
+    bench_business_calendar();
+    bench_recurrence();
+    bench_timer_wheel();
+    bench_datetime_alarm();
+    bench_datetime_loop();
+    bench_stopwatch();
+    bench_tsc_clock();
+    bench_datetime_now();
+
+    return 0;
+}
@@ -1,3 +1,7 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200112L
+#endif
+
 #include "datetime.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -9,6 +13,15 @@
 #include <sys/time.h>
 #endif
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define DATETIME_AVX2
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#define AVX2_LANES 8
+#define DATETIME_SSSE3
+#define TARGET_SSSE3 __attribute__((target("ssse3")))
+#endif
+
 #define return_if(expr) \
     if (expr) {         \
         return;         \
@@ -39,15 +52,108 @@
         exit(EXIT_FAILURE); \
     }
 
+#define return_error_if_fail(expr, error) \
+    if (!(expr)) {                        \
+        return __set_error(error);        \
+    }
+
+#if defined(_MSC_VER)
+#define THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define THREAD_LOCAL __thread
+#else
+#define THREAD_LOCAL /* the last error is shared by all threads */
+#endif
+
+#if defined(__GNUC__)
+#define CACHE_ALIGNED __attribute__((aligned(64)))
+#else
+#define CACHE_ALIGNED
+#endif
+
 #define MIN_YEAR 1
 #define MAX_YEAR 9999
 
+#define DAYS_PER_400_YEARS 146097
+#define ORDINAL_SHIFT 305 /* ordinal 0 (0000-12-31) is 305 days after 0000-03-01 */
+#define MAX_ORDINAL 3652059       /* 9999-12-31 */
+#define UNIX_EPOCH_ORDINAL 719163 /* 1970-01-01 */
+
+#define MIN_TIMESTAMP ((time_t)(1 - UNIX_EPOCH_ORDINAL) * SECONDS_PER_DAY)
+#define MAX_TIMESTAMP ((time_t)(MAX_ORDINAL - UNIX_EPOCH_ORDINAL + 1) * SECONDS_PER_DAY - 1)
+
+#define PACKED_DAY_BITS 5
+#define PACKED_MONTH_BITS 4
+#define PACKED_TIME_BITS 32
+
+#include "datetime_year_table.h"
+
+#define YEAR_DAYS_BEFORE(year) ((int)(YEAR_TABLE[year] >> 4)) /* the day number of January 1 minus 1 */
+#define YEAR_IS_LEAP(year) ((int)(YEAR_TABLE[year] >> 3) & 1)
+#define YEAR_WEEKDAY(year) ((int)YEAR_TABLE[year] & 7) /* the weekday of January 1 */
+
+/* The days before the first day of the month, for common years and leap years. Entry 13 is the days in the year. */
+static const short DAYS_BEFORE_MONTH[2][MONTHS_PER_YEAR + 2] CACHE_ALIGNED = {
+    {0, 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365},
+    {0, 0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335, 366},
+};
+
+static THREAD_LOCAL DateTimeError __last_error = DATETIME_OK;
+
+/**
+ * @brief Record the error code as the last error of the calling thread.
+ * @param error The error code.
+ * @return Returns the error code.
+ */
+static DateTimeError __set_error(DateTimeError error) {
+    __last_error = error;
+    return error;
+}
+
+/**
+ * @brief Get the description of the error code.
+ * @param error The error code.
+ * @return Returns the description of the error code.
+ */
+const char *datetime_error_string(DateTimeError error) {
+    switch (error) {
+    case DATETIME_OK:
+        return "success";
+    case DATETIME_ERROR_ARGUMENT:
+        return "a required pointer is NULL";
+    case DATETIME_ERROR_SYNTAX:
+        return "the input does not match the expected layout";
+    case DATETIME_ERROR_RANGE:
+        return "a field or the result is out of range";
+    default:
+        return "unknown error";
+    }
+}
+
+/**
+ * @brief Get the error code of the last xxx_checked() or datetime_parse_iso8601() call on the calling thread.
+ * @return Returns the error code, or DATETIME_OK if the last call has succeeded.
+ */
+DateTimeError datetime_last_error(void) {
+    return __last_error;
+}
+
+/**
+ * @brief Reset the last error code of the calling thread to DATETIME_OK.
+ */
+void datetime_clear_error(void) {
+    __last_error = DATETIME_OK;
+}
+
 /**
  * @brief Determine whether the year is a leap year.
  * @param year The year.
  * @return Returns true if the year is a leap year, otherwise returns false.
  */
 bool is_leap_year(int year) {
+    if (year >= MIN_YEAR && year <= MAX_YEAR) {
+        return YEAR_IS_LEAP(year);
+    }
     return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
 }
 
@@ -88,6 +194,21 @@ const char *month_name(Month month) {
     }
 }
 
+/**
+ * @brief Get the full name of the month, reporting errors to the caller.
+ * @param month The month.
+ * @param out The full name of the month (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see month_name()
+ */
+DateTimeError month_name_checked(Month month, const char **out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(month >= JAN && month <= DEC, DATETIME_ERROR_RANGE);
+
+    *out = month_name(month);
+    return __set_error(DATETIME_OK);
+}
+
 /**
  * @brief Get the full name of the weekday.
  * @param weekday The weekday.
@@ -115,6 +236,21 @@ const char *weekday_full_name(Weekday weekday) {
     }
 }
 
+/**
+ * @brief Get the full name of the weekday, reporting errors to the caller.
+ * @param weekday The weekday.
+ * @param out The full name of the weekday (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see weekday_full_name()
+ */
+DateTimeError weekday_full_name_checked(Weekday weekday, const char **out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(weekday >= SUN && weekday <= SAT, DATETIME_ERROR_RANGE);
+
+    *out = weekday_full_name(weekday);
+    return __set_error(DATETIME_OK);
+}
+
 /**
  * @brief Get the abbreviated name of the weekday.
  * @param weekday The weekday.
@@ -142,6 +278,21 @@ const char *weekday_abbr_name(Weekday weekday) {
     }
 }
 
+/**
+ * @brief Get the abbreviated name of the weekday, reporting errors to the caller.
+ * @param weekday The weekday.
+ * @param out The abbreviated name of the weekday (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see weekday_abbr_name()
+ */
+DateTimeError weekday_abbr_name_checked(Weekday weekday, const char **out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(weekday >= SUN && weekday <= SAT, DATETIME_ERROR_RANGE);
+
+    *out = weekday_abbr_name(weekday);
+    return __set_error(DATETIME_OK);
+}
+
 /**
  * @brief Get the number of days in the month.
  * @param year The year.
@@ -171,6 +322,22 @@ int days_in_month(int year, int month) {
     }
 }
 
+/**
+ * @brief Get the number of days in the month, reporting errors to the caller.
+ * @param year The year.
+ * @param month The month.
+ * @param out The number of days in the month (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see days_in_month()
+ */
+DateTimeError days_in_month_checked(int year, int month, int *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(month >= JAN && month <= DEC, DATETIME_ERROR_RANGE);
+
+    *out = days_in_month(year, month);
+    return __set_error(DATETIME_OK);
+}
+
 /**
  * @brief Get the number of days in the year.
  * @param year The year.
@@ -205,1007 +372,3976 @@ static bool __is_valid_date(Date date) {
 }
 
 /**
- * @brief Determine the given date is the n-th day of the year.
- * @param year The year.
- * @param month The month.
- * @param day The day.
- * @return Returns the n-th day of the year.
+ * @brief Determine whether the fields form a valid date, without reporting errors.
+ * @return Returns true if the date is valid, otherwise returns false.
  */
-int nth_day_of_year(int year, int month, int day) {
-    Date date;
-    int i = 0;
-    int days = 0;
-
-    date.year = year;
-    date.month = month;
-    date.day = day;
-    exit_if_fail(__is_valid_date(date));
+static bool __is_valid_date_fields(int year, int month, int day) {
+    static const int DAYS_IN_MONTH[MONTHS_PER_YEAR + 1] = {0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    int month_index = (month >= JAN && month <= DEC) ? month : 0;
+    int month_days = DAYS_IN_MONTH[month_index] + (month_index == FEB && is_leap_year(year));
 
-    for (i = 1; i < month; i++) {
-        days += days_in_month(year, i);
-    }
-    return days + day;
+    return (year >= MIN_YEAR) & (year <= MAX_YEAR) & (day >= 1) & (day <= month_days);
 }
 
 /**
- * @brief Determine the day of the week.
- * @param year The year.
- * @param month The month.
- * @param day The day.
- * @return Returns the day of the week.
+ * @brief Determine whether the fields form a valid time, without reporting errors.
+ * @return Returns true if the time is valid, otherwise returns false.
  */
-Weekday weekday(int year, int month, int day) {
-    Date date;
-    int h;
-
-    date.year = year;
-    date.month = month;
-    date.day = day;
-    exit_if_fail(__is_valid_date(date));
-
-    if (month < 3) {
-        month += 12;
-        year--;
-    }
-    h = (day + (26 * (month + 1)) / 10 + year + year / 4 - year / 100 + year / 400) % DAYS_IN_WEEK;
-    h = (h + 6) % DAYS_IN_WEEK;
-    return (Weekday)h;
+static bool __is_valid_time_fields(int hour, int minute, int second, int millisecond) {
+    return (hour >= 0) & (hour < HOURS_PER_DAY) & (minute >= 0) & (minute < MINUTES_PER_HOUR) &
+           (second >= 0) & (second < SECONDS_PER_MINUTE) & (millisecond >= 0) & (millisecond < MILLISECONDS_PER_SECOND);
 }
 
 /**
- * @brief Get the string representation of the calendar for the given month.
- * @param year The year.
- * @param month The month.
- * @return Returns the string representation of the calendar for the given month.
- * @note The caller must free the returned string.
+ * @brief Determine whether the fields form a valid datetime, without reporting errors.
+ * @return Returns true if the datetime is valid, otherwise returns false.
  */
-char *calendar(int year, int month) {
-    char *calendar = NULL;
-    int days = 0;
-    Weekday first_day;
-    int k = 0;
-    int i = 0;
-    char buf[32];
+static bool __is_valid_datetime_fields(int year, int month, int day, int hour, int minute, int second, int millisecond) {
+    return __is_valid_date_fields(year, month, day) & __is_valid_time_fields(hour, minute, second, millisecond);
+}
 
-    calendar = (char *)malloc(sizeof(char) * 256);
-    return_value_if_fail(calendar != NULL, NULL);
+/**
+ * @brief Determine whether the Date object is valid, without reporting errors.
+ * @param date The Date object.
+ * @return Returns true if the date is valid, otherwise returns false.
+ */
+static bool __date_in_range(Date date) {
+    return __is_valid_date_fields(date.year, date.month, date.day);
+}
 
-    sprintf(calendar, "            %s %04d\n", month_name(month), year);
-    days = days_in_month(year, month);
-    first_day = weekday(year, month, 1);
-    strcat(calendar, " Sun  Mon  Tue  Wed  Thu  Fri  Sat\n");
+/**
+ * @brief Determine whether the Time object is valid, without reporting errors.
+ * @param time The Time object.
+ * @return Returns true if the time is valid, otherwise returns false.
+ */
+static bool __time_in_range(Time time) {
+    return __is_valid_time_fields(time.hour, time.minute, time.second, time.millisecond);
+}
 
-    for (k = 0; k < first_day; k++) {
-        strcat(calendar, "     ");
-    }
+/**
+ * @brief Determine whether the DateTime object is valid, without reporting errors.
+ * @param datetime The DateTime object.
+ * @return Returns true if the datetime is valid, otherwise returns false.
+ */
+static bool __datetime_in_range(DateTime datetime) {
+    return __date_in_range(datetime.date) && __time_in_range(datetime.time);
+}
 
-    for (i = 1; i <= days; i++) {
-        sprintf(buf, "%4d ", i);
-        strcat(calendar, buf);
-        k++;
-        if (k >= DAYS_IN_WEEK) {
-            k = 0;
-            strcat(calendar, "\n");
-        }
-    }
+/**
+ * @brief Convert the calendar time to the local time, reentrantly.
+ * @param t The calendar time.
+ * @param tm The local time (output).
+ */
+static void __localtime(const time_t *t, struct tm *tm) {
+#ifdef _WIN32
+    localtime_s(tm, t);
+#else
+    localtime_r(t, tm);
+#endif
+}
 
-    if (k != 0) {
-        strcat(calendar, "\n");
+/**
+ * @brief Convert the civil date to the day number (0001-01-01 is day 1).
+ * @param year The year.
+ * @param month The month.
+ * @param day The day.
+ * @return Returns the day number.
+ * @note The years 1 ~ 9999 are two table loads. Other years are shifted to start on March 1,
+ *       so the leap day is the last day of the shifted year and the 400-year era is handled in O(1).
+ */
+static int __days_from_civil(int year, int month, int day) {
+    int era;
+    int yoe;
+    int doy;
+    int doe;
+
+    if (year >= MIN_YEAR && year <= MAX_YEAR && month >= JAN && month <= DEC) {
+        return YEAR_DAYS_BEFORE(year) + DAYS_BEFORE_MONTH[YEAR_IS_LEAP(year)][month] + day;
     }
 
-    return calendar;
+    year -= month <= FEB;
+    era = (year >= 0 ? year : year - 399) / 400;
+    yoe = year - era * 400;
+    doy = (153 * (month > FEB ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * DAYS_PER_400_YEARS + doe - ORDINAL_SHIFT;
 }
 
 /**
- * @brief Determine whether the time interval is valid.
- * @param time_interval The TimeInterval object.
- * @return Returns true if the time interval is valid, otherwise returns false.
+ * @brief Convert the day number (0001-01-01 is day 1) to the civil date.
+ * @param days The day number.
+ * @param year The year (output).
+ * @param month The month (output).
+ * @param day The day (output).
+ * @note The days 1 ~ MAX_ORDINAL are looked up in the year table, others use the 400-year era arithmetic.
  */
-static bool __is_valid_time_interval(TimeInterval time_interval) {
-    if (time_interval.days < 0) {
-        fprintf(stderr, "Error: days must be greater than or equal to 0.\n");
-        return false;
+static void __civil_from_days(int days, int *year, int *month, int *day) {
+    int era;
+    int doe;
+    int yoe;
+    int doy;
+    int mp;
+    int leap;
+
+    if (days >= 1 && days <= MAX_ORDINAL) {
+        /* Both estimates are exact or one too small. */
+        *year = (days - 1) * 400 / DAYS_PER_400_YEARS + 1;
+        *year += days > YEAR_DAYS_BEFORE(*year + 1);
+        doy = days - YEAR_DAYS_BEFORE(*year);
+        leap = YEAR_IS_LEAP(*year);
+        *month = (doy - 1) / 32 + 1;
+        *month += doy > DAYS_BEFORE_MONTH[leap][*month + 1];
+        *day = doy - DAYS_BEFORE_MONTH[leap][*month];
+        return;
     }
 
-    if (time_interval.hours < 0 || time_interval.hours >= HOURS_PER_DAY) {
-        fprintf(stderr, "Error: hours must be 0 ~ 23.\n");
-        return false;
-    }
+    days += ORDINAL_SHIFT;
+    era = (days >= 0 ? days : days - (DAYS_PER_400_YEARS - 1)) / DAYS_PER_400_YEARS;
+    doe = days - era * DAYS_PER_400_YEARS;
+    yoe = (doe - doe / 1460 + doe / 36524 - doe / (DAYS_PER_400_YEARS - 1)) / DAYS_IN_COMMON_YEAR;
+    doy = doe - (DAYS_IN_COMMON_YEAR * yoe + yoe / 4 - yoe / 100);
+    mp = (5 * doy + 2) / 153;
 
-    if (time_interval.minutes < 0 || time_interval.minutes >= MINUTES_PER_HOUR) {
-        fprintf(stderr, "Error: minutes must be 0 ~ 59.\n");
-        return false;
-    }
+    *day = doy - (153 * mp + 2) / 5 + 1;
+    *month = mp < 10 ? mp + 3 : mp - 9;
+    *year = yoe + era * 400 + (*month <= FEB);
+}
 
-    if (time_interval.seconds < 0 || time_interval.seconds >= SECONDS_PER_MINUTE) {
-        fprintf(stderr, "Error: seconds must be 0 ~ 59.\n");
-        return false;
+/**
+ * @brief Add days to the day number without overflowing.
+ * @param days The day number.
+ * @param delta The number of days to add/subtract.
+ * @return Returns the new day number. If it is out of range, returns 0 or MAX_ORDINAL + 1.
+ */
+static int __add_days(int days, int delta) {
+    if (delta < 1 - days) {
+        return 0;
     }
-
-    if (time_interval.milliseconds < 0 || time_interval.milliseconds >= MILLISECONDS_PER_SECOND) {
-        fprintf(stderr, "Error: milliseconds must be 0 ~ 999.\n");
-        return false;
+    if (delta > MAX_ORDINAL - days) {
+        return MAX_ORDINAL + 1;
     }
-
-    return true;
+    return days + delta;
 }
 
 /**
- * @brief Normalize the time interval.
- * @param time_interval The TimeInterval object.
+ * @brief Determine the day of the week from the day number (0001-01-01 is day 1, a Monday).
+ * @param days The day number, at least 1.
+ * @return Returns the day of the week.
  */
-static void __time_interval_normalize(TimeInterval *time_interval) {
-    return_if_fail(time_interval != NULL);
-
-    if (time_interval->milliseconds >= MILLISECONDS_PER_SECOND) {
-        time_interval->seconds += time_interval->milliseconds / MILLISECONDS_PER_SECOND;
-        time_interval->milliseconds %= MILLISECONDS_PER_SECOND;
-    }
+static Weekday __weekday_from_days(int days) {
+    return (Weekday)(days % DAYS_IN_WEEK);
+}
 
-    if (time_interval->seconds >= SECONDS_PER_MINUTE) {
-        time_interval->minutes += time_interval->seconds / SECONDS_PER_MINUTE;
-        time_interval->seconds %= SECONDS_PER_MINUTE;
-    }
+/**
+ * @brief Create a Date object from the day number (0001-01-01 is day 1).
+ * @param days The day number.
+ * @return Returns the Date object.
+ */
+static Date __date_from_days(int days) {
+    Date date;
 
-    if (time_interval->minutes >= MINUTES_PER_HOUR) {
-        time_interval->hours += time_interval->minutes / MINUTES_PER_HOUR;
-        time_interval->minutes %= MINUTES_PER_HOUR;
+    if (days < 1 || days > MAX_ORDINAL) {
+        fprintf(stderr, "Error: date must be %04d-01-01 ~ %04d-12-31.\n", MIN_YEAR, MAX_YEAR);
+        exit(EXIT_FAILURE);
     }
 
-    if (time_interval->hours >= HOURS_PER_DAY) {
-        time_interval->days += time_interval->hours / HOURS_PER_DAY;
-        time_interval->hours %= HOURS_PER_DAY;
-    }
+    __civil_from_days(days, &date.year, &date.month, &date.day);
+    return date;
 }
 
 /**
- * @brief Create a TimeInterval object.
- * @param days The days.
- * @param hours The hours.
- * @param minutes The minutes.
- * @param seconds The seconds.
- * @param milliseconds The milliseconds.
- * @return Returns the TimeInterval object.
+ * @brief Determine the given date is the n-th day of the year.
+ * @param year The year.
+ * @param month The month.
+ * @param day The day.
+ * @return Returns the n-th day of the year.
  */
-TimeInterval time_interval_create(int days, int hours, int minutes, int seconds, int milliseconds) {
-    TimeInterval time_interval;
-    time_interval.days = days;
-    time_interval.hours = hours;
-    time_interval.minutes = minutes;
-    time_interval.seconds = seconds;
-    time_interval.milliseconds = milliseconds;
-    __time_interval_normalize(&time_interval);
-    exit_if_fail(__is_valid_time_interval(time_interval));
-    return time_interval;
+int nth_day_of_year(int year, int month, int day) {
+    Date date;
+    date.year = year;
+    date.month = month;
+    date.day = day;
+    exit_if_fail(__is_valid_date(date));
+    return nth_day_of_year_unchecked(year, month, day);
 }
 
 /**
- * @brief Get the string representation of the time interval.
- * @param time_interval The TimeInterval object.
- * @return Returns the string representation of the time interval.
- * @note The caller must free the returned string.
+ * @brief Determine the given date is the n-th day of the year, reporting errors to the caller.
+ * @param year The year.
+ * @param month The month.
+ * @param day The day.
+ * @param out The n-th day of the year (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see nth_day_of_year()
  */
-char *time_interval_to_string(TimeInterval time_interval) {
-    char *time_interval_string = NULL;
-    return_value_if_fail(__is_valid_time_interval(time_interval), NULL);
+DateTimeError nth_day_of_year_checked(int year, int month, int day, int *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(__is_valid_date_fields(year, month, day), DATETIME_ERROR_RANGE);
 
-    time_interval_string = (char *)malloc(sizeof(char) * 128);
-    return_value_if_fail(time_interval_string != NULL, NULL);
+    *out = nth_day_of_year_unchecked(year, month, day);
+    return __set_error(DATETIME_OK);
+}
 
-    sprintf(time_interval_string, "%d day(s) %d hour(s) %d minute(s) %d second(s) %d millisecond(s)", time_interval.days, time_interval.hours, time_interval.minutes, time_interval.seconds, time_interval.milliseconds);
-    return time_interval_string;
+/**
+ * @brief Determine the given date is the n-th day of the year, without validating the arguments.
+ * @param year The year.
+ * @param month The month.
+ * @param day The day.
+ * @return Returns the n-th day of the year.
+ * @note The date must be valid.
+ * @see nth_day_of_year()
+ */
+int nth_day_of_year_unchecked(int year, int month, int day) {
+    return DAYS_BEFORE_MONTH[YEAR_IS_LEAP(year)][month] + day;
 }
 
 /**
- * @brief Create a Date object.
+ * @brief Determine the day of the week.
  * @param year The year.
  * @param month The month.
  * @param day The day.
- * @return Returns the Date object.
+ * @return Returns the day of the week.
  */
-Date date_create(int year, int month, int day) {
+Weekday weekday(int year, int month, int day) {
     Date date;
     date.year = year;
     date.month = month;
     date.day = day;
     exit_if_fail(__is_valid_date(date));
-    return date;
+    return weekday_unchecked(year, month, day);
 }
 
 /**
- * @brief Get the current date.
- * @return Returns the Date object.
+ * @brief Determine the day of the week, reporting errors to the caller.
+ * @param year The year.
+ * @param month The month.
+ * @param day The day.
+ * @param out The day of the week (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see weekday()
  */
-Date date_now() {
-    time_t t = time(NULL);
-    struct tm *tm = localtime(&t);
-    return date_create(tm->tm_year + 1900, tm->tm_mon + 1, tm->tm_mday);
+DateTimeError weekday_checked(int year, int month, int day, Weekday *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(__is_valid_date_fields(year, month, day), DATETIME_ERROR_RANGE);
+
+    *out = weekday_unchecked(year, month, day);
+    return __set_error(DATETIME_OK);
 }
 
 /**
- * @brief Compare two Date objects.
- * @param date1 The first Date object.
+ * @brief Determine the day of the week, without validating the arguments.
+ * @param year The year.
+ * @param month The month.
+ * @param day The day.
+ * @return Returns the day of the week.
+ * @note The date must be valid.
+ * @see weekday()
+ */
+Weekday weekday_unchecked(int year, int month, int day) {
+    return (Weekday)((YEAR_WEEKDAY(year) + DAYS_BEFORE_MONTH[YEAR_IS_LEAP(year)][month] + day - 1) % DAYS_IN_WEEK);
+}
+
+/**
+ * @brief Determine the day of the week from the ordinal (since 0001-01-01).
+ * @param ordinal The ordinal (1 ~ 3652059).
+ * @return Returns the day of the week.
+ */
+Weekday weekday_from_ordinal(int ordinal) {
+    if (ordinal < 1 || ordinal > MAX_ORDINAL) {
+        fprintf(stderr, "Error: ordinal must be 1 ~ %d.\n", MAX_ORDINAL);
+        exit(EXIT_FAILURE);
+    }
+    return __weekday_from_days(ordinal);
+}
+
+/**
+ * @brief Determine the day of the week from the ordinal, reporting errors to the caller.
+ * @param ordinal The ordinal (1 ~ 3652059).
+ * @param out The day of the week (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see weekday_from_ordinal()
+ */
+DateTimeError weekday_from_ordinal_checked(int ordinal, Weekday *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(ordinal >= 1 && ordinal <= MAX_ORDINAL, DATETIME_ERROR_RANGE);
+
+    *out = __weekday_from_days(ordinal);
+    return __set_error(DATETIME_OK);
+}
+
+/**
+ * @brief Determine the day of the week from the ordinal, without validating the arguments.
+ * @param ordinal The ordinal (1 ~ 3652059).
+ * @return Returns the day of the week.
+ * @note The ordinal must be in range. It is a single mod 7, since 0001-01-01 is a Monday.
+ * @see weekday_from_ordinal()
+ */
+Weekday weekday_from_ordinal_unchecked(int ordinal) {
+    return __weekday_from_days(ordinal);
+}
+
+/**
+ * @brief Get the ISO 8601 day of the week from the day number (0001-01-01 is day 1).
+ * @param days The day number.
+ * @return Returns the day of the week (1 ~ 7, Monday is 1).
+ */
+static int __iso_weekday_from_days(int days) {
+    return (days + 6) % DAYS_IN_WEEK + 1;
+}
+
+/**
+ * @brief Get the number of ISO 8601 weeks in the year 1 ~ 9999.
+ * @param year The year.
+ * @return Returns 52 or 53.
+ */
+static int __iso_weeks_in_year(int year) {
+    return 52 + (YEAR_WEEKDAY(year) == THU || (YEAR_WEEKDAY(year) == WED && YEAR_IS_LEAP(year)));
+}
+
+/**
+ * @brief Get the ISO 8601 week date of the valid date.
+ * @param year The year.
+ * @param day_of_year The day of the year (1 ~ 366).
+ * @param iso_weekday The day of the week (1 ~ 7, Monday is 1).
+ * @return Returns the IsoWeek object.
+ * @note The week holding the day is numbered by its Thursday, which is at most 3 days away,
+ *       so the week-numbering year is the year before, the year or the year after.
+ */
+static IsoWeek __iso_week(int year, int day_of_year, int iso_weekday) {
+    IsoWeek iso;
+
+    iso.year = year;
+    iso.week = (day_of_year - iso_weekday + 10) / DAYS_IN_WEEK;
+    iso.weekday = iso_weekday;
+    if (iso.week < 1) {
+        iso.year--;
+        iso.week = __iso_weeks_in_year(iso.year);
+    } else if (iso.week > 52 && iso.week > __iso_weeks_in_year(year)) {
+        iso.year++;
+        iso.week = 1;
+    }
+    return iso;
+}
+
+/**
+ * @brief Convert the ISO 8601 week date to the day number (0001-01-01 is day 1).
+ * @param year The week-numbering year (1 ~ 9999).
+ * @param week The week.
+ * @param weekday The day of the week (1 ~ 7, Monday is 1).
+ * @return Returns the day number, which may be out of range at the ends of the calendar.
+ * @note Week 1 is the week holding January 4.
+ */
+static int __days_from_iso_week(int year, int week, int weekday) {
+    int january_4 = YEAR_DAYS_BEFORE(year) + 4;
+
+    return january_4 - __iso_weekday_from_days(january_4) + (week - 1) * DAYS_IN_WEEK + weekday;
+}
+
+/**
+ * @brief Determine whether the ISO 8601 week date is valid, without reporting errors.
+ * @return Returns true if the week date is valid and falls in 0001-01-01 ~ 9999-12-31, otherwise returns false.
+ */
+static bool __is_valid_iso_week_fields(int year, int week, int weekday) {
+    int days;
+
+    return_value_if_fail(year >= MIN_YEAR && year <= MAX_YEAR, false);
+    return_value_if_fail(week >= 1 && week <= __iso_weeks_in_year(year), false);
+    return_value_if_fail(weekday >= 1 && weekday <= DAYS_IN_WEEK, false);
+
+    days = __days_from_iso_week(year, week, weekday);
+    return days >= 1 && days <= MAX_ORDINAL;
+}
+
+/**
+ * @brief Get the number of ISO 8601 weeks in the week-numbering year.
+ * @param year The year.
+ * @return Returns 53 if the year starts on a Thursday, or is a leap year starting on a Wednesday, otherwise returns 52.
+ */
+int iso_weeks_in_year(int year) {
+    int january_1;
+
+    if (year >= MIN_YEAR && year <= MAX_YEAR) {
+        return __iso_weeks_in_year(year);
+    }
+
+    /* The day numbers of the years before 0001 are negative. */
+    january_1 = (__days_from_civil(year, JAN, 1) % DAYS_IN_WEEK + DAYS_IN_WEEK) % DAYS_IN_WEEK;
+    return 52 + (january_1 == THU || (january_1 == WED && is_leap_year(year)));
+}
+
+/**
+ * @brief Get the ISO 8601 week date of the date.
+ * @param date The Date object.
+ * @return Returns the IsoWeek object.
+ */
+IsoWeek iso_week(Date date) {
+    exit_if_fail(__is_valid_date(date));
+    return iso_week_unchecked(date);
+}
+
+/**
+ * @brief Get the ISO 8601 week date of the date, reporting errors to the caller.
+ * @param date The Date object.
+ * @param out The IsoWeek object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see iso_week()
+ */
+DateTimeError iso_week_checked(Date date, IsoWeek *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(__date_in_range(date), DATETIME_ERROR_RANGE);
+
+    *out = iso_week_unchecked(date);
+    return __set_error(DATETIME_OK);
+}
+
+/**
+ * @brief Get the ISO 8601 week date of the date, without validating the arguments.
+ * @param date The Date object.
+ * @return Returns the IsoWeek object.
+ * @note The date must be valid.
+ * @see iso_week()
+ */
+IsoWeek iso_week_unchecked(Date date) {
+    int day_of_year = DAYS_BEFORE_MONTH[YEAR_IS_LEAP(date.year)][date.month] + date.day;
+
+    return __iso_week(date.year, day_of_year, __iso_weekday_from_days(YEAR_DAYS_BEFORE(date.year) + day_of_year));
+}
+
+/**
+ * @brief Create a Date object from the ISO 8601 week date.
+ * @param year The week-numbering year.
+ * @param week The week (1 ~ iso_weeks_in_year(year)).
+ * @param weekday The day of the week (1 ~ 7, Monday is 1).
+ * @return Returns the Date object.
+ */
+Date date_from_iso_week(int year, int week, int weekday) {
+    if (year < MIN_YEAR || year > MAX_YEAR) {
+        fprintf(stderr, "Error: year must be %d ~ %d.\n", MIN_YEAR, MAX_YEAR);
+        exit(EXIT_FAILURE);
+    }
+    if (week < 1 || week > __iso_weeks_in_year(year)) {
+        fprintf(stderr, "Error: only %d weeks in %d.\n", __iso_weeks_in_year(year), year);
+        exit(EXIT_FAILURE);
+    }
+    if (weekday < 1 || weekday > DAYS_IN_WEEK) {
+        fprintf(stderr, "Error: weekday must be 1 ~ %d.\n", DAYS_IN_WEEK);
+        exit(EXIT_FAILURE);
+    }
+    return __date_from_days(__days_from_iso_week(year, week, weekday));
+}
+
+/**
+ * @brief Create a Date object from the ISO 8601 week date, reporting errors to the caller.
+ * @param year The week-numbering year.
+ * @param week The week (1 ~ iso_weeks_in_year(year)).
+ * @param weekday The day of the week (1 ~ 7, Monday is 1).
+ * @param out The Date object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see date_from_iso_week()
+ */
+DateTimeError date_from_iso_week_checked(int year, int week, int weekday, Date *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(__is_valid_iso_week_fields(year, week, weekday), DATETIME_ERROR_RANGE);
+
+    *out = date_from_iso_week_unchecked(year, week, weekday);
+    return __set_error(DATETIME_OK);
+}
+
+/**
+ * @brief Create a Date object from the ISO 8601 week date, without validating the arguments.
+ * @param year The week-numbering year.
+ * @param week The week (1 ~ iso_weeks_in_year(year)).
+ * @param weekday The day of the week (1 ~ 7, Monday is 1).
+ * @return Returns the Date object.
+ * @note The week date must be valid and fall in 0001-01-01 ~ 9999-12-31.
+ * @see date_from_iso_week()
+ */
+Date date_from_iso_week_unchecked(int year, int week, int weekday) {
+    Date date;
+
+    __civil_from_days(__days_from_iso_week(year, week, weekday), &date.year, &date.month, &date.day);
+    return date;
+}
+
+/* "00" ~ "99", so a value below 100 is written with one 2-byte copy. */
+static const char DIGIT_PAIRS[201] = "00010203040506070809"
+                                     "10111213141516171819"
+                                     "20212223242526272829"
+                                     "30313233343536373839"
+                                     "40414243444546474849"
+                                     "50515253545556575859"
+                                     "60616263646566676869"
+                                     "70717273747576777879"
+                                     "80818283848586878889"
+                                     "90919293949596979899";
+
+/**
+ * @brief Write the value as 2 digits.
+ * @param str The output.
+ * @param value The value (0 ~ 99).
+ */
+static void __write_pair(char *str, int value) {
+    memcpy(str, DIGIT_PAIRS + 2 * value, 2);
+}
+
+/**
+ * @brief Write the year without padding, like strftime() %Y.
+ * @param str The output.
+ * @param year The year (1 ~ 9999).
+ * @return Returns the number of characters written.
+ */
+static size_t __write_year(char *str, int year) {
+    char digits[4];
+    size_t length = year >= 1000 ? 4 : year >= 100 ? 3 : year >= 10 ? 2 : 1;
+
+    __write_pair(digits, year / 100);
+    __write_pair(digits + 2, year % 100);
+    memcpy(str, digits + 4 - length, length);
+    return length;
+}
+
+/**
+ * @brief Write the valid date as yyyy-mm-dd.
+ * @param str The output of DATE_STRING_LENGTH characters.
+ * @param date The Date object.
+ */
+static void __write_date(char *str, Date date) {
+    __write_pair(str, date.year / 100);
+    __write_pair(str + 2, date.year % 100);
+    str[4] = '-';
+    __write_pair(str + 5, date.month);
+    str[7] = '-';
+    __write_pair(str + 8, date.day);
+}
+
+/**
+ * @brief Write the valid time as hh:mm:ss, or hh:mm:ss.fff with the milliseconds.
+ * @param str The output of TIME_ASCII_STRING_LENGTH or TIME_STRING_LENGTH characters.
+ * @param time The Time object.
+ * @param milliseconds Whether to write the milliseconds.
+ */
+static void __write_time(char *str, Time time, bool milliseconds) {
+    __write_pair(str, time.hour);
+    str[2] = ':';
+    __write_pair(str + 3, time.minute);
+    str[5] = ':';
+    __write_pair(str + 6, time.second);
+    if (milliseconds) {
+        str[8] = '.';
+        str[9] = (char)('0' + time.millisecond / 100);
+        __write_pair(str + 10, time.millisecond % 100);
+    }
+}
+
+#ifdef DATETIME_SSSE3
+/**
+ * @brief Determine whether the CPU supports SSSE3. The result is cached after the first call.
+ * @return Returns true if the CPU supports SSSE3, otherwise returns false.
+ */
+static bool __cpu_has_ssse3(void) {
+    static int has_ssse3 = -1;
+
+    if (has_ssse3 < 0) {
+        __builtin_cpu_init();
+        has_ssse3 = __builtin_cpu_supports("ssse3") ? 1 : 0;
+    }
+    return has_ssse3;
+}
+
+/**
+ * @brief Write the valid datetime as yyyy-mm-dd hh:mm:ss.fff with two vector stores.
+ * @param str The output of DATETIME_STRING_LENGTH + 1 characters, NUL-terminated.
+ * @param datetime The DateTime object, passed by address to keep the fields in memory for the vector loads.
+ */
+TARGET_SSSE3 static void __mm_write_datetime(char *str, const DateTime *datetime) {
+    /* Split 8 values below 100 into tens (x * 103 >> 10) and ones, then put the ones digit after the tens digit. */
+    __m128i values = _mm_setr_epi16((short)(datetime->date.year / 100), (short)(datetime->date.year % 100), (short)datetime->date.month,
+                                    (short)datetime->date.day, (short)datetime->time.hour, (short)datetime->time.minute,
+                                    (short)datetime->time.second, (short)(datetime->time.millisecond / 10));
+    __m128i tens = _mm_srli_epi16(_mm_mullo_epi16(values, _mm_set1_epi16(103)), 10);
+    __m128i ones = _mm_sub_epi16(values, _mm_mullo_epi16(tens, _mm_set1_epi16(10)));
+    __m128i digits = _mm_add_epi8(_mm_or_si128(tens, _mm_slli_epi16(ones, 8)), _mm_set1_epi8('0'));
+    __m128i low;
+    __m128i high;
+
+    low = _mm_or_si128(_mm_shuffle_epi8(digits, _mm_setr_epi8(0, 1, 2, 3, -1, 4, 5, -1, 6, 7, -1, 8, 9, -1, 10, 11)),
+                       _mm_setr_epi8(0, 0, 0, 0, '-', 0, 0, '-', 0, 0, ' ', 0, 0, ':', 0, 0));
+    high = _mm_or_si128(_mm_shuffle_epi8(digits, _mm_setr_epi8(-1, 12, 13, -1, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+                        _mm_setr_epi8(':', 0, 0, '.', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0));
+    high = _mm_insert_epi16(high, '0' + datetime->time.millisecond % 10, 3);
+
+    _mm_storeu_si128((__m128i *)str, low);
+    _mm_storel_epi64((__m128i *)(str + 16), high);
+}
+#endif
+
+/**
+ * @brief Write the valid datetime as yyyy-mm-dd hh:mm:ss.fff.
+ * @param str The output of DATETIME_STRING_LENGTH + 1 characters, NUL-terminated.
+ * @param datetime The DateTime object.
+ */
+static void __write_datetime(char *str, const DateTime *datetime) {
+#ifdef DATETIME_SSSE3
+    if (__cpu_has_ssse3()) {
+        __mm_write_datetime(str, datetime);
+        return;
+    }
+#endif
+    __write_date(str, datetime->date);
+    str[DATE_STRING_LENGTH] = ' ';
+    __write_time(str + DATE_STRING_LENGTH + 1, datetime->time, true);
+    str[DATETIME_STRING_LENGTH] = '\0';
+}
+
+/**
+ * @brief Write the valid date as Day Mon dd.
+ * @param str The output of 10 characters.
+ * @param date The Date object.
+ */
+static void __write_ascii_date(char *str, Date date) {
+    memcpy(str, weekday_abbr_name(__weekday_from_days(__days_from_civil(date.year, date.month, date.day))), 3);
+    str[3] = ' ';
+    memcpy(str + 4, month_name((Month)date.month), 3);
+    str[7] = ' ';
+    __write_pair(str + 8, date.day);
+}
+
+/**
+ * @brief Copy the string into the caller's buffer like snprintf().
+ * @param str The string, not NUL-terminated.
+ * @param length The length of the string.
+ * @param buffer The buffer (output), can be NULL if size is 0.
+ * @param size The size of the buffer. At most size - 1 characters are written, followed by a NUL terminator.
+ * @return Returns length.
+ */
+static size_t __copy_to_buffer(const char *str, size_t length, char *buffer, size_t size) {
+    size_t copied;
+
+    if (size > 0) {
+        copied = length < size ? length : size - 1;
+        memcpy(buffer, str, copied);
+        buffer[copied] = '\0';
+    }
+    return length;
+}
+
+/**
+ * @brief Copy the string into a new string.
+ * @param str The string, not NUL-terminated.
+ * @param length The length of the string.
+ * @return Returns the new NUL-terminated string, or NULL if the allocation fails.
+ */
+static char *__string_dup(const char *str, size_t length) {
+    char *copy = (char *)malloc(sizeof(char) * (length + 1));
+    return_value_if_fail(copy != NULL, NULL);
+
+    memcpy(copy, str, length);
+    copy[length] = '\0';
+    return copy;
+}
+
+/**
+ * @brief Get the string representation of the calendar for the given month.
+ * @param year The year.
+ * @param month The month.
+ * @return Returns the string representation of the calendar for the given month, or NULL if the year or the
+ *         month is invalid.
+ * @note The caller must free the returned string.
+ */
+char *calendar(int year, int month) {
+    char calendar[CALENDAR_STRING_LENGTH + 1];
+    size_t length;
+
+    return_value_if_fail(calendar_buffer_checked(year, month, calendar, sizeof(calendar), &length) == DATETIME_OK, NULL);
+    return __string_dup(calendar, length);
+}
+
+/**
+ * @brief Write the string representation of the calendar for the given month into the buffer.
+ * @param year The year.
+ * @param month The month.
+ * @param buffer The buffer (output), can be NULL if size is 0.
+ * @param size The size of the buffer. At most size - 1 characters are written, followed by a NUL terminator.
+ * @return Returns the length of the full string, excluding the NUL terminator, like snprintf().
+ *         The output is truncated if the return value is >= size. Returns 0 if the year or the month is invalid.
+ */
+size_t calendar_buffer(int year, int month, char *buffer, size_t size) {
+    size_t length;
+
+    if (size > 0) {
+        buffer[0] = '\0';
+    }
+    return_value_if_fail(calendar_buffer_checked(year, month, buffer, size, &length) == DATETIME_OK, 0);
+    return length;
+}
+
+/**
+ * @brief Write the string representation of the calendar for the given month into the buffer, reporting errors to
+ *        the caller.
+ * @param year The year.
+ * @param month The month.
+ * @param buffer The buffer (output), can be NULL if size is 0. Unchanged on error.
+ * @param size The size of the buffer. At most size - 1 characters are written, followed by a NUL terminator.
+ * @param out The length of the full string, excluding the NUL terminator, like snprintf() (output).
+ *            Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see calendar_buffer()
+ */
+DateTimeError calendar_buffer_checked(int year, int month, char *buffer, size_t size, size_t *out) {
+    static const char WEEKDAYS[] = " Sun  Mon  Tue  Wed  Thu  Fri  Sat\n";
+    char calendar[CALENDAR_STRING_LENGTH];
+    const char *name;
+    size_t length;
+    int days = 0;
+    Weekday first_day;
+    int k = 0;
+    int i = 0;
+
+    return_error_if_fail(out != NULL && (buffer != NULL || size == 0), DATETIME_ERROR_ARGUMENT);
+    return_value_if_fail(month_name_checked((Month)month, &name) == DATETIME_OK, DATETIME_ERROR_RANGE);
+    return_value_if_fail(days_in_month_checked(year, month, &days) == DATETIME_OK, DATETIME_ERROR_RANGE);
+    return_value_if_fail(weekday_checked(year, month, 1, &first_day) == DATETIME_OK, DATETIME_ERROR_RANGE);
+
+    length = (size_t)sprintf(calendar, "            %s %04d\n", name, year);
+    memcpy(calendar + length, WEEKDAYS, sizeof(WEEKDAYS) - 1);
+    length += sizeof(WEEKDAYS) - 1;
+
+    for (k = 0; k < first_day; k++) {
+        memcpy(calendar + length, "     ", 5);
+        length += 5;
+    }
+
+    for (i = 1; i <= days; i++) {
+        calendar[length] = ' ';
+        calendar[length + 1] = ' ';
+        __write_pair(calendar + length + 2, i);
+        if (i < 10) {
+            calendar[length + 2] = ' ';
+        }
+        calendar[length + 4] = ' ';
+        length += 5;
+        k++;
+        if (k >= DAYS_IN_WEEK) {
+            k = 0;
+            calendar[length++] = '\n';
+        }
+    }
+
+    if (k != 0) {
+        calendar[length++] = '\n';
+    }
+
+    *out = __copy_to_buffer(calendar, length, buffer, size);
+    return __set_error(DATETIME_OK);
+}
+
+/**
+ * @brief Determine whether the time interval is valid.
+ * @param time_interval The TimeInterval object.
+ * @return Returns true if the time interval is valid, otherwise returns false.
+ */
+static bool __is_valid_time_interval(TimeInterval time_interval) {
+    if (time_interval.days < 0) {
+        fprintf(stderr, "Error: days must be greater than or equal to 0.\n");
+        return false;
+    }
+
+    if (time_interval.hours < 0 || time_interval.hours >= HOURS_PER_DAY) {
+        fprintf(stderr, "Error: hours must be 0 ~ 23.\n");
+        return false;
+    }
+
+    if (time_interval.minutes < 0 || time_interval.minutes >= MINUTES_PER_HOUR) {
+        fprintf(stderr, "Error: minutes must be 0 ~ 59.\n");
+        return false;
+    }
+
+    if (time_interval.seconds < 0 || time_interval.seconds >= SECONDS_PER_MINUTE) {
+        fprintf(stderr, "Error: seconds must be 0 ~ 59.\n");
+        return false;
+    }
+
+    if (time_interval.milliseconds < 0 || time_interval.milliseconds >= MILLISECONDS_PER_SECOND) {
+        fprintf(stderr, "Error: milliseconds must be 0 ~ 999.\n");
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Normalize the time interval.
+ * @param time_interval The TimeInterval object.
+ */
+static void __time_interval_normalize(TimeInterval *time_interval) {
+    return_if_fail(time_interval != NULL);
+
+    if (time_interval->milliseconds >= MILLISECONDS_PER_SECOND) {
+        time_interval->seconds += time_interval->milliseconds / MILLISECONDS_PER_SECOND;
+        time_interval->milliseconds %= MILLISECONDS_PER_SECOND;
+    }
+
+    if (time_interval->seconds >= SECONDS_PER_MINUTE) {
+        time_interval->minutes += time_interval->seconds / SECONDS_PER_MINUTE;
+        time_interval->seconds %= SECONDS_PER_MINUTE;
+    }
+
+    if (time_interval->minutes >= MINUTES_PER_HOUR) {
+        time_interval->hours += time_interval->minutes / MINUTES_PER_HOUR;
+        time_interval->minutes %= MINUTES_PER_HOUR;
+    }
+
+    if (time_interval->hours >= HOURS_PER_DAY) {
+        time_interval->days += time_interval->hours / HOURS_PER_DAY;
+        time_interval->hours %= HOURS_PER_DAY;
+    }
+}
+
+/**
+ * @brief Create a TimeInterval object.
+ * @param days The days.
+ * @param hours The hours.
+ * @param minutes The minutes.
+ * @param seconds The seconds.
+ * @param milliseconds The milliseconds.
+ * @return Returns the TimeInterval object.
+ */
+TimeInterval time_interval_create(int days, int hours, int minutes, int seconds, int milliseconds) {
+    TimeInterval time_interval;
+    time_interval.days = days;
+    time_interval.hours = hours;
+    time_interval.minutes = minutes;
+    time_interval.seconds = seconds;
+    time_interval.milliseconds = milliseconds;
+    __time_interval_normalize(&time_interval);
+    exit_if_fail(__is_valid_time_interval(time_interval));
+    return time_interval;
+}
+
+/**
+ * @brief Create a TimeInterval object, reporting errors to the caller.
+ * @param days The days.
+ * @param hours The hours.
+ * @param minutes The minutes.
+ * @param seconds The seconds.
+ * @param milliseconds The milliseconds.
+ * @param out The TimeInterval object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see time_interval_create()
+ */
+DateTimeError time_interval_create_checked(int days, int hours, int minutes, int seconds, int milliseconds, TimeInterval *out) {
+    TimeInterval time_interval;
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+
+    time_interval.days = days;
+    time_interval.hours = hours;
+    time_interval.minutes = minutes;
+    time_interval.seconds = seconds;
+    time_interval.milliseconds = milliseconds;
+    __time_interval_normalize(&time_interval);
+    return_error_if_fail(time_interval.days >= 0 && time_interval.hours >= 0 && time_interval.minutes >= 0 &&
+                             time_interval.seconds >= 0 && time_interval.milliseconds >= 0,
+                         DATETIME_ERROR_RANGE);
+
+    *out = time_interval;
+    return __set_error(DATETIME_OK);
+}
+
+/**
+ * @brief Get the string representation of the time interval.
+ * @param time_interval The TimeInterval object.
+ * @return Returns the string representation of the time interval.
+ * @note The caller must free the returned string.
+ */
+char *time_interval_to_string(TimeInterval time_interval) {
+    char time_interval_string[128];
+    size_t length;
+    return_value_if_fail(__is_valid_time_interval(time_interval), NULL);
+
+    length = time_interval_to_string_buffer(time_interval, time_interval_string, sizeof(time_interval_string));
+    return __string_dup(time_interval_string, length);
+}
+
+/**
+ * @brief Write the string representation of the time interval into the buffer.
+ * @param time_interval The TimeInterval object.
+ * @param buffer The buffer (output), can be NULL if size is 0.
+ * @param size The size of the buffer. At most size - 1 characters are written, followed by a NUL terminator.
+ * @return Returns the length of the full string, excluding the NUL terminator, like snprintf().
+ *         The output is truncated if the return value is >= size. Returns 0 if the time interval is invalid.
+ */
+size_t time_interval_to_string_buffer(TimeInterval time_interval, char *buffer, size_t size) {
+    char time_interval_string[128];
+    size_t length;
+
+    if (size > 0) {
+        buffer[0] = '\0';
+    }
+    return_value_if_fail(__is_valid_time_interval(time_interval), 0);
+
+    length = (size_t)sprintf(time_interval_string, "%d day(s) %d hour(s) %d minute(s) %d second(s) %d millisecond(s)", time_interval.days, time_interval.hours, time_interval.minutes, time_interval.seconds, time_interval.milliseconds);
+    return __copy_to_buffer(time_interval_string, length, buffer, size);
+}
+
+/**
+ * @brief Create a Date object.
+ * @param year The year.
+ * @param month The month.
+ * @param day The day.
+ * @return Returns the Date object.
+ */
+Date date_create(int year, int month, int day) {
+    Date date;
+    date.year = year;
+    date.month = month;
+    date.day = day;
+    exit_if_fail(__is_valid_date(date));
+    return date;
+}
+
+/**
+ * @brief Create a Date object, reporting errors to the caller.
+ * @param year The year.
+ * @param month The month.
+ * @param day The day.
+ * @param out The Date object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see date_create()
+ */
+DateTimeError date_create_checked(int year, int month, int day, Date *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(__is_valid_date_fields(year, month, day), DATETIME_ERROR_RANGE);
+
+    out->year = year;
+    out->month = month;
+    out->day = day;
+    return __set_error(DATETIME_OK);
+}
+
+/**
+ * @brief Get the current date.
+ * @return Returns the Date object.
+ */
+Date date_now() {
+    time_t t = time(NULL);
+    struct tm tm;
+    __localtime(&t, &tm);
+    return date_create(tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday);
+}
+
+/**
+ * @brief Compare two Date objects.
+ * @param date1 The first Date object.
+ * @param date2 The second Date object.
+ * @return Returns 1 if date1 is greater than date2.
+ *         Returns -1 if date1 is less than date2.
+ *         Returns 0 if date1 is equal to date2.
+ */
+int date_compare(Date date1, Date date2) {
+    exit_if_fail(__is_valid_date(date1) && __is_valid_date(date2));
+    return date_compare_unchecked(date1, date2);
+}
+
+/**
+ * @brief Compare two Date objects, reporting errors to the caller.
+ * @param date1 The first Date object.
+ * @param date2 The second Date object.
+ * @param out The result as returned by date_compare() (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see date_compare()
+ */
+DateTimeError date_compare_checked(Date date1, Date date2, int *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(__date_in_range(date1) && __date_in_range(date2), DATETIME_ERROR_RANGE);
+
+    *out = date_compare_unchecked(date1, date2);
+    return __set_error(DATETIME_OK);
+}
+
+/**
+ * @brief Compare two Date objects, without validating the arguments.
+ * @param date1 The first Date object.
+ * @param date2 The second Date object.
+ * @return Returns 1 if date1 is greater than date2.
+ *         Returns -1 if date1 is less than date2.
+ *         Returns 0 if date1 is equal to date2.
+ * @note Both Date objects must be valid.
+ * @see date_compare()
+ */
+int date_compare_unchecked(Date date1, Date date2) {
+    int key1 = (date1.year << (PACKED_MONTH_BITS + PACKED_DAY_BITS)) | (date1.month << PACKED_DAY_BITS) | date1.day;
+    int key2 = (date2.year << (PACKED_MONTH_BITS + PACKED_DAY_BITS)) | (date2.month << PACKED_DAY_BITS) | date2.day;
+    return (key1 > key2) - (key1 < key2);
+}
+
+/**
+ * @brief Add days to the date.
+ * @param date The Date object.
+ * @param days The number of days to add/subtract.
+ * @return Returns the new Date object.
+ */
+Date date_add(Date date, int days) {
+    exit_if_fail(__is_valid_date(date));
+    return __date_from_days(__add_days(__days_from_civil(date.year, date.month, date.day), days));
+}
+
+/**
+ * @brief Add days to the date, reporting errors to the caller.
+ * @param date The Date object.
+ * @param days The number of days to add/subtract.
+ * @param out The new Date object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see date_add()
+ */
+DateTimeError date_add_checked(Date date, int days, Date *out) {
+    int day_number;
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(__date_in_range(date), DATETIME_ERROR_RANGE);
+
+    day_number = __add_days(__days_from_civil(date.year, date.month, date.day), days);
+    return_error_if_fail(day_number >= 1 && day_number <= MAX_ORDINAL, DATETIME_ERROR_RANGE);
+
+    __civil_from_days(day_number, &out->year, &out->month, &out->day);
+    return __set_error(DATETIME_OK);
+}
+
+/**
+ * @brief Add days to the date, without validating the arguments.
+ * @param date The Date object.
+ * @param days The number of days to add/subtract.
+ * @return Returns the new Date object.
+ * @note The Date object and the result must be valid.
+ * @see date_add()
+ */
+Date date_add_unchecked(Date date, int days) {
+    __civil_from_days(__days_from_civil(date.year, date.month, date.day) + days, &date.year, &date.month, &date.day);
+    return date;
+}
+
+/**
+ * @brief Get the the days between two Date objects.
+ * @param date1 The first Date object.
  * @param date2 The second Date object.
- * @return Returns 1 if date1 is greater than date2.
- *         Returns -1 if date1 is less than date2.
- *         Returns 0 if date1 is equal to date2.
+ * @return Returns the days between two Date objects.
+ */
+int date_diff(Date date1, Date date2) {
+    exit_if_fail(__is_valid_date(date1) && __is_valid_date(date2));
+    return date_diff_unchecked(date1, date2);
+}
+
+/**
+ * @brief Get the the days between two Date objects, reporting errors to the caller.
+ * @param date1 The first Date object.
+ * @param date2 The second Date object.
+ * @param out The days between two Date objects (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see date_diff()
+ */
+DateTimeError date_diff_checked(Date date1, Date date2, int *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(__date_in_range(date1) && __date_in_range(date2), DATETIME_ERROR_RANGE);
+
+    *out = date_diff_unchecked(date1, date2);
+    return __set_error(DATETIME_OK);
+}
+
+/**
+ * @brief Get the the days between two Date objects, without validating the arguments.
+ * @param date1 The first Date object.
+ * @param date2 The second Date object.
+ * @return Returns the days between two Date objects.
+ * @note Both Date objects must be valid.
+ * @see date_diff()
+ */
+int date_diff_unchecked(Date date1, Date date2) {
+    return __days_from_civil(date1.year, date1.month, date1.day) - __days_from_civil(date2.year, date2.month, date2.day);
+}
+
+/**
+ * @brief Get the string representation (yyyy-mm-dd) of the date.
+ * @param date The Date object.
+ * @return Returns the string representation of the date.
+ * @note The caller must free the returned string.
+ */
+char *date_to_string(Date date) {
+    char date_string[DATE_STRING_LENGTH];
+    return_value_if_fail(__is_valid_date(date), NULL);
+
+    __write_date(date_string, date);
+    return __string_dup(date_string, DATE_STRING_LENGTH);
+}
+
+/**
+ * @brief Write the string representation (yyyy-mm-dd) of the date into the buffer.
+ * @param date The Date object.
+ * @param buffer The buffer (output), can be NULL if size is 0.
+ * @param size The size of the buffer. At most size - 1 characters are written, followed by a NUL terminator.
+ * @return Returns the length of the full string, excluding the NUL terminator, like snprintf().
+ *         The output is truncated if the return value is >= size. Returns 0 if the date is invalid.
+ */
+size_t date_to_string_buffer(Date date, char *buffer, size_t size) {
+    char date_string[DATE_STRING_LENGTH];
+
+    if (size > 0) {
+        buffer[0] = '\0';
+    }
+    return_value_if_fail(__is_valid_date(date), 0);
+
+    __write_date(date_string, date);
+    return __copy_to_buffer(date_string, DATE_STRING_LENGTH, buffer, size);
+}
+
+/**
+ * @brief Get the string representation (Day Mon dd yyyy) of the date.
+ * @param date The Date object.
+ * @return Returns the string representation of the date.
+ * @note The caller must free the returned string.
+ */
+char *date_ascii_string(Date date) {
+    char date_string[DATE_ASCII_STRING_LENGTH + 1];
+    size_t length;
+    return_value_if_fail(__is_valid_date(date), NULL);
+
+    length = date_ascii_string_buffer(date, date_string, sizeof(date_string));
+    return __string_dup(date_string, length);
+}
+
+/**
+ * @brief Write the string representation (Day Mon dd yyyy) of the date into the buffer.
+ * @param date The Date object.
+ * @param buffer The buffer (output), can be NULL if size is 0.
+ * @param size The size of the buffer. At most size - 1 characters are written, followed by a NUL terminator.
+ * @return Returns the length of the full string, excluding the NUL terminator, like snprintf().
+ *         The output is truncated if the return value is >= size. Returns 0 if the date is invalid.
+ */
+size_t date_ascii_string_buffer(Date date, char *buffer, size_t size) {
+    char date_string[DATE_ASCII_STRING_LENGTH];
+    size_t length;
+
+    if (size > 0) {
+        buffer[0] = '\0';
+    }
+    return_value_if_fail(__is_valid_date(date), 0);
+
+    __write_ascii_date(date_string, date);
+    date_string[10] = ' ';
+    length = 11 + __write_year(date_string + 11, date.year);
+    return __copy_to_buffer(date_string, length, buffer, size);
+}
+
+/**
+ * @brief Determine whether the time is valid.
+ * @param time The Time object.
+ * @return Returns true if the time is valid, otherwise returns false.
+ */
+static bool __is_valid_time(Time time) {
+    if (time.hour < 0 || time.hour >= HOURS_PER_DAY) {
+        fprintf(stderr, "Error: hour must be 0 ~ 23.\n");
+        return false;
+    }
+
+    if (time.minute < 0 || time.minute >= MINUTES_PER_HOUR) {
+        fprintf(stderr, "Error: minute must be 0 ~ 59.\n");
+        return false;
+    }
+
+    if (time.second < 0 || time.second >= SECONDS_PER_MINUTE) {
+        fprintf(stderr, "Error: second must be 0 ~ 59.\n");
+        return false;
+    }
+
+    if (time.millisecond < 0 || time.millisecond >= MILLISECONDS_PER_SECOND) {
+        fprintf(stderr, "Error: millisecond must be 0 ~ 999.\n");
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Convert the Time object to the milliseconds since midnight.
+ * @param time The Time object.
+ * @return Returns the milliseconds since midnight.
+ */
+static int __time_to_milliseconds(Time time) {
+    return time.hour * MILLISECONDS_PER_HOUR + time.minute * MILLISECONDS_PER_MINUTE + time.second * MILLISECONDS_PER_SECOND + time.millisecond;
+}
+
+/**
+ * @brief Create a Time object from the milliseconds since midnight.
+ * @param milliseconds The milliseconds since midnight (0 ~ 86399999).
+ * @return Returns the Time object.
+ */
+static Time __time_from_milliseconds(int milliseconds) {
+    Time time;
+    time.hour = milliseconds / MILLISECONDS_PER_HOUR;
+    time.minute = milliseconds / MILLISECONDS_PER_MINUTE % MINUTES_PER_HOUR;
+    time.second = milliseconds / MILLISECONDS_PER_SECOND % SECONDS_PER_MINUTE;
+    time.millisecond = milliseconds % MILLISECONDS_PER_SECOND;
+    return time;
+}
+
+/**
+ * @brief Create a DateTime object from the epoch value, without range checking.
+ * @param value The epoch value (since 1970-01-01 00:00:00.000 UTC).
+ * @param units_per_day The epoch units per day (SECONDS_PER_DAY or MILLISECONDS_PER_DAY).
+ * @return Returns the DateTime object.
+ */
+static DateTime __datetime_from_epoch(int64_t value, int units_per_day) {
+    DateTime datetime;
+    int64_t days = value / units_per_day;
+    int remainder = (int)(value % units_per_day);
+
+    if (remainder < 0) {
+        days--;
+        remainder += units_per_day;
+    }
+
+    __civil_from_days((int)days + UNIX_EPOCH_ORDINAL, &datetime.date.year, &datetime.date.month, &datetime.date.day);
+    datetime.time = __time_from_milliseconds(remainder * (MILLISECONDS_PER_DAY / units_per_day));
+    return datetime;
+}
+
+/**
+ * @brief Convert the valid DateTime object to the epoch value.
+ * @param datetime The DateTime object.
+ * @param units_per_day The epoch units per day (SECONDS_PER_DAY or MILLISECONDS_PER_DAY).
+ * @return Returns the epoch value (since 1970-01-01 00:00:00.000 UTC).
+ */
+static int64_t __datetime_to_epoch(DateTime datetime, int units_per_day) {
+    int64_t days = __days_from_civil(datetime.date.year, datetime.date.month, datetime.date.day) - UNIX_EPOCH_ORDINAL;
+    return days * units_per_day + __time_to_milliseconds(datetime.time) / (MILLISECONDS_PER_DAY / units_per_day);
+}
+
+/**
+ * @brief Create a Time object.
+ * @param hour The hour.
+ * @param minute The minute.
+ * @param second The second.
+ * @param millisecond The millisecond.
+ * @return Returns the Time object.
+ */
+Time time_create(int hour, int minute, int second, int millisecond) {
+    Time time;
+    time.hour = hour;
+    time.minute = minute;
+    time.second = second;
+    time.millisecond = millisecond;
+    exit_if_fail(__is_valid_time(time));
+    return time;
+}
+
+/**
+ * @brief Create a Time object, reporting errors to the caller.
+ * @param hour The hour.
+ * @param minute The minute.
+ * @param second The second.
+ * @param millisecond The millisecond.
+ * @param out The Time object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see time_create()
+ */
+DateTimeError time_create_checked(int hour, int minute, int second, int millisecond, Time *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(__is_valid_time_fields(hour, minute, second, millisecond), DATETIME_ERROR_RANGE);
+
+    out->hour = hour;
+    out->minute = minute;
+    out->second = second;
+    out->millisecond = millisecond;
+    return __set_error(DATETIME_OK);
+}
+
+/**
+ * @brief Get the current time.
+ * @return Returns the Time object.
+ */
+Time time_now() {
+    Time time;
+
+#ifdef _WIN32
+    SYSTEMTIME st;
+#else
+    struct timeval tv;
+    struct tm tm;
+#endif
+
+#ifdef _WIN32
+    GetLocalTime(&st);
+    time = time_create(st.wHour, st.wMinute, st.wSecond, st.wMilliseconds);
+#else
+    gettimeofday(&tv, NULL);
+    __localtime(&tv.tv_sec, &tm);
+    time = time_create(tm.tm_hour, tm.tm_min, tm.tm_sec, tv.tv_usec / MILLISECONDS_PER_SECOND);
+#endif
+
+    return time;
+}
+
+/**
+ * @brief Compare two Time objects.
+ * @param time1 The first Time object.
+ * @param time2 The second Time object.
+ * @return Returns 1 if time1 is greater than time2.
+ *         Returns -1 if time1 is less than time2.
+ *         Returns 0 if time1 is equal to time2.
+ */
+int time_compare(Time time1, Time time2) {
+    exit_if_fail(__is_valid_time(time1) && __is_valid_time(time2));
+    return time_compare_unchecked(time1, time2);
+}
+
+/**
+ * @brief Compare two Time objects, reporting errors to the caller.
+ * @param time1 The first Time object.
+ * @param time2 The second Time object.
+ * @param out The result as returned by time_compare() (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see time_compare()
+ */
+DateTimeError time_compare_checked(Time time1, Time time2, int *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(__time_in_range(time1) && __time_in_range(time2), DATETIME_ERROR_RANGE);
+
+    *out = time_compare_unchecked(time1, time2);
+    return __set_error(DATETIME_OK);
+}
+
+/**
+ * @brief Compare two Time objects, without validating the arguments.
+ * @param time1 The first Time object.
+ * @param time2 The second Time object.
+ * @return Returns 1 if time1 is greater than time2.
+ *         Returns -1 if time1 is less than time2.
+ *         Returns 0 if time1 is equal to time2.
+ * @note Both Time objects must be valid.
+ * @see time_compare()
+ */
+int time_compare_unchecked(Time time1, Time time2) {
+    int milliseconds1 = __time_to_milliseconds(time1);
+    int milliseconds2 = __time_to_milliseconds(time2);
+    return (milliseconds1 > milliseconds2) - (milliseconds1 < milliseconds2);
+}
+
+/**
+ * @brief Add seconds to the time.
+ * @param time The Time object.
+ * @param milliseconds The number of milliseconds to add/subtract.
+ * @return Returns the new Time object.
+ */
+Time time_add(Time time, int milliseconds) {
+    exit_if_fail(__is_valid_time(time));
+    return time_add_unchecked(time, milliseconds);
+}
+
+/**
+ * @brief Add milliseconds to the time, reporting errors to the caller.
+ * @param time The Time object.
+ * @param milliseconds The number of milliseconds to add/subtract.
+ * @param out The new Time object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see time_add()
+ */
+DateTimeError time_add_checked(Time time, int milliseconds, Time *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(__time_in_range(time), DATETIME_ERROR_RANGE);
+
+    *out = time_add_unchecked(time, milliseconds);
+    return __set_error(DATETIME_OK);
+}
+
+/**
+ * @brief Add milliseconds to the time, without validating the arguments.
+ * @param time The Time object.
+ * @param milliseconds The number of milliseconds to add/subtract.
+ * @return Returns the new Time object.
+ * @note The Time object must be valid.
+ * @see time_add()
+ */
+Time time_add_unchecked(Time time, int milliseconds) {
+    int time_of_day = __time_to_milliseconds(time) + milliseconds % MILLISECONDS_PER_DAY;
+
+    if (time_of_day < 0) {
+        time_of_day += MILLISECONDS_PER_DAY;
+    } else if (time_of_day >= MILLISECONDS_PER_DAY) {
+        time_of_day -= MILLISECONDS_PER_DAY;
+    }
+    return __time_from_milliseconds(time_of_day);
+}
+
+/**
+ * @brief Get the milliseconds between two Time objects.
+ * @param time1 The first Time object.
+ * @param time2 The second Time object.
+ * @return Returns the milliseconds between two Time objects.
+ */
+int time_diff(Time time1, Time time2) {
+    exit_if_fail(__is_valid_time(time1) && __is_valid_time(time2));
+    return time_diff_unchecked(time1, time2);
+}
+
+/**
+ * @brief Get the milliseconds between two Time objects, reporting errors to the caller.
+ * @param time1 The first Time object.
+ * @param time2 The second Time object.
+ * @param out The milliseconds between two Time objects (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see time_diff()
+ */
+DateTimeError time_diff_checked(Time time1, Time time2, int *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(__time_in_range(time1) && __time_in_range(time2), DATETIME_ERROR_RANGE);
+
+    *out = time_diff_unchecked(time1, time2);
+    return __set_error(DATETIME_OK);
+}
+
+/**
+ * @brief Get the milliseconds between two Time objects, without validating the arguments.
+ * @param time1 The first Time object.
+ * @param time2 The second Time object.
+ * @return Returns the milliseconds between two Time objects.
+ * @note Both Time objects must be valid.
+ * @see time_diff()
+ */
+int time_diff_unchecked(Time time1, Time time2) {
+    return __time_to_milliseconds(time1) - __time_to_milliseconds(time2);
+}
+
+/**
+ * @brief Get the string representation (hh:mm:ss.fff) of the time.
+ * @param time The Time object.
+ * @return Returns the string representation of the time.
+ * @note The caller must free the returned string.
+ */
+char *time_to_string(Time time) {
+    char time_string[TIME_STRING_LENGTH];
+    return_value_if_fail(__is_valid_time(time), NULL);
+
+    __write_time(time_string, time, true);
+    return __string_dup(time_string, TIME_STRING_LENGTH);
+}
+
+/**
+ * @brief Write the string representation (hh:mm:ss.fff) of the time into the buffer.
+ * @param time The Time object.
+ * @param buffer The buffer (output), can be NULL if size is 0.
+ * @param size The size of the buffer. At most size - 1 characters are written, followed by a NUL terminator.
+ * @return Returns the length of the full string, excluding the NUL terminator, like snprintf().
+ *         The output is truncated if the return value is >= size. Returns 0 if the time is invalid.
+ */
+size_t time_to_string_buffer(Time time, char *buffer, size_t size) {
+    char time_string[TIME_STRING_LENGTH];
+
+    if (size > 0) {
+        buffer[0] = '\0';
+    }
+    return_value_if_fail(__is_valid_time(time), 0);
+
+    __write_time(time_string, time, true);
+    return __copy_to_buffer(time_string, TIME_STRING_LENGTH, buffer, size);
+}
+
+/**
+ * @brief Get the string representation (hh:mm:ss) of the time.
+ * @param time The Time object.
+ * @return Returns the string representation of the time.
+ * @note The caller must free the returned string.
+ */
+char *time_ascii_string(Time time) {
+    char time_string[TIME_ASCII_STRING_LENGTH];
+    return_value_if_fail(__is_valid_time(time), NULL);
+
+    __write_time(time_string, time, false);
+    return __string_dup(time_string, TIME_ASCII_STRING_LENGTH);
+}
+
+/**
+ * @brief Write the string representation (hh:mm:ss) of the time into the buffer.
+ * @param time The Time object.
+ * @param buffer The buffer (output), can be NULL if size is 0.
+ * @param size The size of the buffer. At most size - 1 characters are written, followed by a NUL terminator.
+ * @return Returns the length of the full string, excluding the NUL terminator, like snprintf().
+ *         The output is truncated if the return value is >= size. Returns 0 if the time is invalid.
+ */
+size_t time_ascii_string_buffer(Time time, char *buffer, size_t size) {
+    char time_string[TIME_ASCII_STRING_LENGTH];
+
+    if (size > 0) {
+        buffer[0] = '\0';
+    }
+    return_value_if_fail(__is_valid_time(time), 0);
+
+    __write_time(time_string, time, false);
+    return __copy_to_buffer(time_string, TIME_ASCII_STRING_LENGTH, buffer, size);
+}
+
+/**
+ * @brief Determine whether the datetime is valid.
+ * @param datetime The DateTime object.
+ * @return Returns true if the datetime is valid, otherwise returns false.
+ */
+static bool __is_valid_datetime(DateTime datetime) {
+    return __is_valid_date(datetime.date) && __is_valid_time(datetime.time);
+}
+
+/**
+ * @brief Create a DateTime object.
+ * @param year The year.
+ * @param month The month.
+ * @param day The day.
+ * @param hour The hour.
+ * @param minute The minute.
+ * @param second The second.
+ * @param millisecond The millisecond.
+ * @return Returns the Date object.
+ */
+DateTime datetime_create(int year, int month, int day, int hour, int minute, int second, int millisecond) {
+    DateTime datetime;
+    datetime.date = date_create(year, month, day);
+    datetime.time = time_create(hour, minute, second, millisecond);
+    exit_if_fail(__is_valid_datetime(datetime));
+    return datetime;
+}
+
+/**
+ * @brief Create a DateTime object, reporting errors to the caller.
+ * @param year The year.
+ * @param month The month.
+ * @param day The day.
+ * @param hour The hour.
+ * @param minute The minute.
+ * @param second The second.
+ * @param millisecond The millisecond.
+ * @param out The DateTime object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see datetime_create()
+ */
+DateTimeError datetime_create_checked(int year, int month, int day, int hour, int minute, int second, int millisecond, DateTime *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(__is_valid_datetime_fields(year, month, day, hour, minute, second, millisecond), DATETIME_ERROR_RANGE);
+
+    out->date.year = year;
+    out->date.month = month;
+    out->date.day = day;
+    out->time.hour = hour;
+    out->time.minute = minute;
+    out->time.second = second;
+    out->time.millisecond = millisecond;
+    return __set_error(DATETIME_OK);
+}
+
+/**
+ * @brief Read the wall clock.
+ * @param clock The clock to read.
+ * @return Returns the Instant of the reading.
+ */
+static Instant __clock_now(DateTimeClock clock) {
+#ifdef _WIN32
+    FILETIME ft;
+    ULARGE_INTEGER value;
+
+    (void)clock;
+    GetSystemTimeAsFileTime(&ft);
+    value.LowPart = ft.dwLowDateTime;
+    value.HighPart = ft.dwHighDateTime;
+    /* 100-nanosecond intervals since 1601-01-01 */
+    return (Instant)(value.QuadPart / 10000) - (Instant)116444736 * 100 * MILLISECONDS_PER_SECOND;
+#else
+    struct timespec ts;
+
+#ifdef CLOCK_REALTIME_COARSE
+    clock_gettime(clock == DATETIME_CLOCK_REALTIME_COARSE ? CLOCK_REALTIME_COARSE : CLOCK_REALTIME, &ts);
+#else
+    (void)clock;
+    clock_gettime(CLOCK_REALTIME, &ts);
+#endif
+    return (Instant)ts.tv_sec * MILLISECONDS_PER_SECOND + ts.tv_nsec / NANOSECONDS_PER_MILLISECOND;
+#endif
+}
+
+#define UTC_OFFSET_CACHE_SECONDS (15 * SECONDS_PER_MINUTE)
+
+/* The UTC offset of local time over the quarter hour [__offset_from, __offset_until) of UTC, per thread */
+static THREAD_LOCAL int64_t __offset_from = 1;
+static THREAD_LOCAL int64_t __offset_until = 0;
+static THREAD_LOCAL int __offset_seconds = 0;
+
+/**
+ * @brief Get the UTC offset of local time at the Instant, from the cache of the calling thread.
+ * @param instant The Instant.
+ * @return Returns the seconds local time is ahead of UTC.
+ */
+static int __utc_offset(Instant instant) {
+    int64_t seconds = instant >= 0 ? instant / MILLISECONDS_PER_SECOND : -((-instant + MILLISECONDS_PER_SECOND - 1) / MILLISECONDS_PER_SECOND);
+    int64_t local;
+    time_t t;
+    struct tm tm;
+
+    if (seconds < __offset_from || seconds >= __offset_until) {
+        t = (time_t)seconds;
+        __localtime(&t, &tm);
+        local = (int64_t)(__days_from_civil(tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday) - UNIX_EPOCH_ORDINAL) * SECONDS_PER_DAY +
+                tm.tm_hour * SECONDS_PER_HOUR + tm.tm_min * SECONDS_PER_MINUTE + tm.tm_sec;
+        __offset_seconds = (int)(local - seconds);
+        __offset_from = seconds - (seconds % UTC_OFFSET_CACHE_SECONDS + UTC_OFFSET_CACHE_SECONDS) % UTC_OFFSET_CACHE_SECONDS;
+        __offset_until = __offset_from + UTC_OFFSET_CACHE_SECONDS;
+    }
+    return __offset_seconds;
+}
+
+/**
+ * @brief Get the current datetime.
+ * @return Returns the DateTime object, in local time.
+ * @note The date and the time come from the same reading of the clock.
+ * @see datetime_now_snapshot()
+ */
+DateTime datetime_now() {
+    Instant instant = __clock_now(DATETIME_CLOCK_REALTIME);
+
+    return __datetime_from_epoch(instant + (Instant)__utc_offset(instant) * MILLISECONDS_PER_SECOND, MILLISECONDS_PER_DAY);
+}
+
+/**
+ * @brief Get the current datetime in UTC.
+ * @return Returns the DateTime object, in UTC.
+ * @see datetime_now_snapshot()
+ */
+DateTime datetime_now_utc(void) {
+    return __datetime_from_epoch(__clock_now(DATETIME_CLOCK_REALTIME), MILLISECONDS_PER_DAY);
+}
+
+/**
+ * @brief Read the wall clock once, and convert the reading to UTC and to local time.
+ * @param clock The clock to read. CLOCK_REALTIME_COARSE falls back to CLOCK_REALTIME where it is missing.
+ * @return Returns the DateTimeSnapshot object, every field from the same reading.
+ * @note One clock_gettime(), through the vDSO on Linux. localtime() only runs when the reading leaves the quarter
+ *       hour of UTC whose offset the calling thread has cached, as time zones change offsets on quarter hours,
+ *       so a change of the TZ environment variable shows within 15 minutes.
+ */
+DateTimeSnapshot datetime_now_snapshot(DateTimeClock clock) {
+    DateTimeSnapshot snapshot;
+
+    snapshot.instant = __clock_now(clock);
+    snapshot.utc_offset = __utc_offset(snapshot.instant);
+    snapshot.utc = __datetime_from_epoch(snapshot.instant, MILLISECONDS_PER_DAY);
+    snapshot.local = __datetime_from_epoch(snapshot.instant + (Instant)snapshot.utc_offset * MILLISECONDS_PER_SECOND, MILLISECONDS_PER_DAY);
+    return snapshot;
+}
+
+/**
+ * @brief Create a DateTime object from the Unix timestamp (since 1970-01-01 00:00:00 UTC).
+ * @param timestamp The Unix timestamp. The range of timestamp is -62135596800 (0001-01-01 00:00:00 UTC) ~ 253402300799 (9999-12-31 23:59:59 UTC).
+ * @return Returns the DateTime object.
+ */
+DateTime datetime_from_timestamp(time_t timestamp) {
+    if (timestamp < MIN_TIMESTAMP || timestamp > MAX_TIMESTAMP) {
+        /* Through double, exact at this magnitude: long is 32 bits on LLP64, and C89 has no long long */
+        fprintf(stderr, "Error: timestamp must be %.0f ~ %.0f.\n", (double)MIN_TIMESTAMP, (double)MAX_TIMESTAMP);
+        exit(EXIT_FAILURE);
+    }
+    return __datetime_from_epoch(timestamp, SECONDS_PER_DAY);
+}
+
+/**
+ * @brief Create a DateTime object from the Unix timestamp, reporting errors to the caller.
+ * @param timestamp The Unix timestamp. The range of timestamp is -62135596800 (0001-01-01 00:00:00 UTC) ~ 253402300799 (9999-12-31 23:59:59 UTC).
+ * @param out The DateTime object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see datetime_from_timestamp()
+ */
+DateTimeError datetime_from_timestamp_checked(time_t timestamp, DateTime *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(timestamp >= MIN_TIMESTAMP && timestamp <= MAX_TIMESTAMP, DATETIME_ERROR_RANGE);
+
+    *out = __datetime_from_epoch(timestamp, SECONDS_PER_DAY);
+    return __set_error(DATETIME_OK);
+}
+
+/**
+ * @brief Create a DateTime object from the Unix timestamp, without validating the arguments.
+ * @param timestamp The Unix timestamp. The range of timestamp is -62135596800 (0001-01-01 00:00:00 UTC) ~ 253402300799 (9999-12-31 23:59:59 UTC).
+ * @return Returns the DateTime object.
+ * @note The timestamp must be in range.
+ * @see datetime_from_timestamp()
+ */
+DateTime datetime_from_timestamp_unchecked(time_t timestamp) {
+    return __datetime_from_epoch(timestamp, SECONDS_PER_DAY);
+}
+
+/**
+ * @brief Convert the DateTime object to the Unix timestamp (since 1970-01-01 00:00:00 UTC).
+ * @param datetime The DateTime object.
+ * @return Returns the Unix timestamp.
+ */
+time_t datetime_to_timestamp(DateTime datetime) {
+    exit_if_fail(__is_valid_datetime(datetime));
+    return (time_t)__datetime_to_epoch(datetime, SECONDS_PER_DAY);
+}
+
+/**
+ * @brief Convert the DateTime object to the Unix timestamp, reporting errors to the caller.
+ * @param datetime The DateTime object.
+ * @param out The Unix timestamp (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see datetime_to_timestamp()
+ */
+DateTimeError datetime_to_timestamp_checked(DateTime datetime, time_t *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(__datetime_in_range(datetime), DATETIME_ERROR_RANGE);
+
+    *out = (time_t)__datetime_to_epoch(datetime, SECONDS_PER_DAY);
+    return __set_error(DATETIME_OK);
+}
+
+/**
+ * @brief Convert the DateTime object to the Unix timestamp, without validating the arguments.
+ * @param datetime The DateTime object.
+ * @return Returns the Unix timestamp.
+ * @note The DateTime object must be valid.
+ * @see datetime_to_timestamp()
+ */
+time_t datetime_to_timestamp_unchecked(DateTime datetime) {
+    return (time_t)__datetime_to_epoch(datetime, SECONDS_PER_DAY);
+}
+
+/**
+ * @brief Create a DateTime object from the ordinal (since 0001-01-01 00:00:00).
+ * @param ordinal The ordinal.
+ * @return Returns the DateTime object.
+ */
+DateTime datetime_from_ordinal(int ordinal) {
+    DateTime datetime;
+    int year;
+    int month;
+    int day;
+
+    if (ordinal <= 0) {
+        fprintf(stderr, "Error: ordinal must be greater than 0.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    __civil_from_days(ordinal, &year, &month, &day);
+    datetime.date = date_create(year, month, day);
+    datetime.time = time_create(0, 0, 0, 0);
+    return datetime;
+}
+
+/**
+ * @brief Create a DateTime object from the ordinal, reporting errors to the caller.
+ * @param ordinal The ordinal.
+ * @param out The DateTime object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see datetime_from_ordinal()
+ */
+DateTimeError datetime_from_ordinal_checked(int ordinal, DateTime *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(ordinal >= 1 && ordinal <= MAX_ORDINAL, DATETIME_ERROR_RANGE);
+
+    *out = datetime_from_ordinal_unchecked(ordinal);
+    return __set_error(DATETIME_OK);
+}
+
+/**
+ * @brief Create a DateTime object from the ordinal, without validating the arguments.
+ * @param ordinal The ordinal.
+ * @return Returns the DateTime object.
+ * @note The ordinal must be in range.
+ * @see datetime_from_ordinal()
+ */
+DateTime datetime_from_ordinal_unchecked(int ordinal) {
+    DateTime datetime;
+    __civil_from_days(ordinal, &datetime.date.year, &datetime.date.month, &datetime.date.day);
+    datetime.time = __time_from_milliseconds(0);
+    return datetime;
+}
+
+/**
+ * @brief Convert the DateTime object to the ordinal (since 0001-01-01 00:00:00).
+ * @param datetime The DateTime object.
+ * @return Returns the ordinal.
+ */
+int datetime_to_ordinal(DateTime datetime) {
+    exit_if_fail(__is_valid_datetime(datetime));
+    return datetime_to_ordinal_unchecked(datetime);
+}
+
+/**
+ * @brief Convert the DateTime object to the ordinal, reporting errors to the caller.
+ * @param datetime The DateTime object.
+ * @param out The ordinal (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see datetime_to_ordinal()
+ */
+DateTimeError datetime_to_ordinal_checked(DateTime datetime, int *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(__datetime_in_range(datetime), DATETIME_ERROR_RANGE);
+
+    *out = datetime_to_ordinal_unchecked(datetime);
+    return __set_error(DATETIME_OK);
+}
+
+/**
+ * @brief Convert the DateTime object to the ordinal, without validating the arguments.
+ * @param datetime The DateTime object.
+ * @return Returns the ordinal.
+ * @note The DateTime object must be valid.
+ * @see datetime_to_ordinal()
+ */
+int datetime_to_ordinal_unchecked(DateTime datetime) {
+    return __days_from_civil(datetime.date.year, datetime.date.month, datetime.date.day);
+}
+
+/**
+ * @brief Compare two DateTime objects.
+ * @param datetime1 The first DateTime object.
+ * @param datetime2 The second DateTime object.
+ * @return Returns 1 if datetime1 is greater than datetime2.
+ *         Returns -1 if datetime1 is less than datetime2.
+ *         Returns 0 if datetime1 is equal to datetime2.
+ */
+int datetime_compare(DateTime datetime1, DateTime datetime2) {
+    exit_if_fail(__is_valid_datetime(datetime1) && __is_valid_datetime(datetime2));
+    return datetime_compare_unchecked(datetime1, datetime2);
+}
+
+/**
+ * @brief Compare two DateTime objects, reporting errors to the caller.
+ * @param datetime1 The first DateTime object.
+ * @param datetime2 The second DateTime object.
+ * @param out The result as returned by datetime_compare() (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see datetime_compare()
+ */
+DateTimeError datetime_compare_checked(DateTime datetime1, DateTime datetime2, int *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(__datetime_in_range(datetime1) && __datetime_in_range(datetime2), DATETIME_ERROR_RANGE);
+
+    *out = datetime_compare_unchecked(datetime1, datetime2);
+    return __set_error(DATETIME_OK);
+}
+
+/**
+ * @brief Compare two DateTime objects, without validating the arguments.
+ * @param datetime1 The first DateTime object.
+ * @param datetime2 The second DateTime object.
+ * @return Returns 1 if datetime1 is greater than datetime2.
+ *         Returns -1 if datetime1 is less than datetime2.
+ *         Returns 0 if datetime1 is equal to datetime2.
+ * @note Both DateTime objects must be valid.
+ * @see datetime_compare()
+ */
+int datetime_compare_unchecked(DateTime datetime1, DateTime datetime2) {
+    int result = date_compare_unchecked(datetime1.date, datetime2.date);
+    return result != 0 ? result : time_compare_unchecked(datetime1.time, datetime2.time);
+}
+
+/**
+ * @brief Add days and milliseconds to the valid datetime.
+ * @param datetime The DateTime object.
+ * @param days The number of days to add/subtract.
+ * @param milliseconds The number of milliseconds to add/subtract.
+ * @param day_number The new day number (output). If it is out of range, it is 0 or MAX_ORDINAL + 1.
+ * @return Returns the new milliseconds since midnight.
+ */
+static int __datetime_add_fields(DateTime datetime, int days, int milliseconds, int *day_number) {
+    int time_of_day;
+
+    *day_number = __days_from_civil(datetime.date.year, datetime.date.month, datetime.date.day) + milliseconds / MILLISECONDS_PER_DAY;
+    time_of_day = __time_to_milliseconds(datetime.time) + milliseconds % MILLISECONDS_PER_DAY;
+    if (time_of_day < 0) {
+        (*day_number)--;
+        time_of_day += MILLISECONDS_PER_DAY;
+    } else if (time_of_day >= MILLISECONDS_PER_DAY) {
+        (*day_number)++;
+        time_of_day -= MILLISECONDS_PER_DAY;
+    }
+
+    *day_number = __add_days(*day_number, days);
+    return time_of_day;
+}
+
+/**
+ * @brief Add days and milliseconds to the datetime.
+ * @param datetime The DateTime object.
+ * @param days The number of days to add/subtract.
+ * @param milliseconds The number of milliseconds to add/subtract.
+ * @return DateTime The new DateTime object.
+ */
+DateTime datetime_add(DateTime datetime, int days, int milliseconds) {
+    int day_number;
+    int time_of_day;
+    exit_if_fail(__is_valid_datetime(datetime));
+
+    time_of_day = __datetime_add_fields(datetime, days, milliseconds, &day_number);
+    datetime.date = __date_from_days(day_number);
+    datetime.time = __time_from_milliseconds(time_of_day);
+    return datetime;
+}
+
+/**
+ * @brief Add days and milliseconds to the datetime, reporting errors to the caller.
+ * @param datetime The DateTime object.
+ * @param days The number of days to add/subtract.
+ * @param milliseconds The number of milliseconds to add/subtract.
+ * @param out The new DateTime object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see datetime_add()
+ */
+DateTimeError datetime_add_checked(DateTime datetime, int days, int milliseconds, DateTime *out) {
+    int day_number;
+    int time_of_day;
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(__datetime_in_range(datetime), DATETIME_ERROR_RANGE);
+
+    time_of_day = __datetime_add_fields(datetime, days, milliseconds, &day_number);
+    return_error_if_fail(day_number >= 1 && day_number <= MAX_ORDINAL, DATETIME_ERROR_RANGE);
+
+    __civil_from_days(day_number, &out->date.year, &out->date.month, &out->date.day);
+    out->time = __time_from_milliseconds(time_of_day);
+    return __set_error(DATETIME_OK);
+}
+
+/**
+ * @brief Add days and milliseconds to the datetime, without validating the arguments.
+ * @param datetime The DateTime object.
+ * @param days The number of days to add/subtract.
+ * @param milliseconds The number of milliseconds to add/subtract.
+ * @return DateTime The new DateTime object.
+ * @note The DateTime object and the result must be valid.
+ * @see datetime_add()
+ */
+DateTime datetime_add_unchecked(DateTime datetime, int days, int milliseconds) {
+    int day_number;
+    int time_of_day = __datetime_add_fields(datetime, days, milliseconds, &day_number);
+
+    __civil_from_days(day_number, &datetime.date.year, &datetime.date.month, &datetime.date.day);
+    datetime.time = __time_from_milliseconds(time_of_day);
+    return datetime;
+}
+
+/**
+ * @brief Get the difference between two DateTime objects.
+ * @param datetime1 The first DateTime object.
+ * @param datetime2 The second DateTime object.
+ * @return TimeInterval The difference between two DateTime objects.
+ */
+TimeInterval datetime_diff(DateTime datetime1, DateTime datetime2) {
+    exit_if_fail(__is_valid_datetime(datetime1) && __is_valid_datetime(datetime2));
+    return datetime_diff_unchecked(datetime1, datetime2);
+}
+
+/**
+ * @brief Get the difference between two DateTime objects, reporting errors to the caller.
+ * @param datetime1 The first DateTime object.
+ * @param datetime2 The second DateTime object.
+ * @param out The difference between two DateTime objects (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see datetime_diff()
+ */
+DateTimeError datetime_diff_checked(DateTime datetime1, DateTime datetime2, TimeInterval *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(__datetime_in_range(datetime1) && __datetime_in_range(datetime2), DATETIME_ERROR_RANGE);
+
+    *out = datetime_diff_unchecked(datetime1, datetime2);
+    return __set_error(DATETIME_OK);
+}
+
+/**
+ * @brief Get the difference between two DateTime objects, without validating the arguments.
+ * @param datetime1 The first DateTime object.
+ * @param datetime2 The second DateTime object.
+ * @return TimeInterval The difference between two DateTime objects.
+ * @note Both DateTime objects must be valid.
+ * @see datetime_diff()
+ */
+TimeInterval datetime_diff_unchecked(DateTime datetime1, DateTime datetime2) {
+    TimeInterval time_interval;
+    int days_diff;
+    int milliseconds_diff;
+
+    days_diff = __days_from_civil(datetime1.date.year, datetime1.date.month, datetime1.date.day) - __days_from_civil(datetime2.date.year, datetime2.date.month, datetime2.date.day);
+    milliseconds_diff = __time_to_milliseconds(datetime1.time) - __time_to_milliseconds(datetime2.time);
+
+    if (days_diff < 0 || (days_diff == 0 && milliseconds_diff < 0)) {
+        days_diff = -days_diff;
+        milliseconds_diff = -milliseconds_diff;
+    }
+
+    if (milliseconds_diff < 0) {
+        days_diff--;
+        milliseconds_diff += MILLISECONDS_PER_DAY;
+    }
+
+    time_interval.days = days_diff;
+    time_interval.hours = milliseconds_diff / MILLISECONDS_PER_HOUR;
+    time_interval.minutes = milliseconds_diff / MILLISECONDS_PER_MINUTE % MINUTES_PER_HOUR;
+    time_interval.seconds = milliseconds_diff / MILLISECONDS_PER_SECOND % SECONDS_PER_MINUTE;
+    time_interval.milliseconds = milliseconds_diff % MILLISECONDS_PER_SECOND;
+    return time_interval;
+}
+
+/**
+ * @brief Get the string representation (yyyy-mm-dd hh:mm:ss.fff) of the datetime.
+ * @param datetime The DateTime object.
+ * @return Returns the string representation of the datetime.
+ * @note The caller must free the returned string.
+ */
+char *datetime_to_string(DateTime datetime) {
+    char datetime_string[DATETIME_STRING_LENGTH + 1];
+    return_value_if_fail(__is_valid_datetime(datetime), NULL);
+
+    __write_datetime(datetime_string, &datetime);
+    return __string_dup(datetime_string, DATETIME_STRING_LENGTH);
+}
+
+/**
+ * @brief Write the string representation (yyyy-mm-dd hh:mm:ss.fff) of the datetime into the buffer.
+ * @param datetime The DateTime object.
+ * @param buffer The buffer (output), can be NULL if size is 0.
+ * @param size The size of the buffer. At most size - 1 characters are written, followed by a NUL terminator.
+ * @return Returns the length of the full string, excluding the NUL terminator, like snprintf().
+ *         The output is truncated if the return value is >= size. Returns 0 if the datetime is invalid.
+ */
+size_t datetime_to_string_buffer(DateTime datetime, char *buffer, size_t size) {
+    char datetime_string[DATETIME_STRING_LENGTH + 1];
+
+    if (size > 0) {
+        buffer[0] = '\0';
+    }
+    return_value_if_fail(__is_valid_datetime(datetime), 0);
+
+    if (size > DATETIME_STRING_LENGTH) {
+        __write_datetime(buffer, &datetime);
+        return DATETIME_STRING_LENGTH;
+    }
+    __write_datetime(datetime_string, &datetime);
+    return __copy_to_buffer(datetime_string, DATETIME_STRING_LENGTH, buffer, size);
+}
+
+/**
+ * @brief Get the string representation (Day Mon dd hh:mm:ss yyyy) of the datetime.
+ * @param datetime DateTime Time object.
+ * @return Returns the string representation of the datetime.
+ * @note The caller must free the returned string.
+ */
+char *datetime_ascii_string(DateTime datetime) {
+    char datetime_string[DATETIME_ASCII_STRING_LENGTH + 1];
+    size_t length;
+    return_value_if_fail(__is_valid_datetime(datetime), NULL);
+
+    length = datetime_ascii_string_buffer(datetime, datetime_string, sizeof(datetime_string));
+    return __string_dup(datetime_string, length);
+}
+
+/**
+ * @brief Write the string representation (Day Mon dd hh:mm:ss yyyy) of the datetime into the buffer.
+ * @param datetime The DateTime object.
+ * @param buffer The buffer (output), can be NULL if size is 0.
+ * @param size The size of the buffer. At most size - 1 characters are written, followed by a NUL terminator.
+ * @return Returns the length of the full string, excluding the NUL terminator, like snprintf().
+ *         The output is truncated if the return value is >= size. Returns 0 if the datetime is invalid.
+ */
+size_t datetime_ascii_string_buffer(DateTime datetime, char *buffer, size_t size) {
+    char datetime_string[DATETIME_ASCII_STRING_LENGTH];
+    size_t length;
+
+    if (size > 0) {
+        buffer[0] = '\0';
+    }
+    return_value_if_fail(__is_valid_datetime(datetime), 0);
+
+    __write_ascii_date(datetime_string, datetime.date);
+    datetime_string[10] = ' ';
+    __write_time(datetime_string + 11, datetime.time, false);
+    datetime_string[19] = ' ';
+    length = 20 + __write_year(datetime_string + 20, datetime.date.year);
+    return __copy_to_buffer(datetime_string, length, buffer, size);
+}
+
+#define STRFTIME_MAX_SIZE 65536
+
+/**
+ * @brief Format the datetime with strftime(), for the formats that a DateTimeFormat plan does not support.
+ * @param datetime The DateTime object, valid.
+ * @param format The format string.
+ * @return Returns the string representation of the datetime, or NULL if the allocation fails.
+ * @note The weekday and the day of the year are filled in, so every specifier of strftime() works.
+ *       A result longer than STRFTIME_MAX_SIZE - 1 characters is returned empty.
+ */
+static char *__format_strftime(DateTime datetime, const char *format) {
+    int days = __days_from_civil(datetime.date.year, datetime.date.month, datetime.date.day);
+    char *datetime_string = NULL;
+    char *resized = NULL;
+    size_t size;
+    size_t length = 0;
+    struct tm tm;
+
+    memset(&tm, 0, sizeof(tm));
+    tm.tm_year = datetime.date.year - 1900;
+    tm.tm_mon = datetime.date.month - 1;
+    tm.tm_mday = datetime.date.day;
+    tm.tm_hour = datetime.time.hour;
+    tm.tm_min = datetime.time.minute;
+    tm.tm_sec = datetime.time.second;
+    tm.tm_wday = days % DAYS_IN_WEEK;
+    tm.tm_yday = days - __days_from_civil(datetime.date.year, JAN, 1);
+
+    /* strftime() returns 0 when the buffer is too small: grow it until the result fits */
+    for (size = 128; size <= STRFTIME_MAX_SIZE; size *= 2) {
+        resized = (char *)realloc(datetime_string, sizeof(char) * size);
+        if (resized == NULL) {
+            free(datetime_string);
+            return NULL;
+        }
+        datetime_string = resized;
+        length = strftime(datetime_string, size, format, &tm);
+        if (length > 0) {
+            break;
+        }
+    }
+    datetime_string[length] = '\0';
+
+    resized = (char *)realloc(datetime_string, sizeof(char) * (length + 1));
+    return resized != NULL ? resized : datetime_string;
+}
+
+/**
+ * @brief Get the specified string representation of the datetime.
+ * @param datetime The DateTime object.
+ * @param format The format string.
+ * | Specifier | Replaced by                                               | Example                  |
+ * | %a        | Abbreviated weekday name                                  | Sun                      |
+ * | %A        | Full weekday name                                         | Sunday                   |
+ * | %b        | Abbreviated month name                                    | Mar                      |
+ * | %B        | Full month name                                           | March                    |
+ * | %c        | Date and time representation for the current locale       | Sun Aug 19 02:56:02 2012 |
+ * | %d        | Day of the month (01-31)                                  | 19                       |
+ * | %D        | Short date, same as %m/%d/%y                              | 08/19/12                 |
+ * | %F        | Short date, same as %Y-%m-%d                              | 2012-08-19               |
+ * | %G        | ISO 8601 week-numbering year                              | 2012                     |
+ * | %h        | Abbreviated month name, same as %b                        | Mar                      |
+ * | %H        | Hour in 24h format (00-23)                                | 14                       |
+ * | %I        | Hour in 12h format (01-12)                                | 02                       |
+ * | %j        | Day of the year (001-366)                                 | 231                      |
+ * | %m        | Month as a decimal number (01-12)                         | 08                       |
+ * | %M        | Minute (00-59)                                            | 55                       |
+ * | %n        | A new-line character                                      |                          |
+ * | %p        | AM or PM                                                  | PM                       |
+ * | %r        | 12-hour clock time, same as %I:%M:%S %p                   | 02:55:02 PM              |
+ * | %R        | 24-hour clock time, same as %H:%M                         | 14:55                    |
+ * | %S        | Second (00-61)                                            | 02                       |
+ * | %t        | A horizontal-tab character                                |                          |
+ * | %T        | Time, same as %H:%M:%S                                    | 14:55:02                 |
+ * | %u        | ISO 8601 weekday as a decimal number (1-7, Monday is 1)   | 7                        |
+ * | %U        | Week number of the year (Sunday as the first day) (00-53) | 33                       |
+ * | %V        | ISO 8601 week number of the year (01-53)                  | 33                       |
+ * | %w        | Weekday as a decimal number (0-6)                         | 4                        |
+ * | %W        | Week number of the year (Monday as the first day) (00-53) | 34                       |
+ * | %x        | Date representation for the current locale                | 08/19/12                 |
+ * | %X        | Time representation for the current locale                | 02:50:06                 |
+ * | %y        | Year without century (00-99)                              | 01                       |
+ * | %Y        | Year with century                                         | 2001                     |
+ * | %z        | Timezone offset (+0000)                                   | +0000                    |
+ * | %%        | A % sign                                                  | %                        |
+ * @return Returns the specified string representation of the datetime.
+ * @note The formats with other specifiers, flags or widths (%Z, %-d, %10Y...) go through strftime(), slower.
+ *       The caller must free the returned string.
+ */
+char *datetime_format_string(DateTime datetime, const char *format) {
+    DateTimeFormat *plan = NULL;
+    char *datetime_string = NULL;
+    size_t length;
+    return_value_if_fail(__is_valid_datetime(datetime) && format != NULL, NULL);
+
+    plan = datetime_format_create(format);
+    if (plan == NULL) {
+        return __format_strftime(datetime, format);
+    }
+
+    length = datetime_format_render(plan, datetime, NULL, 0);
+    datetime_string = (char *)malloc(sizeof(char) * (length + 1));
+    if (datetime_string != NULL) {
+        datetime_format_render(plan, datetime, datetime_string, length + 1);
+    }
+
+    datetime_format_destroy(plan);
+    return datetime_string;
+}
+
+/* The operations of a DateTimeFormat plan. */
+typedef enum FormatOpKind {
+    FORMAT_LITERAL,
+    FORMAT_WEEKDAY_ABBR,
+    FORMAT_WEEKDAY_FULL,
+    FORMAT_MONTH_ABBR,
+    FORMAT_MONTH_FULL,
+    FORMAT_DAY,
+    FORMAT_DAY_SPACE,
+    FORMAT_ISO_YEAR,
+    FORMAT_HOUR,
+    FORMAT_HOUR_12,
+    FORMAT_DAY_OF_YEAR,
+    FORMAT_MONTH,
+    FORMAT_MINUTE,
+    FORMAT_AM_PM,
+    FORMAT_SECOND,
+    FORMAT_ISO_WEEKDAY,
+    FORMAT_WEEK_SUNDAY,
+    FORMAT_ISO_WEEK,
+    FORMAT_WEEKDAY,
+    FORMAT_WEEK_MONDAY,
+    FORMAT_YEAR_2,
+    FORMAT_YEAR,
+    FORMAT_ZONE
+} FormatOpKind;
+
+typedef struct FormatOp {
+    FormatOpKind kind;
+    size_t offset; /* FORMAT_LITERAL: the first character in DateTimeFormat.text */
+    size_t length; /* FORMAT_LITERAL: the number of characters */
+} FormatOp;
+
+struct DateTimeFormat {
+    FormatOp *ops;
+    size_t count;
+    char *text;
+    size_t text_length;
+    size_t max_length;
+};
+
+/**
+ * @brief Get the expansion of the composite specifiers, as strftime() produces them in the "C" locale.
+ * @param specifier The character after '%'.
+ * @return Returns the expansion, or NULL if the specifier is not composite.
+ */
+static const char *__format_expansion(char specifier) {
+    switch (specifier) {
+    case 'c':
+        return "%a %b %e %H:%M:%S %Y";
+    case 'x':
+    case 'D':
+        return "%m/%d/%y";
+    case 'X':
+    case 'T':
+        return "%H:%M:%S";
+    case 'F':
+        return "%Y-%m-%d";
+    case 'R':
+        return "%H:%M";
+    case 'r':
+        return "%I:%M:%S %p";
+    case 'h':
+        return "%b";
+    case 'n':
+        return "\n";
+    case 't':
+        return "\t";
+    default:
+        return NULL;
+    }
+}
+
+/**
+ * @brief Get the operation of the specifier.
+ * @param specifier The character after '%'.
+ * @param max_length The maximum number of characters the operation writes (output).
+ * @return Returns the operation kind, or FORMAT_LITERAL if the specifier is not supported.
+ */
+static FormatOpKind __format_op_kind(char specifier, size_t *max_length) {
+    *max_length = 2;
+    switch (specifier) {
+    case 'a':
+        *max_length = 3;
+        return FORMAT_WEEKDAY_ABBR;
+    case 'A':
+        *max_length = 9;
+        return FORMAT_WEEKDAY_FULL;
+    case 'b':
+        *max_length = 3;
+        return FORMAT_MONTH_ABBR;
+    case 'B':
+        *max_length = 9;
+        return FORMAT_MONTH_FULL;
+    case 'd':
+        return FORMAT_DAY;
+    case 'e':
+        return FORMAT_DAY_SPACE;
+    case 'G':
+        *max_length = 4;
+        return FORMAT_ISO_YEAR;
+    case 'H':
+        return FORMAT_HOUR;
+    case 'I':
+        return FORMAT_HOUR_12;
+    case 'j':
+        *max_length = 3;
+        return FORMAT_DAY_OF_YEAR;
+    case 'm':
+        return FORMAT_MONTH;
+    case 'M':
+        return FORMAT_MINUTE;
+    case 'p':
+        return FORMAT_AM_PM;
+    case 'S':
+        return FORMAT_SECOND;
+    case 'u':
+        *max_length = 1;
+        return FORMAT_ISO_WEEKDAY;
+    case 'U':
+        return FORMAT_WEEK_SUNDAY;
+    case 'V':
+        return FORMAT_ISO_WEEK;
+    case 'w':
+        *max_length = 1;
+        return FORMAT_WEEKDAY;
+    case 'W':
+        return FORMAT_WEEK_MONDAY;
+    case 'y':
+        return FORMAT_YEAR_2;
+    case 'Y':
+        *max_length = 4;
+        return FORMAT_YEAR;
+    case 'z':
+        *max_length = 5;
+        return FORMAT_ZONE;
+    default:
+        return FORMAT_LITERAL;
+    }
+}
+
+/**
+ * @brief Append the operations of the format string to the plan.
+ * @param plan The DateTimeFormat object, with room for the operations and characters of the format.
+ * @param format The format string.
+ * @return Returns true if every specifier is supported, otherwise returns false.
+ */
+static bool __format_compile(DateTimeFormat *plan, const char *format) {
+    const char *expansion = NULL;
+    FormatOp *last = NULL;
+    size_t max_length;
+
+    for (; *format != '\0'; format++) {
+        if (*format == '%' && format[1] != '%') {
+            format++;
+            expansion = __format_expansion(*format);
+            if (expansion != NULL) {
+                return_value_if_fail(__format_compile(plan, expansion), false);
+                continue;
+            }
+            plan->ops[plan->count].kind = __format_op_kind(*format, &max_length);
+            return_value_if(plan->ops[plan->count].kind == FORMAT_LITERAL, false);
+            plan->count++;
+            plan->max_length += max_length;
+            continue;
+        }
+
+        /* Merge the character into the literal run before it. */
+        format += (*format == '%');
+        last = plan->count > 0 ? &plan->ops[plan->count - 1] : NULL;
+        if (last == NULL || last->kind != FORMAT_LITERAL) {
+            last = &plan->ops[plan->count++];
+            last->kind = FORMAT_LITERAL;
+            last->offset = plan->text_length;
+            last->length = 0;
+        }
+        plan->text[plan->text_length++] = *format;
+        last->length++;
+        plan->max_length++;
+    }
+    return true;
+}
+
+/**
+ * @brief Create a DateTimeFormat object, the compiled plan of the format string.
+ * @param format The format string. The specifiers are listed in datetime_format_string().
+ * @return Returns the DateTimeFormat object, or NULL if the format has an unsupported specifier or the allocation fails.
+ * @note The caller must destroy the returned format with datetime_format_destroy().
+ */
+DateTimeFormat *datetime_format_create(const char *format) {
+    DateTimeFormat *plan = NULL;
+    size_t capacity;
+
+    return_value_if_fail(format != NULL, NULL);
+
+    /* Every expansion has fewer operations and literal characters than 8 times the specifier. */
+    capacity = strlen(format) * 8 + 1;
+    plan = (DateTimeFormat *)calloc(1, sizeof(DateTimeFormat));
+    return_value_if_fail(plan != NULL, NULL);
+    plan->ops = (FormatOp *)malloc(sizeof(FormatOp) * capacity);
+    plan->text = (char *)malloc(sizeof(char) * capacity);
+
+    if (plan->ops == NULL || plan->text == NULL || !__format_compile(plan, format)) {
+        datetime_format_destroy(plan);
+        return NULL;
+    }
+    return plan;
+}
+
+/**
+ * @brief Destroy the DateTimeFormat object.
+ * @param format The DateTimeFormat object.
+ */
+void datetime_format_destroy(DateTimeFormat *format) {
+    return_if_fail(format != NULL);
+    free(format->ops);
+    free(format->text);
+    free(format);
+}
+
+/**
+ * @brief Get the maximum length of the strings rendered by the DateTimeFormat object.
+ * @param format The DateTimeFormat object.
+ * @return Returns the maximum number of characters, excluding the NUL terminator.
+ */
+size_t datetime_format_max_length(const DateTimeFormat *format) {
+    return_value_if_fail(format != NULL, 0);
+    return format->max_length;
+}
+
+/**
+ * @brief Write the value as 2 digits.
+ * @param str The output.
+ * @param value The value (0 ~ 99).
+ * @param pad The character written for the leading zero.
+ * @return Returns 2.
+ */
+static size_t __format_2_digits(char *str, int value, char pad) {
+    __write_pair(str, value);
+    if (value < 10) {
+        str[0] = pad;
+    }
+    return 2;
+}
+
+/**
+ * @brief Copy the string without the NUL terminator.
+ * @param str The output.
+ * @param src The string.
+ * @return Returns the number of characters written.
+ */
+static size_t __format_copy(char *str, const char *src) {
+    size_t length = 0;
+
+    while (src[length] != '\0') {
+        str[length] = src[length];
+        length++;
+    }
+    return length;
+}
+
+/**
+ * @brief Render the valid DateTime object into the buffer of at least format->max_length characters.
+ * @param format The DateTimeFormat object.
+ * @param datetime The DateTime object.
+ * @param str The output, not NUL-terminated.
+ * @return Returns the number of characters written.
+ */
+static size_t __format_render(const DateTimeFormat *format, DateTime datetime, char *str) {
+    static const char MONTH_NAMES[MONTHS_PER_YEAR + 1][10] = {"", "January", "February", "March", "April", "May", "June",
+                                                             "July", "August", "September", "October", "November", "December"};
+    static const char WEEKDAY_NAMES[DAYS_IN_WEEK][10] = {"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
+    const FormatOp *op = NULL;
+    const FormatOp *end = format->ops + format->count;
+    char *p = str;
+    int days = __days_from_civil(datetime.date.year, datetime.date.month, datetime.date.day);
+    int day_of_year = days - __days_from_civil(datetime.date.year, JAN, 1);
+    int wday = days % DAYS_IN_WEEK;
+    size_t i;
+
+    for (op = format->ops; op < end; op++) {
+        switch (op->kind) {
+        case FORMAT_LITERAL:
+            for (i = 0; i < op->length; i++) {
+                p[i] = format->text[op->offset + i];
+            }
+            p += op->length;
+            break;
+        case FORMAT_WEEKDAY_ABBR:
+            memcpy(p, WEEKDAY_NAMES[wday], 3);
+            p += 3;
+            break;
+        case FORMAT_WEEKDAY_FULL:
+            p += __format_copy(p, WEEKDAY_NAMES[wday]);
+            break;
+        case FORMAT_MONTH_ABBR:
+            memcpy(p, MONTH_NAMES[datetime.date.month], 3);
+            p += 3;
+            break;
+        case FORMAT_MONTH_FULL:
+            p += __format_copy(p, MONTH_NAMES[datetime.date.month]);
+            break;
+        case FORMAT_DAY:
+            p += __format_2_digits(p, datetime.date.day, '0');
+            break;
+        case FORMAT_DAY_SPACE:
+            p += __format_2_digits(p, datetime.date.day, ' ');
+            break;
+        case FORMAT_ISO_YEAR:
+            p += __write_year(p, __iso_week(datetime.date.year, day_of_year + 1, __iso_weekday_from_days(days)).year);
+            break;
+        case FORMAT_HOUR:
+            p += __format_2_digits(p, datetime.time.hour, '0');
+            break;
+        case FORMAT_HOUR_12:
+            p += __format_2_digits(p, (datetime.time.hour + 11) % 12 + 1, '0');
+            break;
+        case FORMAT_DAY_OF_YEAR:
+            *p++ = (char)('0' + (day_of_year + 1) / 100);
+            p += __format_2_digits(p, (day_of_year + 1) % 100, '0');
+            break;
+        case FORMAT_MONTH:
+            p += __format_2_digits(p, datetime.date.month, '0');
+            break;
+        case FORMAT_MINUTE:
+            p += __format_2_digits(p, datetime.time.minute, '0');
+            break;
+        case FORMAT_AM_PM:
+            p[0] = datetime.time.hour < 12 ? 'A' : 'P';
+            p[1] = 'M';
+            p += 2;
+            break;
+        case FORMAT_SECOND:
+            p += __format_2_digits(p, datetime.time.second, '0');
+            break;
+        case FORMAT_ISO_WEEKDAY:
+            *p++ = (char)('0' + __iso_weekday_from_days(days));
+            break;
+        case FORMAT_WEEK_SUNDAY:
+            p += __format_2_digits(p, (day_of_year + DAYS_IN_WEEK - wday) / DAYS_IN_WEEK, '0');
+            break;
+        case FORMAT_ISO_WEEK:
+            p += __format_2_digits(p, __iso_week(datetime.date.year, day_of_year + 1, __iso_weekday_from_days(days)).week, '0');
+            break;
+        case FORMAT_WEEKDAY:
+            *p++ = (char)('0' + wday);
+            break;
+        case FORMAT_WEEK_MONDAY:
+            p += __format_2_digits(p, (day_of_year + DAYS_IN_WEEK - (wday + 6) % DAYS_IN_WEEK) / DAYS_IN_WEEK, '0');
+            break;
+        case FORMAT_YEAR_2:
+            p += __format_2_digits(p, datetime.date.year % 100, '0');
+            break;
+        case FORMAT_YEAR:
+            p += __write_year(p, datetime.date.year);
+            break;
+        default:
+            memcpy(p, "+0000", 5);
+            p += 5;
+            break;
+        }
+    }
+    return (size_t)(p - str);
+}
+
+/**
+ * @brief Render the DateTime object with the compiled format.
+ * @param format The DateTimeFormat object.
+ * @param datetime The DateTime object.
+ * @param buffer The buffer (output), can be NULL if size is 0.
+ * @param size The size of the buffer. At most size - 1 characters are written, followed by a NUL terminator.
+ * @return Returns the length of the full string, excluding the NUL terminator, like snprintf().
+ *         The output is truncated if the return value is >= size. Returns 0 if the DateTime object is invalid.
+ */
+size_t datetime_format_render(const DateTimeFormat *format, DateTime datetime, char *buffer, size_t size) {
+    char scratch[128];
+    char *str = NULL;
+    size_t length;
+
+    if (size > 0) {
+        buffer[0] = '\0';
+    }
+    return_value_if_fail(format != NULL && __is_valid_datetime(datetime), 0);
+
+    if (size > format->max_length) {
+        length = __format_render(format, datetime, buffer);
+        buffer[length] = '\0';
+        return length;
+    }
+
+    /* The buffer may be too small, render into a scratch buffer and truncate. */
+    str = format->max_length <= sizeof(scratch) ? scratch : (char *)malloc(sizeof(char) * format->max_length);
+    return_value_if_fail(str != NULL, 0);
+    length = __format_render(format, datetime, str);
+    if (size > 0) {
+        size = length < size ? length : size - 1;
+        memcpy(buffer, str, size);
+        buffer[size] = '\0';
+    }
+    if (str != scratch) {
+        free(str);
+    }
+    return length;
+}
+
+/**
+ * @brief Convert the DateTime object to the Instant.
+ * @param datetime The DateTime object.
+ * @return Returns the Instant (milliseconds since 1970-01-01 00:00:00.000 UTC).
  */
-int date_compare(Date date1, Date date2) {
-    exit_if_fail(__is_valid_date(date1) && __is_valid_date(date2));
+Instant instant_from_datetime(DateTime datetime) {
+    exit_if_fail(__is_valid_datetime(datetime));
+    return __datetime_to_epoch(datetime, MILLISECONDS_PER_DAY);
+}
 
-    if (date1.year > date2.year) {
-        return 1;
-    } else if (date1.year < date2.year) {
-        return -1;
-    }
+/**
+ * @brief Convert the DateTime object to the Instant, reporting errors to the caller.
+ * @param datetime The DateTime object.
+ * @param out The Instant (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see instant_from_datetime()
+ */
+DateTimeError instant_from_datetime_checked(DateTime datetime, Instant *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(__datetime_in_range(datetime), DATETIME_ERROR_RANGE);
 
-    if (date1.month > date2.month) {
-        return 1;
-    } else if (date1.month < date2.month) {
-        return -1;
-    }
+    *out = __datetime_to_epoch(datetime, MILLISECONDS_PER_DAY);
+    return __set_error(DATETIME_OK);
+}
 
-    if (date1.day > date2.day) {
-        return 1;
-    } else if (date1.day < date2.day) {
-        return -1;
-    }
+/**
+ * @brief Convert the DateTime object to the Instant, without validating the arguments.
+ * @param datetime The DateTime object.
+ * @return Returns the Instant (milliseconds since 1970-01-01 00:00:00.000 UTC).
+ * @note The DateTime object must be valid.
+ * @see instant_from_datetime()
+ */
+Instant instant_from_datetime_unchecked(DateTime datetime) {
+    return __datetime_to_epoch(datetime, MILLISECONDS_PER_DAY);
+}
 
-    return 0;
+/**
+ * @brief Convert the Instant to the DateTime object.
+ * @param instant The Instant. The range of instant is INSTANT_MIN (0001-01-01 00:00:00.000 UTC) ~ INSTANT_MAX (9999-12-31 23:59:59.999 UTC).
+ * @return Returns the DateTime object.
+ */
+DateTime instant_to_datetime(Instant instant) {
+    if (instant < INSTANT_MIN || instant > INSTANT_MAX) {
+        fprintf(stderr, "Error: instant must be %.0f ~ %.0f.\n", (double)INSTANT_MIN, (double)INSTANT_MAX);
+        exit(EXIT_FAILURE);
+    }
+    return __datetime_from_epoch(instant, MILLISECONDS_PER_DAY);
 }
 
 /**
- * @brief Add days to the date.
- * @param date The Date object.
- * @param days The number of days to add/subtract.
- * @return Returns the new Date object.
+ * @brief Convert the Instant to the DateTime object, reporting errors to the caller.
+ * @param instant The Instant. The range of instant is INSTANT_MIN (0001-01-01 00:00:00.000 UTC) ~ INSTANT_MAX (9999-12-31 23:59:59.999 UTC).
+ * @param out The DateTime object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see instant_to_datetime()
  */
-Date date_add(Date date, int days) {
-    struct tm tm_date = {0};
-    exit_if_fail(__is_valid_date(date));
+DateTimeError instant_to_datetime_checked(Instant instant, DateTime *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(instant >= INSTANT_MIN && instant <= INSTANT_MAX, DATETIME_ERROR_RANGE);
 
-    tm_date.tm_year = date.year - 1900;
-    tm_date.tm_mon = date.month - 1;
-    tm_date.tm_mday = date.day + days;
+    *out = __datetime_from_epoch(instant, MILLISECONDS_PER_DAY);
+    return __set_error(DATETIME_OK);
+}
 
-    mktime(&tm_date);
-    return date_create(tm_date.tm_year + 1900, tm_date.tm_mon + 1, tm_date.tm_mday);
+/**
+ * @brief Convert the Instant to the DateTime object, without validating the arguments.
+ * @param instant The Instant. The range of instant is INSTANT_MIN (0001-01-01 00:00:00.000 UTC) ~ INSTANT_MAX (9999-12-31 23:59:59.999 UTC).
+ * @return Returns the DateTime object.
+ * @note The Instant must be in range.
+ * @see instant_to_datetime()
+ */
+DateTime instant_to_datetime_unchecked(Instant instant) {
+    return __datetime_from_epoch(instant, MILLISECONDS_PER_DAY);
 }
 
 /**
- * @brief Get the the days between two Date objects.
- * @param date1 The first Date object.
- * @param date2 The second Date object.
- * @return Returns the days between two Date objects.
+ * @brief Compare two Instants.
+ * @param instant1 The first Instant.
+ * @param instant2 The second Instant.
+ * @return Returns 1 if instant1 is greater than instant2.
+ *         Returns -1 if instant1 is less than instant2.
+ *         Returns 0 if instant1 is equal to instant2.
  */
-int date_diff(Date date1, Date date2) {
-    struct tm tm_date1 = {0};
-    struct tm tm_date2 = {0};
-    time_t time1;
-    time_t time2;
-    double diff_seconds = 0;
+int instant_compare(Instant instant1, Instant instant2) {
+    return (instant1 > instant2) - (instant1 < instant2);
+}
 
-    exit_if_fail(__is_valid_date(date1) && __is_valid_date(date2));
+/**
+ * @brief Add milliseconds to the Instant.
+ * @param instant The Instant.
+ * @param milliseconds The number of milliseconds to add/subtract.
+ * @return Returns the new Instant.
+ */
+Instant instant_add(Instant instant, int64_t milliseconds) {
+    return instant + milliseconds;
+}
 
-    tm_date1.tm_year = date1.year - 1900;
-    tm_date1.tm_mon = date1.month - 1;
-    tm_date1.tm_mday = date1.day;
-    tm_date2.tm_year = date2.year - 1900;
-    tm_date2.tm_mon = date2.month - 1;
-    tm_date2.tm_mday = date2.day;
+/**
+ * @brief Get the milliseconds between two Instants.
+ * @param instant1 The first Instant.
+ * @param instant2 The second Instant.
+ * @return Returns the milliseconds between two Instants.
+ */
+int64_t instant_diff(Instant instant1, Instant instant2) {
+    return instant1 - instant2;
+}
 
-    time1 = mktime(&tm_date1);
-    time2 = mktime(&tm_date2);
-    diff_seconds = difftime(time1, time2);
-    return (int)(diff_seconds / SECONDS_PER_DAY);
+/**
+ * @brief Get the earlier of two Instants.
+ * @param instant1 The first Instant.
+ * @param instant2 The second Instant.
+ * @return Returns the earlier Instant.
+ */
+Instant instant_min(Instant instant1, Instant instant2) {
+    return instant1 < instant2 ? instant1 : instant2;
 }
 
 /**
- * @brief Get the string representation (yyyy-mm-dd) of the date.
+ * @brief Get the later of two Instants.
+ * @param instant1 The first Instant.
+ * @param instant2 The second Instant.
+ * @return Returns the later Instant.
+ */
+Instant instant_max(Instant instant1, Instant instant2) {
+    return instant1 > instant2 ? instant1 : instant2;
+}
+
+/**
+ * @brief Pack the Date object into 32 bits (year:14 | month:4 | day:5).
  * @param date The Date object.
- * @return Returns the string representation of the date.
- * @note The caller must free the returned string.
+ * @return Returns the PackedDate.
  */
-char *date_to_string(Date date) {
-    char *date_string = NULL;
-    return_value_if_fail(__is_valid_date(date), NULL);
+PackedDate date_pack(Date date) {
+    exit_if_fail(__is_valid_date(date));
+    return date_pack_unchecked(date);
+}
 
-    date_string = (char *)malloc(sizeof(char) * 11);
-    return_value_if_fail(date_string != NULL, NULL);
+/**
+ * @brief Pack the Date object into 32 bits, reporting errors to the caller.
+ * @param date The Date object.
+ * @param out The PackedDate (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see date_pack()
+ */
+DateTimeError date_pack_checked(Date date, PackedDate *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(__date_in_range(date), DATETIME_ERROR_RANGE);
 
-    sprintf(date_string, "%04d-%02d-%02d", date.year, date.month, date.day);
-    return date_string;
+    *out = date_pack_unchecked(date);
+    return __set_error(DATETIME_OK);
 }
 
 /**
- * @brief Get the string representation (Day Mon dd yyyy) of the date.
+ * @brief Pack the Date object into 32 bits, without validating the arguments.
  * @param date The Date object.
- * @return Returns the string representation of the date.
- * @note The caller must free the returned string.
+ * @return Returns the PackedDate.
+ * @note The Date object must be valid.
+ * @see date_pack()
  */
-char *date_ascii_string(Date date) {
-    char *date_string = NULL;
-    struct tm tm = {0};
-    char weekday_abbr[4] = {0};
-    return_value_if_fail(__is_valid_date(date), NULL);
+PackedDate date_pack_unchecked(Date date) {
+    return ((PackedDate)date.year << (PACKED_MONTH_BITS + PACKED_DAY_BITS)) | ((PackedDate)date.month << PACKED_DAY_BITS) | (PackedDate)date.day;
+}
 
-    tm.tm_year = date.year - 1900;
-    tm.tm_mon = date.month - 1;
-    tm.tm_mday = date.day;
+/**
+ * @brief Unpack the PackedDate into the Date object.
+ * @param packed_date The PackedDate.
+ * @return Returns the Date object.
+ */
+Date date_unpack(PackedDate packed_date) {
+    Date date = date_unpack_unchecked(packed_date);
+    exit_if_fail(__is_valid_date(date));
+    return date;
+}
 
-    date_string = (char *)calloc(16, sizeof(char));
-    return_value_if_fail(date_string != NULL, NULL);
+/**
+ * @brief Unpack the PackedDate into the Date object, reporting errors to the caller.
+ * @param packed_date The PackedDate.
+ * @param out The Date object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see date_unpack()
+ */
+DateTimeError date_unpack_checked(PackedDate packed_date, Date *out) {
+    Date date = date_unpack_unchecked(packed_date);
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(__date_in_range(date), DATETIME_ERROR_RANGE);
 
-    strcpy(weekday_abbr, weekday_abbr_name(weekday(date.year, date.month, date.day)));
-    strftime(date_string, 13, " %b %d %Y", &tm);
-    memmove(date_string + 3, date_string, 12);
-    memcpy(date_string, weekday_abbr, 3);
-    return date_string;
+    *out = date;
+    return __set_error(DATETIME_OK);
 }
 
 /**
- * @brief Determine whether the time is valid.
+ * @brief Unpack the PackedDate into the Date object, without validating the arguments.
+ * @param packed_date The PackedDate.
+ * @return Returns the Date object.
+ * @note The PackedDate must hold a valid date.
+ * @see date_unpack()
+ */
+Date date_unpack_unchecked(PackedDate packed_date) {
+    Date date;
+    date.year = (int)(packed_date >> (PACKED_MONTH_BITS + PACKED_DAY_BITS));
+    date.month = (int)(packed_date >> PACKED_DAY_BITS) & ((1 << PACKED_MONTH_BITS) - 1);
+    date.day = (int)packed_date & ((1 << PACKED_DAY_BITS) - 1);
+    return date;
+}
+
+/**
+ * @brief Pack the Time object into 32 bits (milliseconds since midnight).
  * @param time The Time object.
- * @return Returns true if the time is valid, otherwise returns false.
+ * @return Returns the PackedTime.
  */
-static bool __is_valid_time(Time time) {
-    if (time.hour < 0 || time.hour >= HOURS_PER_DAY) {
-        fprintf(stderr, "Error: hour must be 0 ~ 23.\n");
-        return false;
-    }
+PackedTime time_pack(Time time) {
+    exit_if_fail(__is_valid_time(time));
+    return time_pack_unchecked(time);
+}
 
-    if (time.minute < 0 || time.minute >= MINUTES_PER_HOUR) {
-        fprintf(stderr, "Error: minute must be 0 ~ 59.\n");
-        return false;
-    }
+/**
+ * @brief Pack the Time object into 32 bits, reporting errors to the caller.
+ * @param time The Time object.
+ * @param out The PackedTime (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see time_pack()
+ */
+DateTimeError time_pack_checked(Time time, PackedTime *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(__time_in_range(time), DATETIME_ERROR_RANGE);
 
-    if (time.second < 0 || time.second >= SECONDS_PER_MINUTE) {
-        fprintf(stderr, "Error: second must be 0 ~ 59.\n");
-        return false;
-    }
+    *out = (PackedTime)__time_to_milliseconds(time);
+    return __set_error(DATETIME_OK);
+}
 
-    if (time.millisecond < 0 || time.millisecond >= MILLISECONDS_PER_SECOND) {
-        fprintf(stderr, "Error: millisecond must be 0 ~ 999.\n");
-        return false;
+/**
+ * @brief Pack the Time object into 32 bits, without validating the arguments.
+ * @param time The Time object.
+ * @return Returns the PackedTime.
+ * @note The Time object must be valid.
+ * @see time_pack()
+ */
+PackedTime time_pack_unchecked(Time time) {
+    return (PackedTime)__time_to_milliseconds(time);
+}
+
+/**
+ * @brief Unpack the PackedTime into the Time object.
+ * @param packed_time The PackedTime.
+ * @return Returns the Time object.
+ */
+Time time_unpack(PackedTime packed_time) {
+    if (packed_time >= MILLISECONDS_PER_DAY) {
+        fprintf(stderr, "Error: packed time must be 0 ~ %d.\n", MILLISECONDS_PER_DAY - 1);
+        exit(EXIT_FAILURE);
     }
+    return __time_from_milliseconds((int)packed_time);
+}
 
-    return true;
+/**
+ * @brief Unpack the PackedTime into the Time object, reporting errors to the caller.
+ * @param packed_time The PackedTime.
+ * @param out The Time object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see time_unpack()
+ */
+DateTimeError time_unpack_checked(PackedTime packed_time, Time *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(packed_time < MILLISECONDS_PER_DAY, DATETIME_ERROR_RANGE);
+
+    *out = __time_from_milliseconds((int)packed_time);
+    return __set_error(DATETIME_OK);
 }
 
 /**
- * @brief Create a Time object.
- * @param hour The hour.
- * @param minute The minute.
- * @param second The second.
- * @param millisecond The millisecond.
+ * @brief Unpack the PackedTime into the Time object, without validating the arguments.
+ * @param packed_time The PackedTime.
  * @return Returns the Time object.
+ * @note The PackedTime must be in range.
+ * @see time_unpack()
  */
-Time time_create(int hour, int minute, int second, int millisecond) {
-    Time time;
-    time.hour = hour;
-    time.minute = minute;
-    time.second = second;
-    time.millisecond = millisecond;
-    exit_if_fail(__is_valid_time(time));
-    return time;
+Time time_unpack_unchecked(PackedTime packed_time) {
+    return __time_from_milliseconds((int)packed_time);
 }
 
 /**
- * @brief Get the current time.
- * @return Returns the Time object.
+ * @brief Pack the DateTime object into 64 bits (PackedDate:32 | PackedTime:32).
+ * @param datetime The DateTime object.
+ * @return Returns the PackedDateTime.
  */
-Time time_now() {
-    Time time;
+PackedDateTime datetime_pack(DateTime datetime) {
+    return ((PackedDateTime)date_pack(datetime.date) << PACKED_TIME_BITS) | time_pack(datetime.time);
+}
 
-#ifdef _WIN32
-    SYSTEMTIME st;
-#else
-    struct timeval tv;
-    struct tm *tm;
-#endif
+/**
+ * @brief Pack the DateTime object into 64 bits, reporting errors to the caller.
+ * @param datetime The DateTime object.
+ * @param out The PackedDateTime (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see datetime_pack()
+ */
+DateTimeError datetime_pack_checked(DateTime datetime, PackedDateTime *out) {
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail(__datetime_in_range(datetime), DATETIME_ERROR_RANGE);
 
-#ifdef _WIN32
-    GetLocalTime(&st);
-    time = time_create(st.wHour, st.wMinute, st.wSecond, st.wMilliseconds);
-#else
-    gettimeofday(&tv, NULL);
-    tm = localtime(&tv.tv_sec);
-    time = time_create(tm->tm_hour, tm->tm_min, tm->tm_sec, tv.tv_usec / MILLISECONDS_PER_SECOND);
-#endif
+    *out = datetime_pack_unchecked(datetime);
+    return __set_error(DATETIME_OK);
+}
 
-    return time;
+/**
+ * @brief Pack the DateTime object into 64 bits, without validating the arguments.
+ * @param datetime The DateTime object.
+ * @return Returns the PackedDateTime.
+ * @note The DateTime object must be valid.
+ * @see datetime_pack()
+ */
+PackedDateTime datetime_pack_unchecked(DateTime datetime) {
+    return ((PackedDateTime)date_pack_unchecked(datetime.date) << PACKED_TIME_BITS) | time_pack_unchecked(datetime.time);
 }
 
 /**
- * @brief Compare two Time objects.
- * @param time1 The first Time object.
- * @param time2 The second Time object.
- * @return Returns 1 if time1 is greater than time2.
- *         Returns -1 if time1 is less than time2.
- *         Returns 0 if time1 is equal to time2.
+ * @brief Unpack the PackedDateTime into the DateTime object.
+ * @param packed_datetime The PackedDateTime.
+ * @return Returns the DateTime object.
  */
-int time_compare(Time time1, Time time2) {
-    exit_if_fail(__is_valid_time(time1) && __is_valid_time(time2));
+DateTime datetime_unpack(PackedDateTime packed_datetime) {
+    DateTime datetime;
+    datetime.date = date_unpack((PackedDate)(packed_datetime >> PACKED_TIME_BITS));
+    datetime.time = time_unpack((PackedTime)packed_datetime);
+    return datetime;
+}
 
-    if (time1.hour > time2.hour) {
-        return 1;
-    } else if (time1.hour < time2.hour) {
-        return -1;
-    }
+/**
+ * @brief Unpack the PackedDateTime into the DateTime object, reporting errors to the caller.
+ * @param packed_datetime The PackedDateTime.
+ * @param out The DateTime object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see datetime_unpack()
+ */
+DateTimeError datetime_unpack_checked(PackedDateTime packed_datetime, DateTime *out) {
+    DateTime datetime;
+    return_error_if_fail(out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_error_if_fail((PackedTime)packed_datetime < MILLISECONDS_PER_DAY, DATETIME_ERROR_RANGE);
 
-    if (time1.minute > time2.minute) {
-        return 1;
-    } else if (time1.minute < time2.minute) {
-        return -1;
-    }
+    datetime = datetime_unpack_unchecked(packed_datetime);
+    return_error_if_fail(__date_in_range(datetime.date), DATETIME_ERROR_RANGE);
+
+    *out = datetime;
+    return __set_error(DATETIME_OK);
+}
+
+/**
+ * @brief Unpack the PackedDateTime into the DateTime object, without validating the arguments.
+ * @param packed_datetime The PackedDateTime.
+ * @return Returns the DateTime object.
+ * @note The PackedDateTime must hold a valid datetime.
+ * @see datetime_unpack()
+ */
+DateTime datetime_unpack_unchecked(PackedDateTime packed_datetime) {
+    DateTime datetime;
+    datetime.date = date_unpack_unchecked((PackedDate)(packed_datetime >> PACKED_TIME_BITS));
+    datetime.time = __time_from_milliseconds((int)(PackedTime)packed_datetime);
+    return datetime;
+}
 
-    if (time1.second > time2.second) {
-        return 1;
-    } else if (time1.second < time2.second) {
-        return -1;
+/**
+ * @brief Create a DateTimeColumn object.
+ * @param length The number of rows.
+ * @return Returns the DateTimeColumn object with all fields set to 0, or NULL if the length is too large
+ *         or the allocation fails.
+ * @note The caller must destroy the returned column with datetime_column_destroy().
+ */
+DateTimeColumn *datetime_column_create(size_t length) {
+    DateTimeColumn *column = NULL;
+    int *fields = NULL;
+
+    /* The seven fields share one allocation, whose size must not wrap */
+    return_value_if_fail(length <= (SIZE_MAX - 1) / 7, NULL);
+
+    column = (DateTimeColumn *)malloc(sizeof(DateTimeColumn));
+    return_value_if_fail(column != NULL, NULL);
+
+    fields = (int *)calloc(length * 7 + 1, sizeof(int));
+    if (fields == NULL) {
+        free(column);
+        return NULL;
     }
 
-    if (time1.millisecond > time2.millisecond) {
-        return 1;
-    } else if (time1.millisecond < time2.millisecond) {
-        return -1;
+    column->length = length;
+    column->years = fields;
+    column->months = fields + length;
+    column->days = fields + length * 2;
+    column->hours = fields + length * 3;
+    column->minutes = fields + length * 4;
+    column->seconds = fields + length * 5;
+    column->milliseconds = fields + length * 6;
+    return column;
+}
+
+/**
+ * @brief Create a DateTimeColumn object from the array of DateTime objects.
+ * @param datetimes The array of DateTime objects.
+ * @param length The number of DateTime objects.
+ * @return Returns the DateTimeColumn object, or NULL if the allocation fails.
+ * @note The caller must destroy the returned column with datetime_column_destroy().
+ */
+DateTimeColumn *datetime_column_from_array(const DateTime *datetimes, size_t length) {
+    DateTimeColumn *column = NULL;
+    size_t i;
+
+    return_value_if_fail(datetimes != NULL || length == 0, NULL);
+    column = datetime_column_create(length);
+    return_value_if_fail(column != NULL, NULL);
+
+    for (i = 0; i < length; i++) {
+        column->years[i] = datetimes[i].date.year;
+        column->months[i] = datetimes[i].date.month;
+        column->days[i] = datetimes[i].date.day;
+        column->hours[i] = datetimes[i].time.hour;
+        column->minutes[i] = datetimes[i].time.minute;
+        column->seconds[i] = datetimes[i].time.second;
+        column->milliseconds[i] = datetimes[i].time.millisecond;
     }
+    return column;
+}
 
-    return 0;
+/**
+ * @brief Destroy the DateTimeColumn object.
+ * @param column The DateTimeColumn object.
+ */
+void datetime_column_destroy(DateTimeColumn *column) {
+    return_if_fail(column != NULL);
+    free(column->years);
+    free(column);
 }
 
 /**
- * @brief Add seconds to the time.
- * @param time The Time object.
- * @param milliseconds The number of milliseconds to add/subtract.
- * @return Returns the new Time object.
+ * @brief Set the row of the DateTimeColumn object.
+ * @param column The DateTimeColumn object.
+ * @param index The row index.
+ * @param datetime The DateTime object.
  */
-Time time_add(Time time, int milliseconds) {
-    int total_milliseconds = 0;
-    exit_if_fail(__is_valid_time(time));
+void datetime_column_set(DateTimeColumn *column, size_t index, DateTime datetime) {
+    return_if_fail(column != NULL && index < column->length);
+    column->years[index] = datetime.date.year;
+    column->months[index] = datetime.date.month;
+    column->days[index] = datetime.date.day;
+    column->hours[index] = datetime.time.hour;
+    column->minutes[index] = datetime.time.minute;
+    column->seconds[index] = datetime.time.second;
+    column->milliseconds[index] = datetime.time.millisecond;
+}
+
+/**
+ * @brief Get the row of the DateTimeColumn object.
+ * @param column The DateTimeColumn object.
+ * @param index The row index.
+ * @return Returns the DateTime object.
+ */
+DateTime datetime_column_get(const DateTimeColumn *column, size_t index) {
+    DateTime datetime = {{0, 0, 0}, {0, 0, 0, 0}};
+    return_value_if_fail(column != NULL && index < column->length, datetime);
+
+    datetime.date.year = column->years[index];
+    datetime.date.month = column->months[index];
+    datetime.date.day = column->days[index];
+    datetime.time.hour = column->hours[index];
+    datetime.time.minute = column->minutes[index];
+    datetime.time.second = column->seconds[index];
+    datetime.time.millisecond = column->milliseconds[index];
+    return datetime;
+}
 
-    total_milliseconds = time.millisecond + milliseconds;
+/**
+ * @brief Convert the row of the DateTimeColumn object to the epoch value.
+ * @param column The DateTimeColumn object.
+ * @param index The row index.
+ * @param units_per_day The epoch units per day (SECONDS_PER_DAY or MILLISECONDS_PER_DAY).
+ * @return Returns the epoch value (since 1970-01-01 00:00:00.000 UTC).
+ */
+static int64_t __column_get_epoch(const DateTimeColumn *column, size_t index, int units_per_day) {
+    int64_t days = __days_from_civil(column->years[index], column->months[index], column->days[index]) - UNIX_EPOCH_ORDINAL;
+    int milliseconds = column->hours[index] * MILLISECONDS_PER_HOUR + column->minutes[index] * MILLISECONDS_PER_MINUTE + column->seconds[index] * MILLISECONDS_PER_SECOND + column->milliseconds[index];
+    return days * units_per_day + milliseconds / (MILLISECONDS_PER_DAY / units_per_day);
+}
 
-    if (total_milliseconds < 0) {
-        time.second += total_milliseconds / MILLISECONDS_PER_SECOND - 1;
-        time.millisecond = total_milliseconds % MILLISECONDS_PER_SECOND + MILLISECONDS_PER_SECOND;
-    } else {
-        time.second += total_milliseconds / MILLISECONDS_PER_SECOND;
-        time.millisecond = total_milliseconds % MILLISECONDS_PER_SECOND;
-    }
+/**
+ * @brief Set the row of the DateTimeColumn object from the epoch value.
+ * @param column The DateTimeColumn object.
+ * @param index The row index.
+ * @param value The epoch value (since 1970-01-01 00:00:00.000 UTC).
+ * @param min_value The minimum epoch value (0001-01-01 00:00:00.000 UTC).
+ * @param max_value The maximum epoch value (9999-12-31 23:59:59.999 UTC).
+ * @param units_per_day The epoch units per day (SECONDS_PER_DAY or MILLISECONDS_PER_DAY).
+ * @return Returns true if the value is in range, otherwise returns false and leaves the row unchanged.
+ */
+static bool __column_set_epoch(DateTimeColumn *column, size_t index, int64_t value, int64_t min_value, int64_t max_value, int units_per_day) {
+    int64_t days;
+    int milliseconds;
+
+    return_value_if(value < min_value || value > max_value, false);
+
+    days = value / units_per_day;
+    milliseconds = (int)(value % units_per_day);
+    days -= milliseconds < 0;
+    milliseconds += (milliseconds < 0) * units_per_day;
+    milliseconds *= MILLISECONDS_PER_DAY / units_per_day;
+
+    __civil_from_days((int)days + UNIX_EPOCH_ORDINAL, &column->years[index], &column->months[index], &column->days[index]);
+    column->hours[index] = milliseconds / MILLISECONDS_PER_HOUR;
+    column->minutes[index] = milliseconds / MILLISECONDS_PER_MINUTE % MINUTES_PER_HOUR;
+    column->seconds[index] = milliseconds / MILLISECONDS_PER_SECOND % SECONDS_PER_MINUTE;
+    column->milliseconds[index] = milliseconds % MILLISECONDS_PER_SECOND;
+    return true;
+}
 
-    if (time.second < 0) {
-        time.minute += time.second / SECONDS_PER_MINUTE - 1;
-        time.second = time.second % SECONDS_PER_MINUTE + SECONDS_PER_MINUTE;
-    } else {
-        time.minute += time.second / SECONDS_PER_MINUTE;
-        time.second = time.second % SECONDS_PER_MINUTE;
-    }
+#ifdef DATETIME_AVX2
+/**
+ * @brief Determine whether the CPU supports AVX2. The result is cached after the first call.
+ * @return Returns true if the CPU supports AVX2, otherwise returns false.
+ */
+static bool __cpu_has_avx2(void) {
+    static int has_avx2 = -1;
 
-    if (time.minute < 0) {
-        time.hour += time.minute / MINUTES_PER_HOUR - 1;
-        time.minute = time.minute % MINUTES_PER_HOUR + MINUTES_PER_HOUR;
-    } else {
-        time.hour += time.minute / MINUTES_PER_HOUR;
-        time.minute = time.minute % MINUTES_PER_HOUR;
+    if (has_avx2 < 0) {
+        __builtin_cpu_init();
+        has_avx2 = __builtin_cpu_supports("avx2") ? 1 : 0;
     }
-
-    time.hour = (time.hour + HOURS_PER_DAY) % HOURS_PER_DAY;
-    return time;
+    return has_avx2;
 }
 
 /**
- * @brief Get the milliseconds between two Time objects.
- * @param time1 The first Time object.
- * @param time2 The second Time object.
- * @return Returns the milliseconds between two Time objects.
+ * @brief Divide 8 non-negative 32-bit lanes by the constant with a multiply and a shift.
+ * @param x The dividends.
+ * @param divisor The divisor.
+ * @param shift The shift (>= 32). It must be large enough to make the quotient exact for every dividend used.
+ * @return Returns the quotients.
  */
-int time_diff(Time time1, Time time2) {
-    int milliseconds1;
-    int milliseconds2;
-    exit_if_fail(__is_valid_time(time1) && __is_valid_time(time2));
+TARGET_AVX2 static __m256i __mm256_div_epu32(__m256i x, uint32_t divisor, int shift) {
+    const __m256i magic = _mm256_set1_epi32((int)(uint32_t)((((uint64_t)1 << shift) + divisor - 1) / divisor));
+    const __m128i count = _mm_cvtsi32_si128(shift);
+    __m256i even = _mm256_srl_epi64(_mm256_mul_epu32(x, magic), count);
+    __m256i odd = _mm256_srl_epi64(_mm256_mul_epu32(_mm256_srli_epi64(x, 32), magic), count);
+    return _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+}
 
-    milliseconds1 = (time1.hour * MINUTES_PER_HOUR * SECONDS_PER_MINUTE + time1.minute * SECONDS_PER_MINUTE + time1.second) * MILLISECONDS_PER_SECOND + time1.millisecond;
-    milliseconds2 = (time2.hour * MINUTES_PER_HOUR * SECONDS_PER_MINUTE + time2.minute * SECONDS_PER_MINUTE + time2.second) * MILLISECONDS_PER_SECOND + time2.millisecond;
-    return milliseconds1 - milliseconds2;
+/**
+ * @brief Multiply 8 32-bit lanes by the constant.
+ */
+TARGET_AVX2 static __m256i __mm256_mul_const(__m256i x, int factor) {
+    return _mm256_mullo_epi32(x, _mm256_set1_epi32(factor));
 }
 
 /**
- * @brief Get the string representation (hh:mm:ss.fff) of the time.
- * @param time The Time object.
- * @return Returns the string representation of the time.
- * @note The caller must free the returned string.
+ * @brief Determine which of 8 32-bit lanes are out of the range min_value ~ max_value.
+ * @return Returns all ones in the lanes out of range, and zeros in the others.
  */
-char *time_to_string(Time time) {
-    char *time_string = NULL;
-    return_value_if_fail(__is_valid_time(time), NULL);
+TARGET_AVX2 static __m256i __mm256_out_of_range(__m256i x, int min_value, int max_value) {
+    return _mm256_or_si256(_mm256_cmpgt_epi32(_mm256_set1_epi32(min_value), x), _mm256_cmpgt_epi32(x, _mm256_set1_epi32(max_value)));
+}
 
-    time_string = (char *)malloc(sizeof(char) * 13);
-    return_value_if_fail(time_string != NULL, NULL);
+/**
+ * @brief Vectorized __civil_from_days() for 8 day numbers in 1 ~ MAX_ORDINAL.
+ */
+TARGET_AVX2 static void __mm256_civil_from_days(__m256i days, __m256i *year, __m256i *month, __m256i *day) {
+    __m256i z;
+    __m256i era;
+    __m256i doe;
+    __m256i yoe;
+    __m256i doy;
+    __m256i mp;
+
+    z = _mm256_add_epi32(days, _mm256_set1_epi32(ORDINAL_SHIFT));
+    era = __mm256_div_epu32(z, DAYS_PER_400_YEARS, 39);
+    doe = _mm256_sub_epi32(z, __mm256_mul_const(era, DAYS_PER_400_YEARS));
+    yoe = _mm256_sub_epi32(doe, __mm256_div_epu32(doe, 1460, 32));
+    yoe = _mm256_add_epi32(yoe, __mm256_div_epu32(doe, 36524, 33));
+    yoe = _mm256_sub_epi32(yoe, __mm256_div_epu32(doe, DAYS_PER_400_YEARS - 1, 35));
+    yoe = __mm256_div_epu32(yoe, DAYS_IN_COMMON_YEAR, 32);
+    doy = _mm256_add_epi32(__mm256_mul_const(yoe, DAYS_IN_COMMON_YEAR), __mm256_div_epu32(yoe, 4, 32));
+    doy = _mm256_sub_epi32(doe, _mm256_sub_epi32(doy, __mm256_div_epu32(yoe, 100, 32)));
+    mp = __mm256_div_epu32(_mm256_add_epi32(__mm256_mul_const(doy, 5), _mm256_set1_epi32(2)), 153, 32);
+
+    *day = _mm256_add_epi32(__mm256_mul_const(mp, 153), _mm256_set1_epi32(2));
+    *day = _mm256_sub_epi32(_mm256_add_epi32(doy, _mm256_set1_epi32(1)), __mm256_div_epu32(*day, 5, 32));
+    *month = _mm256_add_epi32(mp, _mm256_set1_epi32(3));
+    *month = _mm256_sub_epi32(*month, _mm256_and_si256(_mm256_cmpgt_epi32(mp, _mm256_set1_epi32(9)), _mm256_set1_epi32(MONTHS_PER_YEAR)));
+    *year = _mm256_add_epi32(yoe, __mm256_mul_const(era, 400));
+    *year = _mm256_sub_epi32(*year, _mm256_cmpgt_epi32(_mm256_set1_epi32(MAR), *month));
+}
 
-    sprintf(time_string, "%02d:%02d:%02d.%03d", time.hour, time.minute, time.second, time.millisecond);
-    return time_string;
+/**
+ * @brief Vectorized __days_from_civil() for 8 valid dates.
+ */
+TARGET_AVX2 static __m256i __mm256_days_from_civil(__m256i year, __m256i month, __m256i day) {
+    __m256i before_mar;
+    __m256i era;
+    __m256i yoe;
+    __m256i doy;
+    __m256i doe;
+
+    before_mar = _mm256_cmpgt_epi32(_mm256_set1_epi32(MAR), month);
+    year = _mm256_add_epi32(year, before_mar);
+    era = __mm256_div_epu32(year, 400, 32);
+    yoe = _mm256_sub_epi32(year, __mm256_mul_const(era, 400));
+    month = _mm256_add_epi32(_mm256_sub_epi32(month, _mm256_set1_epi32(3)), _mm256_and_si256(before_mar, _mm256_set1_epi32(MONTHS_PER_YEAR)));
+    doy = __mm256_div_epu32(_mm256_add_epi32(__mm256_mul_const(month, 153), _mm256_set1_epi32(2)), 5, 32);
+    doy = _mm256_add_epi32(doy, _mm256_sub_epi32(day, _mm256_set1_epi32(1)));
+    doe = _mm256_add_epi32(__mm256_mul_const(yoe, DAYS_IN_COMMON_YEAR), __mm256_div_epu32(yoe, 4, 32));
+    doe = _mm256_add_epi32(_mm256_sub_epi32(doe, __mm256_div_epu32(yoe, 100, 32)), doy);
+    return _mm256_sub_epi32(_mm256_add_epi32(__mm256_mul_const(era, DAYS_PER_400_YEARS), doe), _mm256_set1_epi32(ORDINAL_SHIFT));
 }
 
 /**
- * @brief Get the string representation (hh:mm:ss) of the time.
- * @param time The Time object.
- * @return Returns the string representation of the time.
- * @note The caller must free the returned string.
+ * @brief Split 4 epoch values into day numbers and units since midnight.
+ * @param values The epoch values, each in min_value ~ min_value + 2^52.
+ * @param min_value The epoch value of 0001-01-01 00:00:00.000 UTC.
+ * @param units_per_day The epoch units per day.
+ * @param days The day numbers (output, 0001-01-01 is day 1).
+ * @param remainders The units since midnight (output).
  */
-char *time_ascii_string(Time time) {
-    char *time_string = NULL;
-    struct tm tm = {0};
-    return_value_if_fail(__is_valid_time(time), NULL);
+TARGET_AVX2 static void __mm256_split_epoch(__m256i values, int64_t min_value, int units_per_day, __m128i *days, __m128i *remainders) {
+    const __m256d TWO_POW_52 = _mm256_set1_pd(4503599627370496.0);
+    __m256i offsets;
+    __m256d offsets_pd;
+    __m128i quotients;
+
+    /* offsets < 2^52, so OR-ing in the exponent of 2^52 converts them to double exactly. */
+    offsets = _mm256_sub_epi64(values, _mm256_set1_epi64x(min_value));
+    offsets_pd = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(offsets, _mm256_castpd_si256(TWO_POW_52))), TWO_POW_52);
+    quotients = _mm256_cvttpd_epi32(_mm256_floor_pd(_mm256_div_pd(offsets_pd, _mm256_set1_pd(units_per_day))));
+
+    offsets = _mm256_sub_epi64(offsets, _mm256_mul_epu32(_mm256_cvtepu32_epi64(quotients), _mm256_set1_epi64x(units_per_day)));
+    *remainders = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(offsets, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)));
+    *days = _mm_add_epi32(quotients, _mm_set1_epi32(1));
+}
 
-    tm.tm_hour = time.hour;
-    tm.tm_min = time.minute;
-    tm.tm_sec = time.second;
+/**
+ * @brief Set 8 rows of the DateTimeColumn object from the epoch values.
+ * @return Returns true if every value is in range, otherwise returns false and leaves the rows unchanged.
+ * @see __column_set_epoch()
+ */
+TARGET_AVX2 static bool __mm256_column_set_epoch(DateTimeColumn *column, size_t index, const int64_t *values, int64_t min_value, int64_t max_value, int units_per_day) {
+    __m256i low = _mm256_loadu_si256((const __m256i *)values);
+    __m256i high = _mm256_loadu_si256((const __m256i *)(values + 4));
+    __m256i min_values = _mm256_set1_epi64x(min_value);
+    __m256i max_values = _mm256_set1_epi64x(max_value);
+    __m256i out_of_range;
+    __m128i days_low;
+    __m128i days_high;
+    __m128i remainders_low;
+    __m128i remainders_high;
+    __m256i days;
+    __m256i milliseconds;
+    __m256i seconds;
+    __m256i minutes;
+    __m256i year;
+    __m256i month;
+    __m256i day;
+    __m256i hour;
+
+    out_of_range = _mm256_or_si256(_mm256_cmpgt_epi64(min_values, low), _mm256_cmpgt_epi64(low, max_values));
+    out_of_range = _mm256_or_si256(out_of_range, _mm256_cmpgt_epi64(min_values, high));
+    out_of_range = _mm256_or_si256(out_of_range, _mm256_cmpgt_epi64(high, max_values));
+    return_value_if_fail(_mm256_testz_si256(out_of_range, out_of_range), false);
+
+    __mm256_split_epoch(low, min_value, units_per_day, &days_low, &remainders_low);
+    __mm256_split_epoch(high, min_value, units_per_day, &days_high, &remainders_high);
+    days = _mm256_inserti128_si256(_mm256_castsi128_si256(days_low), days_high, 1);
+    milliseconds = _mm256_inserti128_si256(_mm256_castsi128_si256(remainders_low), remainders_high, 1);
+    milliseconds = __mm256_mul_const(milliseconds, MILLISECONDS_PER_DAY / units_per_day);
+
+    __mm256_civil_from_days(days, &year, &month, &day);
+    seconds = __mm256_div_epu32(milliseconds, MILLISECONDS_PER_SECOND, 36);
+    minutes = __mm256_div_epu32(milliseconds, MILLISECONDS_PER_MINUTE, 39);
+    hour = __mm256_div_epu32(milliseconds, MILLISECONDS_PER_HOUR, 47);
+
+    _mm256_storeu_si256((__m256i *)(column->years + index), year);
+    _mm256_storeu_si256((__m256i *)(column->months + index), month);
+    _mm256_storeu_si256((__m256i *)(column->days + index), day);
+    _mm256_storeu_si256((__m256i *)(column->hours + index), hour);
+    _mm256_storeu_si256((__m256i *)(column->minutes + index), _mm256_sub_epi32(minutes, __mm256_mul_const(hour, MINUTES_PER_HOUR)));
+    _mm256_storeu_si256((__m256i *)(column->seconds + index), _mm256_sub_epi32(seconds, __mm256_mul_const(minutes, SECONDS_PER_MINUTE)));
+    _mm256_storeu_si256((__m256i *)(column->milliseconds + index), _mm256_sub_epi32(milliseconds, __mm256_mul_const(seconds, MILLISECONDS_PER_SECOND)));
+    return true;
+}
 
-    time_string = (char *)calloc(9, sizeof(char));
-    return_value_if_fail(time_string != NULL, NULL);
+/**
+ * @brief Convert 8 valid rows of the DateTimeColumn object to the epoch values.
+ * @see __column_get_epoch()
+ */
+TARGET_AVX2 static void __mm256_column_get_epoch(const DateTimeColumn *column, size_t index, int units_per_day, int64_t *values) {
+    __m256i days;
+    __m256i milliseconds;
+
+    days = __mm256_days_from_civil(_mm256_loadu_si256((const __m256i *)(column->years + index)),
+                                   _mm256_loadu_si256((const __m256i *)(column->months + index)),
+                                   _mm256_loadu_si256((const __m256i *)(column->days + index)));
+    days = _mm256_sub_epi32(days, _mm256_set1_epi32(UNIX_EPOCH_ORDINAL));
+
+    milliseconds = __mm256_mul_const(_mm256_loadu_si256((const __m256i *)(column->hours + index)), MILLISECONDS_PER_HOUR);
+    milliseconds = _mm256_add_epi32(milliseconds, __mm256_mul_const(_mm256_loadu_si256((const __m256i *)(column->minutes + index)), MILLISECONDS_PER_MINUTE));
+    milliseconds = _mm256_add_epi32(milliseconds, __mm256_mul_const(_mm256_loadu_si256((const __m256i *)(column->seconds + index)), MILLISECONDS_PER_SECOND));
+    milliseconds = _mm256_add_epi32(milliseconds, _mm256_loadu_si256((const __m256i *)(column->milliseconds + index)));
+    if (units_per_day == SECONDS_PER_DAY) {
+        milliseconds = __mm256_div_epu32(milliseconds, MILLISECONDS_PER_SECOND, 36);
+    }
 
-    strftime(time_string, 9, "%H:%M:%S", &tm);
-    return time_string;
+    _mm256_storeu_si256((__m256i *)values, _mm256_add_epi64(_mm256_mul_epi32(_mm256_cvtepi32_epi64(_mm256_castsi256_si128(days)), _mm256_set1_epi64x(units_per_day)),
+                                                             _mm256_cvtepi32_epi64(_mm256_castsi256_si128(milliseconds))));
+    _mm256_storeu_si256((__m256i *)(values + 4), _mm256_add_epi64(_mm256_mul_epi32(_mm256_cvtepi32_epi64(_mm256_extracti128_si256(days, 1)), _mm256_set1_epi64x(units_per_day)),
+                                                                   _mm256_cvtepi32_epi64(_mm256_extracti128_si256(milliseconds, 1))));
 }
 
 /**
- * @brief Determine whether the datetime is valid.
- * @param datetime The DateTime object.
- * @return Returns true if the datetime is valid, otherwise returns false.
+ * @brief Validate 8 rows of the DateTimeColumn object.
+ * @return Returns the 8-bit mask of the valid rows, bit j for the row index + j.
+ * @see __is_valid_datetime_fields()
  */
-static bool __is_valid_datetime(DateTime datetime) {
-    return __is_valid_date(datetime.date) && __is_valid_time(datetime.time);
+TARGET_AVX2 static int __mm256_column_valid_rows(const DateTimeColumn *column, size_t index) {
+    const __m256i DAYS_IN_MONTH_LOW = _mm256_setr_epi32(0, 31, 28, 31, 30, 31, 30, 31);
+    const __m256i DAYS_IN_MONTH_HIGH = _mm256_setr_epi32(31, 30, 31, 30, 31, 0, 0, 0);
+    const __m256i ONE = _mm256_set1_epi32(1);
+    __m256i year = _mm256_loadu_si256((const __m256i *)(column->years + index));
+    __m256i month = _mm256_loadu_si256((const __m256i *)(column->months + index));
+    __m256i day = _mm256_loadu_si256((const __m256i *)(column->days + index));
+    __m256i inverse;
+    __m256i leap;
+    __m256i month_days;
+    __m256i invalid;
+
+    invalid = __mm256_out_of_range(year, MIN_YEAR, MAX_YEAR);
+    invalid = _mm256_or_si256(invalid, __mm256_out_of_range(month, JAN, DEC));
+    invalid = _mm256_or_si256(invalid, __mm256_out_of_range(_mm256_loadu_si256((const __m256i *)(column->hours + index)), 0, HOURS_PER_DAY - 1));
+    invalid = _mm256_or_si256(invalid, __mm256_out_of_range(_mm256_loadu_si256((const __m256i *)(column->minutes + index)), 0, MINUTES_PER_HOUR - 1));
+    invalid = _mm256_or_si256(invalid, __mm256_out_of_range(_mm256_loadu_si256((const __m256i *)(column->seconds + index)), 0, SECONDS_PER_MINUTE - 1));
+    invalid = _mm256_or_si256(invalid, __mm256_out_of_range(_mm256_loadu_si256((const __m256i *)(column->milliseconds + index)), 0, MILLISECONDS_PER_SECOND - 1));
+
+    /* year is a multiple of 25 iff year * 25^-1 (mod 2^32) <= (2^32 - 1) / 25, so no division is needed. */
+    inverse = __mm256_mul_const(year, (int)0xC28F5C29u);
+    leap = _mm256_cmpeq_epi32(_mm256_min_epu32(inverse, _mm256_set1_epi32(0x0A3D70A3)), inverse);
+    leap = _mm256_andnot_si256(leap, _mm256_set1_epi32(-1));
+    leap = _mm256_or_si256(leap, _mm256_cmpeq_epi32(_mm256_and_si256(year, _mm256_set1_epi32(15)), _mm256_setzero_si256()));
+    leap = _mm256_and_si256(leap, _mm256_cmpeq_epi32(_mm256_and_si256(year, _mm256_set1_epi32(3)), _mm256_setzero_si256()));
+
+    /* Look the months up in two 8-entry tables, then add the leap day to February. */
+    month_days = _mm256_blendv_epi8(_mm256_permutevar8x32_epi32(DAYS_IN_MONTH_LOW, month), _mm256_permutevar8x32_epi32(DAYS_IN_MONTH_HIGH, month),
+                                    _mm256_cmpgt_epi32(month, _mm256_set1_epi32(AUG - 1)));
+    month_days = _mm256_add_epi32(month_days, _mm256_and_si256(_mm256_and_si256(leap, _mm256_cmpeq_epi32(month, _mm256_set1_epi32(FEB))), ONE));
+    invalid = _mm256_or_si256(invalid, _mm256_cmpgt_epi32(ONE, day));
+    invalid = _mm256_or_si256(invalid, _mm256_cmpgt_epi32(day, month_days));
+
+    return ~_mm256_movemask_ps(_mm256_castsi256_ps(invalid)) & ((1 << AVX2_LANES) - 1);
 }
 
 /**
- * @brief Create a DateTime object.
- * @param year The year.
- * @param month The month.
- * @param day The day.
- * @param hour The hour.
- * @param minute The minute.
- * @param second The second.
- * @param millisecond The millisecond.
- * @return Returns the Date object.
+ * @brief Determine the day of the week of 8 valid day numbers.
+ * @return Returns the weekdays, days % 7 computed with a multiply and a shift.
  */
-DateTime datetime_create(int year, int month, int day, int hour, int minute, int second, int millisecond) {
-    DateTime datetime;
-    datetime.date = date_create(year, month, day);
-    datetime.time = time_create(hour, minute, second, millisecond);
-    exit_if_fail(__is_valid_datetime(datetime));
-    return datetime;
+TARGET_AVX2 static __m256i __mm256_weekday_from_days(__m256i days) {
+    return _mm256_sub_epi32(days, __mm256_mul_const(__mm256_div_epu32(days, DAYS_IN_WEEK, 34), DAYS_IN_WEEK));
 }
 
 /**
- * @brief Get the current datetime.
- * @return Returns the DateTime object.
+ * @brief Determine the day of the week of 8 valid Date objects.
+ * @param dates The 8 Date objects.
+ * @param weekdays The 8 weekdays (output).
  */
-DateTime datetime_now() {
-    DateTime datetime;
-    datetime.date = date_now();
-    datetime.time = time_now();
-    return datetime;
+TARGET_AVX2 static void __mm256_weekday_many(const Date *dates, Weekday *weekdays) {
+    /* 8 Date objects are 24 ints: split them into the years, the months and the days, 8 of each. */
+    __m256i a = _mm256_loadu_si256((const __m256i *)dates);
+    __m256i b = _mm256_loadu_si256((const __m256i *)dates + 1);
+    __m256i c = _mm256_loadu_si256((const __m256i *)dates + 2);
+    __m256i year = _mm256_blend_epi32(_mm256_blend_epi32(a, b, 0x92), c, 0x24);
+    __m256i month = _mm256_blend_epi32(_mm256_blend_epi32(a, b, 0x24), c, 0x49);
+    __m256i day = _mm256_blend_epi32(_mm256_blend_epi32(a, b, 0x49), c, 0x92);
+
+    year = _mm256_permutevar8x32_epi32(year, _mm256_setr_epi32(0, 3, 6, 1, 4, 7, 2, 5));
+    month = _mm256_permutevar8x32_epi32(month, _mm256_setr_epi32(1, 4, 7, 2, 5, 0, 3, 6));
+    day = _mm256_permutevar8x32_epi32(day, _mm256_setr_epi32(2, 5, 0, 3, 6, 1, 4, 7));
+    _mm256_storeu_si256((__m256i *)weekdays, __mm256_weekday_from_days(__mm256_days_from_civil(year, month, day)));
 }
 
 /**
- * @brief Create a DateTime object from the Unix timestamp (since 1970-01-01 00:00:00 UTC).
- * @param timestamp The Unix timestamp. The range of timestamp is 0 ~ 2147483647 (2038-01-19 03:14:07 UTC).
- * @return Returns the DateTime object.
+ * @brief Determine the day of the week of 8 valid rows of the DateTimeColumn object.
+ * @param column The DateTimeColumn object.
+ * @param index The first row.
+ * @param weekdays The 8 weekdays (output).
  */
-DateTime datetime_from_timestamp(time_t timestamp) {
-    DateTime datetime;
-    struct tm *tm = NULL;
-
-    const time_t MAX_TIMESTAMP = 2147483647;
-    if (timestamp > MAX_TIMESTAMP) {
-        fprintf(stderr, "Error: timestamp must be less than or equal to %ld.\n", (long)MAX_TIMESTAMP);
-        exit(EXIT_FAILURE);
-    }
-
-    tm = gmtime(&timestamp);
-    datetime.date = date_create(tm->tm_year + 1900, tm->tm_mon + 1, tm->tm_mday);
-    datetime.time = time_create(tm->tm_hour, tm->tm_min, tm->tm_sec, 0);
-    return datetime;
+TARGET_AVX2 static void __mm256_column_weekday(const DateTimeColumn *column, size_t index, Weekday *weekdays) {
+    __m256i days = __mm256_days_from_civil(_mm256_loadu_si256((const __m256i *)(column->years + index)),
+                                           _mm256_loadu_si256((const __m256i *)(column->months + index)),
+                                           _mm256_loadu_si256((const __m256i *)(column->days + index)));
+    _mm256_storeu_si256((__m256i *)weekdays, __mm256_weekday_from_days(days));
 }
+#endif
 
 /**
- * @brief Convert the DateTime object to the Unix timestamp (since 1970-01-01 00:00:00 UTC).
- * @param datetime The DateTime object.
- * @return Returns the Unix timestamp.
+ * @brief Convert every row of the DateTimeColumn object to the epoch values, 8 rows at a time on AVX2.
+ * @param column The DateTimeColumn object. Every row must be valid.
+ * @param units_per_day The epoch units per day (SECONDS_PER_DAY or MILLISECONDS_PER_DAY).
+ * @param values The array of column->length epoch values (output).
  */
-time_t datetime_to_timestamp(DateTime datetime) {
-    const int SECONDS_PER_COMMON_YEAR = DAYS_IN_COMMON_YEAR * SECONDS_PER_DAY;
-    const int SECONDS_PER_LEAP_YEAR = DAYS_IN_LEAP_YEAR * SECONDS_PER_DAY;
-
-    int years_passed = 0;
-    int leap_years_passed = 0;
-    int non_leap_years_passed = 0;
-    time_t seconds_passed = 0;
-    int days_passed_current_year = 0;
-    int year;
-
-    exit_if_fail(__is_valid_datetime(datetime));
-
-    years_passed = datetime.date.year - 1970;
+static void __column_to_epoch(const DateTimeColumn *column, int units_per_day, int64_t *values) {
+    size_t i = 0;
 
-    for (year = 1970; year < datetime.date.year; year++) {
-        if (is_leap_year(year)) {
-            leap_years_passed++;
+#ifdef DATETIME_AVX2
+    if (__cpu_has_avx2()) {
+        for (; i + AVX2_LANES <= column->length; i += AVX2_LANES) {
+            __mm256_column_get_epoch(column, i, units_per_day, values + i);
         }
     }
-    non_leap_years_passed = years_passed - leap_years_passed;
-
-    seconds_passed = ((time_t)non_leap_years_passed * SECONDS_PER_COMMON_YEAR) + ((time_t)leap_years_passed * SECONDS_PER_LEAP_YEAR);
-
-    days_passed_current_year = nth_day_of_year(datetime.date.year, datetime.date.month, datetime.date.day) - 1;
-    seconds_passed += ((time_t)days_passed_current_year * SECONDS_PER_DAY) + (datetime.time.hour * SECONDS_PER_HOUR) + (datetime.time.minute * SECONDS_PER_MINUTE) + datetime.time.second;
+#endif
 
-    return seconds_passed;
+    for (; i < column->length; i++) {
+        values[i] = __column_get_epoch(column, i, units_per_day);
+    }
 }
 
 /**
- * @brief Create a DateTime object from the ordinal (since 0001-01-01 00:00:00).
- * @param ordinal The ordinal.
- * @return Returns the DateTime object.
+ * @brief Fill every row of the DateTimeColumn object from the epoch values, 8 rows at a time on AVX2.
+ * @param column The DateTimeColumn object.
+ * @param values The array of column->length epoch values.
+ * @param min_value The minimum epoch value (0001-01-01 00:00:00.000 UTC).
+ * @param max_value The maximum epoch value (9999-12-31 23:59:59.999 UTC).
+ * @param units_per_day The epoch units per day (SECONDS_PER_DAY or MILLISECONDS_PER_DAY).
+ * @return Returns true if every value is in range, otherwise returns false.
  */
-DateTime datetime_from_ordinal(int ordinal) {
-    DateTime datetime;
-    int year = 1;
-    int month = JAN;
-    int days = 0;
-
-    if (ordinal <= 0) {
-        fprintf(stderr, "Error: ordinal must be greater than 0.\n");
-        exit(EXIT_FAILURE);
+static bool __column_from_epoch(DateTimeColumn *column, const int64_t *values, int64_t min_value, int64_t max_value, int units_per_day) {
+    bool all_valid = true;
+    size_t i = 0;
+    size_t j;
+
+#ifdef DATETIME_AVX2
+    if (__cpu_has_avx2()) {
+        for (; i + AVX2_LANES <= column->length; i += AVX2_LANES) {
+            if (!__mm256_column_set_epoch(column, i, values + i, min_value, max_value, units_per_day)) {
+                for (j = i; j < i + AVX2_LANES; j++) {
+                    all_valid &= __column_set_epoch(column, j, values[j], min_value, max_value, units_per_day);
+                }
+            }
+        }
     }
+#endif
 
-    while (ordinal > 0) {
-        days = days_in_year(year);
+    for (j = i; j < column->length; j++) {
+        all_valid &= __column_set_epoch(column, j, values[j], min_value, max_value, units_per_day);
+    }
+    return all_valid;
+}
 
-        if (ordinal >= days) {
-            ordinal -= days;
-            year++;
-        } else {
-            for (month = JAN; month <= DEC; month++) {
-                days = days_in_month(year, month);
-                if (ordinal >= days) {
-                    ordinal -= days;
-                } else {
-                    break;
+/**
+ * @brief Validate every row of the DateTimeColumn object.
+ * @param column The DateTimeColumn object.
+ * @param valid The array of column->length results (output), 1 for a valid row and 0 otherwise, can be NULL.
+ *              An int array rather than bool, so that C and C++ agree on its layout.
+ * @return Returns the number of valid rows.
+ * @note Nothing is printed to stderr for invalid rows. Runs 8 rows at a time with AVX2 when the CPU supports it.
+ */
+size_t datetime_column_validate(const DateTimeColumn *column, int *valid) {
+    size_t count = 0;
+    size_t i = 0;
+    size_t j;
+    bool row_valid;
+
+    return_value_if_fail(column != NULL, 0);
+
+#ifdef DATETIME_AVX2
+    if (__cpu_has_avx2()) {
+        int rows;
+        for (; i + AVX2_LANES <= column->length; i += AVX2_LANES) {
+            rows = __mm256_column_valid_rows(column, i);
+            count += (size_t)__builtin_popcount(rows);
+            if (valid != NULL) {
+                for (j = 0; j < AVX2_LANES; j++) {
+                    valid[i + j] = (rows >> j) & 1;
                 }
             }
-            break;
         }
     }
+#endif
 
-    datetime.date = date_create(year, month, ordinal);
-    datetime.time = time_create(0, 0, 0, 0);
-    return datetime;
+    for (j = i; j < column->length; j++) {
+        row_valid = __is_valid_datetime_fields(column->years[j], column->months[j], column->days[j], column->hours[j], column->minutes[j], column->seconds[j], column->milliseconds[j]);
+        count += row_valid;
+        if (valid != NULL) {
+            valid[j] = row_valid;
+        }
+    }
+    return count;
 }
 
 /**
- * @brief Convert the DateTime object to the ordinal (since 0001-01-01 00:00:00).
- * @param datetime The DateTime object.
- * @return Returns the ordinal.
+ * @brief Validate every row of the DateTimeColumn object into a packed bitmask.
+ * @param column The DateTimeColumn object.
+ * @param mask The array of DATETIME_MASK_WORDS(column->length) words (output). Bit i % 64 of mask[i / 64] is set
+ *             if the row i is valid. The unused bits of the last word are cleared.
+ * @return Returns the number of valid rows.
+ * @note The rules are the same as datetime_column_validate(). Nothing is printed to stderr for invalid rows.
+ *       Runs 8 rows at a time with AVX2 when the CPU supports it.
  */
-int datetime_to_ordinal(DateTime datetime) {
-    int ordinal = 0;
-    int year;
-    int month;
-    exit_if_fail(__is_valid_datetime(datetime));
+size_t datetime_column_validate_mask(const DateTimeColumn *column, uint64_t *mask) {
+    size_t count = 0;
+    size_t i = 0;
+    bool row_valid;
+
+    return_value_if_fail(column != NULL && mask != NULL, 0);
+    memset(mask, 0, DATETIME_MASK_WORDS(column->length) * sizeof(uint64_t));
+
+#ifdef DATETIME_AVX2
+    if (__cpu_has_avx2()) {
+        int rows;
+        for (; i + AVX2_LANES <= column->length; i += AVX2_LANES) {
+            rows = __mm256_column_valid_rows(column, i);
+            count += (size_t)__builtin_popcount(rows);
+            mask[i / 64] |= (uint64_t)rows << (i % 64);
+        }
+    }
+#endif
 
-    for (year = 1; year < datetime.date.year; year++) {
-        ordinal += days_in_year(year);
+    for (; i < column->length; i++) {
+        row_valid = __is_valid_datetime_fields(column->years[i], column->months[i], column->days[i], column->hours[i], column->minutes[i], column->seconds[i], column->milliseconds[i]);
+        count += row_valid;
+        mask[i / 64] |= (uint64_t)row_valid << (i % 64);
     }
+    return count;
+}
+
+/**
+ * @brief Convert every row of the DateTimeColumn object to the Unix timestamp.
+ * @param column The DateTimeColumn object. Every row must be valid (see datetime_column_validate()).
+ * @param timestamps The array of column->length Unix timestamps (output).
+ * @note Runs 8 rows at a time with AVX2 when the CPU supports it.
+ */
+void datetime_column_to_timestamp(const DateTimeColumn *column, time_t *timestamps) {
+    size_t i;
 
-    for (month = JAN; month < datetime.date.month; month++) {
-        ordinal += days_in_month(datetime.date.year, month);
+    return_if_fail(column != NULL && timestamps != NULL);
+
+    if (sizeof(time_t) == sizeof(int64_t)) {
+        __column_to_epoch(column, SECONDS_PER_DAY, (int64_t *)timestamps);
+        return;
     }
 
-    ordinal += datetime.date.day;
-    return ordinal;
+    for (i = 0; i < column->length; i++) {
+        timestamps[i] = (time_t)__column_get_epoch(column, i, SECONDS_PER_DAY);
+    }
 }
 
 /**
- * @brief Compare two DateTime objects.
- * @param datetime1 The first DateTime object.
- * @param datetime2 The second DateTime object.
- * @return Returns 1 if datetime1 is greater than datetime2.
- *         Returns -1 if datetime1 is less than datetime2.
- *         Returns 0 if datetime1 is equal to datetime2.
+ * @brief Fill every row of the DateTimeColumn object from the Unix timestamps.
+ * @param column The DateTimeColumn object.
+ * @param timestamps The array of column->length Unix timestamps.
+ * @return Returns true if every timestamp is in range (see datetime_from_timestamp()), otherwise returns false.
+ *         Rows with out-of-range timestamps are left unchanged.
+ * @note Runs 8 rows at a time with AVX2 when the CPU supports it.
  */
-int datetime_compare(DateTime datetime1, DateTime datetime2) {
-    exit_if_fail(__is_valid_datetime(datetime1) && __is_valid_datetime(datetime2));
+bool datetime_column_from_timestamp(DateTimeColumn *column, const time_t *timestamps) {
+    bool all_valid = true;
+    size_t i;
 
-    if (date_compare(datetime1.date, datetime2.date) > 0) {
-        return 1;
-    } else if (date_compare(datetime1.date, datetime2.date) < 0) {
-        return -1;
-    }
+    return_value_if_fail(column != NULL && timestamps != NULL, false);
 
-    if (time_compare(datetime1.time, datetime2.time) > 0) {
-        return 1;
-    } else if (time_compare(datetime1.time, datetime2.time) < 0) {
-        return -1;
+    if (sizeof(time_t) == sizeof(int64_t)) {
+        return __column_from_epoch(column, (const int64_t *)timestamps, MIN_TIMESTAMP, MAX_TIMESTAMP, SECONDS_PER_DAY);
     }
 
-    return 0;
+    for (i = 0; i < column->length; i++) {
+        all_valid &= __column_set_epoch(column, i, timestamps[i], MIN_TIMESTAMP, MAX_TIMESTAMP, SECONDS_PER_DAY);
+    }
+    return all_valid;
 }
 
 /**
- * @brief Add days and milliseconds to the datetime.
- * @param datetime The DateTime object.
- * @param days The number of days to add/subtract.
- * @param milliseconds The number of milliseconds to add/subtract.
- * @return DateTime The new DateTime object.
+ * @brief Convert every row of the DateTimeColumn object to the Instant.
+ * @param column The DateTimeColumn object. Every row must be valid (see datetime_column_validate()).
+ * @param instants The array of column->length Instants (output).
+ * @note Runs 8 rows at a time with AVX2 when the CPU supports it.
  */
-DateTime datetime_add(DateTime datetime, int days, int milliseconds) {
-    TimeInterval time_interval;
-    exit_if_fail(__is_valid_datetime(datetime));
-
-    datetime.date = date_add(datetime.date, days);
+void datetime_column_to_instant(const DateTimeColumn *column, Instant *instants) {
+    return_if_fail(column != NULL && instants != NULL);
+    __column_to_epoch(column, MILLISECONDS_PER_DAY, instants);
+}
 
-    if (milliseconds >= 0) {
-        time_interval = time_interval_create(0, 0, 0, 0, milliseconds);
-        datetime.date = date_add(datetime.date, time_interval.days);
+/**
+ * @brief Fill every row of the DateTimeColumn object from the Instants.
+ * @param column The DateTimeColumn object.
+ * @param instants The array of column->length Instants.
+ * @return Returns true if every Instant is in range (see instant_to_datetime()), otherwise returns false.
+ *         Rows with out-of-range Instants are left unchanged.
+ * @note Runs 8 rows at a time with AVX2 when the CPU supports it.
+ */
+bool datetime_column_from_instant(DateTimeColumn *column, const Instant *instants) {
+    return_value_if_fail(column != NULL && instants != NULL, false);
+    return __column_from_epoch(column, instants, INSTANT_MIN, INSTANT_MAX, MILLISECONDS_PER_DAY);
+}
 
-        datetime.time.millisecond += time_interval.milliseconds;
-        if (datetime.time.millisecond >= MILLISECONDS_PER_SECOND) {
-            datetime.time.second++;
-            datetime.time.millisecond %= MILLISECONDS_PER_SECOND;
-        }
+/**
+ * @brief Determine the day of the week for every row of the DateTimeColumn object.
+ * @param column The DateTimeColumn object. Every row must be valid (see datetime_column_validate()).
+ * @param weekdays The array of column->length weekdays (output).
+ * @note Runs 8 rows at a time with AVX2 when the CPU supports it.
+ */
+void datetime_column_weekday(const DateTimeColumn *column, Weekday *weekdays) {
+    size_t i = 0;
 
-        datetime.time.second += time_interval.seconds;
-        if (datetime.time.second >= SECONDS_PER_MINUTE) {
-            datetime.time.minute++;
-            datetime.time.second %= SECONDS_PER_MINUTE;
-        }
+    return_if_fail(column != NULL && weekdays != NULL);
 
-        datetime.time.minute += time_interval.minutes;
-        if (datetime.time.minute >= MINUTES_PER_HOUR) {
-            datetime.time.hour++;
-            datetime.time.minute %= MINUTES_PER_HOUR;
+#ifdef DATETIME_AVX2
+    if (__cpu_has_avx2() && sizeof(Weekday) == sizeof(int)) {
+        for (; i + AVX2_LANES <= column->length; i += AVX2_LANES) {
+            __mm256_column_weekday(column, i, weekdays + i);
         }
+    }
+#endif
 
-        datetime.time.hour += time_interval.hours;
-        if (datetime.time.hour >= HOURS_PER_DAY) {
-            datetime.date = date_add(datetime.date, 1);
-            datetime.time.hour %= HOURS_PER_DAY;
-        }
-    } else {
-        time_interval = time_interval_create(0, 0, 0, 0, -milliseconds);
-        datetime.date = date_add(datetime.date, -time_interval.days);
-
-        datetime.time.millisecond -= time_interval.milliseconds;
-        if (datetime.time.millisecond < 0) {
-            datetime.time.second--;
-            datetime.time.millisecond += MILLISECONDS_PER_SECOND;
-        }
+    for (; i < column->length; i++) {
+        weekdays[i] = __weekday_from_days(__days_from_civil(column->years[i], column->months[i], column->days[i]));
+    }
+}
 
-        datetime.time.second -= time_interval.seconds;
-        if (datetime.time.second < 0) {
-            datetime.time.minute--;
-            datetime.time.second += SECONDS_PER_MINUTE;
-        }
+/**
+ * @brief Determine the day of the week of every Date object.
+ * @param dates The array of count Date objects. Every Date object must be valid.
+ * @param weekdays The array of count weekdays (output).
+ * @param count The number of rows.
+ * @note Runs 8 rows at a time with AVX2 when the CPU supports it.
+ */
+void weekday_many(const Date *dates, Weekday *weekdays, size_t count) {
+    size_t i = 0;
 
-        datetime.time.minute -= time_interval.minutes;
-        if (datetime.time.minute < 0) {
-            datetime.time.hour--;
-            datetime.time.minute += MINUTES_PER_HOUR;
-        }
+    return_if_fail(dates != NULL && weekdays != NULL);
 
-        datetime.time.hour -= time_interval.hours;
-        if (datetime.time.hour < 0) {
-            datetime.date = date_add(datetime.date, -1);
-            datetime.time.hour += HOURS_PER_DAY;
+#ifdef DATETIME_AVX2
+    if (__cpu_has_avx2() && sizeof(Weekday) == sizeof(int)) {
+        for (; i + AVX2_LANES <= count; i += AVX2_LANES) {
+            __mm256_weekday_many(dates + i, weekdays + i);
         }
     }
+#endif
 
-    return datetime;
+    for (; i < count; i++) {
+        weekdays[i] = __weekday_from_days(__days_from_civil(dates[i].year, dates[i].month, dates[i].day));
+    }
 }
 
 /**
- * @brief Get the difference between two DateTime objects.
- * @param datetime1 The first DateTime object.
- * @param datetime2 The second DateTime object.
- * @return TimeInterval The difference between two DateTime objects.
+ * @brief Get the ISO 8601 week date of every Date object.
+ * @param dates The array of count Date objects. Every Date object must be valid.
+ * @param weeks The array of count IsoWeek objects (output).
+ * @param count The number of rows.
  */
-TimeInterval datetime_diff(DateTime datetime1, DateTime datetime2) {
-    TimeInterval time_interval;
-    DateTime temp;
-    int days_diff = 0;
-    int milliseconds_diff = 0;
+void iso_week_many(const Date *dates, IsoWeek *weeks, size_t count) {
+    size_t i;
 
-    exit_if_fail(__is_valid_datetime(datetime1) && __is_valid_datetime(datetime2));
+    return_if_fail(dates != NULL && weeks != NULL);
 
-    if (datetime_compare(datetime1, datetime2) < 0) {
-        temp = datetime1;
-        datetime1 = datetime2;
-        datetime2 = temp;
+    for (i = 0; i < count; i++) {
+        weeks[i] = iso_week_unchecked(dates[i]);
     }
+}
 
-    days_diff = date_diff(datetime1.date, datetime2.date);
-    milliseconds_diff = time_diff(datetime1.time, datetime2.time);
+/**
+ * @brief Create the Date object of every ISO 8601 week date.
+ * @param weeks The array of count IsoWeek objects. Every week date must be valid (see date_from_iso_week_checked()).
+ * @param dates The array of count Date objects (output).
+ * @param count The number of rows.
+ */
+void date_from_iso_week_many(const IsoWeek *weeks, Date *dates, size_t count) {
+    size_t i;
 
-    if (milliseconds_diff < 0) {
-        days_diff--;
-        milliseconds_diff += MILLISECONDS_PER_DAY;
-    }
+    return_if_fail(weeks != NULL && dates != NULL);
 
-    time_interval = time_interval_create(days_diff, 0, 0, 0, milliseconds_diff);
-    return time_interval;
+    for (i = 0; i < count; i++) {
+        dates[i] = date_from_iso_week_unchecked(weeks[i].year, weeks[i].week, weeks[i].weekday);
+    }
 }
 
 /**
- * @brief Get the string representation (yyyy-mm-dd hh:mm:ss.fff) of the datetime.
- * @param datetime The DateTime object.
- * @return Returns the string representation of the datetime.
- * @note The caller must free the returned string.
+ * @brief Compare two DateTimeColumn objects row by row.
+ * @param column1 The first DateTimeColumn object. Every row must be valid (see datetime_column_validate()).
+ * @param column2 The second DateTimeColumn object with the same length. Every row must be valid.
+ * @param results The array of column1->length results (output), each as returned by datetime_compare().
  */
-char *datetime_to_string(DateTime datetime) {
-    char *datetime_str = NULL;
-    char *date_str = NULL;
-    char *time_str = NULL;
-    return_value_if_fail(__is_valid_datetime(datetime), NULL);
+void datetime_column_compare(const DateTimeColumn *column1, const DateTimeColumn *column2, int *results) {
+    size_t i;
+    int days1;
+    int days2;
+    int milliseconds1;
+    int milliseconds2;
 
-    date_str = date_to_string(datetime.date);
-    time_str = time_to_string(datetime.time);
-    datetime_str = (char *)malloc(sizeof(char) * (strlen(date_str) + strlen(time_str) + 2));
-    if (datetime_str == NULL) {
-        free(date_str);
-        free(time_str);
-        return NULL;
-    }
+    return_if_fail(column1 != NULL && column2 != NULL && results != NULL);
+    return_if_fail(column1->length == column2->length);
 
-    sprintf(datetime_str, "%s %s", date_str, time_str);
-    free(date_str);
-    free(time_str);
-    return datetime_str;
+    for (i = 0; i < column1->length; i++) {
+        days1 = __days_from_civil(column1->years[i], column1->months[i], column1->days[i]);
+        days2 = __days_from_civil(column2->years[i], column2->months[i], column2->days[i]);
+        milliseconds1 = column1->hours[i] * MILLISECONDS_PER_HOUR + column1->minutes[i] * MILLISECONDS_PER_MINUTE + column1->seconds[i] * MILLISECONDS_PER_SECOND + column1->milliseconds[i];
+        milliseconds2 = column2->hours[i] * MILLISECONDS_PER_HOUR + column2->minutes[i] * MILLISECONDS_PER_MINUTE + column2->seconds[i] * MILLISECONDS_PER_SECOND + column2->milliseconds[i];
+        results[i] = days1 != days2 ? (days1 > days2) - (days1 < days2) : (milliseconds1 > milliseconds2) - (milliseconds1 < milliseconds2);
+    }
 }
 
 /**
- * @brief Get the string representation (Day Mon dd hh:mm:ss yyyy) of the datetime.
- * @param datetime DateTime Time object.
- * @return Returns the string representation of the datetime.
- * @note The caller must free the returned string.
+ * @brief Create DateTime objects from the Unix timestamps.
+ * @param timestamps The array of count Unix timestamps.
+ * @param datetimes The array of count DateTime objects (output).
+ * @param count The number of rows.
+ * @return Returns true if every timestamp is in range (see datetime_from_timestamp()), otherwise returns false.
+ *         Rows with out-of-range timestamps are left unchanged.
  */
-char *datetime_ascii_string(DateTime datetime) {
-    char *datetime_string = NULL;
-    struct tm tm = {0};
-    char weekday_abbr[4] = {0};
-    return_value_if_fail(__is_valid_datetime(datetime), NULL);
-
-    tm.tm_year = datetime.date.year - 1900;
-    tm.tm_mon = datetime.date.month - 1;
-    tm.tm_mday = datetime.date.day;
-    tm.tm_hour = datetime.time.hour;
-    tm.tm_min = datetime.time.minute;
-    tm.tm_sec = datetime.time.second;
+bool datetime_array_from_timestamp(const time_t *timestamps, DateTime *datetimes, size_t count) {
+    bool all_valid = true;
+    size_t i;
 
-    datetime_string = (char *)calloc(25, sizeof(char));
-    return_value_if_fail(datetime_string != NULL, NULL);
+    return_value_if_fail(timestamps != NULL && datetimes != NULL, false);
 
-    strcpy(weekday_abbr, weekday_abbr_name(weekday(datetime.date.year, datetime.date.month, datetime.date.day)));
-    strftime(datetime_string, 22, " %b %d %H:%M:%S %Y", &tm);
-    memmove(datetime_string + 3, datetime_string, 21);
-    memcpy(datetime_string, weekday_abbr, 3);
-    return datetime_string;
+    for (i = 0; i < count; i++) {
+        if (timestamps[i] < MIN_TIMESTAMP || timestamps[i] > MAX_TIMESTAMP) {
+            all_valid = false;
+            continue;
+        }
+        datetimes[i] = __datetime_from_epoch(timestamps[i], SECONDS_PER_DAY);
+    }
+    return all_valid;
 }
 
 /**
- * @brief Replaces all occurrences of the specified substring in the string with the specified new substring.
- * @param str The string to be replaced.
- * @param old_str The replaced substring.
- * @param new_str The new substring.
- * @return The string after replacing.
+ * @brief Convert the DateTime objects to the Unix timestamps.
+ * @param datetimes The array of count DateTime objects. Every DateTime object must be valid.
+ * @param timestamps The array of count Unix timestamps (output).
+ * @param count The number of rows.
  */
-static char *str_replace_string(char *str, const char *old_str, const char *new_str) {
-    size_t old_str_len;
-    size_t new_str_len;
-    char *p = NULL;
+void datetime_array_to_timestamp(const DateTime *datetimes, time_t *timestamps, size_t count) {
+    size_t i;
 
-    return_value_if_fail(str != NULL && old_str != NULL && new_str != NULL, str);
+    return_if_fail(datetimes != NULL && timestamps != NULL);
 
-    old_str_len = strlen(old_str);
-    new_str_len = strlen(new_str);
-    return_value_if_fail(old_str_len > 0, str);
-
-    p = str;
-    while ((p = strstr(p, old_str))) {
-        memmove(p + new_str_len, p + old_str_len, strlen(p + old_str_len) + 1);
-        memcpy(p, new_str, new_str_len);
-        p += new_str_len;
+    for (i = 0; i < count; i++) {
+        timestamps[i] = (time_t)__datetime_to_epoch(datetimes[i], SECONDS_PER_DAY);
     }
+}
+
+/**
+ * @brief Write the string representations (yyyy-mm-dd hh:mm:ss.fff) of the DateTime objects.
+ * @param datetimes The array of count DateTime objects. Every DateTime object must be valid.
+ * @param buffer The buffer of count * stride characters (output). Row i is written NUL-terminated at buffer + i * stride.
+ * @param stride The distance between rows in the buffer, at least DATETIME_STRING_LENGTH + 1.
+ * @param count The number of rows.
+ */
+void datetime_array_to_string(const DateTime *datetimes, char *buffer, size_t stride, size_t count) {
+    size_t i;
+
+    return_if_fail(datetimes != NULL && buffer != NULL && stride > DATETIME_STRING_LENGTH);
 
-    return str;
+    for (i = 0; i < count; i++) {
+        __write_datetime(buffer + i * stride, &datetimes[i]);
+    }
 }
 
 /**
- * @brief Adjust the weekday generated by the ctime()/strftime() in C library.
- * @param str The string to be adjusted.
- * @param year The year.
- * @param month The month.
- * @param day The day.
- * @return Returns the string after adjusting.
+ * @brief Parse the number of digits at the string.
+ * @param str The string.
+ * @param digits The number of digits.
+ * @return Returns the number, or -1 if a character is not a digit.
  */
-static char *__adjust_weekday(char *str, int year, int month, int day) {
-    char weekday_abbr[4] = {0};
-    char weekday_full[10] = {0};
+static int __parse_digits(const char *str, int digits) {
+    int value = 0;
+    int i;
+
+    for (i = 0; i < digits; i++) {
+        return_value_if(str[i] < '0' || str[i] > '9', -1);
+        value = value * 10 + (str[i] - '0');
+    }
+    return value;
+}
 
-    return_value_if_fail(str != NULL, NULL);
-    return_value_if_fail(__is_valid_date(date_create(year, month, day)), str);
+/**
+ * @brief Parse the string representations (yyyy-mm-dd hh:mm:ss.fff) into DateTime objects.
+ * @param buffer The buffer of count * stride characters. Row i starts at buffer + i * stride and needs no NUL terminator.
+ * @param stride The distance between rows in the buffer, at least DATETIME_STRING_LENGTH.
+ * @param datetimes The array of count DateTime objects (output). Invalid rows are left unchanged.
+ * @param valid The array of count results (output), 1 for a valid row and 0 otherwise, can be NULL.
+ *              An int array rather than bool, so that C and C++ agree on its layout.
+ * @param count The number of rows.
+ * @return Returns the number of valid rows.
+ * @note Nothing is printed to stderr for invalid rows.
+ */
+size_t datetime_array_parse(const char *buffer, size_t stride, DateTime *datetimes, int *valid, size_t count) {
+    size_t parsed = 0;
+    size_t i;
+    const char *str;
+    DateTime datetime;
+    bool row_valid;
+
+    return_value_if_fail(buffer != NULL && datetimes != NULL && stride >= DATETIME_STRING_LENGTH, 0);
+
+    for (i = 0; i < count; i++) {
+        str = buffer + i * stride;
+        datetime.date.year = __parse_digits(str, 4);
+        datetime.date.month = __parse_digits(str + 5, 2);
+        datetime.date.day = __parse_digits(str + 8, 2);
+        datetime.time.hour = __parse_digits(str + 11, 2);
+        datetime.time.minute = __parse_digits(str + 14, 2);
+        datetime.time.second = __parse_digits(str + 17, 2);
+        datetime.time.millisecond = __parse_digits(str + 20, 3);
+
+        row_valid = str[4] == '-' && str[7] == '-' && str[10] == ' ' && str[13] == ':' && str[16] == ':' && str[19] == '.' &&
+                    __is_valid_datetime_fields(datetime.date.year, datetime.date.month, datetime.date.day, datetime.time.hour,
+                                               datetime.time.minute, datetime.time.second, datetime.time.millisecond);
+        if (row_valid) {
+            datetimes[i] = datetime;
+            parsed++;
+        }
+        if (valid != NULL) {
+            valid[i] = row_valid;
+        }
+    }
+    return parsed;
+}
 
-    strcpy(weekday_abbr, weekday_abbr_name(weekday(year, month, day)));
-    strcpy(weekday_full, weekday_full_name(weekday(year, month, day)));
+/**
+ * @brief Validate and convert the fields of yyyy-mm-ddThh:mm:ss one character at a time.
+ * @param str The string of at least 19 characters.
+ * @param fields The year, month, day, hour, minute and second (output).
+ * @return Returns true if every digit and separator is in place, otherwise returns false.
+ * @note The separator at index 10 is not checked.
+ */
+static bool __parse_iso8601_fields(const char *str, int *fields) {
+    fields[0] = __parse_digits(str, 4);
+    fields[1] = __parse_digits(str + 5, 2);
+    fields[2] = __parse_digits(str + 8, 2);
+    fields[3] = __parse_digits(str + 11, 2);
+    fields[4] = __parse_digits(str + 14, 2);
+    fields[5] = __parse_digits(str + 17, 2);
+
+    return str[4] == '-' && str[7] == '-' && str[13] == ':' && str[16] == ':' && fields[0] >= 0 && fields[1] >= 0 && fields[2] >= 0 &&
+           fields[3] >= 0 && fields[4] >= 0 && fields[5] >= 0;
+}
 
-    str_replace_string(str, "Sunday", weekday_full);
-    str_replace_string(str, "Monday", weekday_full);
-    str_replace_string(str, "Tuesday", weekday_full);
-    str_replace_string(str, "Wednesday", weekday_full);
-    str_replace_string(str, "Thursday", weekday_full);
-    str_replace_string(str, "Friday", weekday_full);
-    str_replace_string(str, "Saturday", weekday_full);
+#ifdef DATETIME_SSSE3
+/**
+ * @brief Find the characters of the 16-byte block that are not a digit or the expected separator.
+ * @param block The 16 characters.
+ * @param digits The mask of the digit positions.
+ * @param separators The expected separators, checked where separator_mask is set.
+ * @param separator_mask The mask of the separator positions.
+ * @return Returns the bit mask of the misplaced characters.
+ */
+TARGET_SSSE3 static int __mm_misplaced_chars(__m128i block, __m128i digits, __m128i separators, __m128i separator_mask) {
+    __m128i values = _mm_sub_epi8(block, _mm_set1_epi8('0'));
+    __m128i is_digit = _mm_cmpeq_epi8(_mm_subs_epu8(values, _mm_set1_epi8(9)), _mm_setzero_si128());
+    __m128i is_separator = _mm_cmpeq_epi8(block, separators);
 
-    str_replace_string(str, "Sun", weekday_abbr);
-    str_replace_string(str, "Mon", weekday_abbr);
-    str_replace_string(str, "Tue", weekday_abbr);
-    str_replace_string(str, "Wed", weekday_abbr);
-    str_replace_string(str, "Thu", weekday_abbr);
-    str_replace_string(str, "Fri", weekday_abbr);
-    str_replace_string(str, "Sat", weekday_abbr);
+    return _mm_movemask_epi8(_mm_or_si128(_mm_andnot_si128(is_digit, digits), _mm_andnot_si128(is_separator, separator_mask)));
+}
 
-    return str;
+/**
+ * @brief Validate and convert the fields of yyyy-mm-ddThh:mm:ss with two overlapping 16-byte loads.
+ * @param str The string of at least 19 characters.
+ * @param fields The year, month, day, hour, minute and second (output).
+ * @return Returns true if every digit and separator is in place, otherwise returns false.
+ * @note The separator at index 10 is not checked.
+ */
+TARGET_SSSE3 static bool __mm_parse_iso8601_fields(const char *str, int *fields) {
+    /* The low block holds yyyy-mm-ddThh:mm, the high block (from index 3) ends with :ss. */
+    __m128i low = _mm_loadu_si128((const __m128i *)str);
+    __m128i high = _mm_loadu_si128((const __m128i *)(str + 3));
+    __m128i pairs;
+    int misplaced;
+
+    misplaced = __mm_misplaced_chars(low, _mm_setr_epi8(-1, -1, -1, -1, 0, -1, -1, 0, -1, -1, 0, -1, -1, 0, -1, -1),
+                                     _mm_setr_epi8(0, 0, 0, 0, '-', 0, 0, '-', 0, 0, 0, 0, 0, ':', 0, 0),
+                                     _mm_setr_epi8(0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0)) |
+                __mm_misplaced_chars(high, _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1),
+                                     _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, ':', 0, 0),
+                                     _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0));
+    return_value_if(misplaced != 0, false);
+
+    /* Gather the 14 digits as y y y y m m d d h h m m s s, then 10 * tens + ones for every pair. */
+    low = _mm_shuffle_epi8(_mm_sub_epi8(low, _mm_set1_epi8('0')), _mm_setr_epi8(0, 1, 2, 3, 5, 6, 8, 9, 11, 12, 14, 15, -1, -1, -1, -1));
+    high = _mm_shuffle_epi8(_mm_sub_epi8(high, _mm_set1_epi8('0')), _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 14, 15, -1, -1));
+    pairs = _mm_maddubs_epi16(_mm_or_si128(low, high), _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+
+    fields[0] = _mm_extract_epi16(pairs, 0) * 100 + _mm_extract_epi16(pairs, 1);
+    fields[1] = _mm_extract_epi16(pairs, 2);
+    fields[2] = _mm_extract_epi16(pairs, 3);
+    fields[3] = _mm_extract_epi16(pairs, 4);
+    fields[4] = _mm_extract_epi16(pairs, 5);
+    fields[5] = _mm_extract_epi16(pairs, 6);
+    return true;
 }
+#endif
 
 /**
- * @brief Get the specified string representation of the datetime.
- * @param datetime The DateTime object.
- * @param format The format string.
- * | Specifier | Replaced by                                               | Example                  |
- * | %a        | Abbreviated weekday name                                  | Sun                      |
- * | %A        | Full weekday name                                         | Sunday                   |
- * | %b        | Abbreviated month name                                    | Mar                      |
- * | %B        | Full month name                                           | March                    |
- * | %c        | Date and time representation for the current locale       | Sun Aug 19 02:56:02 2012 |
- * | %d        | Day of the month (01-31)                                  | 19                       |
- * | %H        | Hour in 24h format (00-23)                                | 14                       |
- * | %I        | Hour in 12h format (01-12)                                | 02                       |
- * | %j        | Day of the year (001-366)                                 | 231                      |
- * | %m        | Month as a decimal number (01-12)                         | 08                       |
- * | %M        | Minute (00-59)                                            | 55                       |
- * | %p        | AM or PM                                                  | PM                       |
- * | %S        | Second (00-61)                                            | 02                       |
- * | %U        | Week number of the year (Sunday as the first day) (00-53) | 33                       |
- * | %w        | Weekday as a decimal number (0-6)                         | 4                        |
- * | %W        | Week number of the year (Monday as the first day) (00-53) | 34                       |
- * | %x        | Date representation for the current locale                | 08/19/12                 |
- * | %X        | Time representation for the current locale                | 02:50:06                 |
- * | %y        | Year without century (00-99)                              | 01                       |
- * | %Y        | Year with century                                         | 2001                     |
- * | %z        | Timezone offset (+0000)                                   | +0000                    |
- * | %%        | A % sign                                                  | %                        |
- * @return Returns the specified string representation of the datetime.
- * @note The caller must free the returned string.
+ * @brief Parse the ISO 8601 / RFC 3339 representation into a DateTime object.
+ * @see datetime_parse_iso8601()
  */
-char *datetime_format_string(DateTime datetime, const char *format) {
-    char *datetime_string = NULL;
-    struct tm tm = {0};
-    return_value_if_fail(__is_valid_datetime(datetime) && format != NULL, NULL);
+static DateTimeError __parse_iso8601(const char *s, size_t len, DateTime *out) {
+    DateTime datetime;
+    Instant instant;
+    int fields[6];
+    int millisecond = 0;
+    int offset_minutes = 0;
+    int offset_hour;
+    int offset_minute;
+    int digits;
+    size_t i = 19;
+    bool matched;
+
+    return_value_if_fail(s != NULL && out != NULL, DATETIME_ERROR_ARGUMENT);
+    return_value_if(len < 19, DATETIME_ERROR_SYNTAX);
+
+#ifdef DATETIME_SSSE3
+    matched = __cpu_has_ssse3() ? __mm_parse_iso8601_fields(s, fields) : __parse_iso8601_fields(s, fields);
+#else
+    matched = __parse_iso8601_fields(s, fields);
+#endif
+    return_value_if(!matched || (s[10] != 'T' && s[10] != 't' && s[10] != ' '), DATETIME_ERROR_SYNTAX);
 
-    tm.tm_year = datetime.date.year - 1900;
-    tm.tm_mon = datetime.date.month - 1;
-    tm.tm_mday = datetime.date.day;
-    tm.tm_hour = datetime.time.hour;
-    tm.tm_min = datetime.time.minute;
-    tm.tm_sec = datetime.time.second;
+    if (i < len && (s[i] == '.' || s[i] == ',')) {
+        for (i++, digits = 0; i < len && s[i] >= '0' && s[i] <= '9'; i++, digits++) {
+            if (digits < 3) {
+                millisecond = millisecond * 10 + (s[i] - '0');
+            }
+        }
+        return_value_if(digits == 0, DATETIME_ERROR_SYNTAX);
+        for (; digits < 3; digits++) {
+            millisecond *= 10;
+        }
+    }
 
-    datetime_string = (char *)malloc(sizeof(char) * 128);
-    return_value_if_fail(datetime_string != NULL, NULL);
+    if (i < len && (s[i] == 'Z' || s[i] == 'z')) {
+        i++;
+    } else if (i < len && (s[i] == '+' || s[i] == '-')) {
+        return_value_if(len - i < 6 || s[i + 3] != ':', DATETIME_ERROR_SYNTAX);
+        offset_hour = __parse_digits(s + i + 1, 2);
+        offset_minute = __parse_digits(s + i + 4, 2);
+        return_value_if(offset_hour < 0 || offset_minute < 0, DATETIME_ERROR_SYNTAX);
+        return_value_if(offset_hour >= HOURS_PER_DAY || offset_minute >= MINUTES_PER_HOUR, DATETIME_ERROR_RANGE);
+        offset_minutes = (offset_hour * MINUTES_PER_HOUR + offset_minute) * (s[i] == '-' ? -1 : 1);
+        i += 6;
+    }
+    return_value_if(i != len, DATETIME_ERROR_SYNTAX);
+    return_value_if(!__is_valid_datetime_fields(fields[0], fields[1], fields[2], fields[3], fields[4], fields[5], millisecond), DATETIME_ERROR_RANGE);
+
+    datetime.date.year = fields[0];
+    datetime.date.month = fields[1];
+    datetime.date.day = fields[2];
+    datetime.time.hour = fields[3];
+    datetime.time.minute = fields[4];
+    datetime.time.second = fields[5];
+    datetime.time.millisecond = millisecond;
+
+    if (offset_minutes != 0) {
+        instant = __datetime_to_epoch(datetime, MILLISECONDS_PER_DAY) - (Instant)offset_minutes * MILLISECONDS_PER_MINUTE;
+        return_value_if(instant < INSTANT_MIN || instant > INSTANT_MAX, DATETIME_ERROR_RANGE);
+        datetime = __datetime_from_epoch(instant, MILLISECONDS_PER_DAY);
+    }
 
-    strftime(datetime_string, 128, format, &tm);
-    __adjust_weekday(datetime_string, datetime.date.year, datetime.date.month, datetime.date.day);
-    datetime_string = (char *)realloc(datetime_string, sizeof(char) * (strlen(datetime_string) + 1));
+    *out = datetime;
+    return DATETIME_OK;
+}
 
-    return datetime_string;
+/**
+ * @brief Parse the ISO 8601 / RFC 3339 representation (yyyy-mm-ddThh:mm:ss[.fff][Z|+hh:mm|-hh:mm]) into a DateTime object.
+ * @param s The string. It needs no NUL terminator.
+ * @param len The number of characters of the string.
+ * @param out The DateTime object (output), in UTC if the string has a zone, otherwise as written. Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @note The separator between the date and the time can be 'T', 't' or ' '. The fraction can have any number of digits
+ *       and is truncated to milliseconds. Nothing is printed to stderr.
+ */
+DateTimeError datetime_parse_iso8601(const char *s, size_t len, DateTime *out) {
+    return __set_error(__parse_iso8601(s, len, out));
 }
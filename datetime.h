@@ -2,10 +2,15 @@
 #define _DATETIME_H_
 
 #include <time.h>
+#include <stdint.h>
 
+#ifdef __cplusplus
+extern "C" {
+#else
 typedef int bool;
 #define true 1
 #define false 0
+#endif
 
 #define NANOSECONDS_PER_MICROSECOND 1000
 #define NANOSECONDS_PER_MILLISECOND (NANOSECONDS_PER_MICROSECOND * 1000)
@@ -35,6 +40,16 @@ typedef int bool;
 #define DAYS_IN_FEBRUARY_COMMON 28
 #define DAYS_IN_FEBRUARY_LEAP 29
 
+/* Maximum lengths of the string representations, excluding the NUL terminator. */
+#define DATE_STRING_LENGTH 10            /* yyyy-mm-dd */
+#define DATE_ASCII_STRING_LENGTH 15      /* Day Mon dd yyyy */
+#define TIME_STRING_LENGTH 12            /* hh:mm:ss.fff */
+#define TIME_ASCII_STRING_LENGTH 8       /* hh:mm:ss */
+#define DATETIME_STRING_LENGTH 23        /* yyyy-mm-dd hh:mm:ss.fff */
+#define DATETIME_ASCII_STRING_LENGTH 24  /* Day Mon dd hh:mm:ss yyyy */
+#define DATETIME_ISO8601_LENGTH 24       /* yyyy-mm-ddThh:mm:ss.fffZ */
+#define CALENDAR_STRING_LENGTH 254       /* 2 header lines and 6 weeks */
+
 typedef enum Month {
     JAN = 1,
     FEB,
@@ -74,6 +89,13 @@ typedef struct Date {
     int day;
 } Date;
 
+/* A date in the ISO 8601 week-numbering calendar (weeks start on Monday, week 1 holds the first Thursday). */
+typedef struct IsoWeek {
+    int year;    /* the week-numbering year, which differs from the calendar year around January 1 */
+    int week;    /* 1 ~ 53 */
+    int weekday; /* 1 ~ 7, Monday is 1 */
+} IsoWeek;
+
 typedef struct Time {
     int hour;
     int minute;
@@ -86,6 +108,82 @@ typedef struct DateTime {
     Time time;
 } DateTime;
 
+/* Milliseconds since 1970-01-01 00:00:00.000 UTC, ordered like the DateTime it represents. */
+typedef int64_t Instant;
+
+/* The seconds are split so that every literal fits in a 32-bit long */
+#define INSTANT_MIN (((Instant)-62135596 * 1000 - 800) * MILLISECONDS_PER_SECOND)    /* 0001-01-01 00:00:00.000 UTC */
+#define INSTANT_MAX (((Instant)253402300 * 1000 + 800) * MILLISECONDS_PER_SECOND - 1) /* 9999-12-31 23:59:59.999 UTC */
+
+/* The wall clocks of datetime_now_snapshot(). */
+typedef enum DateTimeClock {
+    DATETIME_CLOCK_REALTIME,       /* CLOCK_REALTIME */
+    DATETIME_CLOCK_REALTIME_COARSE /* CLOCK_REALTIME_COARSE: as of the last timer tick, a few ms behind, but cheaper */
+} DateTimeClock;
+
+/* One reading of the wall clock, in every representation. */
+typedef struct DateTimeSnapshot {
+    Instant instant; /* milliseconds since 1970-01-01 00:00:00.000 UTC */
+    DateTime utc;
+    DateTime local;
+    int utc_offset; /* the seconds local time is ahead of UTC */
+} DateTimeSnapshot;
+
+/* Bit-packed storage variants. Packed values sort, compare and hash as plain unsigned integers. */
+typedef uint32_t PackedDate;     /* year:14 | month:4 | day:5 */
+typedef uint32_t PackedTime;     /* milliseconds since midnight */
+typedef uint64_t PackedDateTime; /* PackedDate:32 | PackedTime:32 */
+
+/* Struct-of-arrays storage for a column of DateTime values, one contiguous array per field. */
+typedef struct DateTimeColumn {
+    size_t length;
+    int *years;
+    int *months;
+    int *days;
+    int *hours;
+    int *minutes;
+    int *seconds;
+    int *milliseconds;
+} DateTimeColumn;
+
+#define DATETIME_MASK_WORDS(length) (((length) + 63) / 64) /* 64-bit words of a validity bitmask over length rows */
+
+/*
+ * Error codes of the functions that report errors to the caller instead of exiting.
+ *
+ * Every function that exits on invalid input has a xxx_checked() variant that returns the error code,
+ * writes the result to the out parameter and prints nothing. Hot paths on values that are already known
+ * to be valid can call the xxx_unchecked() variants, which skip the validation entirely: passing them an
+ * invalid value is undefined behavior.
+ */
+typedef enum DateTimeError {
+    DATETIME_OK = 0,
+    DATETIME_ERROR_ARGUMENT, /* a required pointer is NULL */
+    DATETIME_ERROR_SYNTAX,   /* the input does not match the expected layout */
+    DATETIME_ERROR_RANGE     /* a field or the result is out of range */
+} DateTimeError;
+
+/* A format string compiled once into the list of operations that renders it. */
+typedef struct DateTimeFormat DateTimeFormat;
+
+/**
+ * @brief Get the description of the error code.
+ * @param error The error code.
+ * @return Returns the description of the error code.
+ */
+const char *datetime_error_string(DateTimeError error);
+
+/**
+ * @brief Get the error code of the last xxx_checked() or datetime_parse_iso8601() call on the calling thread.
+ * @return Returns the error code, or DATETIME_OK if the last call has succeeded.
+ */
+DateTimeError datetime_last_error(void);
+
+/**
+ * @brief Reset the last error code of the calling thread to DATETIME_OK.
+ */
+void datetime_clear_error(void);
+
 /**
  * @brief Determine whether the year is a leap year.
  * @param year The year.
@@ -100,6 +198,15 @@ bool is_leap_year(int year);
  */
 const char *month_name(Month month);
 
+/**
+ * @brief Get the full name of the month, reporting errors to the caller.
+ * @param month The month.
+ * @param out The full name of the month (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see month_name()
+ */
+DateTimeError month_name_checked(Month month, const char **out);
+
 /**
  * @brief Get the full name of the weekday.
  * @param weekday The weekday.
@@ -107,6 +214,15 @@ const char *month_name(Month month);
  */
 const char *weekday_full_name(Weekday weekday);
 
+/**
+ * @brief Get the full name of the weekday, reporting errors to the caller.
+ * @param weekday The weekday.
+ * @param out The full name of the weekday (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see weekday_full_name()
+ */
+DateTimeError weekday_full_name_checked(Weekday weekday, const char **out);
+
 /**
  * @brief Get the abbreviated name of the weekday.
  * @param weekday The weekday.
@@ -114,6 +230,15 @@ const char *weekday_full_name(Weekday weekday);
  */
 const char *weekday_abbr_name(Weekday weekday);
 
+/**
+ * @brief Get the abbreviated name of the weekday, reporting errors to the caller.
+ * @param weekday The weekday.
+ * @param out The abbreviated name of the weekday (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see weekday_abbr_name()
+ */
+DateTimeError weekday_abbr_name_checked(Weekday weekday, const char **out);
+
 /**
  * @brief Get the number of days in the month.
  * @param year The year.
@@ -122,6 +247,16 @@ const char *weekday_abbr_name(Weekday weekday);
  */
 int days_in_month(int year, int month);
 
+/**
+ * @brief Get the number of days in the month, reporting errors to the caller.
+ * @param year The year.
+ * @param month The month.
+ * @param out The number of days in the month (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see days_in_month()
+ */
+DateTimeError days_in_month_checked(int year, int month, int *out);
+
 /**
  * @brief Get the number of days in the year.
  * @param year The year.
@@ -138,6 +273,28 @@ int days_in_year(int year);
  */
 int nth_day_of_year(int year, int month, int day);
 
+/**
+ * @brief Determine the given date is the n-th day of the year, reporting errors to the caller.
+ * @param year The year.
+ * @param month The month.
+ * @param day The day.
+ * @param out The n-th day of the year (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see nth_day_of_year()
+ */
+DateTimeError nth_day_of_year_checked(int year, int month, int day, int *out);
+
+/**
+ * @brief Determine the given date is the n-th day of the year, without validating the arguments.
+ * @param year The year.
+ * @param month The month.
+ * @param day The day.
+ * @return Returns the n-th day of the year.
+ * @note The date must be valid.
+ * @see nth_day_of_year()
+ */
+int nth_day_of_year_unchecked(int year, int month, int day);
+
 /**
  * @brief Determine the day of the week.
  * @param year The year.
@@ -147,15 +304,176 @@ int nth_day_of_year(int year, int month, int day);
  */
 Weekday weekday(int year, int month, int day);
 
+/**
+ * @brief Determine the day of the week, reporting errors to the caller.
+ * @param year The year.
+ * @param month The month.
+ * @param day The day.
+ * @param out The day of the week (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see weekday()
+ */
+DateTimeError weekday_checked(int year, int month, int day, Weekday *out);
+
+/**
+ * @brief Determine the day of the week, without validating the arguments.
+ * @param year The year.
+ * @param month The month.
+ * @param day The day.
+ * @return Returns the day of the week.
+ * @note The date must be valid.
+ * @see weekday()
+ */
+Weekday weekday_unchecked(int year, int month, int day);
+
+/**
+ * @brief Determine the day of the week from the ordinal (since 0001-01-01).
+ * @param ordinal The ordinal (1 ~ 3652059).
+ * @return Returns the day of the week.
+ */
+Weekday weekday_from_ordinal(int ordinal);
+
+/**
+ * @brief Determine the day of the week from the ordinal, reporting errors to the caller.
+ * @param ordinal The ordinal (1 ~ 3652059).
+ * @param out The day of the week (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see weekday_from_ordinal()
+ */
+DateTimeError weekday_from_ordinal_checked(int ordinal, Weekday *out);
+
+/**
+ * @brief Determine the day of the week from the ordinal, without validating the arguments.
+ * @param ordinal The ordinal (1 ~ 3652059).
+ * @return Returns the day of the week.
+ * @note The ordinal must be in range. It is a single mod 7, since 0001-01-01 is a Monday.
+ * @see weekday_from_ordinal()
+ */
+Weekday weekday_from_ordinal_unchecked(int ordinal);
+
+/**
+ * @brief Determine the day of the week of every Date object.
+ * @param dates The array of count Date objects. Every Date object must be valid.
+ * @param weekdays The array of count weekdays (output).
+ * @param count The number of rows.
+ * @note Runs 8 rows at a time with AVX2 when the CPU supports it.
+ */
+void weekday_many(const Date *dates, Weekday *weekdays, size_t count);
+
+/**
+ * @brief Get the number of ISO 8601 weeks in the week-numbering year.
+ * @param year The year.
+ * @return Returns 53 if the year starts on a Thursday, or is a leap year starting on a Wednesday, otherwise returns 52.
+ */
+int iso_weeks_in_year(int year);
+
+/**
+ * @brief Get the ISO 8601 week date of the date.
+ * @param date The Date object.
+ * @return Returns the IsoWeek object.
+ */
+IsoWeek iso_week(Date date);
+
+/**
+ * @brief Get the ISO 8601 week date of the date, reporting errors to the caller.
+ * @param date The Date object.
+ * @param out The IsoWeek object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see iso_week()
+ */
+DateTimeError iso_week_checked(Date date, IsoWeek *out);
+
+/**
+ * @brief Get the ISO 8601 week date of the date, without validating the arguments.
+ * @param date The Date object.
+ * @return Returns the IsoWeek object.
+ * @note The date must be valid.
+ * @see iso_week()
+ */
+IsoWeek iso_week_unchecked(Date date);
+
+/**
+ * @brief Create a Date object from the ISO 8601 week date.
+ * @param year The week-numbering year.
+ * @param week The week (1 ~ iso_weeks_in_year(year)).
+ * @param weekday The day of the week (1 ~ 7, Monday is 1).
+ * @return Returns the Date object.
+ */
+Date date_from_iso_week(int year, int week, int weekday);
+
+/**
+ * @brief Create a Date object from the ISO 8601 week date, reporting errors to the caller.
+ * @param year The week-numbering year.
+ * @param week The week (1 ~ iso_weeks_in_year(year)).
+ * @param weekday The day of the week (1 ~ 7, Monday is 1).
+ * @param out The Date object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see date_from_iso_week()
+ */
+DateTimeError date_from_iso_week_checked(int year, int week, int weekday, Date *out);
+
+/**
+ * @brief Create a Date object from the ISO 8601 week date, without validating the arguments.
+ * @param year The week-numbering year.
+ * @param week The week (1 ~ iso_weeks_in_year(year)).
+ * @param weekday The day of the week (1 ~ 7, Monday is 1).
+ * @return Returns the Date object.
+ * @note The week date must be valid and fall in 0001-01-01 ~ 9999-12-31.
+ * @see date_from_iso_week()
+ */
+Date date_from_iso_week_unchecked(int year, int week, int weekday);
+
+/**
+ * @brief Get the ISO 8601 week date of every Date object.
+ * @param dates The array of count Date objects. Every Date object must be valid.
+ * @param weeks The array of count IsoWeek objects (output).
+ * @param count The number of rows.
+ */
+void iso_week_many(const Date *dates, IsoWeek *weeks, size_t count);
+
+/**
+ * @brief Create the Date object of every ISO 8601 week date.
+ * @param weeks The array of count IsoWeek objects. Every week date must be valid (see date_from_iso_week_checked()).
+ * @param dates The array of count Date objects (output).
+ * @param count The number of rows.
+ */
+void date_from_iso_week_many(const IsoWeek *weeks, Date *dates, size_t count);
+
 /**
  * @brief Get the string representation of the calendar for the given month.
  * @param year The year.
  * @param month The month.
- * @return Returns the string representation of the calendar for the given month.
+ * @return Returns the string representation of the calendar for the given month, or NULL if the year or the
+ *         month is invalid.
  * @note The caller must free the returned string.
  */
 char *calendar(int year, int month);
 
+/**
+ * @brief Write the string representation of the calendar for the given month into the buffer.
+ * @param year The year.
+ * @param month The month.
+ * @param buffer The buffer (output), can be NULL if size is 0.
+ * @param size The size of the buffer. At most size - 1 characters are written, followed by a NUL terminator.
+ * @return Returns the length of the full string, excluding the NUL terminator, like snprintf().
+ *         The output is truncated if the return value is >= size. Returns 0 if the year or the month is invalid.
+ */
+size_t calendar_buffer(int year, int month, char *buffer, size_t size);
+
+/**
+ * @brief Write the string representation of the calendar for the given month into the buffer, reporting errors to
+ *        the caller.
+ * @param year The year.
+ * @param month The month.
+ * @param buffer The buffer (output), can be NULL if size is 0. Unchanged on error.
+ * @param size The size of the buffer. At most size - 1 characters are written, followed by a NUL terminator.
+ * @param out The length of the full string, excluding the NUL terminator, like snprintf() (output).
+ *            Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see calendar_buffer()
+ */
+DateTimeError calendar_buffer_checked(int year, int month, char *buffer, size_t size, size_t *out);
+
 /**
  * @brief Create a TimeInterval object.
  * @param days The days.
@@ -167,6 +485,19 @@ char *calendar(int year, int month);
  */
 TimeInterval time_interval_create(int days, int hours, int minutes, int seconds, int milliseconds);
 
+/**
+ * @brief Create a TimeInterval object, reporting errors to the caller.
+ * @param days The days.
+ * @param hours The hours.
+ * @param minutes The minutes.
+ * @param seconds The seconds.
+ * @param milliseconds The milliseconds.
+ * @param out The TimeInterval object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see time_interval_create()
+ */
+DateTimeError time_interval_create_checked(int days, int hours, int minutes, int seconds, int milliseconds, TimeInterval *out);
+
 /**
  * @brief Get the string representation of the time interval.
  * @param time_interval The TimeInterval object.
@@ -175,6 +506,16 @@ TimeInterval time_interval_create(int days, int hours, int minutes, int seconds,
  */
 char *time_interval_to_string(TimeInterval time_interval);
 
+/**
+ * @brief Write the string representation of the time interval into the buffer.
+ * @param time_interval The TimeInterval object.
+ * @param buffer The buffer (output), can be NULL if size is 0.
+ * @param size The size of the buffer. At most size - 1 characters are written, followed by a NUL terminator.
+ * @return Returns the length of the full string, excluding the NUL terminator, like snprintf().
+ *         The output is truncated if the return value is >= size. Returns 0 if the time interval is invalid.
+ */
+size_t time_interval_to_string_buffer(TimeInterval time_interval, char *buffer, size_t size);
+
 /**
  * @brief Create a Date object.
  * @param year The year.
@@ -184,6 +525,17 @@ char *time_interval_to_string(TimeInterval time_interval);
  */
 Date date_create(int year, int month, int day);
 
+/**
+ * @brief Create a Date object, reporting errors to the caller.
+ * @param year The year.
+ * @param month The month.
+ * @param day The day.
+ * @param out The Date object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see date_create()
+ */
+DateTimeError date_create_checked(int year, int month, int day, Date *out);
+
 /**
  * @brief Get the current date.
  * @return Returns the Date object.
@@ -200,6 +552,28 @@ Date date_now();
  */
 int date_compare(Date date1, Date date2);
 
+/**
+ * @brief Compare two Date objects, reporting errors to the caller.
+ * @param date1 The first Date object.
+ * @param date2 The second Date object.
+ * @param out The result as returned by date_compare() (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see date_compare()
+ */
+DateTimeError date_compare_checked(Date date1, Date date2, int *out);
+
+/**
+ * @brief Compare two Date objects, without validating the arguments.
+ * @param date1 The first Date object.
+ * @param date2 The second Date object.
+ * @return Returns 1 if date1 is greater than date2.
+ *         Returns -1 if date1 is less than date2.
+ *         Returns 0 if date1 is equal to date2.
+ * @note Both Date objects must be valid.
+ * @see date_compare()
+ */
+int date_compare_unchecked(Date date1, Date date2);
+
 /**
  * @brief Add days to the date.
  * @param date The Date object.
@@ -208,6 +582,26 @@ int date_compare(Date date1, Date date2);
  */
 Date date_add(Date date, int days);
 
+/**
+ * @brief Add days to the date, reporting errors to the caller.
+ * @param date The Date object.
+ * @param days The number of days to add/subtract.
+ * @param out The new Date object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see date_add()
+ */
+DateTimeError date_add_checked(Date date, int days, Date *out);
+
+/**
+ * @brief Add days to the date, without validating the arguments.
+ * @param date The Date object.
+ * @param days The number of days to add/subtract.
+ * @return Returns the new Date object.
+ * @note The Date object and the result must be valid.
+ * @see date_add()
+ */
+Date date_add_unchecked(Date date, int days);
+
 /**
  * @brief Get the the days between two Date objects.
  * @param date1 The first Date object.
@@ -216,6 +610,26 @@ Date date_add(Date date, int days);
  */
 int date_diff(Date date1, Date date2);
 
+/**
+ * @brief Get the the days between two Date objects, reporting errors to the caller.
+ * @param date1 The first Date object.
+ * @param date2 The second Date object.
+ * @param out The days between two Date objects (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see date_diff()
+ */
+DateTimeError date_diff_checked(Date date1, Date date2, int *out);
+
+/**
+ * @brief Get the the days between two Date objects, without validating the arguments.
+ * @param date1 The first Date object.
+ * @param date2 The second Date object.
+ * @return Returns the days between two Date objects.
+ * @note Both Date objects must be valid.
+ * @see date_diff()
+ */
+int date_diff_unchecked(Date date1, Date date2);
+
 /**
  * @brief Get the string representation (yyyy-mm-dd) of the date.
  * @param date The Date object.
@@ -224,6 +638,16 @@ int date_diff(Date date1, Date date2);
  */
 char *date_to_string(Date date);
 
+/**
+ * @brief Write the string representation (yyyy-mm-dd) of the date into the buffer.
+ * @param date The Date object.
+ * @param buffer The buffer (output), can be NULL if size is 0.
+ * @param size The size of the buffer. At most size - 1 characters are written, followed by a NUL terminator.
+ * @return Returns the length of the full string, excluding the NUL terminator, like snprintf().
+ *         The output is truncated if the return value is >= size. Returns 0 if the date is invalid.
+ */
+size_t date_to_string_buffer(Date date, char *buffer, size_t size);
+
 /**
  * @brief Get the string representation (Day Mon dd yyyy) of the date.
  * @param date The Date object.
@@ -232,6 +656,16 @@ char *date_to_string(Date date);
  */
 char *date_ascii_string(Date date);
 
+/**
+ * @brief Write the string representation (Day Mon dd yyyy) of the date into the buffer.
+ * @param date The Date object.
+ * @param buffer The buffer (output), can be NULL if size is 0.
+ * @param size The size of the buffer. At most size - 1 characters are written, followed by a NUL terminator.
+ * @return Returns the length of the full string, excluding the NUL terminator, like snprintf().
+ *         The output is truncated if the return value is >= size. Returns 0 if the date is invalid.
+ */
+size_t date_ascii_string_buffer(Date date, char *buffer, size_t size);
+
 /**
  * @brief Create a Time object.
  * @param hour The hour.
@@ -242,6 +676,18 @@ char *date_ascii_string(Date date);
  */
 Time time_create(int hour, int minute, int second, int millisecond);
 
+/**
+ * @brief Create a Time object, reporting errors to the caller.
+ * @param hour The hour.
+ * @param minute The minute.
+ * @param second The second.
+ * @param millisecond The millisecond.
+ * @param out The Time object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see time_create()
+ */
+DateTimeError time_create_checked(int hour, int minute, int second, int millisecond, Time *out);
+
 /**
  * @brief Get the current time.
  * @return Returns the Time object.
@@ -258,6 +704,28 @@ Time time_now();
  */
 int time_compare(Time time1, Time time2);
 
+/**
+ * @brief Compare two Time objects, reporting errors to the caller.
+ * @param time1 The first Time object.
+ * @param time2 The second Time object.
+ * @param out The result as returned by time_compare() (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see time_compare()
+ */
+DateTimeError time_compare_checked(Time time1, Time time2, int *out);
+
+/**
+ * @brief Compare two Time objects, without validating the arguments.
+ * @param time1 The first Time object.
+ * @param time2 The second Time object.
+ * @return Returns 1 if time1 is greater than time2.
+ *         Returns -1 if time1 is less than time2.
+ *         Returns 0 if time1 is equal to time2.
+ * @note Both Time objects must be valid.
+ * @see time_compare()
+ */
+int time_compare_unchecked(Time time1, Time time2);
+
 /**
  * @brief Add seconds to the time.
  * @param time The Time object.
@@ -266,6 +734,26 @@ int time_compare(Time time1, Time time2);
  */
 Time time_add(Time time, int milliseconds);
 
+/**
+ * @brief Add milliseconds to the time, reporting errors to the caller.
+ * @param time The Time object.
+ * @param milliseconds The number of milliseconds to add/subtract.
+ * @param out The new Time object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see time_add()
+ */
+DateTimeError time_add_checked(Time time, int milliseconds, Time *out);
+
+/**
+ * @brief Add milliseconds to the time, without validating the arguments.
+ * @param time The Time object.
+ * @param milliseconds The number of milliseconds to add/subtract.
+ * @return Returns the new Time object.
+ * @note The Time object must be valid.
+ * @see time_add()
+ */
+Time time_add_unchecked(Time time, int milliseconds);
+
 /**
  * @brief Get the milliseconds between two Time objects.
  * @param time1 The first Time object.
@@ -274,6 +762,26 @@ Time time_add(Time time, int milliseconds);
  */
 int time_diff(Time time1, Time time2);
 
+/**
+ * @brief Get the milliseconds between two Time objects, reporting errors to the caller.
+ * @param time1 The first Time object.
+ * @param time2 The second Time object.
+ * @param out The milliseconds between two Time objects (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see time_diff()
+ */
+DateTimeError time_diff_checked(Time time1, Time time2, int *out);
+
+/**
+ * @brief Get the milliseconds between two Time objects, without validating the arguments.
+ * @param time1 The first Time object.
+ * @param time2 The second Time object.
+ * @return Returns the milliseconds between two Time objects.
+ * @note Both Time objects must be valid.
+ * @see time_diff()
+ */
+int time_diff_unchecked(Time time1, Time time2);
+
 /**
  * @brief Get the string representation (hh:mm:ss.fff) of the time.
  * @param time The Time object.
@@ -282,6 +790,16 @@ int time_diff(Time time1, Time time2);
  */
 char *time_to_string(Time time);
 
+/**
+ * @brief Write the string representation (hh:mm:ss.fff) of the time into the buffer.
+ * @param time The Time object.
+ * @param buffer The buffer (output), can be NULL if size is 0.
+ * @param size The size of the buffer. At most size - 1 characters are written, followed by a NUL terminator.
+ * @return Returns the length of the full string, excluding the NUL terminator, like snprintf().
+ *         The output is truncated if the return value is >= size. Returns 0 if the time is invalid.
+ */
+size_t time_to_string_buffer(Time time, char *buffer, size_t size);
+
 /**
  * @brief Get the string representation (hh:mm:ss) of the time.
  * @param time The Time object.
@@ -290,6 +808,16 @@ char *time_to_string(Time time);
  */
 char *time_ascii_string(Time time);
 
+/**
+ * @brief Write the string representation (hh:mm:ss) of the time into the buffer.
+ * @param time The Time object.
+ * @param buffer The buffer (output), can be NULL if size is 0.
+ * @param size The size of the buffer. At most size - 1 characters are written, followed by a NUL terminator.
+ * @return Returns the length of the full string, excluding the NUL terminator, like snprintf().
+ *         The output is truncated if the return value is >= size. Returns 0 if the time is invalid.
+ */
+size_t time_ascii_string_buffer(Time time, char *buffer, size_t size);
+
 /**
  * @brief Create a DateTime object.
  * @param year The year.
@@ -303,19 +831,71 @@ char *time_ascii_string(Time time);
  */
 DateTime datetime_create(int year, int month, int day, int hour, int minute, int second, int millisecond);
 
+/**
+ * @brief Create a DateTime object, reporting errors to the caller.
+ * @param year The year.
+ * @param month The month.
+ * @param day The day.
+ * @param hour The hour.
+ * @param minute The minute.
+ * @param second The second.
+ * @param millisecond The millisecond.
+ * @param out The DateTime object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see datetime_create()
+ */
+DateTimeError datetime_create_checked(int year, int month, int day, int hour, int minute, int second, int millisecond, DateTime *out);
+
 /**
  * @brief Get the current datetime.
- * @return Returns the DateTime object.
+ * @return Returns the DateTime object, in local time.
+ * @note The date and the time come from the same reading of the clock.
+ * @see datetime_now_snapshot()
  */
 DateTime datetime_now();
 
+/**
+ * @brief Get the current datetime in UTC.
+ * @return Returns the DateTime object, in UTC.
+ * @see datetime_now_snapshot()
+ */
+DateTime datetime_now_utc(void);
+
+/**
+ * @brief Read the wall clock once, and convert the reading to UTC and to local time.
+ * @param clock The clock to read. CLOCK_REALTIME_COARSE falls back to CLOCK_REALTIME where it is missing.
+ * @return Returns the DateTimeSnapshot object, every field from the same reading.
+ * @note One clock_gettime(), through the vDSO on Linux. localtime() only runs when the reading leaves the quarter
+ *       hour of UTC whose offset the calling thread has cached, as time zones change offsets on quarter hours,
+ *       so a change of the TZ environment variable shows within 15 minutes.
+ */
+DateTimeSnapshot datetime_now_snapshot(DateTimeClock clock);
+
 /**
  * @brief Create a DateTime object from the Unix timestamp (since 1970-01-01 00:00:00 UTC).
- * @param timestamp The Unix timestamp. The range of timestamp is 0 ~ 2147483647 (2038-01-19 03:14:07 UTC).
+ * @param timestamp The Unix timestamp. The range of timestamp is -62135596800 (0001-01-01 00:00:00 UTC) ~ 253402300799 (9999-12-31 23:59:59 UTC).
  * @return Returns the DateTime object.
  */
 DateTime datetime_from_timestamp(time_t timestamp);
 
+/**
+ * @brief Create a DateTime object from the Unix timestamp, reporting errors to the caller.
+ * @param timestamp The Unix timestamp. The range of timestamp is -62135596800 (0001-01-01 00:00:00 UTC) ~ 253402300799 (9999-12-31 23:59:59 UTC).
+ * @param out The DateTime object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see datetime_from_timestamp()
+ */
+DateTimeError datetime_from_timestamp_checked(time_t timestamp, DateTime *out);
+
+/**
+ * @brief Create a DateTime object from the Unix timestamp, without validating the arguments.
+ * @param timestamp The Unix timestamp. The range of timestamp is -62135596800 (0001-01-01 00:00:00 UTC) ~ 253402300799 (9999-12-31 23:59:59 UTC).
+ * @return Returns the DateTime object.
+ * @note The timestamp must be in range.
+ * @see datetime_from_timestamp()
+ */
+DateTime datetime_from_timestamp_unchecked(time_t timestamp);
+
 /**
  * @brief Convert the DateTime object to the Unix timestamp (since 1970-01-01 00:00:00 UTC).
  * @param datetime The DateTime object.
@@ -323,6 +903,24 @@ DateTime datetime_from_timestamp(time_t timestamp);
  */
 time_t datetime_to_timestamp(DateTime datetime);
 
+/**
+ * @brief Convert the DateTime object to the Unix timestamp, reporting errors to the caller.
+ * @param datetime The DateTime object.
+ * @param out The Unix timestamp (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see datetime_to_timestamp()
+ */
+DateTimeError datetime_to_timestamp_checked(DateTime datetime, time_t *out);
+
+/**
+ * @brief Convert the DateTime object to the Unix timestamp, without validating the arguments.
+ * @param datetime The DateTime object.
+ * @return Returns the Unix timestamp.
+ * @note The DateTime object must be valid.
+ * @see datetime_to_timestamp()
+ */
+time_t datetime_to_timestamp_unchecked(DateTime datetime);
+
 /**
  * @brief Create a DateTime object from the ordinal (since 0001-01-01 00:00:00).
  * @param ordinal The ordinal.
@@ -330,6 +928,24 @@ time_t datetime_to_timestamp(DateTime datetime);
  */
 DateTime datetime_from_ordinal(int ordinal);
 
+/**
+ * @brief Create a DateTime object from the ordinal, reporting errors to the caller.
+ * @param ordinal The ordinal.
+ * @param out The DateTime object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see datetime_from_ordinal()
+ */
+DateTimeError datetime_from_ordinal_checked(int ordinal, DateTime *out);
+
+/**
+ * @brief Create a DateTime object from the ordinal, without validating the arguments.
+ * @param ordinal The ordinal.
+ * @return Returns the DateTime object.
+ * @note The ordinal must be in range.
+ * @see datetime_from_ordinal()
+ */
+DateTime datetime_from_ordinal_unchecked(int ordinal);
+
 /**
  * @brief Convert the DateTime object to the ordinal (since 0001-01-01 00:00:00).
  * @param datetime The DateTime object.
@@ -337,6 +953,24 @@ DateTime datetime_from_ordinal(int ordinal);
  */
 int datetime_to_ordinal(DateTime datetime);
 
+/**
+ * @brief Convert the DateTime object to the ordinal, reporting errors to the caller.
+ * @param datetime The DateTime object.
+ * @param out The ordinal (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see datetime_to_ordinal()
+ */
+DateTimeError datetime_to_ordinal_checked(DateTime datetime, int *out);
+
+/**
+ * @brief Convert the DateTime object to the ordinal, without validating the arguments.
+ * @param datetime The DateTime object.
+ * @return Returns the ordinal.
+ * @note The DateTime object must be valid.
+ * @see datetime_to_ordinal()
+ */
+int datetime_to_ordinal_unchecked(DateTime datetime);
+
 /**
  * @brief Compare two DateTime objects.
  * @param datetime1 The first DateTime object.
@@ -347,6 +981,28 @@ int datetime_to_ordinal(DateTime datetime);
  */
 int datetime_compare(DateTime datetime1, DateTime datetime2);
 
+/**
+ * @brief Compare two DateTime objects, reporting errors to the caller.
+ * @param datetime1 The first DateTime object.
+ * @param datetime2 The second DateTime object.
+ * @param out The result as returned by datetime_compare() (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see datetime_compare()
+ */
+DateTimeError datetime_compare_checked(DateTime datetime1, DateTime datetime2, int *out);
+
+/**
+ * @brief Compare two DateTime objects, without validating the arguments.
+ * @param datetime1 The first DateTime object.
+ * @param datetime2 The second DateTime object.
+ * @return Returns 1 if datetime1 is greater than datetime2.
+ *         Returns -1 if datetime1 is less than datetime2.
+ *         Returns 0 if datetime1 is equal to datetime2.
+ * @note Both DateTime objects must be valid.
+ * @see datetime_compare()
+ */
+int datetime_compare_unchecked(DateTime datetime1, DateTime datetime2);
+
 /**
  * @brief Add days and milliseconds to the datetime.
  * @param datetime The DateTime object.
@@ -356,6 +1012,28 @@ int datetime_compare(DateTime datetime1, DateTime datetime2);
  */
 DateTime datetime_add(DateTime datetime, int days, int milliseconds);
 
+/**
+ * @brief Add days and milliseconds to the datetime, reporting errors to the caller.
+ * @param datetime The DateTime object.
+ * @param days The number of days to add/subtract.
+ * @param milliseconds The number of milliseconds to add/subtract.
+ * @param out The new DateTime object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see datetime_add()
+ */
+DateTimeError datetime_add_checked(DateTime datetime, int days, int milliseconds, DateTime *out);
+
+/**
+ * @brief Add days and milliseconds to the datetime, without validating the arguments.
+ * @param datetime The DateTime object.
+ * @param days The number of days to add/subtract.
+ * @param milliseconds The number of milliseconds to add/subtract.
+ * @return DateTime The new DateTime object.
+ * @note The DateTime object and the result must be valid.
+ * @see datetime_add()
+ */
+DateTime datetime_add_unchecked(DateTime datetime, int days, int milliseconds);
+
 /**
  * @brief Get the difference between two DateTime objects.
  * @param datetime1 The first DateTime object.
@@ -364,6 +1042,26 @@ DateTime datetime_add(DateTime datetime, int days, int milliseconds);
  */
 TimeInterval datetime_diff(DateTime datetime1, DateTime datetime2);
 
+/**
+ * @brief Get the difference between two DateTime objects, reporting errors to the caller.
+ * @param datetime1 The first DateTime object.
+ * @param datetime2 The second DateTime object.
+ * @param out The difference between two DateTime objects (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see datetime_diff()
+ */
+DateTimeError datetime_diff_checked(DateTime datetime1, DateTime datetime2, TimeInterval *out);
+
+/**
+ * @brief Get the difference between two DateTime objects, without validating the arguments.
+ * @param datetime1 The first DateTime object.
+ * @param datetime2 The second DateTime object.
+ * @return TimeInterval The difference between two DateTime objects.
+ * @note Both DateTime objects must be valid.
+ * @see datetime_diff()
+ */
+TimeInterval datetime_diff_unchecked(DateTime datetime1, DateTime datetime2);
+
 /**
  * @brief Get the string representation (yyyy-mm-dd hh:mm:ss.fff) of the datetime.
  * @param datetime The DateTime object.
@@ -372,6 +1070,16 @@ TimeInterval datetime_diff(DateTime datetime1, DateTime datetime2);
  */
 char *datetime_to_string(DateTime datetime);
 
+/**
+ * @brief Write the string representation (yyyy-mm-dd hh:mm:ss.fff) of the datetime into the buffer.
+ * @param datetime The DateTime object.
+ * @param buffer The buffer (output), can be NULL if size is 0.
+ * @param size The size of the buffer. At most size - 1 characters are written, followed by a NUL terminator.
+ * @return Returns the length of the full string, excluding the NUL terminator, like snprintf().
+ *         The output is truncated if the return value is >= size. Returns 0 if the datetime is invalid.
+ */
+size_t datetime_to_string_buffer(DateTime datetime, char *buffer, size_t size);
+
 /**
  * @brief Get the string representation (Day Mon dd hh:mm:ss yyyy) of the datetime.
  * @param datetime DateTime Time object.
@@ -380,6 +1088,16 @@ char *datetime_to_string(DateTime datetime);
  */
 char *datetime_ascii_string(DateTime datetime);
 
+/**
+ * @brief Write the string representation (Day Mon dd hh:mm:ss yyyy) of the datetime into the buffer.
+ * @param datetime The DateTime object.
+ * @param buffer The buffer (output), can be NULL if size is 0.
+ * @param size The size of the buffer. At most size - 1 characters are written, followed by a NUL terminator.
+ * @return Returns the length of the full string, excluding the NUL terminator, like snprintf().
+ *         The output is truncated if the return value is >= size. Returns 0 if the datetime is invalid.
+ */
+size_t datetime_ascii_string_buffer(DateTime datetime, char *buffer, size_t size);
+
 /**
  * @brief Get the specified string representation of the datetime.
  * @param datetime The DateTime object.
@@ -391,14 +1109,25 @@ char *datetime_ascii_string(DateTime datetime);
  * | %B        | Full month name                                           | March                    |
  * | %c        | Date and time representation for the current locale       | Sun Aug 19 02:56:02 2012 |
  * | %d        | Day of the month (01-31)                                  | 19                       |
+ * | %D        | Short date, same as %m/%d/%y                              | 08/19/12                 |
+ * | %F        | Short date, same as %Y-%m-%d                              | 2012-08-19               |
+ * | %G        | ISO 8601 week-numbering year                              | 2012                     |
+ * | %h        | Abbreviated month name, same as %b                        | Mar                      |
  * | %H        | Hour in 24h format (00-23)                                | 14                       |
  * | %I        | Hour in 12h format (01-12)                                | 02                       |
  * | %j        | Day of the year (001-366)                                 | 231                      |
  * | %m        | Month as a decimal number (01-12)                         | 08                       |
  * | %M        | Minute (00-59)                                            | 55                       |
+ * | %n        | A new-line character                                      |                          |
  * | %p        | AM or PM                                                  | PM                       |
+ * | %r        | 12-hour clock time, same as %I:%M:%S %p                   | 02:55:02 PM              |
+ * | %R        | 24-hour clock time, same as %H:%M                         | 14:55                    |
  * | %S        | Second (00-61)                                            | 02                       |
+ * | %t        | A horizontal-tab character                                |                          |
+ * | %T        | Time, same as %H:%M:%S                                    | 14:55:02                 |
+ * | %u        | ISO 8601 weekday as a decimal number (1-7, Monday is 1)   | 7                        |
  * | %U        | Week number of the year (Sunday as the first day) (00-53) | 33                       |
+ * | %V        | ISO 8601 week number of the year (01-53)                  | 33                       |
  * | %w        | Weekday as a decimal number (0-6)                         | 4                        |
  * | %W        | Week number of the year (Monday as the first day) (00-53) | 34                       |
  * | %x        | Date representation for the current locale                | 08/19/12                 |
@@ -408,8 +1137,451 @@ char *datetime_ascii_string(DateTime datetime);
  * | %z        | Timezone offset (+0000)                                   | +0000                    |
  * | %%        | A % sign                                                  | %                        |
  * @return Returns the specified string representation of the datetime.
- * @note The caller must free the returned string.
+ * @note The formats with other specifiers, flags or widths (%Z, %-d, %10Y...) go through strftime(), slower.
+ *       The caller must free the returned string.
  */
 char *datetime_format_string(DateTime datetime, const char *format);
 
+/**
+ * @brief Create a DateTimeFormat object, the compiled plan of the format string.
+ * @param format The format string. The specifiers are listed in datetime_format_string().
+ * @return Returns the DateTimeFormat object, or NULL if the format has an unsupported specifier or the allocation fails.
+ * @note The caller must destroy the returned format with datetime_format_destroy().
+ */
+DateTimeFormat *datetime_format_create(const char *format);
+
+/**
+ * @brief Destroy the DateTimeFormat object.
+ * @param format The DateTimeFormat object.
+ */
+void datetime_format_destroy(DateTimeFormat *format);
+
+/**
+ * @brief Get the maximum length of the strings rendered by the DateTimeFormat object.
+ * @param format The DateTimeFormat object.
+ * @return Returns the maximum number of characters, excluding the NUL terminator.
+ */
+size_t datetime_format_max_length(const DateTimeFormat *format);
+
+/**
+ * @brief Render the DateTime object with the compiled format.
+ * @param format The DateTimeFormat object.
+ * @param datetime The DateTime object.
+ * @param buffer The buffer (output), can be NULL if size is 0.
+ * @param size The size of the buffer. At most size - 1 characters are written, followed by a NUL terminator.
+ * @return Returns the length of the full string, excluding the NUL terminator, like snprintf().
+ *         The output is truncated if the return value is >= size. Returns 0 if the DateTime object is invalid.
+ */
+size_t datetime_format_render(const DateTimeFormat *format, DateTime datetime, char *buffer, size_t size);
+
+/**
+ * @brief Convert the DateTime object to the Instant.
+ * @param datetime The DateTime object.
+ * @return Returns the Instant (milliseconds since 1970-01-01 00:00:00.000 UTC).
+ */
+Instant instant_from_datetime(DateTime datetime);
+
+/**
+ * @brief Convert the DateTime object to the Instant, reporting errors to the caller.
+ * @param datetime The DateTime object.
+ * @param out The Instant (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see instant_from_datetime()
+ */
+DateTimeError instant_from_datetime_checked(DateTime datetime, Instant *out);
+
+/**
+ * @brief Convert the DateTime object to the Instant, without validating the arguments.
+ * @param datetime The DateTime object.
+ * @return Returns the Instant (milliseconds since 1970-01-01 00:00:00.000 UTC).
+ * @note The DateTime object must be valid.
+ * @see instant_from_datetime()
+ */
+Instant instant_from_datetime_unchecked(DateTime datetime);
+
+/**
+ * @brief Convert the Instant to the DateTime object.
+ * @param instant The Instant. The range of instant is INSTANT_MIN (0001-01-01 00:00:00.000 UTC) ~ INSTANT_MAX (9999-12-31 23:59:59.999 UTC).
+ * @return Returns the DateTime object.
+ */
+DateTime instant_to_datetime(Instant instant);
+
+/**
+ * @brief Convert the Instant to the DateTime object, reporting errors to the caller.
+ * @param instant The Instant. The range of instant is INSTANT_MIN (0001-01-01 00:00:00.000 UTC) ~ INSTANT_MAX (9999-12-31 23:59:59.999 UTC).
+ * @param out The DateTime object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see instant_to_datetime()
+ */
+DateTimeError instant_to_datetime_checked(Instant instant, DateTime *out);
+
+/**
+ * @brief Convert the Instant to the DateTime object, without validating the arguments.
+ * @param instant The Instant. The range of instant is INSTANT_MIN (0001-01-01 00:00:00.000 UTC) ~ INSTANT_MAX (9999-12-31 23:59:59.999 UTC).
+ * @return Returns the DateTime object.
+ * @note The Instant must be in range.
+ * @see instant_to_datetime()
+ */
+DateTime instant_to_datetime_unchecked(Instant instant);
+
+/**
+ * @brief Compare two Instants.
+ * @param instant1 The first Instant.
+ * @param instant2 The second Instant.
+ * @return Returns 1 if instant1 is greater than instant2.
+ *         Returns -1 if instant1 is less than instant2.
+ *         Returns 0 if instant1 is equal to instant2.
+ */
+int instant_compare(Instant instant1, Instant instant2);
+
+/**
+ * @brief Add milliseconds to the Instant.
+ * @param instant The Instant.
+ * @param milliseconds The number of milliseconds to add/subtract.
+ * @return Returns the new Instant.
+ */
+Instant instant_add(Instant instant, int64_t milliseconds);
+
+/**
+ * @brief Get the milliseconds between two Instants.
+ * @param instant1 The first Instant.
+ * @param instant2 The second Instant.
+ * @return Returns the milliseconds between two Instants.
+ */
+int64_t instant_diff(Instant instant1, Instant instant2);
+
+/**
+ * @brief Get the earlier of two Instants.
+ * @param instant1 The first Instant.
+ * @param instant2 The second Instant.
+ * @return Returns the earlier Instant.
+ */
+Instant instant_min(Instant instant1, Instant instant2);
+
+/**
+ * @brief Get the later of two Instants.
+ * @param instant1 The first Instant.
+ * @param instant2 The second Instant.
+ * @return Returns the later Instant.
+ */
+Instant instant_max(Instant instant1, Instant instant2);
+
+/**
+ * @brief Pack the Date object into 32 bits (year:14 | month:4 | day:5).
+ * @param date The Date object.
+ * @return Returns the PackedDate.
+ */
+PackedDate date_pack(Date date);
+
+/**
+ * @brief Pack the Date object into 32 bits, reporting errors to the caller.
+ * @param date The Date object.
+ * @param out The PackedDate (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see date_pack()
+ */
+DateTimeError date_pack_checked(Date date, PackedDate *out);
+
+/**
+ * @brief Pack the Date object into 32 bits, without validating the arguments.
+ * @param date The Date object.
+ * @return Returns the PackedDate.
+ * @note The Date object must be valid.
+ * @see date_pack()
+ */
+PackedDate date_pack_unchecked(Date date);
+
+/**
+ * @brief Unpack the PackedDate into the Date object.
+ * @param packed_date The PackedDate.
+ * @return Returns the Date object.
+ */
+Date date_unpack(PackedDate packed_date);
+
+/**
+ * @brief Unpack the PackedDate into the Date object, reporting errors to the caller.
+ * @param packed_date The PackedDate.
+ * @param out The Date object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see date_unpack()
+ */
+DateTimeError date_unpack_checked(PackedDate packed_date, Date *out);
+
+/**
+ * @brief Unpack the PackedDate into the Date object, without validating the arguments.
+ * @param packed_date The PackedDate.
+ * @return Returns the Date object.
+ * @note The PackedDate must hold a valid date.
+ * @see date_unpack()
+ */
+Date date_unpack_unchecked(PackedDate packed_date);
+
+/**
+ * @brief Pack the Time object into 32 bits (milliseconds since midnight).
+ * @param time The Time object.
+ * @return Returns the PackedTime.
+ */
+PackedTime time_pack(Time time);
+
+/**
+ * @brief Pack the Time object into 32 bits, reporting errors to the caller.
+ * @param time The Time object.
+ * @param out The PackedTime (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see time_pack()
+ */
+DateTimeError time_pack_checked(Time time, PackedTime *out);
+
+/**
+ * @brief Pack the Time object into 32 bits, without validating the arguments.
+ * @param time The Time object.
+ * @return Returns the PackedTime.
+ * @note The Time object must be valid.
+ * @see time_pack()
+ */
+PackedTime time_pack_unchecked(Time time);
+
+/**
+ * @brief Unpack the PackedTime into the Time object.
+ * @param packed_time The PackedTime.
+ * @return Returns the Time object.
+ */
+Time time_unpack(PackedTime packed_time);
+
+/**
+ * @brief Unpack the PackedTime into the Time object, reporting errors to the caller.
+ * @param packed_time The PackedTime.
+ * @param out The Time object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see time_unpack()
+ */
+DateTimeError time_unpack_checked(PackedTime packed_time, Time *out);
+
+/**
+ * @brief Unpack the PackedTime into the Time object, without validating the arguments.
+ * @param packed_time The PackedTime.
+ * @return Returns the Time object.
+ * @note The PackedTime must be in range.
+ * @see time_unpack()
+ */
+Time time_unpack_unchecked(PackedTime packed_time);
+
+/**
+ * @brief Pack the DateTime object into 64 bits (PackedDate:32 | PackedTime:32).
+ * @param datetime The DateTime object.
+ * @return Returns the PackedDateTime.
+ */
+PackedDateTime datetime_pack(DateTime datetime);
+
+/**
+ * @brief Pack the DateTime object into 64 bits, reporting errors to the caller.
+ * @param datetime The DateTime object.
+ * @param out The PackedDateTime (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see datetime_pack()
+ */
+DateTimeError datetime_pack_checked(DateTime datetime, PackedDateTime *out);
+
+/**
+ * @brief Pack the DateTime object into 64 bits, without validating the arguments.
+ * @param datetime The DateTime object.
+ * @return Returns the PackedDateTime.
+ * @note The DateTime object must be valid.
+ * @see datetime_pack()
+ */
+PackedDateTime datetime_pack_unchecked(DateTime datetime);
+
+/**
+ * @brief Unpack the PackedDateTime into the DateTime object.
+ * @param packed_datetime The PackedDateTime.
+ * @return Returns the DateTime object.
+ */
+DateTime datetime_unpack(PackedDateTime packed_datetime);
+
+/**
+ * @brief Unpack the PackedDateTime into the DateTime object, reporting errors to the caller.
+ * @param packed_datetime The PackedDateTime.
+ * @param out The DateTime object (output). Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @see datetime_unpack()
+ */
+DateTimeError datetime_unpack_checked(PackedDateTime packed_datetime, DateTime *out);
+
+/**
+ * @brief Unpack the PackedDateTime into the DateTime object, without validating the arguments.
+ * @param packed_datetime The PackedDateTime.
+ * @return Returns the DateTime object.
+ * @note The PackedDateTime must hold a valid datetime.
+ * @see datetime_unpack()
+ */
+DateTime datetime_unpack_unchecked(PackedDateTime packed_datetime);
+
+/**
+ * @brief Create a DateTimeColumn object.
+ * @param length The number of rows.
+ * @return Returns the DateTimeColumn object with all fields set to 0, or NULL if the length is too large
+ *         or the allocation fails.
+ * @note The caller must destroy the returned column with datetime_column_destroy().
+ */
+DateTimeColumn *datetime_column_create(size_t length);
+
+/**
+ * @brief Create a DateTimeColumn object from the array of DateTime objects.
+ * @param datetimes The array of DateTime objects.
+ * @param length The number of DateTime objects.
+ * @return Returns the DateTimeColumn object, or NULL if the allocation fails.
+ * @note The caller must destroy the returned column with datetime_column_destroy().
+ */
+DateTimeColumn *datetime_column_from_array(const DateTime *datetimes, size_t length);
+
+/**
+ * @brief Destroy the DateTimeColumn object.
+ * @param column The DateTimeColumn object.
+ */
+void datetime_column_destroy(DateTimeColumn *column);
+
+/**
+ * @brief Set the row of the DateTimeColumn object.
+ * @param column The DateTimeColumn object.
+ * @param index The row index.
+ * @param datetime The DateTime object.
+ */
+void datetime_column_set(DateTimeColumn *column, size_t index, DateTime datetime);
+
+/**
+ * @brief Get the row of the DateTimeColumn object.
+ * @param column The DateTimeColumn object.
+ * @param index The row index.
+ * @return Returns the DateTime object.
+ */
+DateTime datetime_column_get(const DateTimeColumn *column, size_t index);
+
+/**
+ * @brief Validate every row of the DateTimeColumn object.
+ * @param column The DateTimeColumn object.
+ * @param valid The array of column->length results (output), 1 for a valid row and 0 otherwise, can be NULL.
+ *              An int array rather than bool, so that C and C++ agree on its layout.
+ * @return Returns the number of valid rows.
+ * @note Nothing is printed to stderr for invalid rows. Runs 8 rows at a time with AVX2 when the CPU supports it.
+ */
+size_t datetime_column_validate(const DateTimeColumn *column, int *valid);
+
+/**
+ * @brief Validate every row of the DateTimeColumn object into a packed bitmask.
+ * @param column The DateTimeColumn object.
+ * @param mask The array of DATETIME_MASK_WORDS(column->length) words (output). Bit i % 64 of mask[i / 64] is set
+ *             if the row i is valid. The unused bits of the last word are cleared.
+ * @return Returns the number of valid rows.
+ * @note The rules are the same as datetime_column_validate(). Nothing is printed to stderr for invalid rows.
+ *       Runs 8 rows at a time with AVX2 when the CPU supports it.
+ */
+size_t datetime_column_validate_mask(const DateTimeColumn *column, uint64_t *mask);
+
+/**
+ * @brief Convert every row of the DateTimeColumn object to the Unix timestamp.
+ * @param column The DateTimeColumn object. Every row must be valid (see datetime_column_validate()).
+ * @param timestamps The array of column->length Unix timestamps (output).
+ * @note Runs 8 rows at a time with AVX2 when the CPU supports it.
+ */
+void datetime_column_to_timestamp(const DateTimeColumn *column, time_t *timestamps);
+
+/**
+ * @brief Fill every row of the DateTimeColumn object from the Unix timestamps.
+ * @param column The DateTimeColumn object.
+ * @param timestamps The array of column->length Unix timestamps.
+ * @return Returns true if every timestamp is in range (see datetime_from_timestamp()), otherwise returns false.
+ *         Rows with out-of-range timestamps are left unchanged.
+ * @note Runs 8 rows at a time with AVX2 when the CPU supports it.
+ */
+bool datetime_column_from_timestamp(DateTimeColumn *column, const time_t *timestamps);
+
+/**
+ * @brief Convert every row of the DateTimeColumn object to the Instant.
+ * @param column The DateTimeColumn object. Every row must be valid (see datetime_column_validate()).
+ * @param instants The array of column->length Instants (output).
+ * @note Runs 8 rows at a time with AVX2 when the CPU supports it.
+ */
+void datetime_column_to_instant(const DateTimeColumn *column, Instant *instants);
+
+/**
+ * @brief Fill every row of the DateTimeColumn object from the Instants.
+ * @param column The DateTimeColumn object.
+ * @param instants The array of column->length Instants.
+ * @return Returns true if every Instant is in range (see instant_to_datetime()), otherwise returns false.
+ *         Rows with out-of-range Instants are left unchanged.
+ * @note Runs 8 rows at a time with AVX2 when the CPU supports it.
+ */
+bool datetime_column_from_instant(DateTimeColumn *column, const Instant *instants);
+
+/**
+ * @brief Determine the day of the week for every row of the DateTimeColumn object.
+ * @param column The DateTimeColumn object. Every row must be valid (see datetime_column_validate()).
+ * @param weekdays The array of column->length weekdays (output).
+ * @note Runs 8 rows at a time with AVX2 when the CPU supports it.
+ */
+void datetime_column_weekday(const DateTimeColumn *column, Weekday *weekdays);
+
+/**
+ * @brief Compare two DateTimeColumn objects row by row.
+ * @param column1 The first DateTimeColumn object. Every row must be valid (see datetime_column_validate()).
+ * @param column2 The second DateTimeColumn object with the same length. Every row must be valid.
+ * @param results The array of column1->length results (output), each as returned by datetime_compare().
+ */
+void datetime_column_compare(const DateTimeColumn *column1, const DateTimeColumn *column2, int *results);
+
+/**
+ * @brief Create DateTime objects from the Unix timestamps.
+ * @param timestamps The array of count Unix timestamps.
+ * @param datetimes The array of count DateTime objects (output).
+ * @param count The number of rows.
+ * @return Returns true if every timestamp is in range (see datetime_from_timestamp()), otherwise returns false.
+ *         Rows with out-of-range timestamps are left unchanged.
+ */
+bool datetime_array_from_timestamp(const time_t *timestamps, DateTime *datetimes, size_t count);
+
+/**
+ * @brief Convert the DateTime objects to the Unix timestamps.
+ * @param datetimes The array of count DateTime objects. Every DateTime object must be valid.
+ * @param timestamps The array of count Unix timestamps (output).
+ * @param count The number of rows.
+ */
+void datetime_array_to_timestamp(const DateTime *datetimes, time_t *timestamps, size_t count);
+
+/**
+ * @brief Write the string representations (yyyy-mm-dd hh:mm:ss.fff) of the DateTime objects.
+ * @param datetimes The array of count DateTime objects. Every DateTime object must be valid.
+ * @param buffer The buffer of count * stride characters (output). Row i is written NUL-terminated at buffer + i * stride.
+ * @param stride The distance between rows in the buffer, at least DATETIME_STRING_LENGTH + 1.
+ * @param count The number of rows.
+ */
+void datetime_array_to_string(const DateTime *datetimes, char *buffer, size_t stride, size_t count);
+
+/**
+ * @brief Parse the string representations (yyyy-mm-dd hh:mm:ss.fff) into DateTime objects.
+ * @param buffer The buffer of count * stride characters. Row i starts at buffer + i * stride and needs no NUL terminator.
+ * @param stride The distance between rows in the buffer, at least DATETIME_STRING_LENGTH.
+ * @param datetimes The array of count DateTime objects (output). Invalid rows are left unchanged.
+ * @param valid The array of count results (output), 1 for a valid row and 0 otherwise, can be NULL.
+ *              An int array rather than bool, so that C and C++ agree on its layout.
+ * @param count The number of rows.
+ * @return Returns the number of valid rows.
+ * @note Nothing is printed to stderr for invalid rows.
+ */
+size_t datetime_array_parse(const char *buffer, size_t stride, DateTime *datetimes, int *valid, size_t count);
+
+/**
+ * @brief Parse the ISO 8601 / RFC 3339 representation (yyyy-mm-ddThh:mm:ss[.fff][Z|+hh:mm|-hh:mm]) into a DateTime object.
+ * @param s The string. It needs no NUL terminator.
+ * @param len The number of characters of the string.
+ * @param out The DateTime object (output), in UTC if the string has a zone, otherwise as written. Unchanged on error.
+ * @return Returns DATETIME_OK on success, otherwise returns the error code.
+ * @note The separator between the date and the time can be 'T', 't' or ' '. The fraction can have any number of digits
+ *       and is truncated to milliseconds. Nothing is printed to stderr.
+ */
+DateTimeError datetime_parse_iso8601(const char *s, size_t len, DateTime *out);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif
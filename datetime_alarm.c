@@ -0,0 +1,332 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include "datetime_alarm.h"
+#include <errno.h>
+#include <stdlib.h>
+#include <time.h>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+#ifndef TFD_TIMER_CANCEL_ON_SET
+#define TFD_TIMER_CANCEL_ON_SET (1 << 1) /* Linux 2.6.37, not declared by older C libraries */
+#endif
+#endif
+
+#define return_if_fail(expr) \
+    if (!(expr)) {           \
+        return;              \
+    }
+
+#define return_value_if_fail(expr, ret) \
+    if (!(expr)) {                      \
+        return (ret);                   \
+    }
+
+struct DateTimeAlarm {
+    int fd;
+    bool local;
+    bool armed;
+    DateTime deadline;
+};
+
+/**
+ * @brief Convert the DateTime object to the timespec of CLOCK_REALTIME.
+ * @param datetime The DateTime object, in UTC.
+ * @param out The timespec (output), with tv_nsec in 0 ~ 999999999. Unchanged on error.
+ * @return Returns true on success, or false if the DateTime object is invalid.
+ * @note One multiply-add from the days since 1970-01-01, as instant_from_datetime().
+ */
+bool datetime_to_timespec(DateTime datetime, struct timespec *out) {
+    Instant instant;
+    Instant seconds;
+
+    return_value_if_fail(out != NULL && instant_from_datetime_checked(datetime, &instant) == DATETIME_OK, false);
+
+    /* Rounded down, so that the nanoseconds are positive before 1970 */
+    seconds = instant >= 0 ? instant / MILLISECONDS_PER_SECOND : -((-instant + MILLISECONDS_PER_SECOND - 1) / MILLISECONDS_PER_SECOND);
+    out->tv_sec = (time_t)seconds;
+    out->tv_nsec = (long)(instant - seconds * MILLISECONDS_PER_SECOND) * NANOSECONDS_PER_MILLISECOND;
+    return true;
+}
+
+#ifdef __linux__
+
+/**
+ * @brief Convert the deadline of the alarm to the timespec of CLOCK_REALTIME.
+ * @param alarm The DateTimeAlarm object.
+ * @param deadline The DateTime object.
+ * @param out The timespec (output).
+ * @return Returns true on success, or false if the deadline is invalid or does not exist in local time.
+ */
+static bool __deadline_timespec(const DateTimeAlarm *alarm, DateTime deadline, struct timespec *out) {
+    struct tm tm;
+    time_t seconds;
+
+    return_value_if_fail(datetime_to_timespec(deadline, out), false);
+    return_value_if_fail(alarm->local, true);
+
+    tm.tm_year = deadline.date.year - 1900;
+    tm.tm_mon = deadline.date.month - 1;
+    tm.tm_mday = deadline.date.day;
+    tm.tm_hour = deadline.time.hour;
+    tm.tm_min = deadline.time.minute;
+    tm.tm_sec = deadline.time.second;
+    tm.tm_isdst = -1;
+    seconds = mktime(&tm);
+    return_value_if_fail(seconds != (time_t)-1, false);
+
+    /* mktime() moves a time skipped by a change to daylight saving time past the gap: reject it instead */
+    return_value_if_fail(tm.tm_year == deadline.date.year - 1900 && tm.tm_mon == deadline.date.month - 1 &&
+                             tm.tm_mday == deadline.date.day && tm.tm_hour == deadline.time.hour &&
+                             tm.tm_min == deadline.time.minute && tm.tm_sec == deadline.time.second,
+                         false);
+    out->tv_sec = seconds;
+    return true;
+}
+
+/**
+ * @brief Arm the timerfd of the alarm at the deadline.
+ * @param alarm The DateTimeAlarm object.
+ * @param deadline The DateTime object.
+ * @return Returns true on success, otherwise returns false.
+ */
+static bool __arm(DateTimeAlarm *alarm, DateTime deadline) {
+    struct itimerspec spec;
+
+    if (!__deadline_timespec(alarm, deadline, &spec.it_value)) {
+        errno = EINVAL;
+        return false;
+    }
+    /* An it_value of 0 would disarm the timer: 1970-01-01 00:00:00 UTC has passed anyway */
+    if (spec.it_value.tv_sec == 0 && spec.it_value.tv_nsec == 0) {
+        spec.it_value.tv_nsec = 1;
+    }
+    spec.it_interval.tv_sec = 0;
+    spec.it_interval.tv_nsec = 0;
+    return_value_if_fail(timerfd_settime(alarm->fd, TFD_TIMER_ABSTIME | TFD_TIMER_CANCEL_ON_SET, &spec, NULL) == 0, false);
+
+    alarm->deadline = deadline;
+    alarm->armed = true;
+    return true;
+}
+
+/**
+ * @brief Create a DateTimeAlarm object, disarmed.
+ * @param local Nonzero if the deadlines are in local time, like datetime_now(), rather than in UTC.
+ *              Local deadlines are converted with mktime() when armed, and again when the clock is set.
+ * @return Returns the DateTimeAlarm object, or NULL if the timerfd cannot be created (see errno).
+ * @note The caller must destroy the returned alarm with datetime_alarm_destroy().
+ */
+DateTimeAlarm *datetime_alarm_create(int local) {
+    DateTimeAlarm *alarm = (DateTimeAlarm *)calloc(1, sizeof(DateTimeAlarm));
+
+    return_value_if_fail(alarm != NULL, NULL);
+    alarm->fd = timerfd_create(CLOCK_REALTIME, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (alarm->fd < 0) {
+        free(alarm);
+        return NULL;
+    }
+    alarm->local = local;
+    return alarm;
+}
+
+/**
+ * @brief Destroy the DateTimeAlarm object, closing its file descriptor.
+ * @param alarm The DateTimeAlarm object.
+ */
+void datetime_alarm_destroy(DateTimeAlarm *alarm) {
+    return_if_fail(alarm != NULL);
+
+    close(alarm->fd);
+    free(alarm);
+}
+
+/**
+ * @brief Get the file descriptor of the alarm.
+ * @param alarm The DateTimeAlarm object.
+ * @return Returns the non-blocking file descriptor, readable when datetime_alarm_read() has an event.
+ * @note Owned by the alarm: do not read or close it directly.
+ */
+int datetime_alarm_fd(const DateTimeAlarm *alarm) {
+    return alarm->fd;
+}
+
+/**
+ * @brief Arm the alarm at the deadline, replacing the previous one.
+ * @param alarm The DateTimeAlarm object.
+ * @param deadline The DateTime object, in local time or UTC as given to datetime_alarm_create().
+ * @return Returns true on success, or false if the deadline is invalid, does not exist in local time (skipped by a
+ *         change to daylight saving time), or the timerfd cannot be armed (see errno).
+ * @note A deadline that has already passed expires at once.
+ */
+bool datetime_alarm_set(DateTimeAlarm *alarm, DateTime deadline) {
+    return_value_if_fail(alarm != NULL, false);
+
+    return __arm(alarm, deadline);
+}
+
+/**
+ * @brief Disarm the alarm.
+ * @param alarm The DateTimeAlarm object.
+ * @return Returns true on success, otherwise returns false (see errno).
+ */
+bool datetime_alarm_clear(DateTimeAlarm *alarm) {
+    struct itimerspec spec;
+
+    return_value_if_fail(alarm != NULL, false);
+
+    spec.it_value.tv_sec = 0;
+    spec.it_value.tv_nsec = 0;
+    spec.it_interval = spec.it_value;
+    return_value_if_fail(timerfd_settime(alarm->fd, 0, &spec, NULL) == 0, false);
+    alarm->armed = false;
+    return true;
+}
+
+/**
+ * @brief Determine whether the alarm is armed.
+ * @param alarm The DateTimeAlarm object.
+ * @param deadline The deadline of the alarm (output), can be NULL.
+ * @return Returns true if the alarm is armed and its expiry has not been read, otherwise returns false.
+ */
+bool datetime_alarm_armed(const DateTimeAlarm *alarm, DateTime *deadline) {
+    return_value_if_fail(alarm != NULL && alarm->armed, false);
+
+    if (deadline != NULL) {
+        *deadline = alarm->deadline;
+    }
+    return true;
+}
+
+/**
+ * @brief Consume the pending event of the alarm, without blocking.
+ * @param alarm The DateTimeAlarm object.
+ * @return Returns ALARM_EXPIRED once the deadline has passed, ALARM_CLOCK_CHANGED if the wall clock was set
+ *         (an armed alarm is armed again, and expires at once if the jump went past the deadline; a disarmed
+ *         alarm stays disarmed), ALARM_NONE if there is no event, or ALARM_ERROR.
+ * @note Call it when the file descriptor is readable.
+ */
+AlarmEvent datetime_alarm_read(DateTimeAlarm *alarm) {
+    uint64_t expirations;
+    ssize_t size;
+
+    return_value_if_fail(alarm != NULL, ALARM_ERROR);
+
+    do {
+        size = read(alarm->fd, &expirations, sizeof(expirations));
+    } while (size < 0 && errno == EINTR);
+
+    if (size == (ssize_t)sizeof(expirations)) {
+        alarm->armed = false;
+        return ALARM_EXPIRED;
+    }
+    return_value_if_fail(size < 0, ALARM_ERROR);
+    return_value_if_fail(errno != EAGAIN && errno != EWOULDBLOCK, ALARM_NONE);
+    return_value_if_fail(errno == ECANCELED, ALARM_ERROR);
+
+    /*
+     * The wall clock was set: the kernel cancelled the timer, arm it again with the new clock. The fd of an alarm
+     * that has expired stays registered for the changes of the clock until it is set again: clear it instead.
+     */
+    if (!alarm->armed) {
+        return_value_if_fail(datetime_alarm_clear(alarm), ALARM_ERROR);
+        return ALARM_CLOCK_CHANGED;
+    }
+    return_value_if_fail(__arm(alarm, alarm->deadline), ALARM_ERROR);
+    return ALARM_CLOCK_CHANGED;
+}
+
+/**
+ * @brief Block until the deadline passes, following the changes of the wall clock.
+ * @param alarm The DateTimeAlarm object.
+ * @param timeout_milliseconds The maximum time to wait in milliseconds, or -1 to wait without a limit.
+ * @return Returns ALARM_EXPIRED if the deadline has passed, ALARM_NONE on timeout or if the alarm is not armed,
+ *         or ALARM_ERROR.
+ */
+AlarmEvent datetime_alarm_wait(DateTimeAlarm *alarm, int timeout_milliseconds) {
+    struct pollfd pollfd;
+    struct timespec start;
+    struct timespec now;
+    AlarmEvent event;
+    int64_t remaining = timeout_milliseconds;
+    int ready;
+
+    return_value_if_fail(alarm != NULL, ALARM_ERROR);
+    return_value_if_fail(alarm->armed, ALARM_NONE);
+    return_value_if_fail(clock_gettime(CLOCK_MONOTONIC, &start) == 0, ALARM_ERROR);
+
+    pollfd.fd = alarm->fd;
+    pollfd.events = POLLIN;
+    for (;;) {
+        ready = poll(&pollfd, 1, timeout_milliseconds < 0 ? -1 : (int)remaining);
+        if (ready < 0 && errno != EINTR) {
+            return ALARM_ERROR;
+        }
+        if (ready > 0) {
+            event = datetime_alarm_read(alarm);
+            return_value_if_fail(event != ALARM_EXPIRED && event != ALARM_ERROR, event);
+        }
+        if (timeout_milliseconds >= 0) {
+            return_value_if_fail(clock_gettime(CLOCK_MONOTONIC, &now) == 0, ALARM_ERROR);
+            remaining = timeout_milliseconds - ((int64_t)(now.tv_sec - start.tv_sec) * MILLISECONDS_PER_SECOND +
+                                                (now.tv_nsec - start.tv_nsec) / NANOSECONDS_PER_MILLISECOND);
+            return_value_if_fail(remaining > 0, ALARM_NONE);
+        }
+    }
+}
+
+#else
+
+DateTimeAlarm *datetime_alarm_create(int local) {
+    (void)local;
+    errno = ENOSYS;
+    return NULL;
+}
+
+void datetime_alarm_destroy(DateTimeAlarm *alarm) {
+    (void)alarm;
+}
+
+int datetime_alarm_fd(const DateTimeAlarm *alarm) {
+    (void)alarm;
+    return -1;
+}
+
+bool datetime_alarm_set(DateTimeAlarm *alarm, DateTime deadline) {
+    (void)alarm;
+    (void)deadline;
+    errno = ENOSYS;
+    return false;
+}
+
+bool datetime_alarm_clear(DateTimeAlarm *alarm) {
+    (void)alarm;
+    errno = ENOSYS;
+    return false;
+}
+
+bool datetime_alarm_armed(const DateTimeAlarm *alarm, DateTime *deadline) {
+    (void)alarm;
+    (void)deadline;
+    return false;
+}
+
+AlarmEvent datetime_alarm_read(DateTimeAlarm *alarm) {
+    (void)alarm;
+    errno = ENOSYS;
+    return ALARM_ERROR;
+}
+
+AlarmEvent datetime_alarm_wait(DateTimeAlarm *alarm, int timeout_milliseconds) {
+    (void)alarm;
+    (void)timeout_milliseconds;
+    errno = ENOSYS;
+    return ALARM_ERROR;
+}
+
+#endif
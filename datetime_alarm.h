@@ -0,0 +1,110 @@
+#ifndef _DATETIME_ALARM_H_
+#define _DATETIME_ALARM_H_
+
+#include "datetime.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Defined by <time.h> with _POSIX_C_SOURCE >= 199309L. */
+struct timespec;
+
+/* What datetime_alarm_read() found. */
+typedef enum AlarmEvent {
+    ALARM_NONE,          /* the deadline has not passed */
+    ALARM_EXPIRED,       /* the deadline has passed, the alarm is disarmed */
+    ALARM_CLOCK_CHANGED, /* the wall clock was set, an armed alarm is armed again for the same deadline */
+    ALARM_ERROR          /* see errno */
+} AlarmEvent;
+
+/*
+ * A one-shot alarm at an absolute wall-clock deadline, on a Linux timerfd armed with
+ * TFD_TIMER_ABSTIME | TFD_TIMER_CANCEL_ON_SET. The file descriptor becomes readable when the deadline passes
+ * or the wall clock is set, so it can wait in epoll() or poll() next to sockets instead of polling datetime_now().
+ *
+ * Only available on Linux: elsewhere datetime_alarm_create() returns NULL with errno set to ENOSYS.
+ */
+typedef struct DateTimeAlarm DateTimeAlarm;
+
+/**
+ * @brief Convert the DateTime object to the timespec of CLOCK_REALTIME.
+ * @param datetime The DateTime object, in UTC.
+ * @param out The timespec (output), with tv_nsec in 0 ~ 999999999. Unchanged on error.
+ * @return Returns true on success, or false if the DateTime object is invalid.
+ * @note One multiply-add from the days since 1970-01-01, as instant_from_datetime().
+ */
+bool datetime_to_timespec(DateTime datetime, struct timespec *out);
+
+/**
+ * @brief Create a DateTimeAlarm object, disarmed.
+ * @param local Nonzero if the deadlines are in local time, like datetime_now(), rather than in UTC.
+ *              Local deadlines are converted with mktime() when armed, and again when the clock is set.
+ * @return Returns the DateTimeAlarm object, or NULL if the timerfd cannot be created (see errno).
+ * @note The caller must destroy the returned alarm with datetime_alarm_destroy().
+ */
+DateTimeAlarm *datetime_alarm_create(int local);
+
+/**
+ * @brief Destroy the DateTimeAlarm object, closing its file descriptor.
+ * @param alarm The DateTimeAlarm object.
+ */
+void datetime_alarm_destroy(DateTimeAlarm *alarm);
+
+/**
+ * @brief Get the file descriptor of the alarm.
+ * @param alarm The DateTimeAlarm object.
+ * @return Returns the non-blocking file descriptor, readable when datetime_alarm_read() has an event.
+ * @note Owned by the alarm: do not read or close it directly.
+ */
+int datetime_alarm_fd(const DateTimeAlarm *alarm);
+
+/**
+ * @brief Arm the alarm at the deadline, replacing the previous one.
+ * @param alarm The DateTimeAlarm object.
+ * @param deadline The DateTime object, in local time or UTC as given to datetime_alarm_create().
+ * @return Returns true on success, or false if the deadline is invalid, does not exist in local time (skipped by a
+ *         change to daylight saving time), or the timerfd cannot be armed (see errno).
+ * @note A deadline that has already passed expires at once.
+ */
+bool datetime_alarm_set(DateTimeAlarm *alarm, DateTime deadline);
+
+/**
+ * @brief Disarm the alarm.
+ * @param alarm The DateTimeAlarm object.
+ * @return Returns true on success, otherwise returns false (see errno).
+ */
+bool datetime_alarm_clear(DateTimeAlarm *alarm);
+
+/**
+ * @brief Determine whether the alarm is armed.
+ * @param alarm The DateTimeAlarm object.
+ * @param deadline The deadline of the alarm (output), can be NULL.
+ * @return Returns true if the alarm is armed and its expiry has not been read, otherwise returns false.
+ */
+bool datetime_alarm_armed(const DateTimeAlarm *alarm, DateTime *deadline);
+
+/**
+ * @brief Consume the pending event of the alarm, without blocking.
+ * @param alarm The DateTimeAlarm object.
+ * @return Returns ALARM_EXPIRED once the deadline has passed, ALARM_CLOCK_CHANGED if the wall clock was set
+ *         (an armed alarm is armed again, and expires at once if the jump went past the deadline; a disarmed
+ *         alarm stays disarmed), ALARM_NONE if there is no event, or ALARM_ERROR.
+ * @note Call it when the file descriptor is readable.
+ */
+AlarmEvent datetime_alarm_read(DateTimeAlarm *alarm);
+
+/**
+ * @brief Block until the deadline passes, following the changes of the wall clock.
+ * @param alarm The DateTimeAlarm object.
+ * @param timeout_milliseconds The maximum time to wait in milliseconds, or -1 to wait without a limit.
+ * @return Returns ALARM_EXPIRED if the deadline has passed, ALARM_NONE on timeout or if the alarm is not armed,
+ *         or ALARM_ERROR.
+ */
+AlarmEvent datetime_alarm_wait(DateTimeAlarm *alarm, int timeout_milliseconds);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
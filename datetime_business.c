@@ -0,0 +1,630 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include "datetime_business.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define return_if_fail(expr) \
+    if (!(expr)) {           \
+        return;              \
+    }
+
+#define return_value_if_fail(expr, ret) \
+    if (!(expr)) {                      \
+        return (ret);                   \
+    }
+
+#define MAX_ORDINAL 3652059 /* 9999-12-31 */
+#define WORD_DAYS 64
+
+#define IMAGE_MAGIC 0x43425444 /* "DTBC" in little-endian order, byte-swapped on the other byte order */
+#define IMAGE_VERSION 1
+
+/*
+ * The image: the header, then words uint64_t of business days (bit i of word w is the day first + w * 64 + i),
+ * then words + 1 uint32_t of the number of business days before every word, the last one being the total.
+ */
+typedef struct BusinessCalendarHeader {
+    uint32_t magic;
+    uint32_t version;
+    int32_t first;  /* the ordinal of the first date */
+    int32_t length; /* the number of days */
+    int32_t weekend_mask;
+    uint32_t words;
+} BusinessCalendarHeader;
+
+/* Who releases the image. */
+typedef enum ImageOwner {
+    IMAGE_OWNED,
+    IMAGE_MAPPED,
+    IMAGE_BORROWED
+} ImageOwner;
+
+struct BusinessCalendar {
+    BusinessCalendarHeader *header;
+    uint64_t *bits;
+    uint32_t *ranks;
+    void *image;
+    size_t size;
+    ImageOwner owner;
+};
+
+/**
+ * @brief Get the size of the image of a calendar.
+ * @param words The number of 64-day words.
+ * @return Returns the size in bytes.
+ */
+static size_t __image_size(uint32_t words) {
+    return sizeof(BusinessCalendarHeader) + sizeof(uint64_t) * words + sizeof(uint32_t) * (words + 1);
+}
+
+/**
+ * @brief Count the set bits.
+ * @param x The word.
+ * @return Returns the number of set bits.
+ */
+static int __popcount64(uint64_t x) {
+#ifdef __GNUC__
+    return __builtin_popcountll(x);
+#else
+    x = x - ((x >> 1) & 0x5555555555555555);
+    x = (x & 0x3333333333333333) + ((x >> 2) & 0x3333333333333333);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0F;
+    return (int)((x * 0x0101010101010101) >> 56);
+#endif
+}
+
+/**
+ * @brief Find the k-th set bit.
+ * @param x The word.
+ * @param k The number of set bits before the bit.
+ * @return Returns the position of the bit, or -1 if the word has k set bits or fewer.
+ */
+static int __select64(uint64_t x, int k) {
+    int position = 0;
+    int count;
+
+    return_value_if_fail(k >= 0 && k < __popcount64(x), -1);
+
+    /* Skip whole bytes, then the bits of the last byte. */
+    while ((count = __popcount64(x & 0xFF)) <= k) {
+        k -= count;
+        x >>= 8;
+        position += 8;
+    }
+    for (;; x >>= 1, position++) {
+        if ((x & 1) && k-- == 0) {
+            return position;
+        }
+    }
+}
+
+/**
+ * @brief Convert the date to the ordinal, without reporting errors.
+ * @param date The Date object.
+ * @param ordinal The ordinal (output).
+ * @return Returns true if the date is valid, otherwise returns false.
+ */
+static bool __ordinal_from_date(Date date, int *ordinal) {
+    DateTime datetime;
+
+    datetime.date = date;
+    datetime.time.hour = 0;
+    datetime.time.minute = 0;
+    datetime.time.second = 0;
+    datetime.time.millisecond = 0;
+    return datetime_to_ordinal_checked(datetime, ordinal) == DATETIME_OK;
+}
+
+/**
+ * @brief Get the index of the date in the calendar.
+ * @param calendar The BusinessCalendar object.
+ * @param date The Date object.
+ * @param limit The largest index accepted.
+ * @param index The number of days from the first date (output).
+ * @return Returns true if the date is valid and its index is 0 ~ limit, otherwise returns false.
+ */
+static bool __index_from_date(const BusinessCalendar *calendar, Date date, int limit, int *index) {
+    int ordinal;
+
+    return_value_if_fail(__ordinal_from_date(date, &ordinal), false);
+    *index = ordinal - calendar->header->first;
+    return *index >= 0 && *index <= limit;
+}
+
+/**
+ * @brief Get the date at the index of the calendar.
+ * @param calendar The BusinessCalendar object.
+ * @param index The number of days from the first date.
+ * @return Returns the Date object.
+ */
+static Date __date_from_index(const BusinessCalendar *calendar, int index) {
+    return datetime_from_ordinal_unchecked(calendar->header->first + index).date;
+}
+
+/**
+ * @brief Count the business days before the index.
+ * @param calendar The BusinessCalendar object.
+ * @param index The number of days from the first date (0 ~ length).
+ * @return Returns the number of business days in the first index days.
+ */
+static int __rank(const BusinessCalendar *calendar, int index) {
+    int word = index / WORD_DAYS;
+    int bit = index % WORD_DAYS;
+    int rank = (int)calendar->ranks[word];
+
+    if (bit > 0) {
+        rank += __popcount64(calendar->bits[word] & (((uint64_t)1 << bit) - 1));
+    }
+    return rank;
+}
+
+/**
+ * @brief Find the business day with the given rank.
+ * @param calendar The BusinessCalendar object.
+ * @param rank The number of business days up to and including the day (1 ~ total).
+ * @return Returns the index of the day, or -1 if the index does not hold the rank.
+ */
+static int __select(const BusinessCalendar *calendar, int rank) {
+    uint32_t low = 0;
+    uint32_t high = calendar->header->words - 1;
+    uint32_t middle;
+    int bit;
+
+    /* The first word whose business days reach the rank. */
+    while (low < high) {
+        middle = low + (high - low) / 2;
+        if ((int)calendar->ranks[middle + 1] >= rank) {
+            high = middle;
+        } else {
+            low = middle + 1;
+        }
+    }
+    bit = __select64(calendar->bits[low], rank - (int)calendar->ranks[low] - 1);
+    return bit >= 0 ? (int)low * WORD_DAYS + bit : -1;
+}
+
+/**
+ * @brief Rebuild the number of business days before every word.
+ * @param calendar The BusinessCalendar object.
+ */
+static void __build_ranks(BusinessCalendar *calendar) {
+    uint32_t word;
+
+    calendar->ranks[0] = 0;
+    for (word = 0; word < calendar->header->words; word++) {
+        calendar->ranks[word + 1] = calendar->ranks[word] + (uint32_t)__popcount64(calendar->bits[word]);
+    }
+}
+
+/**
+ * @brief Point the calendar at the sections of the image.
+ * @param calendar The BusinessCalendar object.
+ * @param image The image.
+ * @param size The size of the image in bytes.
+ * @param owner Who releases the image.
+ */
+static void __attach_image(BusinessCalendar *calendar, void *image, size_t size, ImageOwner owner) {
+    calendar->header = (BusinessCalendarHeader *)image;
+    calendar->bits = (uint64_t *)(calendar->header + 1);
+    calendar->ranks = (uint32_t *)(calendar->bits + calendar->header->words);
+    calendar->image = image;
+    calendar->size = size;
+    calendar->owner = owner;
+}
+
+/**
+ * @brief Create a BusinessCalendar object without holidays.
+ * @param first The first date of the calendar.
+ * @param last The last date of the calendar.
+ * @param weekend_mask The weekend days, bit i set if Weekday i is a weekend day (see BUSINESS_WEEKEND_SAT_SUN).
+ * @return Returns the BusinessCalendar object, or NULL if a date is invalid, first is after last,
+ *         the mask is out of range or the allocation fails.
+ * @note The caller must destroy the returned calendar with business_calendar_destroy().
+ */
+BusinessCalendar *business_calendar_create(Date first, Date last, int weekend_mask) {
+    BusinessCalendar *calendar = NULL;
+    BusinessCalendarHeader *header = NULL;
+    void *image = NULL;
+    int first_ordinal;
+    int last_ordinal;
+    int length;
+    uint32_t words;
+    int i;
+
+    return_value_if_fail(__ordinal_from_date(first, &first_ordinal) && __ordinal_from_date(last, &last_ordinal), NULL);
+    return_value_if_fail(first_ordinal <= last_ordinal, NULL);
+    return_value_if_fail(weekend_mask >= 0 && weekend_mask < (1 << DAYS_IN_WEEK), NULL);
+
+    length = last_ordinal - first_ordinal + 1;
+    words = (uint32_t)((length + WORD_DAYS - 1) / WORD_DAYS);
+    calendar = (BusinessCalendar *)malloc(sizeof(BusinessCalendar));
+    image = calloc(1, __image_size(words));
+    if (calendar == NULL || image == NULL) {
+        free(calendar);
+        free(image);
+        return NULL;
+    }
+    header = (BusinessCalendarHeader *)image;
+    header->magic = IMAGE_MAGIC;
+    header->version = IMAGE_VERSION;
+    header->first = first_ordinal;
+    header->length = length;
+    header->weekend_mask = weekend_mask;
+    header->words = words;
+    __attach_image(calendar, image, __image_size(words), IMAGE_OWNED);
+
+    for (i = 0; i < length; i++) {
+        if (!((weekend_mask >> weekday_from_ordinal_unchecked(first_ordinal + i)) & 1)) {
+            calendar->bits[i / WORD_DAYS] |= (uint64_t)1 << (i % WORD_DAYS);
+        }
+    }
+    __build_ranks(calendar);
+    return calendar;
+}
+
+/**
+ * @brief Destroy the BusinessCalendar object, unmapping it if it was mapped.
+ * @param calendar The BusinessCalendar object.
+ */
+void business_calendar_destroy(BusinessCalendar *calendar) {
+    return_if_fail(calendar != NULL);
+
+    if (calendar->owner == IMAGE_OWNED) {
+        free(calendar->image);
+    }
+#ifndef _WIN32
+    if (calendar->owner == IMAGE_MAPPED) {
+        munmap(calendar->image, calendar->size);
+    }
+#endif
+    free(calendar);
+}
+
+/**
+ * @brief Get the first date of the calendar.
+ * @param calendar The BusinessCalendar object.
+ * @return Returns the first date.
+ */
+Date business_calendar_first(const BusinessCalendar *calendar) {
+    return __date_from_index(calendar, 0);
+}
+
+/**
+ * @brief Get the last date of the calendar.
+ * @param calendar The BusinessCalendar object.
+ * @return Returns the last date.
+ */
+Date business_calendar_last(const BusinessCalendar *calendar) {
+    return __date_from_index(calendar, calendar->header->length - 1);
+}
+
+/**
+ * @brief Get the weekend mask of the calendar.
+ * @param calendar The BusinessCalendar object.
+ * @return Returns the weekend mask.
+ */
+int business_calendar_weekend_mask(const BusinessCalendar *calendar) {
+    return calendar->header->weekend_mask;
+}
+
+/**
+ * @brief Set or clear the business-day bits of the dates and rebuild the index.
+ * @param calendar The BusinessCalendar object.
+ * @param dates The array of count Date objects.
+ * @param count The number of rows.
+ * @param holiday Whether the dates become holidays.
+ * @return Returns the number of dates in the calendar.
+ */
+static size_t __set_holidays(BusinessCalendar *calendar, const Date *dates, size_t count, bool holiday) {
+    size_t updated = 0;
+    size_t i;
+    int index;
+    uint64_t bit;
+
+    return_value_if_fail(calendar != NULL && dates != NULL && calendar->owner == IMAGE_OWNED, 0);
+
+    for (i = 0; i < count; i++) {
+        if (!__index_from_date(calendar, dates[i], calendar->header->length - 1, &index)) {
+            continue;
+        }
+        bit = (uint64_t)1 << (index % WORD_DAYS);
+        if (holiday) {
+            calendar->bits[index / WORD_DAYS] &= ~bit;
+        } else if (!((calendar->header->weekend_mask >> weekday_from_ordinal_unchecked(calendar->header->first + index)) & 1)) {
+            calendar->bits[index / WORD_DAYS] |= bit;
+        }
+        updated++;
+    }
+    __build_ranks(calendar);
+    return updated;
+}
+
+/**
+ * @brief Mark the dates as holidays.
+ * @param calendar The BusinessCalendar object, not created from an image.
+ * @param dates The array of count Date objects. Weekend days are accepted and stay non-business days.
+ * @param count The number of rows.
+ * @return Returns the number of dates in the calendar. Invalid dates and dates out of the calendar are skipped.
+ * @note The index is rebuilt once per call, so pass the holidays in one array rather than one by one.
+ */
+size_t business_calendar_add_holidays(BusinessCalendar *calendar, const Date *dates, size_t count) {
+    return __set_holidays(calendar, dates, count, true);
+}
+
+/**
+ * @brief Make the holidays business days again, unless they are weekend days.
+ * @param calendar The BusinessCalendar object, not created from an image.
+ * @param dates The array of count Date objects.
+ * @param count The number of rows.
+ * @return Returns the number of dates in the calendar. Invalid dates and dates out of the calendar are skipped.
+ */
+size_t business_calendar_remove_holidays(BusinessCalendar *calendar, const Date *dates, size_t count) {
+    return __set_holidays(calendar, dates, count, false);
+}
+
+/**
+ * @brief Determine whether the date is a business day.
+ * @param calendar The BusinessCalendar object.
+ * @param date The Date object.
+ * @return Returns true if the date is in the calendar and is neither a weekend day nor a holiday, otherwise returns false.
+ */
+bool business_calendar_is_business_day(const BusinessCalendar *calendar, Date date) {
+    int index;
+
+    return_value_if_fail(calendar != NULL, false);
+    return_value_if_fail(__index_from_date(calendar, date, calendar->header->length - 1, &index), false);
+    return (int)(calendar->bits[index / WORD_DAYS] >> (index % WORD_DAYS)) & 1;
+}
+
+/**
+ * @brief Move the date by the number of business days.
+ * @param calendar The BusinessCalendar object.
+ * @param date The Date object in the calendar.
+ * @param days The number of business days. A positive number counts the business days after the date,
+ *             a negative number the business days before it, and 0 rolls a non-business day forward.
+ * @param out The Date object (output). Unchanged on error.
+ * @return Returns true on success, or false if a date is out of the calendar or the result would be.
+ * @note O(log n) in the number of 64-day words of the calendar, whatever the number of days.
+ */
+bool business_calendar_add(const BusinessCalendar *calendar, Date date, int days, Date *out) {
+    int index;
+    int rank;
+    int result;
+    bool business_day;
+
+    return_value_if_fail(calendar != NULL && out != NULL, false);
+    return_value_if_fail(__index_from_date(calendar, date, calendar->header->length - 1, &index), false);
+
+    business_day = (int)(calendar->bits[index / WORD_DAYS] >> (index % WORD_DAYS)) & 1;
+    if (days == 0 && business_day) {
+        *out = date;
+        return true;
+    }
+
+    /* The rank of the result: the business days up to and including it. */
+    rank = __rank(calendar, index + 1);
+    if (days == 0) {
+        rank++;
+    } else if (days > 0) {
+        return_value_if_fail(days <= (int)calendar->ranks[calendar->header->words] - rank, false);
+        rank += days;
+    } else {
+        /* Compared without negating days, which overflows for INT_MIN */
+        rank -= business_day;
+        return_value_if_fail(days >= -rank, false);
+        rank += days + 1;
+    }
+    return_value_if_fail(rank <= (int)calendar->ranks[calendar->header->words], false);
+
+    result = __select(calendar, rank);
+    return_value_if_fail(result >= 0 && result < calendar->header->length, false);
+    *out = __date_from_index(calendar, result);
+    return true;
+}
+
+/**
+ * @brief Move every date by the same number of business days.
+ * @param calendar The BusinessCalendar object.
+ * @param dates The array of count Date objects.
+ * @param days The number of business days, as in business_calendar_add().
+ * @param results The array of count Date objects (output). Failed rows are left unchanged.
+ * @param valid The array of count results (output), 1 for a row moved and 0 otherwise, can be NULL.
+ * @param count The number of rows.
+ * @return Returns the number of rows moved.
+ */
+size_t business_calendar_add_many(const BusinessCalendar *calendar, const Date *dates, int days, Date *results, int *valid, size_t count) {
+    size_t moved = 0;
+    size_t i;
+    bool row_valid;
+
+    return_value_if_fail(calendar != NULL && dates != NULL && results != NULL, 0);
+
+    for (i = 0; i < count; i++) {
+        row_valid = business_calendar_add(calendar, dates[i], days, &results[i]);
+        moved += row_valid;
+        if (valid != NULL) {
+            valid[i] = row_valid;
+        }
+    }
+    return moved;
+}
+
+/**
+ * @brief Count the business days from the date to the other date, excluding the other date.
+ * @param calendar The BusinessCalendar object.
+ * @param from The first Date object.
+ * @param to The second Date object. It may also be the day after the last date of the calendar.
+ * @param out The number of business days in from ~ to - 1, or the negated number in to ~ from - 1
+ *            if to is before from (output). Unchanged on error.
+ * @return Returns true on success, or false if a date is out of the calendar.
+ * @note O(1): two lookups in the index and two population counts.
+ */
+bool business_calendar_count(const BusinessCalendar *calendar, Date from, Date to, int *out) {
+    int from_index;
+    int to_index;
+
+    return_value_if_fail(calendar != NULL && out != NULL, false);
+    return_value_if_fail(__index_from_date(calendar, from, calendar->header->length, &from_index), false);
+    return_value_if_fail(__index_from_date(calendar, to, calendar->header->length, &to_index), false);
+
+    *out = __rank(calendar, to_index) - __rank(calendar, from_index);
+    return true;
+}
+
+/**
+ * @brief Get the image of the calendar, the bytes saved by business_calendar_save().
+ * @param calendar The BusinessCalendar object.
+ * @param size The size of the image in bytes (output).
+ * @return Returns the image.
+ * @note The image is in the byte order of the machine and is only valid on machines with the same byte order.
+ */
+const void *business_calendar_image(const BusinessCalendar *calendar, size_t *size) {
+    return_value_if_fail(calendar != NULL && size != NULL, NULL);
+    *size = calendar->size;
+    return calendar->image;
+}
+
+/**
+ * @brief Determine whether the bytes are the image of a calendar.
+ * @param image The image.
+ * @param size The size of the image in bytes.
+ * @return Returns true if the image is valid, otherwise returns false.
+ * @note O(n) in the number of words: the index must hold the population counts of the bitmap, and the bits
+ *       after the last day must be clear, or the lookups would return dates out of the calendar.
+ */
+static bool __is_valid_image(const void *image, size_t size) {
+    const BusinessCalendarHeader *header = (const BusinessCalendarHeader *)image;
+    const uint64_t *bits = NULL;
+    const uint32_t *ranks = NULL;
+    int tail;
+    uint32_t word;
+
+    return_value_if_fail(image != NULL && (size_t)image % sizeof(uint64_t) == 0, false);
+    return_value_if_fail(size >= sizeof(BusinessCalendarHeader), false);
+    return_value_if_fail(header->magic == IMAGE_MAGIC && header->version == IMAGE_VERSION, false);
+    return_value_if_fail(header->first >= 1 && header->length >= 1 && header->length <= MAX_ORDINAL - header->first + 1, false);
+    return_value_if_fail(header->weekend_mask >= 0 && header->weekend_mask < (1 << DAYS_IN_WEEK), false);
+    return_value_if_fail(header->words == (uint32_t)((header->length + WORD_DAYS - 1) / WORD_DAYS), false);
+    return_value_if_fail(size == __image_size(header->words), false);
+
+    bits = (const uint64_t *)(header + 1);
+    ranks = (const uint32_t *)(bits + header->words);
+    return_value_if_fail(ranks[0] == 0, false);
+    for (word = 0; word < header->words; word++) {
+        return_value_if_fail(ranks[word + 1] == ranks[word] + (uint32_t)__popcount64(bits[word]), false);
+    }
+
+    tail = header->length % WORD_DAYS;
+    return tail == 0 || (bits[header->words - 1] >> tail) == 0;
+}
+
+/**
+ * @brief Create a read-only BusinessCalendar object over an image, without copying it.
+ * @param image The image, aligned to 8 bytes. It must outlive the calendar.
+ * @param size The size of the image in bytes.
+ * @return Returns the BusinessCalendar object, or NULL if the image is not a valid calendar or the allocation fails.
+ * @note The caller must destroy the returned calendar with business_calendar_destroy(), which leaves the image alone.
+ */
+BusinessCalendar *business_calendar_from_image(const void *image, size_t size) {
+    BusinessCalendar *calendar = NULL;
+
+    return_value_if_fail(__is_valid_image(image, size), NULL);
+
+    calendar = (BusinessCalendar *)malloc(sizeof(BusinessCalendar));
+    return_value_if_fail(calendar != NULL, NULL);
+    __attach_image(calendar, (void *)image, size, IMAGE_BORROWED);
+    return calendar;
+}
+
+/**
+ * @brief Save the image of the calendar to the file.
+ * @param calendar The BusinessCalendar object.
+ * @param path The path of the file, replaced if it exists.
+ * @return Returns true on success, otherwise returns false.
+ */
+bool business_calendar_save(const BusinessCalendar *calendar, const char *path) {
+    FILE *file = NULL;
+    bool written;
+
+    return_value_if_fail(calendar != NULL && path != NULL, false);
+
+    file = fopen(path, "wb");
+    return_value_if_fail(file != NULL, false);
+    written = fwrite(calendar->image, 1, calendar->size, file) == calendar->size;
+    return fclose(file) == 0 && written;
+}
+
+/**
+ * @brief Map a file saved by business_calendar_save() read-only into memory.
+ * @param path The path of the file.
+ * @return Returns the BusinessCalendar object, or NULL if the file cannot be mapped or is not a valid calendar.
+ * @note The pages are shared by every process mapping the same file.
+ *       The caller must destroy the returned calendar with business_calendar_destroy().
+ */
+BusinessCalendar *business_calendar_map(const char *path) {
+    BusinessCalendar *calendar = NULL;
+    void *image = NULL;
+    size_t size;
+#ifdef _WIN32
+    FILE *file = NULL;
+    long length;
+
+    /* No shared mapping, read a private copy. */
+    return_value_if_fail(path != NULL, NULL);
+    file = fopen(path, "rb");
+    return_value_if_fail(file != NULL, NULL);
+    if (fseek(file, 0, SEEK_END) != 0 || (length = ftell(file)) <= 0 || fseek(file, 0, SEEK_SET) != 0) {
+        fclose(file);
+        return NULL;
+    }
+    size = (size_t)length;
+    image = malloc(size);
+    if (image == NULL || fread(image, 1, size, file) != size) {
+        free(image);
+        fclose(file);
+        return NULL;
+    }
+    fclose(file);
+
+    calendar = business_calendar_from_image(image, size);
+    if (calendar == NULL) {
+        free(image);
+        return NULL;
+    }
+    calendar->owner = IMAGE_OWNED;
+#else
+    struct stat st;
+    int fd;
+
+    return_value_if_fail(path != NULL, NULL);
+    fd = open(path, O_RDONLY);
+    return_value_if_fail(fd >= 0, NULL);
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return NULL;
+    }
+    size = (size_t)st.st_size;
+    image = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    return_value_if_fail(image != MAP_FAILED, NULL);
+
+    calendar = business_calendar_from_image(image, size);
+    if (calendar == NULL) {
+        munmap(image, size);
+        return NULL;
+    }
+    calendar->owner = IMAGE_MAPPED;
+#endif
+    return calendar;
+}
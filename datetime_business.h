@@ -0,0 +1,166 @@
+#ifndef _DATETIME_BUSINESS_H_
+#define _DATETIME_BUSINESS_H_
+
+#include "datetime.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Weekend masks, bit i set if Weekday i is a weekend day. */
+#define BUSINESS_WEEKEND_NONE 0
+#define BUSINESS_WEEKEND_SAT_SUN ((1 << SAT) | (1 << SUN))
+#define BUSINESS_WEEKEND_FRI_SAT ((1 << FRI) | (1 << SAT))
+#define BUSINESS_WEEKEND_SUN (1 << SUN)
+
+/*
+ * A business-day calendar over a range of dates: a weekend mask, and a bitmap of the business days
+ * with the holidays cleared, indexed by the number of business days before every 64-day word.
+ *
+ * The whole calendar is one flat image, so it can be saved to a file and mapped read-only by every
+ * worker (business_calendar_save(), business_calendar_map()). Queries never write to the calendar and
+ * are safe to run from any number of threads at once.
+ */
+typedef struct BusinessCalendar BusinessCalendar;
+
+/**
+ * @brief Create a BusinessCalendar object without holidays.
+ * @param first The first date of the calendar.
+ * @param last The last date of the calendar.
+ * @param weekend_mask The weekend days, bit i set if Weekday i is a weekend day (see BUSINESS_WEEKEND_SAT_SUN).
+ * @return Returns the BusinessCalendar object, or NULL if a date is invalid, first is after last,
+ *         the mask is out of range or the allocation fails.
+ * @note The caller must destroy the returned calendar with business_calendar_destroy().
+ */
+BusinessCalendar *business_calendar_create(Date first, Date last, int weekend_mask);
+
+/**
+ * @brief Destroy the BusinessCalendar object, unmapping it if it was mapped.
+ * @param calendar The BusinessCalendar object.
+ */
+void business_calendar_destroy(BusinessCalendar *calendar);
+
+/**
+ * @brief Get the first date of the calendar.
+ * @param calendar The BusinessCalendar object.
+ * @return Returns the first date.
+ */
+Date business_calendar_first(const BusinessCalendar *calendar);
+
+/**
+ * @brief Get the last date of the calendar.
+ * @param calendar The BusinessCalendar object.
+ * @return Returns the last date.
+ */
+Date business_calendar_last(const BusinessCalendar *calendar);
+
+/**
+ * @brief Get the weekend mask of the calendar.
+ * @param calendar The BusinessCalendar object.
+ * @return Returns the weekend mask.
+ */
+int business_calendar_weekend_mask(const BusinessCalendar *calendar);
+
+/**
+ * @brief Mark the dates as holidays.
+ * @param calendar The BusinessCalendar object, not created from an image.
+ * @param dates The array of count Date objects. Weekend days are accepted and stay non-business days.
+ * @param count The number of rows.
+ * @return Returns the number of dates in the calendar. Invalid dates and dates out of the calendar are skipped.
+ * @note The index is rebuilt once per call, so pass the holidays in one array rather than one by one.
+ */
+size_t business_calendar_add_holidays(BusinessCalendar *calendar, const Date *dates, size_t count);
+
+/**
+ * @brief Make the holidays business days again, unless they are weekend days.
+ * @param calendar The BusinessCalendar object, not created from an image.
+ * @param dates The array of count Date objects.
+ * @param count The number of rows.
+ * @return Returns the number of dates in the calendar. Invalid dates and dates out of the calendar are skipped.
+ */
+size_t business_calendar_remove_holidays(BusinessCalendar *calendar, const Date *dates, size_t count);
+
+/**
+ * @brief Determine whether the date is a business day.
+ * @param calendar The BusinessCalendar object.
+ * @param date The Date object.
+ * @return Returns true if the date is in the calendar and is neither a weekend day nor a holiday, otherwise returns false.
+ */
+bool business_calendar_is_business_day(const BusinessCalendar *calendar, Date date);
+
+/**
+ * @brief Move the date by the number of business days.
+ * @param calendar The BusinessCalendar object.
+ * @param date The Date object in the calendar.
+ * @param days The number of business days. A positive number counts the business days after the date,
+ *             a negative number the business days before it, and 0 rolls a non-business day forward.
+ * @param out The Date object (output). Unchanged on error.
+ * @return Returns true on success, or false if a date is out of the calendar or the result would be.
+ * @note O(log n) in the number of 64-day words of the calendar, whatever the number of days.
+ */
+bool business_calendar_add(const BusinessCalendar *calendar, Date date, int days, Date *out);
+
+/**
+ * @brief Move every date by the same number of business days.
+ * @param calendar The BusinessCalendar object.
+ * @param dates The array of count Date objects.
+ * @param days The number of business days, as in business_calendar_add().
+ * @param results The array of count Date objects (output). Failed rows are left unchanged.
+ * @param valid The array of count results (output), 1 for a row moved and 0 otherwise, can be NULL.
+ * @param count The number of rows.
+ * @return Returns the number of rows moved.
+ */
+size_t business_calendar_add_many(const BusinessCalendar *calendar, const Date *dates, int days, Date *results, int *valid, size_t count);
+
+/**
+ * @brief Count the business days from the date to the other date, excluding the other date.
+ * @param calendar The BusinessCalendar object.
+ * @param from The first Date object.
+ * @param to The second Date object. It may also be the day after the last date of the calendar.
+ * @param out The number of business days in from ~ to - 1, or the negated number in to ~ from - 1
+ *            if to is before from (output). Unchanged on error.
+ * @return Returns true on success, or false if a date is out of the calendar.
+ * @note O(1): two lookups in the index and two population counts.
+ */
+bool business_calendar_count(const BusinessCalendar *calendar, Date from, Date to, int *out);
+
+/**
+ * @brief Get the image of the calendar, the bytes saved by business_calendar_save().
+ * @param calendar The BusinessCalendar object.
+ * @param size The size of the image in bytes (output).
+ * @return Returns the image.
+ * @note The image is in the byte order of the machine and is only valid on machines with the same byte order.
+ */
+const void *business_calendar_image(const BusinessCalendar *calendar, size_t *size);
+
+/**
+ * @brief Create a read-only BusinessCalendar object over an image, without copying it.
+ * @param image The image, aligned to 8 bytes. It must outlive the calendar.
+ * @param size The size of the image in bytes.
+ * @return Returns the BusinessCalendar object, or NULL if the image is not a valid calendar or the allocation fails.
+ * @note The caller must destroy the returned calendar with business_calendar_destroy(), which leaves the image alone.
+ */
+BusinessCalendar *business_calendar_from_image(const void *image, size_t size);
+
+/**
+ * @brief Save the image of the calendar to the file.
+ * @param calendar The BusinessCalendar object.
+ * @param path The path of the file, replaced if it exists.
+ * @return Returns true on success, otherwise returns false.
+ */
+bool business_calendar_save(const BusinessCalendar *calendar, const char *path);
+
+/**
+ * @brief Map a file saved by business_calendar_save() read-only into memory.
+ * @param path The path of the file.
+ * @return Returns the BusinessCalendar object, or NULL if the file cannot be mapped or is not a valid calendar.
+ * @note The pages are shared by every process mapping the same file.
+ *       The caller must destroy the returned calendar with business_calendar_destroy().
+ */
+BusinessCalendar *business_calendar_map(const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
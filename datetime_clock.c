@@ -0,0 +1,460 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include "datetime_clock.h"
+#include <stdlib.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#if defined(__GNUC__) && defined(__x86_64__) && !defined(_WIN32)
+#include <cpuid.h>
+#include <x86intrin.h>
+#define DATETIME_TSC
+__extension__ typedef unsigned __int128 TscProduct;
+#endif
+
+#define return_if_fail(expr) \
+    if (!(expr)) {           \
+        return;              \
+    }
+
+#define return_value_if_fail(expr, ret) \
+    if (!(expr)) {                      \
+        return (ret);                   \
+    }
+
+#ifndef CLOCK_MONOTONIC_RAW
+#define CLOCK_MONOTONIC_RAW CLOCK_MONOTONIC
+#endif
+
+#define TSC_SHIFT 32                /* the fraction bits of the nanoseconds per tick */
+#define TSC_SAMPLES 5               /* the reads of CLOCK_REALTIME per calibration, the tightest one is kept */
+#define TSC_FIRST_MILLISECONDS 10   /* the first calibration */
+#define TSC_STEP_NANOSECONDS 100000 /* with TSC_STEP_PPM of the elapsed time, more than NTP can slew: the wall clock was set */
+#define TSC_STEP_PPM 1000
+
+struct TscClock {
+    bool tsc;
+    int recalibrate_milliseconds;
+    uint64_t period;          /* the ticks between two calibrations */
+    uint64_t multiplier;      /* the nanoseconds per tick << TSC_SHIFT */
+    uint64_t base_ticks;      /* the latest calibration */
+    int64_t base_nanoseconds;
+    uint64_t origin_ticks;    /* the first calibration since the wall clock was set, to measure the frequency */
+    int64_t origin_nanoseconds;
+};
+
+/**
+ * @brief Read the monotonic clock.
+ * @param clock The clock.
+ * @return Returns the MonoTime in nanoseconds.
+ * @note clock_gettime() reads the clock in the vDSO on Linux, without a system call: tens of ns. Older kernels
+ *       make a system call for CLOCK_MONOTONIC_RAW. QueryPerformanceCounter() on Windows.
+ */
+MonoTime mono_now(MonoClock clock) {
+#ifdef _WIN32
+    static LONGLONG frequency;
+    LARGE_INTEGER counter;
+    LARGE_INTEGER value;
+
+    (void)clock;
+    if (frequency == 0) {
+        QueryPerformanceFrequency(&value);
+        frequency = value.QuadPart;
+    }
+    QueryPerformanceCounter(&counter);
+    /* Split, so that the multiplication does not overflow after 10 days of a 10 MHz counter */
+    return (MonoTime)(counter.QuadPart / frequency * NANOSECONDS_PER_SECOND + counter.QuadPart % frequency * NANOSECONDS_PER_SECOND / frequency);
+#else
+    struct timespec ts;
+
+    clock_gettime(clock == MONO_CLOCK_RAW ? CLOCK_MONOTONIC_RAW : CLOCK_MONOTONIC, &ts);
+    return (MonoTime)ts.tv_sec * NANOSECONDS_PER_SECOND + ts.tv_nsec;
+#endif
+}
+
+/**
+ * @brief Convert the nanoseconds to a TimeInterval object, truncated to milliseconds.
+ * @param nanoseconds The nanoseconds. Negative durations give an empty interval.
+ * @return Returns the TimeInterval object.
+ */
+TimeInterval mono_to_time_interval(int64_t nanoseconds) {
+    TimeInterval time_interval;
+    int64_t milliseconds = nanoseconds > 0 ? nanoseconds / NANOSECONDS_PER_MILLISECOND : 0;
+
+    time_interval.days = (int)(milliseconds / MILLISECONDS_PER_DAY);
+    time_interval.hours = (int)(milliseconds % MILLISECONDS_PER_DAY / MILLISECONDS_PER_HOUR);
+    time_interval.minutes = (int)(milliseconds % MILLISECONDS_PER_HOUR / MILLISECONDS_PER_MINUTE);
+    time_interval.seconds = (int)(milliseconds % MILLISECONDS_PER_MINUTE / MILLISECONDS_PER_SECOND);
+    time_interval.milliseconds = (int)(milliseconds % MILLISECONDS_PER_SECOND);
+    return time_interval;
+}
+
+/**
+ * @brief Initialize the stopwatch, stopped at 0.
+ * @param stopwatch The Stopwatch object (output).
+ * @param clock The clock of the stopwatch.
+ */
+void stopwatch_init(Stopwatch *stopwatch, MonoClock clock) {
+    return_if_fail(stopwatch != NULL);
+
+    stopwatch->clock = clock;
+    stopwatch->running = 0;
+    stopwatch->started = 0;
+    stopwatch->elapsed = 0;
+    stopwatch->lap_elapsed = 0;
+}
+
+/**
+ * @brief Initialize the stopwatch and start it.
+ * @param clock The clock of the stopwatch.
+ * @return Returns the running Stopwatch object.
+ */
+Stopwatch stopwatch_start_new(MonoClock clock) {
+    Stopwatch stopwatch;
+
+    stopwatch_init(&stopwatch, clock);
+    stopwatch_start(&stopwatch);
+    return stopwatch;
+}
+
+/**
+ * @brief Start the stopwatch, or start it again after stopwatch_stop() without losing the elapsed time.
+ * @param stopwatch The Stopwatch object.
+ * @note Does nothing if the stopwatch is running.
+ */
+void stopwatch_start(Stopwatch *stopwatch) {
+    return_if_fail(stopwatch != NULL && !stopwatch->running);
+
+    stopwatch->started = mono_now(stopwatch->clock);
+    stopwatch->running = 1;
+}
+
+/**
+ * @brief Stop the stopwatch, keeping the elapsed time.
+ * @param stopwatch The Stopwatch object.
+ * @return Returns the elapsed nanoseconds.
+ */
+int64_t stopwatch_stop(Stopwatch *stopwatch) {
+    return_value_if_fail(stopwatch != NULL, 0);
+
+    if (stopwatch->running) {
+        stopwatch->elapsed += mono_now(stopwatch->clock) - stopwatch->started;
+        stopwatch->running = 0;
+    }
+    return stopwatch->elapsed;
+}
+
+/**
+ * @brief Set the elapsed time of the stopwatch to 0, keeping it running or stopped.
+ * @param stopwatch The Stopwatch object.
+ */
+void stopwatch_reset(Stopwatch *stopwatch) {
+    return_if_fail(stopwatch != NULL);
+
+    if (stopwatch->running) {
+        stopwatch->started = mono_now(stopwatch->clock);
+    }
+    stopwatch->elapsed = 0;
+    stopwatch->lap_elapsed = 0;
+}
+
+/**
+ * @brief Get the elapsed time of the stopwatch, the split time, without starting a new lap.
+ * @param stopwatch The Stopwatch object.
+ * @return Returns the elapsed nanoseconds, excluding the time stopped.
+ */
+int64_t stopwatch_elapsed(const Stopwatch *stopwatch) {
+    return_value_if_fail(stopwatch != NULL, 0);
+
+    return stopwatch->running ? stopwatch->elapsed + (mono_now(stopwatch->clock) - stopwatch->started) : stopwatch->elapsed;
+}
+
+/**
+ * @brief End the current lap and start the next one.
+ * @param stopwatch The Stopwatch object.
+ * @return Returns the elapsed nanoseconds of the lap, excluding the time stopped.
+ */
+int64_t stopwatch_lap(Stopwatch *stopwatch) {
+    int64_t elapsed;
+    int64_t lap;
+
+    return_value_if_fail(stopwatch != NULL, 0);
+
+    elapsed = stopwatch_elapsed(stopwatch);
+    lap = elapsed - stopwatch->lap_elapsed;
+    stopwatch->lap_elapsed = elapsed;
+    return lap;
+}
+
+/**
+ * @brief Get the elapsed time of the stopwatch as a TimeInterval object.
+ * @param stopwatch The Stopwatch object.
+ * @return Returns the TimeInterval object, truncated to milliseconds.
+ * @see mono_to_time_interval()
+ */
+TimeInterval stopwatch_interval(const Stopwatch *stopwatch) {
+    return mono_to_time_interval(stopwatch_elapsed(stopwatch));
+}
+
+/**
+ * @brief Read CLOCK_REALTIME.
+ * @return Returns the nanoseconds since 1970-01-01 00:00:00 UTC.
+ */
+static int64_t __realtime_nanoseconds(void) {
+#ifdef _WIN32
+    FILETIME ft;
+    ULARGE_INTEGER value;
+
+    GetSystemTimeAsFileTime(&ft);
+    value.LowPart = ft.dwLowDateTime;
+    value.HighPart = ft.dwHighDateTime;
+    /* 100-nanosecond intervals since 1601-01-01 */
+    return ((int64_t)value.QuadPart - (int64_t)116444736 * 1000000000) * 100;
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (int64_t)ts.tv_sec * NANOSECONDS_PER_SECOND + ts.tv_nsec;
+#endif
+}
+
+/**
+ * @brief Determine whether the CPU has an invariant TSC, ticking at a constant rate in every power state.
+ * @return Returns true if the CPU has an invariant TSC, otherwise returns false.
+ */
+static bool __has_invariant_tsc(void) {
+#ifdef DATETIME_TSC
+    unsigned int eax = 0;
+    unsigned int ebx = 0;
+    unsigned int ecx = 0;
+    unsigned int edx = 0;
+
+    return_value_if_fail(__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) && eax >= 0x80000007, false);
+    return_value_if_fail(__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx), false);
+    return (edx & (1 << 8)) != 0;
+#else
+    return false;
+#endif
+}
+
+#ifdef DATETIME_TSC
+/**
+ * @brief Read the TSC and CLOCK_REALTIME at the same time, keeping the tightest of TSC_SAMPLES reads.
+ * @param ticks The TSC in the middle of the read of CLOCK_REALTIME (output).
+ * @param nanoseconds The nanoseconds of CLOCK_REALTIME (output).
+ */
+static void __sample(uint64_t *ticks, int64_t *nanoseconds) {
+    uint64_t best = (uint64_t)-1;
+    uint64_t before;
+    uint64_t after;
+    int64_t now;
+    int i;
+
+    for (i = 0; i < TSC_SAMPLES; i++) {
+        before = __rdtsc();
+        now = __realtime_nanoseconds();
+        after = __rdtsc();
+        if (after - before < best) {
+            best = after - before;
+            *ticks = before + (after - before) / 2;
+            *nanoseconds = now;
+        }
+    }
+}
+
+/**
+ * @brief Measure the nanoseconds per tick since the origin of the clock.
+ * @param clock The TscClock object.
+ * @param ticks The ticks of a sample after the origin.
+ * @param nanoseconds The nanoseconds of the sample, after the origin.
+ */
+static void __measure(TscClock *clock, uint64_t ticks, int64_t nanoseconds) {
+    clock->multiplier = (uint64_t)(((TscProduct)(uint64_t)(nanoseconds - clock->origin_nanoseconds) << TSC_SHIFT) / (ticks - clock->origin_ticks));
+    clock->period = (uint64_t)((TscProduct)clock->recalibrate_milliseconds * NANOSECONDS_PER_MILLISECOND << TSC_SHIFT) / clock->multiplier;
+}
+#endif
+
+/**
+ * @brief Create a TscClock object, calibrated.
+ * @param recalibrate_milliseconds The period of the calibration against CLOCK_REALTIME in milliseconds, at least 1,
+ *                                 so that the clock follows NTP and the steps of the wall clock.
+ * @param tsc Nonzero to use the TSC if the CPU has an invariant one, or 0 for CLOCK_REALTIME.
+ * @return Returns the TscClock object, or NULL if the period is invalid or the allocation fails.
+ * @note The first calibration sleeps 10 ms. The caller must destroy the returned clock with tsc_clock_destroy().
+ */
+TscClock *tsc_clock_create(int recalibrate_milliseconds, int tsc) {
+    TscClock *clock;
+#ifdef DATETIME_TSC
+    struct timespec ts;
+    uint64_t ticks;
+    int64_t nanoseconds;
+#endif
+
+    return_value_if_fail(recalibrate_milliseconds >= 1, NULL);
+    clock = (TscClock *)calloc(1, sizeof(TscClock));
+    return_value_if_fail(clock != NULL, NULL);
+
+    clock->tsc = tsc && __has_invariant_tsc();
+    clock->recalibrate_milliseconds = recalibrate_milliseconds;
+    clock->multiplier = (uint64_t)1 << TSC_SHIFT;
+#ifdef DATETIME_TSC
+    if (clock->tsc) {
+        __sample(&clock->origin_ticks, &clock->origin_nanoseconds);
+        ts.tv_sec = 0;
+        ts.tv_nsec = TSC_FIRST_MILLISECONDS * NANOSECONDS_PER_MILLISECOND;
+        nanosleep(&ts, NULL);
+        __sample(&ticks, &nanoseconds);
+        if (ticks > clock->origin_ticks && nanoseconds > clock->origin_nanoseconds) {
+            __measure(clock, ticks, nanoseconds);
+            clock->base_ticks = ticks;
+            clock->base_nanoseconds = nanoseconds;
+        } else {
+            clock->tsc = false; /* the wall clock was set in between, or the TSC is not usable after all */
+        }
+    }
+#endif
+    return clock;
+}
+
+/**
+ * @brief Destroy the TscClock object.
+ * @param clock The TscClock object.
+ */
+void tsc_clock_destroy(TscClock *clock) {
+    free(clock);
+}
+
+/**
+ * @brief Determine whether the clock reads the TSC, rather than falling back to CLOCK_REALTIME.
+ * @param clock The TscClock object.
+ * @return Returns true if the clock reads the TSC, otherwise returns false.
+ */
+bool tsc_clock_is_tsc(const TscClock *clock) {
+    return clock->tsc;
+}
+
+/**
+ * @brief Get the calibrated frequency of the ticks of the clock.
+ * @param clock The TscClock object.
+ * @return Returns the ticks per second, 1000000000 when falling back to CLOCK_REALTIME.
+ */
+int64_t tsc_clock_frequency(const TscClock *clock) {
+#ifdef DATETIME_TSC
+    return (int64_t)(((TscProduct)NANOSECONDS_PER_SECOND << TSC_SHIFT) / clock->multiplier);
+#else
+    (void)clock;
+    return NANOSECONDS_PER_SECOND;
+#endif
+}
+
+/**
+ * @brief Read the ticks of the clock, to convert them later with tsc_clock_to_nanoseconds().
+ * @param clock The TscClock object.
+ * @return Returns the ticks: one rdtsc instruction, or clock_gettime(CLOCK_REALTIME) when falling back.
+ */
+uint64_t tsc_clock_ticks(const TscClock *clock) {
+#ifdef DATETIME_TSC
+    if (clock->tsc) {
+        return __rdtsc();
+    }
+#else
+    (void)clock;
+#endif
+    return (uint64_t)__realtime_nanoseconds();
+}
+
+/**
+ * @brief Convert the ticks of the clock to nanoseconds since 1970-01-01 00:00:00 UTC, with the current calibration.
+ * @param clock The TscClock object.
+ * @param ticks The ticks from tsc_clock_ticks().
+ * @return Returns the nanoseconds since 1970-01-01 00:00:00 UTC.
+ */
+int64_t tsc_clock_to_nanoseconds(const TscClock *clock, uint64_t ticks) {
+#ifdef DATETIME_TSC
+    if (clock->tsc) {
+        /* Ticks read before the latest calibration count backwards from it */
+        if (ticks >= clock->base_ticks) {
+            return clock->base_nanoseconds + (int64_t)(((TscProduct)(ticks - clock->base_ticks) * clock->multiplier) >> TSC_SHIFT);
+        }
+        return clock->base_nanoseconds - (int64_t)(((TscProduct)(clock->base_ticks - ticks) * clock->multiplier) >> TSC_SHIFT);
+    }
+#else
+    (void)clock;
+#endif
+    return (int64_t)ticks;
+}
+
+/**
+ * @brief Calibrate the clock against CLOCK_REALTIME now.
+ * @param clock The TscClock object.
+ * @note Called by tsc_clock_now() once the period has passed. The frequency is measured over every calibration
+ *       since the wall clock was last set, and the wall clock is followed from the latest one.
+ */
+void tsc_clock_calibrate(TscClock *clock) {
+#ifdef DATETIME_TSC
+    uint64_t ticks;
+    int64_t nanoseconds;
+    int64_t predicted;
+    int64_t error;
+    int64_t limit;
+
+    return_if_fail(clock != NULL && clock->tsc);
+
+    __sample(&ticks, &nanoseconds);
+    predicted = tsc_clock_to_nanoseconds(clock, ticks);
+    error = nanoseconds > predicted ? nanoseconds - predicted : predicted - nanoseconds;
+    limit = TSC_STEP_NANOSECONDS + (predicted > clock->base_nanoseconds ? predicted - clock->base_nanoseconds : 0) / 1000000 * TSC_STEP_PPM;
+    if (error > limit || ticks <= clock->origin_ticks || nanoseconds <= clock->origin_nanoseconds) {
+        /* The wall clock was set: keep the frequency, and measure it again from here */
+        clock->origin_ticks = ticks;
+        clock->origin_nanoseconds = nanoseconds;
+    } else {
+        __measure(clock, ticks, nanoseconds);
+    }
+    clock->base_ticks = ticks;
+    clock->base_nanoseconds = nanoseconds;
+#else
+    (void)clock;
+#endif
+}
+
+/**
+ * @brief Get the current time in nanoseconds since 1970-01-01 00:00:00 UTC.
+ * @param clock The TscClock object.
+ * @return Returns the nanoseconds since 1970-01-01 00:00:00 UTC.
+ */
+int64_t tsc_clock_now(TscClock *clock) {
+    uint64_t ticks = tsc_clock_ticks(clock);
+
+    if (clock->tsc && ticks - clock->base_ticks >= clock->period) {
+        tsc_clock_calibrate(clock);
+    }
+    return tsc_clock_to_nanoseconds(clock, ticks);
+}
+
+/**
+ * @brief Get the current Instant.
+ * @param clock The TscClock object.
+ * @return Returns the Instant, in milliseconds since 1970-01-01 00:00:00 UTC.
+ */
+Instant tsc_clock_now_instant(TscClock *clock) {
+    int64_t nanoseconds = tsc_clock_now(clock);
+
+    /* Rounded down, like the timestamps before 1970 */
+    return nanoseconds >= 0 ? nanoseconds / NANOSECONDS_PER_MILLISECOND
+                            : -((-nanoseconds + NANOSECONDS_PER_MILLISECOND - 1) / NANOSECONDS_PER_MILLISECOND);
+}
+
+/**
+ * @brief Get the current DateTime object.
+ * @param clock The TscClock object.
+ * @return Returns the DateTime object, in UTC.
+ */
+DateTime tsc_clock_now_datetime(TscClock *clock) {
+    return instant_to_datetime_unchecked(tsc_clock_now_instant(clock));
+}
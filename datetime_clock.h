@@ -0,0 +1,192 @@
+#ifndef _DATETIME_CLOCK_H_
+#define _DATETIME_CLOCK_H_
+
+#include "datetime.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A reading of a monotonic clock in nanoseconds since an unspecified start: only the differences are meaningful. */
+typedef int64_t MonoTime;
+
+/* The monotonic clocks. Neither jumps when the wall clock is set. */
+typedef enum MonoClock {
+    MONO_CLOCK_MONOTONIC, /* CLOCK_MONOTONIC: slewed by NTP to the rate of real time */
+    MONO_CLOCK_RAW        /* CLOCK_MONOTONIC_RAW: the rate of the hardware, never slewed (CLOCK_MONOTONIC where missing) */
+} MonoClock;
+
+/*
+ * A stopwatch on a monotonic clock, with nanosecond resolution. It can be stopped and started again, and
+ * its elapsed time split into laps. A plain value: no allocation, and no clock read but in the calls below.
+ */
+typedef struct Stopwatch {
+    MonoClock clock;
+    int running;          /* 1 while running, an int so that C and C++ agree on the layout */
+    MonoTime started;     /* the start of the current run */
+    int64_t elapsed;      /* the nanoseconds of the previous runs */
+    int64_t lap_elapsed;  /* the elapsed nanoseconds at the start of the current lap */
+} Stopwatch;
+
+/**
+ * @brief Read the monotonic clock.
+ * @param clock The clock.
+ * @return Returns the MonoTime in nanoseconds.
+ * @note clock_gettime() reads the clock in the vDSO on Linux, without a system call: tens of ns. Older kernels
+ *       make a system call for CLOCK_MONOTONIC_RAW. QueryPerformanceCounter() on Windows.
+ */
+MonoTime mono_now(MonoClock clock);
+
+/**
+ * @brief Convert the nanoseconds to a TimeInterval object, truncated to milliseconds.
+ * @param nanoseconds The nanoseconds. Negative durations give an empty interval.
+ * @return Returns the TimeInterval object.
+ */
+TimeInterval mono_to_time_interval(int64_t nanoseconds);
+
+/**
+ * @brief Initialize the stopwatch, stopped at 0.
+ * @param stopwatch The Stopwatch object (output).
+ * @param clock The clock of the stopwatch.
+ */
+void stopwatch_init(Stopwatch *stopwatch, MonoClock clock);
+
+/**
+ * @brief Initialize the stopwatch and start it.
+ * @param clock The clock of the stopwatch.
+ * @return Returns the running Stopwatch object.
+ */
+Stopwatch stopwatch_start_new(MonoClock clock);
+
+/**
+ * @brief Start the stopwatch, or start it again after stopwatch_stop() without losing the elapsed time.
+ * @param stopwatch The Stopwatch object.
+ * @note Does nothing if the stopwatch is running.
+ */
+void stopwatch_start(Stopwatch *stopwatch);
+
+/**
+ * @brief Stop the stopwatch, keeping the elapsed time.
+ * @param stopwatch The Stopwatch object.
+ * @return Returns the elapsed nanoseconds.
+ */
+int64_t stopwatch_stop(Stopwatch *stopwatch);
+
+/**
+ * @brief Set the elapsed time of the stopwatch to 0, keeping it running or stopped.
+ * @param stopwatch The Stopwatch object.
+ */
+void stopwatch_reset(Stopwatch *stopwatch);
+
+/**
+ * @brief Get the elapsed time of the stopwatch, the split time, without starting a new lap.
+ * @param stopwatch The Stopwatch object.
+ * @return Returns the elapsed nanoseconds, excluding the time stopped.
+ */
+int64_t stopwatch_elapsed(const Stopwatch *stopwatch);
+
+/**
+ * @brief End the current lap and start the next one.
+ * @param stopwatch The Stopwatch object.
+ * @return Returns the elapsed nanoseconds of the lap, excluding the time stopped.
+ */
+int64_t stopwatch_lap(Stopwatch *stopwatch);
+
+/**
+ * @brief Get the elapsed time of the stopwatch as a TimeInterval object.
+ * @param stopwatch The Stopwatch object.
+ * @return Returns the TimeInterval object, truncated to milliseconds.
+ * @see mono_to_time_interval()
+ */
+TimeInterval stopwatch_interval(const Stopwatch *stopwatch);
+
+/*
+ * A wall clock on the invariant TSC of x86-64, for timestamps cheaper than clock_gettime(). The TSC is calibrated
+ * against CLOCK_REALTIME when the clock is created and again every period, and its ticks are converted to
+ * nanoseconds since 1970-01-01 00:00:00 UTC with a 32.32 fixed-point multiply. Where the CPU has no invariant TSC
+ * (or on another architecture) the ticks are the nanoseconds of CLOCK_REALTIME, and the same calls still work.
+ *
+ * The clock is not thread-safe, as tsc_clock_now() recalibrates it in place: use one clock per thread, or
+ * serialize the calls.
+ */
+typedef struct TscClock TscClock;
+
+/**
+ * @brief Create a TscClock object, calibrated.
+ * @param recalibrate_milliseconds The period of the calibration against CLOCK_REALTIME in milliseconds, at least 1,
+ *                                 so that the clock follows NTP and the steps of the wall clock.
+ * @param tsc Nonzero to use the TSC if the CPU has an invariant one, or 0 for CLOCK_REALTIME.
+ * @return Returns the TscClock object, or NULL if the period is invalid or the allocation fails.
+ * @note The first calibration sleeps 10 ms. The caller must destroy the returned clock with tsc_clock_destroy().
+ */
+TscClock *tsc_clock_create(int recalibrate_milliseconds, int tsc);
+
+/**
+ * @brief Destroy the TscClock object.
+ * @param clock The TscClock object.
+ */
+void tsc_clock_destroy(TscClock *clock);
+
+/**
+ * @brief Determine whether the clock reads the TSC, rather than falling back to CLOCK_REALTIME.
+ * @param clock The TscClock object.
+ * @return Returns true if the clock reads the TSC, otherwise returns false.
+ */
+bool tsc_clock_is_tsc(const TscClock *clock);
+
+/**
+ * @brief Get the calibrated frequency of the ticks of the clock.
+ * @param clock The TscClock object.
+ * @return Returns the ticks per second, 1000000000 when falling back to CLOCK_REALTIME.
+ */
+int64_t tsc_clock_frequency(const TscClock *clock);
+
+/**
+ * @brief Read the ticks of the clock, to convert them later with tsc_clock_to_nanoseconds().
+ * @param clock The TscClock object.
+ * @return Returns the ticks: one rdtsc instruction, or clock_gettime(CLOCK_REALTIME) when falling back.
+ */
+uint64_t tsc_clock_ticks(const TscClock *clock);
+
+/**
+ * @brief Convert the ticks of the clock to nanoseconds since 1970-01-01 00:00:00 UTC, with the current calibration.
+ * @param clock The TscClock object.
+ * @param ticks The ticks from tsc_clock_ticks().
+ * @return Returns the nanoseconds since 1970-01-01 00:00:00 UTC.
+ */
+int64_t tsc_clock_to_nanoseconds(const TscClock *clock, uint64_t ticks);
+
+/**
+ * @brief Calibrate the clock against CLOCK_REALTIME now.
+ * @param clock The TscClock object.
+ * @note Called by tsc_clock_now() once the period has passed. The frequency is measured over every calibration
+ *       since the wall clock was last set, and the wall clock is followed from the latest one.
+ */
+void tsc_clock_calibrate(TscClock *clock);
+
+/**
+ * @brief Get the current time in nanoseconds since 1970-01-01 00:00:00 UTC.
+ * @param clock The TscClock object.
+ * @return Returns the nanoseconds since 1970-01-01 00:00:00 UTC.
+ */
+int64_t tsc_clock_now(TscClock *clock);
+
+/**
+ * @brief Get the current Instant.
+ * @param clock The TscClock object.
+ * @return Returns the Instant, in milliseconds since 1970-01-01 00:00:00 UTC.
+ */
+Instant tsc_clock_now_instant(TscClock *clock);
+
+/**
+ * @brief Get the current DateTime object.
+ * @param clock The TscClock object.
+ * @return Returns the DateTime object, in UTC.
+ */
+DateTime tsc_clock_now_datetime(TscClock *clock);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
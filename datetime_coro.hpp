@@ -0,0 +1,240 @@
+#ifndef _DATETIME_CORO_HPP_
+#define _DATETIME_CORO_HPP_
+
+/*
+ * C++20 coroutines over the DateTimeLoop of datetime_loop.h: co_await datetime::sleep_until(deadline) and
+ * co_await datetime::sleep_for(interval) suspend the coroutine on a sleeper of the loop, and the loop resumes it
+ * once the deadline has passed. Thousands of sleeping coroutines cost one kernel timer and one thread.
+ *
+ * Header-only, compile with -std=c++20 and link with libdatetime. Linux only, like datetime_loop.h.
+ */
+
+#include "datetime_loop.h"
+
+#include <cerrno>
+#include <coroutine>
+#include <exception>
+#include <system_error>
+
+namespace datetime {
+
+/* A DateTimeLoop owned by the caller. The first loop created on a thread is the current loop of that thread. */
+class Loop {
+public:
+    /**
+     * @brief Create a loop without sleepers.
+     * @throw std::system_error if the loop cannot be created.
+     */
+    Loop() : loop_(datetime_loop_create()) {
+        if (loop_ == nullptr) {
+            throw std::system_error(errno, std::generic_category(), "datetime_loop_create");
+        }
+        if (current_ == nullptr) {
+            current_ = this;
+        }
+    }
+
+    /**
+     * @brief Destroy the loop. The coroutines still sleeping on it must have been destroyed before.
+     */
+    ~Loop() {
+        if (current_ == this) {
+            current_ = nullptr;
+        }
+        datetime_loop_destroy(loop_);
+    }
+
+    Loop(const Loop &) = delete;
+    Loop &operator=(const Loop &) = delete;
+
+    /**
+     * @brief Get the current loop of the thread.
+     * @return Returns the first loop created on the thread and not destroyed yet, or nullptr.
+     */
+    static Loop *current() noexcept {
+        return current_;
+    }
+
+    /**
+     * @brief Get the underlying DateTimeLoop object.
+     * @return Returns the DateTimeLoop object.
+     */
+    DateTimeLoop *get() const noexcept {
+        return loop_;
+    }
+
+    /**
+     * @brief Get the number of sleeping coroutines and other sleepers.
+     * @return Returns the number of registered sleepers.
+     */
+    size_t count() const noexcept {
+        return datetime_loop_count(loop_);
+    }
+
+    /**
+     * @brief Resume the coroutines until none is sleeping or stop() is called.
+     * @throw std::system_error if the loop fails.
+     */
+    void run() {
+        if (!datetime_loop_run(loop_)) {
+            throw std::system_error(errno, std::generic_category(), "datetime_loop_run");
+        }
+    }
+
+    /**
+     * @brief Wait once for the next deadline, and resume the coroutines whose deadline has passed.
+     * @param timeout_milliseconds The maximum time to wait in milliseconds, 0 not to wait, or -1 to wait without a limit.
+     * @return Returns the number of coroutines resumed.
+     * @throw std::system_error if the loop fails.
+     */
+    size_t run_once(int timeout_milliseconds = -1) {
+        size_t woken = 0;
+
+        if (!datetime_loop_run_once(loop_, timeout_milliseconds, &woken)) {
+            throw std::system_error(errno, std::generic_category(), "datetime_loop_run_once");
+        }
+        return woken;
+    }
+
+    /**
+     * @brief Make run() return after the current coroutines suspend.
+     */
+    void stop() noexcept {
+        datetime_loop_stop(loop_);
+    }
+
+private:
+    DateTimeLoop *loop_;
+    static inline thread_local Loop *current_ = nullptr;
+};
+
+/*
+ * The awaitable of sleep_until() and sleep_for(). Destroying the suspended coroutine cancels its sleeper.
+ * Without a loop, as when the thread has no current loop, co_await throws std::system_error with EINVAL.
+ */
+class SleepAwaiter {
+public:
+    SleepAwaiter(Loop *loop, DateTime deadline) noexcept
+        : loop_(loop != nullptr ? loop->get() : nullptr), deadline_(deadline), interval_(), relative_(false), error_(0), sleeper_() {
+    }
+
+    SleepAwaiter(Loop *loop, TimeInterval interval) noexcept
+        : loop_(loop != nullptr ? loop->get() : nullptr), deadline_(), interval_(interval), relative_(true), error_(0), sleeper_() {
+    }
+
+    ~SleepAwaiter() {
+        if (sleeper_.id != 0) {
+            datetime_loop_cancel(loop_, &sleeper_);
+        }
+    }
+
+    SleepAwaiter(const SleepAwaiter &) = delete;
+    SleepAwaiter &operator=(const SleepAwaiter &) = delete;
+
+    bool await_ready() const noexcept {
+        return false;
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle) noexcept {
+        if (loop_ == nullptr) {
+            error_ = EINVAL;
+            return false;
+        }
+        sleeper_.callback = &SleepAwaiter::resume;
+        sleeper_.data = handle.address();
+        errno = 0;
+        if (relative_ ? datetime_loop_sleep_for(loop_, &sleeper_, interval_) : datetime_loop_sleep_until(loop_, &sleeper_, deadline_)) {
+            return true;
+        }
+        error_ = errno == ENOMEM ? ENOMEM : EINVAL;
+        return false;
+    }
+
+    /**
+     * @throw std::system_error with EINVAL if there is no loop or the deadline is invalid or out of range, or ENOMEM.
+     */
+    void await_resume() const {
+        if (error_ != 0) {
+            throw std::system_error(error_, std::generic_category(), "datetime sleep");
+        }
+    }
+
+private:
+    static void resume(void *data) {
+        std::coroutine_handle<>::from_address(data).resume();
+    }
+
+    DateTimeLoop *loop_;
+    DateTime deadline_;
+    TimeInterval interval_;
+    bool relative_;
+    int error_;
+    DateTimeSleeper sleeper_;
+};
+
+/**
+ * @brief Suspend the coroutine until the deadline.
+ * @param loop The loop resuming the coroutine.
+ * @param deadline The DateTime object, in local time like datetime_now().
+ * @return Returns the awaitable.
+ */
+inline SleepAwaiter sleep_until(Loop &loop, DateTime deadline) noexcept {
+    return SleepAwaiter(&loop, deadline);
+}
+
+/**
+ * @brief Suspend the coroutine until the deadline, on the current loop of the thread.
+ * @param deadline The DateTime object, in local time like datetime_now().
+ * @return Returns the awaitable.
+ * @note Without a current loop on the thread (see Loop::current()), co_await throws std::system_error with EINVAL.
+ */
+inline SleepAwaiter sleep_until(DateTime deadline) noexcept {
+    return SleepAwaiter(Loop::current(), deadline);
+}
+
+/**
+ * @brief Suspend the coroutine for the time interval.
+ * @param loop The loop resuming the coroutine.
+ * @param interval The TimeInterval object.
+ * @return Returns the awaitable.
+ */
+inline SleepAwaiter sleep_for(Loop &loop, TimeInterval interval) noexcept {
+    return SleepAwaiter(&loop, interval);
+}
+
+/**
+ * @brief Suspend the coroutine for the time interval, on the current loop of the thread.
+ * @param interval The TimeInterval object.
+ * @return Returns the awaitable.
+ * @note Without a current loop on the thread (see Loop::current()), co_await throws std::system_error with EINVAL.
+ */
+inline SleepAwaiter sleep_for(TimeInterval interval) noexcept {
+    return SleepAwaiter(Loop::current(), interval);
+}
+
+/*
+ * A fire-and-forget coroutine: it runs at once until its first co_await, and frees itself when it returns.
+ * An exception escaping it terminates the program.
+ */
+struct Task {
+    struct promise_type {
+        Task get_return_object() noexcept {
+            return Task();
+        }
+        std::suspend_never initial_suspend() noexcept {
+            return {};
+        }
+        std::suspend_never final_suspend() noexcept {
+            return {};
+        }
+        void return_void() noexcept {
+        }
+        void unhandled_exception() noexcept {
+            std::terminate();
+        }
+    };
+};
+
+} // namespace datetime
+
+#endif
@@ -0,0 +1,403 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include "datetime_loop.h"
+#include "datetime_alarm.h"
+#include <errno.h>
+#include <stdlib.h>
+#include <time.h>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <unistd.h>
+#endif
+
+#define return_if_fail(expr) \
+    if (!(expr)) {           \
+        return;              \
+    }
+
+#define return_value_if_fail(expr, ret) \
+    if (!(expr)) {                      \
+        return (ret);                   \
+    }
+
+#ifdef __linux__
+
+struct DateTimeLoop {
+    int epoll_fd;
+    DateTimeAlarm *alarm;
+    TimerWheel *wheel;
+    bool armed;
+    Instant armed_at; /* the deadline of the alarm if armed */
+    bool expired;     /* the alarm has expired, and its timerfd still follows the changes of the wall clock */
+    bool stopped;
+
+    /* The UTC offset of local time over the quarter hour [offset_from, offset_until) of local time */
+    int64_t offset_from;
+    int64_t offset_until;
+    int64_t offset_seconds;
+
+    /* The batch being dispatched: a copy, so that a callback can cancel the sleepers after it */
+    TimerExpiry dispatching[TIMER_WHEEL_BATCH];
+    size_t dispatch_next;
+    size_t dispatch_count;
+};
+
+/**
+ * @brief Get the milliseconds of the time interval.
+ * @param time_interval The TimeInterval object.
+ * @return Returns the milliseconds.
+ */
+static int64_t __interval_milliseconds(TimeInterval time_interval) {
+    return (int64_t)time_interval.days * MILLISECONDS_PER_DAY + (int64_t)time_interval.hours * MILLISECONDS_PER_HOUR +
+           (int64_t)time_interval.minutes * MILLISECONDS_PER_MINUTE + (int64_t)time_interval.seconds * MILLISECONDS_PER_SECOND +
+           time_interval.milliseconds;
+}
+
+/**
+ * @brief Read CLOCK_REALTIME, the clock of the wheel.
+ * @param context Unused.
+ * @return Returns the current Instant.
+ * @note The wheel runs on UTC Instants rather than on local time, which repeats an hour when daylight saving
+ *       time ends: a deadline in local time would then pass an hour late, and the wheel would stall meanwhile.
+ */
+static Instant __now(void *context) {
+    struct timespec ts;
+
+    (void)context;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (Instant)ts.tv_sec * MILLISECONDS_PER_SECOND + ts.tv_nsec / NANOSECONDS_PER_MILLISECOND;
+}
+
+#define UTC_OFFSET_CACHE_SECONDS (15 * SECONDS_PER_MINUTE)
+
+/**
+ * @brief Convert the deadline in local time to an Instant.
+ * @param loop The DateTimeLoop object, caching the UTC offset of the last quarter hour converted.
+ * @param deadline The DateTime object, in local time.
+ * @param out The Instant (output).
+ * @return Returns true on success, or false if the deadline is invalid or out of the range of time_t.
+ * @note mktime() only runs when the deadline leaves the cached quarter hour, as time zones change offsets on
+ *       quarter hours. A deadline in the gap of the start of daylight saving time is moved forward by mktime(),
+ *       and one in the repeated hour of its end is taken in either offset.
+ */
+static bool __instant_from_local(DateTimeLoop *loop, DateTime deadline, Instant *out) {
+    Instant local;
+    int64_t seconds;
+    struct tm tm;
+    time_t t;
+
+    return_value_if_fail(instant_from_datetime_checked(deadline, &local) == DATETIME_OK, false);
+
+    seconds = local >= 0 ? local / MILLISECONDS_PER_SECOND : -((-local + MILLISECONDS_PER_SECOND - 1) / MILLISECONDS_PER_SECOND);
+    if (seconds < loop->offset_from || seconds >= loop->offset_until) {
+        tm.tm_year = deadline.date.year - 1900;
+        tm.tm_mon = deadline.date.month - 1;
+        tm.tm_mday = deadline.date.day;
+        tm.tm_hour = deadline.time.hour;
+        tm.tm_min = deadline.time.minute;
+        tm.tm_sec = deadline.time.second;
+        tm.tm_isdst = -1;
+        t = mktime(&tm);
+        return_value_if_fail(t != (time_t)-1, false);
+        loop->offset_seconds = seconds - (int64_t)t;
+        loop->offset_from = seconds - (seconds % UTC_OFFSET_CACHE_SECONDS + UTC_OFFSET_CACHE_SECONDS) % UTC_OFFSET_CACHE_SECONDS;
+        loop->offset_until = loop->offset_from + UTC_OFFSET_CACHE_SECONDS;
+    }
+    *out = local - loop->offset_seconds * MILLISECONDS_PER_SECOND;
+    return true;
+}
+
+/**
+ * @brief Wake up the sleepers of a batch expired by the wheel.
+ * @param expired The array of count expired timers.
+ * @param count The number of expired timers.
+ * @param context The DateTimeLoop object.
+ */
+static void __dispatch(const TimerExpiry *expired, size_t count, void *context) {
+    DateTimeLoop *loop = (DateTimeLoop *)context;
+    DateTimeSleeper *sleeper;
+    size_t i;
+
+    for (i = 0; i < count; i++) {
+        loop->dispatching[i] = expired[i];
+    }
+    loop->dispatch_count = count;
+    for (loop->dispatch_next = 0; loop->dispatch_next < loop->dispatch_count;) {
+        sleeper = (DateTimeSleeper *)loop->dispatching[loop->dispatch_next++].data;
+        if (sleeper != NULL) {
+            sleeper->id = 0;
+            sleeper->callback(sleeper->data);
+        }
+    }
+    loop->dispatch_count = 0;
+}
+
+/**
+ * @brief Arm the alarm at the next expiry of the wheel, or disarm it if the wheel is empty.
+ * @param loop The DateTimeLoop object.
+ * @return Returns true on success, otherwise returns false.
+ */
+static bool __rearm(DateTimeLoop *loop) {
+    Instant next;
+
+    if (!timer_wheel_next_expiry(loop->wheel, &next)) {
+        /* Cleared after the last expiry too, so that an idle loop does not wake up when the wall clock is set */
+        return_value_if_fail(loop->armed || loop->expired, true);
+        return_value_if_fail(datetime_alarm_clear(loop->alarm), false);
+        loop->armed = false;
+        loop->expired = false;
+        return true;
+    }
+    return_value_if_fail(!loop->armed || next != loop->armed_at, true);
+    return_value_if_fail(datetime_alarm_set(loop->alarm, instant_to_datetime_unchecked(next)), false);
+    loop->armed = true;
+    loop->armed_at = next;
+    loop->expired = false;
+    return true;
+}
+
+/**
+ * @brief Create a DateTimeLoop object without sleepers.
+ * @return Returns the DateTimeLoop object, or NULL if the epoll instance, the alarm or the wheel cannot be created.
+ * @note The caller must destroy the returned loop with datetime_loop_destroy().
+ */
+DateTimeLoop *datetime_loop_create(void) {
+    DateTimeLoop *loop = (DateTimeLoop *)calloc(1, sizeof(DateTimeLoop));
+    struct epoll_event event;
+
+    return_value_if_fail(loop != NULL, NULL);
+    loop->epoll_fd = epoll_create(1);
+    loop->alarm = datetime_alarm_create(false);
+    loop->wheel = timer_wheel_create(1, __now, NULL);
+    if (loop->epoll_fd >= 0 && loop->alarm != NULL && loop->wheel != NULL) {
+        event.events = EPOLLIN;
+        event.data.ptr = loop->alarm;
+        if (epoll_ctl(loop->epoll_fd, EPOLL_CTL_ADD, datetime_alarm_fd(loop->alarm), &event) == 0) {
+            return loop;
+        }
+    }
+    datetime_loop_destroy(loop);
+    return NULL;
+}
+
+/**
+ * @brief Destroy the DateTimeLoop object, dropping the sleepers without calling them.
+ * @param loop The DateTimeLoop object.
+ */
+void datetime_loop_destroy(DateTimeLoop *loop) {
+    return_if_fail(loop != NULL);
+
+    if (loop->epoll_fd >= 0) {
+        close(loop->epoll_fd);
+    }
+    datetime_alarm_destroy(loop->alarm);
+    timer_wheel_destroy(loop->wheel);
+    free(loop);
+}
+
+/**
+ * @brief Get the file descriptor of the loop, to nest it in another event loop.
+ * @param loop The DateTimeLoop object.
+ * @return Returns the epoll file descriptor, readable when datetime_loop_run_once() has sleepers to wake up.
+ */
+int datetime_loop_fd(const DateTimeLoop *loop) {
+    return loop->epoll_fd;
+}
+
+/**
+ * @brief Register the sleeper until the deadline.
+ * @param loop The DateTimeLoop object.
+ * @param sleeper The sleeper, with its callback and data set. It must stay valid until it wakes up or is cancelled.
+ * @param deadline The DateTime object, in local time like datetime_now(). Converted to an Instant once, here.
+ * @return Returns true on success, or false if the sleeper is already registered, the deadline is invalid,
+ *         or the allocation fails.
+ * @note O(1). A deadline that has already passed wakes the sleeper on the next run of the loop. The loop caches
+ *       the UTC offset of the quarter hour of local time last converted, so that mktime() seldom runs.
+ */
+bool datetime_loop_sleep_until(DateTimeLoop *loop, DateTimeSleeper *sleeper, DateTime deadline) {
+    Instant instant;
+
+    return_value_if_fail(loop != NULL && sleeper != NULL && sleeper->callback != NULL && sleeper->id == 0, false);
+    return_value_if_fail(__instant_from_local(loop, deadline, &instant), false);
+
+    sleeper->id = timer_wheel_schedule_instant(loop->wheel, instant, sleeper);
+    return sleeper->id != 0;
+}
+
+/**
+ * @brief Register the sleeper for the time interval from now.
+ * @param loop The DateTimeLoop object.
+ * @param sleeper The sleeper, with its callback and data set. It must stay valid until it wakes up or is cancelled.
+ * @param time_interval The TimeInterval object.
+ * @return Returns true on success, or false if the sleeper is already registered, the deadline is out of range,
+ *         or the allocation fails.
+ * @see datetime_loop_sleep_until()
+ */
+bool datetime_loop_sleep_for(DateTimeLoop *loop, DateTimeSleeper *sleeper, TimeInterval time_interval) {
+    return_value_if_fail(loop != NULL && sleeper != NULL && sleeper->callback != NULL && sleeper->id == 0, false);
+
+    sleeper->id = timer_wheel_schedule_instant(loop->wheel, timer_wheel_now(loop->wheel) + __interval_milliseconds(time_interval), sleeper);
+    return sleeper->id != 0;
+}
+
+/**
+ * @brief Cancel the sleeper without calling it.
+ * @param loop The DateTimeLoop object.
+ * @param sleeper The sleeper.
+ * @return Returns true if the sleeper was registered, otherwise returns false.
+ * @note Safe from the callback of another sleeper woken up at the same time.
+ */
+bool datetime_loop_cancel(DateTimeLoop *loop, DateTimeSleeper *sleeper) {
+    size_t i;
+
+    return_value_if_fail(loop != NULL && sleeper != NULL && sleeper->id != 0, false);
+
+    if (!timer_wheel_cancel(loop->wheel, sleeper->id)) {
+        /* Expired in the batch being dispatched, but not called yet */
+        for (i = loop->dispatch_next; i < loop->dispatch_count && loop->dispatching[i].id != sleeper->id; i++) {
+        }
+        return_value_if_fail(i < loop->dispatch_count, false);
+        loop->dispatching[i].data = NULL;
+    }
+    sleeper->id = 0;
+    return true;
+}
+
+/**
+ * @brief Get the number of registered sleepers.
+ * @param loop The DateTimeLoop object.
+ * @return Returns the number of registered sleepers.
+ */
+size_t datetime_loop_count(const DateTimeLoop *loop) {
+    return timer_wheel_count(loop->wheel);
+}
+
+/**
+ * @brief Wait for the next expiry of the loop once, and wake up the sleepers whose deadline has passed.
+ * @param loop The DateTimeLoop object.
+ * @param timeout_milliseconds The maximum time to wait in milliseconds, 0 not to wait, or -1 to wait without a limit.
+ * @param woken The number of sleepers woken up (output), can be NULL.
+ * @return Returns true on success, or false if the alarm cannot be armed or waited for (see errno).
+ */
+bool datetime_loop_run_once(DateTimeLoop *loop, int timeout_milliseconds, size_t *woken) {
+    struct epoll_event event;
+    size_t count;
+    int ready;
+
+    return_value_if_fail(loop != NULL && loop->dispatch_count == 0, false);
+    return_value_if_fail(__rearm(loop), false);
+
+    ready = epoll_wait(loop->epoll_fd, &event, 1, timeout_milliseconds);
+    return_value_if_fail(ready >= 0 || errno == EINTR, false);
+    if (ready > 0) {
+        switch (datetime_alarm_read(loop->alarm)) {
+        case ALARM_EXPIRED:
+            loop->armed = false;
+            loop->expired = true;
+            break;
+        case ALARM_CLOCK_CHANGED: /* re-armed by the alarm if armed, otherwise cleared */
+            loop->expired = false;
+            break;
+        case ALARM_ERROR:
+            return false;
+        default:
+            break;
+        }
+    }
+
+    count = timer_wheel_expire(loop->wheel, __dispatch, loop);
+    if (woken != NULL) {
+        *woken = count;
+    }
+    return true;
+}
+
+/**
+ * @brief Run the loop until no sleeper is left or datetime_loop_stop() is called.
+ * @param loop The DateTimeLoop object.
+ * @return Returns true on success, or false on error (see errno).
+ */
+bool datetime_loop_run(DateTimeLoop *loop) {
+    return_value_if_fail(loop != NULL, false);
+
+    loop->stopped = false;
+    while (!loop->stopped && timer_wheel_count(loop->wheel) > 0) {
+        return_value_if_fail(datetime_loop_run_once(loop, -1, NULL), false);
+    }
+    return __rearm(loop);
+}
+
+/**
+ * @brief Make datetime_loop_run() return after the current callbacks.
+ * @param loop The DateTimeLoop object.
+ * @note Only from the thread running the loop, typically from a callback.
+ */
+void datetime_loop_stop(DateTimeLoop *loop) {
+    return_if_fail(loop != NULL);
+
+    loop->stopped = true;
+}
+
+#else
+
+DateTimeLoop *datetime_loop_create(void) {
+    errno = ENOSYS;
+    return NULL;
+}
+
+void datetime_loop_destroy(DateTimeLoop *loop) {
+    (void)loop;
+}
+
+int datetime_loop_fd(const DateTimeLoop *loop) {
+    (void)loop;
+    return -1;
+}
+
+bool datetime_loop_sleep_until(DateTimeLoop *loop, DateTimeSleeper *sleeper, DateTime deadline) {
+    (void)loop;
+    (void)sleeper;
+    (void)deadline;
+    return false;
+}
+
+bool datetime_loop_sleep_for(DateTimeLoop *loop, DateTimeSleeper *sleeper, TimeInterval time_interval) {
+    (void)loop;
+    (void)sleeper;
+    (void)time_interval;
+    return false;
+}
+
+bool datetime_loop_cancel(DateTimeLoop *loop, DateTimeSleeper *sleeper) {
+    (void)loop;
+    (void)sleeper;
+    return false;
+}
+
+size_t datetime_loop_count(const DateTimeLoop *loop) {
+    (void)loop;
+    return 0;
+}
+
+bool datetime_loop_run_once(DateTimeLoop *loop, int timeout_milliseconds, size_t *woken) {
+    (void)loop;
+    (void)timeout_milliseconds;
+    (void)woken;
+    errno = ENOSYS;
+    return false;
+}
+
+bool datetime_loop_run(DateTimeLoop *loop) {
+    (void)loop;
+    errno = ENOSYS;
+    return false;
+}
+
+void datetime_loop_stop(DateTimeLoop *loop) {
+    (void)loop;
+}
+
+#endif
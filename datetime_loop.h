@@ -0,0 +1,120 @@
+#ifndef _DATETIME_LOOP_H_
+#define _DATETIME_LOOP_H_
+
+#include "datetime.h"
+#include "datetime_wheel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The callback of a sleeper, called by the loop once its deadline has passed.
+ * @param data The data of the sleeper.
+ */
+typedef void (*DateTimeSleeperCallback)(void *data);
+
+/* A sleeper, owned by the caller and registered with a loop until it wakes up or is cancelled. */
+typedef struct DateTimeSleeper {
+    DateTimeSleeperCallback callback;
+    void *data;
+    TimerId id; /* set by the loop, 0 when the sleeper is not registered */
+} DateTimeSleeper;
+
+/*
+ * A single-threaded event loop of sleepers: a TimerWheel of their deadlines as UTC Instants of CLOCK_REALTIME,
+ * and one DateTimeAlarm in UTC armed at the next expiry of the wheel and waited for with epoll(). Any number of
+ * sleepers cost one kernel timer, and a sleeper costs no thread and no polling. Local time is only read when a
+ * deadline is registered, so the changes of daylight saving time neither delay nor stall the loop.
+ *
+ * Only available on Linux: elsewhere datetime_loop_create() returns NULL.
+ */
+typedef struct DateTimeLoop DateTimeLoop;
+
+/**
+ * @brief Create a DateTimeLoop object without sleepers.
+ * @return Returns the DateTimeLoop object, or NULL if the epoll instance, the alarm or the wheel cannot be created.
+ * @note The caller must destroy the returned loop with datetime_loop_destroy().
+ */
+DateTimeLoop *datetime_loop_create(void);
+
+/**
+ * @brief Destroy the DateTimeLoop object, dropping the sleepers without calling them.
+ * @param loop The DateTimeLoop object.
+ */
+void datetime_loop_destroy(DateTimeLoop *loop);
+
+/**
+ * @brief Get the file descriptor of the loop, to nest it in another event loop.
+ * @param loop The DateTimeLoop object.
+ * @return Returns the epoll file descriptor, readable when datetime_loop_run_once() has sleepers to wake up.
+ */
+int datetime_loop_fd(const DateTimeLoop *loop);
+
+/**
+ * @brief Register the sleeper until the deadline.
+ * @param loop The DateTimeLoop object.
+ * @param sleeper The sleeper, with its callback and data set. It must stay valid until it wakes up or is cancelled.
+ * @param deadline The DateTime object, in local time like datetime_now(). Converted to an Instant once, here.
+ * @return Returns true on success, or false if the sleeper is already registered, the deadline is invalid,
+ *         or the allocation fails.
+ * @note O(1). A deadline that has already passed wakes the sleeper on the next run of the loop. The loop caches
+ *       the UTC offset of the quarter hour of local time last converted, so that mktime() seldom runs.
+ */
+bool datetime_loop_sleep_until(DateTimeLoop *loop, DateTimeSleeper *sleeper, DateTime deadline);
+
+/**
+ * @brief Register the sleeper for the time interval from now.
+ * @param loop The DateTimeLoop object.
+ * @param sleeper The sleeper, with its callback and data set. It must stay valid until it wakes up or is cancelled.
+ * @param time_interval The TimeInterval object.
+ * @return Returns true on success, or false if the sleeper is already registered, the deadline is out of range,
+ *         or the allocation fails.
+ * @see datetime_loop_sleep_until()
+ */
+bool datetime_loop_sleep_for(DateTimeLoop *loop, DateTimeSleeper *sleeper, TimeInterval time_interval);
+
+/**
+ * @brief Cancel the sleeper without calling it.
+ * @param loop The DateTimeLoop object.
+ * @param sleeper The sleeper.
+ * @return Returns true if the sleeper was registered, otherwise returns false.
+ * @note Safe from the callback of another sleeper woken up at the same time.
+ */
+bool datetime_loop_cancel(DateTimeLoop *loop, DateTimeSleeper *sleeper);
+
+/**
+ * @brief Get the number of registered sleepers.
+ * @param loop The DateTimeLoop object.
+ * @return Returns the number of registered sleepers.
+ */
+size_t datetime_loop_count(const DateTimeLoop *loop);
+
+/**
+ * @brief Wait for the next expiry of the loop once, and wake up the sleepers whose deadline has passed.
+ * @param loop The DateTimeLoop object.
+ * @param timeout_milliseconds The maximum time to wait in milliseconds, 0 not to wait, or -1 to wait without a limit.
+ * @param woken The number of sleepers woken up (output), can be NULL.
+ * @return Returns true on success, or false if the alarm cannot be armed or waited for (see errno).
+ */
+bool datetime_loop_run_once(DateTimeLoop *loop, int timeout_milliseconds, size_t *woken);
+
+/**
+ * @brief Run the loop until no sleeper is left or datetime_loop_stop() is called.
+ * @param loop The DateTimeLoop object.
+ * @return Returns true on success, or false on error (see errno).
+ */
+bool datetime_loop_run(DateTimeLoop *loop);
+
+/**
+ * @brief Make datetime_loop_run() return after the current callbacks.
+ * @param loop The DateTimeLoop object.
+ * @note Only from the thread running the loop, typically from a callback.
+ */
+void datetime_loop_stop(DateTimeLoop *loop);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
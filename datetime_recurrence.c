@@ -0,0 +1,1105 @@
+#include "datetime_recurrence.h"
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define return_if_fail(expr) \
+    if (!(expr)) {           \
+        return;              \
+    }
+
+#define return_value_if_fail(expr, ret) \
+    if (!(expr)) {                      \
+        return (ret);                   \
+    }
+
+#define MAX_YEAR 9999
+#define MAX_RULE_VALUES 64
+
+#define ALL_MINUTES (((uint64_t)1 << MINUTES_PER_HOUR) - 1)
+#define ALL_HOURS (((uint32_t)1 << HOURS_PER_DAY) - 1)
+#define ALL_MONTH_DAYS ((uint32_t)0xFFFFFFFE) /* bits 1 ~ 31 */
+#define ALL_MONTHS ((uint32_t)0x1FFE)        /* bits 1 ~ 12 */
+#define ALL_WEEKDAYS ((uint32_t)0x7F)        /* bits SUN ~ SAT */
+
+/* The period the INTERVAL of a rule counts, or FREQUENCY_NONE for cron expressions. */
+typedef enum RecurrenceFrequency {
+    FREQUENCY_NONE,
+    FREQUENCY_MINUTELY,
+    FREQUENCY_HOURLY,
+    FREQUENCY_DAILY,
+    FREQUENCY_WEEKLY,
+    FREQUENCY_MONTHLY,
+    FREQUENCY_YEARLY
+} RecurrenceFrequency;
+
+/* The fields recurrence_matches() reads for every rule come first, in the first 32 bytes. */
+struct Recurrence {
+    uint64_t minutes;          /* bits 0 ~ 59 */
+    uint32_t hours;            /* bits 0 ~ 23 */
+    uint32_t month_days;       /* bits 1 ~ 31 */
+    uint32_t last_days;        /* bit i: the i-th last day of the month */
+    uint16_t months;           /* bits 1 ~ 12 */
+    unsigned char weekdays;    /* bits SUN ~ SAT */
+    unsigned char day_or;      /* a day matches if its day of the month or its weekday matches, instead of both */
+    unsigned char empty;       /* COUNT found no occurrence */
+    unsigned char frequency;   /* RecurrenceFrequency */
+
+    int interval;
+    int64_t start_period; /* the number of the period of start, see __period() */
+    DateTime start;
+    bool has_until;
+    DateTime until;
+    int second;
+    int millisecond;
+};
+
+/* The bits of RecurrenceBatch.fields, the small fields of a rule packed in one word. */
+#define BATCH_MONTHS_SHIFT 0    /* bits 1 ~ 12: the months, all clear for a rule without occurrence */
+#define BATCH_WEEKDAYS_SHIFT 16 /* bits 16 ~ 22: the weekdays */
+#define BATCH_DAY_OR_BIT 24     /* Recurrence.day_or */
+#define BATCH_BOUNDED_BIT 25    /* a RRULE, whose matches are checked against its bounds */
+
+/*
+ * The bitsets of the rules, one array per field so that matching streams through them. The Recurrence objects
+ * are only read for the rules with bounds whose bitsets match.
+ */
+struct RecurrenceBatch {
+    size_t count;
+    uint64_t *minutes;
+    uint32_t *hours;
+    uint32_t *month_days;
+    uint32_t *last_days;
+    uint32_t *fields;
+    Recurrence *rules;
+};
+
+/* The fields of a minute that the rules are matched against, computed once for any number of rules. */
+typedef struct RecurrenceMinute {
+    DateTime datetime;
+    int last_day; /* the day counted from the end of the month, 1 for the last day */
+    int weekday;
+    int64_t periods[FREQUENCY_YEARLY + 1]; /* the number of the period of every frequency, see __period() */
+} RecurrenceMinute;
+
+/* The range and the names of the values of a cron field. */
+typedef struct CronField {
+    int min;
+    int max;
+    const char *const *names; /* 3-letter names of the values from min, or NULL */
+    int name_count;
+} CronField;
+
+static const char *const MONTH_ABBRS[MONTHS_PER_YEAR] = {"JAN", "FEB", "MAR", "APR", "MAY", "JUN",
+                                                          "JUL", "AUG", "SEP", "OCT", "NOV", "DEC"};
+static const char *const WEEKDAY_ABBRS[DAYS_IN_WEEK] = {"SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT"};
+static const char *const WEEKDAY_CODES[DAYS_IN_WEEK] = {"SU", "MO", "TU", "WE", "TH", "FR", "SA"};
+
+/**
+ * @brief Find the lowest set bit at or above the position.
+ * @param mask The bitset.
+ * @param from The position.
+ * @return Returns the position of the bit, or -1 if there is none.
+ */
+static int __next_bit(uint64_t mask, int from) {
+    int position;
+
+    return_value_if_fail(from < 64, -1);
+    mask &= ~(uint64_t)0 << from;
+    return_value_if_fail(mask != 0, -1);
+#ifdef __GNUC__
+    position = __builtin_ctzll(mask);
+#else
+    for (position = 0; !((mask >> position) & 1); position++) {
+    }
+#endif
+    return position;
+}
+
+/**
+ * @brief Count the set bits.
+ * @param x The word.
+ * @return Returns the number of set bits.
+ */
+static int __popcount64(uint64_t x) {
+#ifdef __GNUC__
+    return __builtin_popcountll(x);
+#else
+    x = x - ((x >> 1) & 0x5555555555555555);
+    x = (x & 0x3333333333333333) + ((x >> 2) & 0x3333333333333333);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0F;
+    return (int)((x * 0x0101010101010101) >> 56);
+#endif
+}
+
+/**
+ * @brief Get the day number of the date (0001-01-01 is day 1).
+ * @param year The year.
+ * @param month The month.
+ * @param day The day.
+ * @return Returns the day number.
+ */
+static int __day_number(int year, int month, int day) {
+    DateTime datetime;
+
+    datetime.date.year = year;
+    datetime.date.month = month;
+    datetime.date.day = day;
+    datetime.time.hour = 0;
+    datetime.time.minute = 0;
+    datetime.time.second = 0;
+    datetime.time.millisecond = 0;
+    return datetime_to_ordinal_unchecked(datetime);
+}
+
+/**
+ * @brief Get the number of the period of the frequency holding the minute.
+ * @param frequency The frequency.
+ * @param year The year.
+ * @param month The month.
+ * @param day_number The day number.
+ * @param hour The hour.
+ * @param minute The minute.
+ * @return Returns the number of the minute, hour, day, week (from Monday), month or year.
+ */
+static int64_t __period(RecurrenceFrequency frequency, int year, int month, int day_number, int hour, int minute) {
+    switch (frequency) {
+    case FREQUENCY_MINUTELY:
+        return ((int64_t)day_number * HOURS_PER_DAY + hour) * MINUTES_PER_HOUR + minute;
+    case FREQUENCY_HOURLY:
+        return (int64_t)day_number * HOURS_PER_DAY + hour;
+    case FREQUENCY_DAILY:
+        return day_number;
+    case FREQUENCY_WEEKLY:
+        return (day_number - 1) / DAYS_IN_WEEK; /* 0001-01-01 is a Monday */
+    case FREQUENCY_MONTHLY:
+        return (int64_t)year * MONTHS_PER_YEAR + month - 1;
+    default:
+        return year;
+    }
+}
+
+/**
+ * @brief Get the bits first ~ last whose periods are a multiple of the interval away from the period of start.
+ * @param rule The Recurrence object.
+ * @param period The period of bit 0. The period of bit i is period + i.
+ * @param first The first bit.
+ * @param last The last bit.
+ * @return Returns the bitset.
+ */
+static uint64_t __stride_mask(const Recurrence *rule, int64_t period, int first, int last) {
+    uint64_t mask = 0;
+    int bit = (int)(((rule->start_period - period) % rule->interval + rule->interval) % rule->interval);
+
+    for (; bit <= last; bit += rule->interval) {
+        if (bit >= first) {
+            mask |= (uint64_t)1 << bit;
+        }
+    }
+    return mask;
+}
+
+/**
+ * @brief Get the months of the year that can hold an occurrence.
+ * @param rule The Recurrence object.
+ * @param year The year.
+ * @return Returns the bitset of the months (bits 1 ~ 12).
+ */
+static uint64_t __month_mask(const Recurrence *rule, int year) {
+    if (rule->interval == 1) {
+        return rule->months;
+    }
+    if (rule->frequency == FREQUENCY_YEARLY) {
+        return (year - rule->start_period) % rule->interval == 0 ? rule->months : 0;
+    }
+    if (rule->frequency == FREQUENCY_MONTHLY) {
+        return rule->months & __stride_mask(rule, (int64_t)year * MONTHS_PER_YEAR - 1, JAN, DEC);
+    }
+    return rule->months;
+}
+
+/**
+ * @brief Get the days of the month that can hold an occurrence.
+ * @param rule The Recurrence object.
+ * @param year The year.
+ * @param month The month.
+ * @param first_day The day number of the first day of the month.
+ * @return Returns the bitset of the days (bits 1 ~ 31).
+ */
+static uint64_t __day_mask(const Recurrence *rule, int year, int month, int first_day) {
+    int month_days = days_in_month(year, month);
+    uint64_t valid = ((uint64_t)1 << (month_days + 1)) - 2;
+    uint64_t month_day_mask = rule->month_days;
+    uint64_t weekday_mask;
+    uint64_t pattern = 0;
+    uint64_t mask;
+    int first_weekday = weekday_from_ordinal_unchecked(first_day);
+    int i;
+
+    for (i = 1; i <= 31; i++) {
+        if ((rule->last_days >> i) & 1 && i <= month_days) {
+            month_day_mask |= (uint64_t)1 << (month_days + 1 - i);
+        }
+    }
+
+    /* The weekdays of the days 1 ~ 7, repeated over the month. */
+    for (i = 0; i < DAYS_IN_WEEK; i++) {
+        pattern |= (uint64_t)((rule->weekdays >> ((first_weekday + i) % DAYS_IN_WEEK)) & 1) << i;
+    }
+    weekday_mask = (pattern | pattern << 7 | pattern << 14 | pattern << 21 | pattern << 28) << 1;
+
+    mask = (rule->day_or ? month_day_mask | weekday_mask : month_day_mask & weekday_mask) & valid;
+    if (rule->interval > 1 && rule->frequency == FREQUENCY_DAILY) {
+        mask &= __stride_mask(rule, first_day - 1, 1, month_days);
+    } else if (rule->interval > 1 && rule->frequency == FREQUENCY_WEEKLY) {
+        for (i = 1; i <= month_days; i++) {
+            if ((__period(FREQUENCY_WEEKLY, year, month, first_day + i - 1, 0, 0) - rule->start_period) % rule->interval != 0) {
+                mask &= ~((uint64_t)1 << i);
+            }
+        }
+    }
+    return mask;
+}
+
+/**
+ * @brief Get the hours of the day that can hold an occurrence.
+ * @param rule The Recurrence object.
+ * @param day_number The day number.
+ * @return Returns the bitset of the hours.
+ */
+static uint64_t __hour_mask(const Recurrence *rule, int day_number) {
+    if (rule->interval > 1 && rule->frequency == FREQUENCY_HOURLY) {
+        return rule->hours & __stride_mask(rule, (int64_t)day_number * HOURS_PER_DAY, 0, HOURS_PER_DAY - 1);
+    }
+    return rule->hours;
+}
+
+/**
+ * @brief Get the minutes of the hour that can hold an occurrence.
+ * @param rule The Recurrence object.
+ * @param day_number The day number.
+ * @param hour The hour.
+ * @return Returns the bitset of the minutes.
+ */
+static uint64_t __minute_mask(const Recurrence *rule, int day_number, int hour) {
+    if (rule->interval > 1 && rule->frequency == FREQUENCY_MINUTELY) {
+        return rule->minutes & __stride_mask(rule, ((int64_t)day_number * HOURS_PER_DAY + hour) * MINUTES_PER_HOUR, 0,
+                                             MINUTES_PER_HOUR - 1);
+    }
+    return rule->minutes;
+}
+
+/**
+ * @brief Find the first occurrence at or after the minute, ignoring COUNT and UNTIL.
+ * @param rule The Recurrence object.
+ * @param year The year of the minute.
+ * @param month The month of the minute.
+ * @param day The day of the minute.
+ * @param hour The hour of the minute.
+ * @param minute The minute. The fields may overflow by one, like minute 60 for the next hour.
+ * @param out The occurrence (output).
+ * @return Returns true if there is an occurrence until the last year, otherwise returns false.
+ * @note A field is only searched again after a field above it moves, and each search is one next-bit lookup.
+ */
+static bool __next_occurrence(const Recurrence *rule, int year, int month, int day, int hour, int minute, DateTime *out) {
+    int last_year = rule->has_until ? rule->until.date.year : MAX_YEAR;
+    int first_day;
+    int next;
+
+    while (year <= last_year) {
+        next = __next_bit(__month_mask(rule, year), month);
+        if (next < 0) {
+            year++;
+            month = JAN;
+            day = 1;
+            hour = 0;
+            minute = 0;
+            continue;
+        }
+        if (next != month) {
+            month = next;
+            day = 1;
+            hour = 0;
+            minute = 0;
+        }
+
+        first_day = __day_number(year, month, 1);
+        next = __next_bit(__day_mask(rule, year, month, first_day), day);
+        if (next < 0) {
+            month++;
+            day = 1;
+            hour = 0;
+            minute = 0;
+            continue;
+        }
+        if (next != day) {
+            day = next;
+            hour = 0;
+            minute = 0;
+        }
+
+        next = __next_bit(__hour_mask(rule, first_day + day - 1), hour);
+        if (next < 0) {
+            day++;
+            hour = 0;
+            minute = 0;
+            continue;
+        }
+        if (next != hour) {
+            hour = next;
+            minute = 0;
+        }
+
+        next = __next_bit(__minute_mask(rule, first_day + day - 1, hour), minute);
+        if (next < 0) {
+            hour++;
+            minute = 0;
+            continue;
+        }
+
+        out->date.year = year;
+        out->date.month = month;
+        out->date.day = day;
+        out->time.hour = hour;
+        out->time.minute = next;
+        out->time.second = rule->second;
+        out->time.millisecond = rule->millisecond;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Find the first occurrence after the datetime.
+ * @param rule The Recurrence object.
+ * @param after The DateTime object.
+ * @param out The first occurrence strictly after the datetime (output). Unchanged on error.
+ * @return Returns true on success, or false if the datetime is invalid or no occurrence follows it until 9999-12-31.
+ * @note Each step jumps to the next set bit of a field, so the cost depends on the number of fields that roll over,
+ *       not on the distance to the occurrence.
+ */
+bool recurrence_next_occurrence(const Recurrence *rule, DateTime after, DateTime *out) {
+    DateTime occurrence;
+    int ordinal;
+    int minute;
+
+    return_value_if_fail(rule != NULL && out != NULL && !rule->empty, false);
+    return_value_if_fail(datetime_to_ordinal_checked(after, &ordinal) == DATETIME_OK, false);
+
+    /* Occurrences have the second and millisecond of the rule, so the search starts at a whole minute. */
+    if (rule->frequency != FREQUENCY_NONE && datetime_compare_unchecked(after, rule->start) < 0) {
+        after = rule->start;
+        minute = after.time.minute;
+    } else {
+        minute = after.time.minute + (after.time.second > rule->second ||
+                                       (after.time.second == rule->second && after.time.millisecond >= rule->millisecond));
+    }
+
+    return_value_if_fail(__next_occurrence(rule, after.date.year, after.date.month, after.date.day, after.time.hour, minute, &occurrence), false);
+    return_value_if_fail(!rule->has_until || datetime_compare_unchecked(occurrence, rule->until) <= 0, false);
+    *out = occurrence;
+    return true;
+}
+
+/**
+ * @brief Find the first occurrence of every rule after the datetime.
+ * @param rules The array of count Recurrence objects.
+ * @param after The DateTime object.
+ * @param results The array of count occurrences (output). Rows without an occurrence are left unchanged.
+ * @param valid The array of count results (output), 1 for a row with an occurrence and 0 otherwise, can be NULL.
+ * @param count The number of rows.
+ * @return Returns the number of rows with an occurrence.
+ */
+size_t recurrence_next_occurrence_many(const Recurrence *const *rules, DateTime after, DateTime *results, int *valid, size_t count) {
+    size_t found = 0;
+    size_t i;
+    bool row_valid;
+
+    return_value_if_fail(rules != NULL && results != NULL, 0);
+
+    for (i = 0; i < count; i++) {
+        row_valid = recurrence_next_occurrence(rules[i], after, &results[i]);
+        found += row_valid;
+        if (valid != NULL) {
+            valid[i] = row_valid;
+        }
+    }
+    return found;
+}
+
+/**
+ * @brief Compute the fields of the minute of the datetime.
+ * @param datetime The DateTime object.
+ * @param minute The fields (output).
+ * @return Returns true on success, or false if the datetime is invalid.
+ */
+static bool __recurrence_minute(DateTime datetime, RecurrenceMinute *minute) {
+    int day_number;
+    int frequency;
+
+    return_value_if_fail(datetime_to_ordinal_checked(datetime, &day_number) == DATETIME_OK, false);
+
+    minute->datetime = datetime;
+    minute->last_day = days_in_month(datetime.date.year, datetime.date.month) + 1 - datetime.date.day;
+    minute->weekday = weekday_from_ordinal_unchecked(day_number);
+    for (frequency = FREQUENCY_MINUTELY; frequency <= FREQUENCY_YEARLY; frequency++) {
+        minute->periods[frequency] = __period((RecurrenceFrequency)frequency, datetime.date.year, datetime.date.month, day_number,
+                                              datetime.time.hour, datetime.time.minute);
+    }
+    return true;
+}
+
+/**
+ * @brief Determine whether the occurrence of the rule in the minute is in the bounds of a RRULE.
+ * @param rule The Recurrence object, compiled from a RRULE.
+ * @param minute The fields of the minute, matched by the bitsets of the rule.
+ * @return Returns true if the occurrence is in start ~ UNTIL and in a period counted by INTERVAL, otherwise returns false.
+ */
+static bool __recurrence_in_bounds(const Recurrence *rule, const RecurrenceMinute *minute) {
+    DateTime datetime = minute->datetime;
+
+    datetime.time.second = rule->second;
+    datetime.time.millisecond = rule->millisecond;
+    return_value_if_fail(datetime_compare_unchecked(datetime, rule->start) >= 0, false);
+    return_value_if_fail(!rule->has_until || datetime_compare_unchecked(datetime, rule->until) <= 0, false);
+    return (minute->periods[rule->frequency] - rule->start_period) % rule->interval == 0;
+}
+
+/**
+ * @brief Determine whether an occurrence falls in the minute.
+ * @param rule The Recurrence object.
+ * @param minute The fields of the minute.
+ * @return Returns true if the rule has an occurrence in the minute, otherwise returns false.
+ */
+static bool __recurrence_matches(const Recurrence *rule, const RecurrenceMinute *minute) {
+    const DateTime *datetime = &minute->datetime;
+    unsigned int month_day;
+    unsigned int week_day;
+    unsigned int matched;
+
+    /* Without branches: the rules of a scheduler match in no predictable order. */
+    month_day = (unsigned int)((rule->month_days >> datetime->date.day) | (rule->last_days >> minute->last_day)) & 1;
+    week_day = (unsigned int)(rule->weekdays >> minute->weekday) & 1;
+    matched = (unsigned int)(rule->minutes >> datetime->time.minute) & (unsigned int)(rule->hours >> datetime->time.hour) &
+              (unsigned int)(rule->months >> datetime->date.month) & ((month_day & week_day) | ((month_day | week_day) & rule->day_or)) &
+              (unsigned int)!rule->empty;
+    return matched != 0 && (rule->frequency == FREQUENCY_NONE || __recurrence_in_bounds(rule, minute));
+}
+
+/**
+ * @brief Determine whether an occurrence falls in the minute of the datetime.
+ * @param rule The Recurrence object.
+ * @param datetime The DateTime object.
+ * @return Returns true if the rule has an occurrence in the minute, otherwise returns false.
+ * @note O(1): a few bit tests. To evaluate many rules on every tick, use recurrence_batch_matches().
+ */
+bool recurrence_matches(const Recurrence *rule, DateTime datetime) {
+    RecurrenceMinute minute;
+
+    return_value_if_fail(rule != NULL && __recurrence_minute(datetime, &minute), false);
+    return __recurrence_matches(rule, &minute);
+}
+
+/**
+ * @brief Determine for every rule whether an occurrence falls in the minute of the datetime.
+ * @param rules The array of count Recurrence objects.
+ * @param datetime The DateTime object.
+ * @param matches The array of count results (output), 1 if the rule has an occurrence in the minute and 0 otherwise.
+ * @param count The number of rows.
+ * @return Returns the number of rules with an occurrence in the minute, or 0 if the datetime is invalid.
+ * @note The datetime is broken down once for all the rules, which leaves a few bit tests per rule.
+ */
+size_t recurrence_matches_many(const Recurrence *const *rules, DateTime datetime, int *matches, size_t count) {
+    RecurrenceMinute minute;
+    size_t found = 0;
+    size_t i;
+
+    return_value_if_fail(rules != NULL && matches != NULL, 0);
+    memset(matches, 0, sizeof(bool) * count);
+    return_value_if_fail(__recurrence_minute(datetime, &minute), 0);
+
+    for (i = 0; i < count; i++) {
+        matches[i] = rules[i] != NULL && __recurrence_matches(rules[i], &minute);
+        found += matches[i];
+    }
+    return found;
+}
+
+/**
+ * @brief Destroy the Recurrence object.
+ * @param rule The Recurrence object.
+ */
+void recurrence_destroy(Recurrence *rule) {
+    free(rule);
+}
+
+/**
+ * @brief Create a RecurrenceBatch object, the rules compiled into arrays of bitsets for recurrence_batch_matches().
+ * @param rules The array of count Recurrence objects, copied. NULL rows never match.
+ * @param count The number of rules.
+ * @return Returns the RecurrenceBatch object, or NULL if the allocation fails.
+ * @note The caller must destroy the returned batch with recurrence_batch_destroy().
+ */
+RecurrenceBatch *recurrence_batch_create(const Recurrence *const *rules, size_t count) {
+    RecurrenceBatch *batch = NULL;
+    const Recurrence *rule = NULL;
+    size_t i;
+
+    return_value_if_fail(rules != NULL || count == 0, NULL);
+    /* The arrays share one allocation of 24 bytes per rule, whose size must not wrap */
+    return_value_if_fail(count <= ((size_t)-1) / (sizeof(uint64_t) + sizeof(uint32_t) * 4), NULL);
+
+    batch = (RecurrenceBatch *)calloc(1, sizeof(RecurrenceBatch));
+    return_value_if_fail(batch != NULL, NULL);
+    batch->minutes = (uint64_t *)calloc(count + 1, sizeof(uint64_t) + sizeof(uint32_t) * 4);
+    batch->rules = (Recurrence *)calloc(count + 1, sizeof(Recurrence));
+    if (batch->minutes == NULL || batch->rules == NULL) {
+        recurrence_batch_destroy(batch);
+        return NULL;
+    }
+    batch->count = count;
+    batch->hours = (uint32_t *)(batch->minutes + count);
+    batch->month_days = batch->hours + count;
+    batch->last_days = batch->month_days + count;
+    batch->fields = batch->last_days + count;
+
+    for (i = 0; i < count; i++) {
+        rule = rules[i];
+        if (rule == NULL || rule->empty) {
+            continue;
+        }
+        batch->rules[i] = *rule;
+        batch->minutes[i] = rule->minutes;
+        batch->hours[i] = rule->hours;
+        batch->month_days[i] = rule->month_days;
+        batch->last_days[i] = rule->last_days;
+        batch->fields[i] = (uint32_t)rule->months << BATCH_MONTHS_SHIFT | (uint32_t)rule->weekdays << BATCH_WEEKDAYS_SHIFT |
+                           (uint32_t)(rule->day_or & 1) << BATCH_DAY_OR_BIT | (uint32_t)(rule->frequency != FREQUENCY_NONE) << BATCH_BOUNDED_BIT;
+    }
+    return batch;
+}
+
+/**
+ * @brief Destroy the RecurrenceBatch object.
+ * @param batch The RecurrenceBatch object.
+ */
+void recurrence_batch_destroy(RecurrenceBatch *batch) {
+    return_if_fail(batch != NULL);
+
+    free(batch->minutes);
+    free(batch->rules);
+    free(batch);
+}
+
+/**
+ * @brief Get the number of rules of the batch.
+ * @param batch The RecurrenceBatch object.
+ * @return Returns the number of rules.
+ */
+size_t recurrence_batch_count(const RecurrenceBatch *batch) {
+    return_value_if_fail(batch != NULL, 0);
+
+    return batch->count;
+}
+
+/**
+ * @brief Determine for every rule of the batch whether an occurrence falls in the minute of the datetime.
+ * @param batch The RecurrenceBatch object.
+ * @param datetime The DateTime object.
+ * @param mask The array of DATETIME_MASK_WORDS(count) words (output). Bit i % 64 of mask[i / 64] is set if the
+ *             rule i has an occurrence in the minute. The unused bits of the last word are cleared.
+ * @return Returns the number of rules with an occurrence in the minute, or 0 if the datetime is invalid.
+ * @note Same results as recurrence_matches_many(), from arrays of 24 bytes per rule read in order, without a
+ *       branch per rule: the bounds of a RRULE are only checked when its bitsets match.
+ */
+size_t recurrence_batch_matches(const RecurrenceBatch *batch, DateTime datetime, uint64_t *mask) {
+    RecurrenceMinute minute;
+    size_t found = 0;
+    size_t words;
+    size_t word;
+    size_t end;
+    size_t i;
+    uint64_t bits;
+    uint64_t bounded;
+    uint32_t fields;
+    uint32_t month_day;
+    uint32_t week_day;
+    uint32_t matched;
+    int minute_shift;
+    int hour_shift;
+    int day_shift;
+    int last_day_shift;
+    int month_shift;
+    int weekday_shift;
+
+    return_value_if_fail(batch != NULL && mask != NULL, 0);
+    words = DATETIME_MASK_WORDS(batch->count);
+    memset(mask, 0, sizeof(uint64_t) * words);
+    return_value_if_fail(__recurrence_minute(datetime, &minute), 0);
+
+    minute_shift = datetime.time.minute;
+    hour_shift = datetime.time.hour;
+    day_shift = datetime.date.day;
+    last_day_shift = minute.last_day;
+    month_shift = BATCH_MONTHS_SHIFT + datetime.date.month;
+    weekday_shift = BATCH_WEEKDAYS_SHIFT + minute.weekday;
+
+    for (word = 0; word < words; word++) {
+        end = word * 64 + 64 < batch->count ? word * 64 + 64 : batch->count;
+        bits = 0;
+        bounded = 0;
+        for (i = word * 64; i < end; i++) {
+            fields = batch->fields[i];
+            month_day = ((batch->month_days[i] >> day_shift) | (batch->last_days[i] >> last_day_shift)) & 1;
+            week_day = (fields >> weekday_shift) & 1;
+            matched = (uint32_t)(batch->minutes[i] >> minute_shift) & (batch->hours[i] >> hour_shift) & (fields >> month_shift) &
+                      ((month_day & week_day) | ((month_day | week_day) & (fields >> BATCH_DAY_OR_BIT))) & 1;
+            bits |= (uint64_t)matched << (i % 64);
+            bounded |= (uint64_t)((fields >> BATCH_BOUNDED_BIT) & matched) << (i % 64);
+        }
+
+        /* The matches of RRULEs out of their bounds are dropped */
+        while (bounded != 0) {
+            i = word * 64 + (size_t)__next_bit(bounded, 0);
+            if (!__recurrence_in_bounds(&batch->rules[i], &minute)) {
+                bits &= ~((uint64_t)1 << (i % 64));
+            }
+            bounded &= bounded - 1;
+        }
+        mask[word] = bits;
+        found += (size_t)__popcount64(bits);
+    }
+    return found;
+}
+
+/**
+ * @brief Parse a decimal number.
+ * @param s The cursor, moved past the number (output).
+ * @param value The number (output).
+ * @return Returns true if at least one digit was read and the number is below 1000000000, otherwise returns false.
+ */
+static bool __parse_number(const char **s, int *value) {
+    const char *p = *s;
+
+    *value = 0;
+    while (isdigit((unsigned char)*p) && p - *s < 9) {
+        *value = *value * 10 + (*p++ - '0');
+    }
+    return_value_if_fail(p > *s && !isdigit((unsigned char)*p), false);
+    *s = p;
+    return true;
+}
+
+/**
+ * @brief Determine whether the string starts with the word, ignoring case.
+ * @param s The string.
+ * @param word The upper-case word.
+ * @return Returns the length of the word if it matches, otherwise returns 0.
+ */
+static size_t __match_word(const char *s, const char *word) {
+    size_t length;
+
+    for (length = 0; word[length] != '\0'; length++) {
+        return_value_if_fail(toupper((unsigned char)s[length]) == word[length], 0);
+    }
+    return length;
+}
+
+/**
+ * @brief Parse a value of a cron field, a number or a name.
+ * @param s The cursor, moved past the value (output).
+ * @param field The field.
+ * @param value The value (output).
+ * @return Returns true if the value is valid, otherwise returns false.
+ */
+static bool __parse_cron_value(const char **s, const CronField *field, int *value) {
+    int i;
+
+    if (field->names != NULL && isalpha((unsigned char)**s)) {
+        for (i = 0; i < field->name_count; i++) {
+            if (__match_word(*s, field->names[i]) > 0 && !isalpha((unsigned char)(*s)[3])) {
+                *s += 3;
+                *value = field->min + i;
+                return true;
+            }
+        }
+        return false;
+    }
+    return __parse_number(s, value) && *value >= field->min && *value <= field->max;
+}
+
+/**
+ * @brief Parse a cron field into its bitset.
+ * @param s The field, ending at a space or the NUL terminator. The cursor is moved past it (output).
+ * @param field The range and the names of the values.
+ * @param bits The bitset (output).
+ * @return Returns true if the field is valid, otherwise returns false.
+ */
+static bool __parse_cron_field(const char **s, const CronField *field, uint64_t *bits) {
+    const char *p = *s;
+    int first;
+    int last;
+    int step;
+    bool single;
+
+    *bits = 0;
+    for (;;) {
+        single = false;
+        if (*p == '*') {
+            p++;
+            first = field->min;
+            last = field->max;
+        } else {
+            return_value_if_fail(__parse_cron_value(&p, field, &first), false);
+            last = first;
+            single = *p != '-';
+            if (!single) {
+                p++;
+                return_value_if_fail(__parse_cron_value(&p, field, &last) && first <= last, false);
+            }
+        }
+
+        /* "a/n" runs from a to the largest value. */
+        step = 1;
+        if (*p == '/') {
+            p++;
+            return_value_if_fail(__parse_number(&p, &step) && step >= 1, false);
+            last = single ? field->max : last;
+        }
+        for (; first <= last; first += step) {
+            *bits |= (uint64_t)1 << first;
+        }
+
+        if (*p != ',') {
+            break;
+        }
+        p++;
+    }
+    return_value_if_fail(*p == '\0' || isspace((unsigned char)*p), false);
+    *s = p;
+    return true;
+}
+
+/**
+ * @brief Get the expansion of a cron macro.
+ * @param expression The expression.
+ * @return Returns the 5 fields of the macro, the expression itself if it is not a macro, or NULL if the macro is unknown.
+ */
+static const char *__cron_expansion(const char *expression) {
+    static const char *const MACROS[][2] = {{"@YEARLY", "0 0 1 1 *"}, {"@ANNUALLY", "0 0 1 1 *"}, {"@MONTHLY", "0 0 1 * *"},
+                                            {"@WEEKLY", "0 0 * * 0"}, {"@DAILY", "0 0 * * *"},    {"@MIDNIGHT", "0 0 * * *"},
+                                            {"@HOURLY", "0 * * * *"}};
+    size_t length;
+    size_t i;
+
+    while (isspace((unsigned char)*expression)) {
+        expression++;
+    }
+    return_value_if_fail(*expression == '@', expression);
+
+    for (i = 0; i < sizeof(MACROS) / sizeof(MACROS[0]); i++) {
+        length = __match_word(expression, MACROS[i][0]);
+        if (length > 0 && (expression[length] == '\0' || isspace((unsigned char)expression[length]))) {
+            for (expression += length; isspace((unsigned char)*expression); expression++) {
+            }
+            return *expression == '\0' ? MACROS[i][1] : NULL;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Compile a cron expression.
+ * @param expression The 5 fields "minute hour day-of-month month day-of-week", separated by spaces.
+ *                   Every field is "*" or a comma-separated list of values and ranges "a-b", each with an
+ *                   optional step "/n". Months and weekdays can be names (JAN, MON), and 7 is also Sunday.
+ *                   The macros @yearly, @annually, @monthly, @weekly, @daily, @midnight and @hourly are accepted.
+ * @return Returns the Recurrence object, or NULL if the expression is invalid or the allocation fails.
+ * @note As in cron, when both the day of the month and the day of the week are restricted (do not start with '*'),
+ *       a day matches if either field matches. Occurrences are at second 0.
+ *       The caller must destroy the returned rule with recurrence_destroy().
+ */
+Recurrence *recurrence_compile_cron(const char *expression) {
+    static const CronField FIELDS[5] = {{0, 59, NULL, 0},
+                                        {0, 23, NULL, 0},
+                                        {1, 31, NULL, 0},
+                                        {1, 12, MONTH_ABBRS, MONTHS_PER_YEAR},
+                                        {0, 7, WEEKDAY_ABBRS, DAYS_IN_WEEK}};
+    Recurrence *rule = NULL;
+    uint64_t bits[5];
+    bool restricted[5];
+    const char *p = NULL;
+    int i;
+
+    return_value_if_fail(expression != NULL, NULL);
+    p = __cron_expansion(expression);
+    return_value_if_fail(p != NULL, NULL);
+
+    for (i = 0; i < 5; i++) {
+        while (isspace((unsigned char)*p)) {
+            p++;
+        }
+        restricted[i] = *p != '*';
+        return_value_if_fail(__parse_cron_field(&p, &FIELDS[i], &bits[i]), NULL);
+    }
+    while (isspace((unsigned char)*p)) {
+        p++;
+    }
+    return_value_if_fail(*p == '\0', NULL);
+
+    rule = (Recurrence *)calloc(1, sizeof(Recurrence));
+    return_value_if_fail(rule != NULL, NULL);
+    rule->minutes = bits[0];
+    rule->hours = (uint32_t)bits[1];
+    rule->month_days = (uint32_t)bits[2];
+    rule->months = (uint16_t)bits[3];
+    rule->weekdays = (unsigned char)((bits[4] | bits[4] >> 7) & ALL_WEEKDAYS); /* 7 is Sunday */
+    rule->day_or = (unsigned char)(restricted[2] && restricted[4]);
+    rule->frequency = FREQUENCY_NONE;
+    rule->interval = 1;
+    return rule;
+}
+
+/**
+ * @brief Parse a comma-separated list of numbers of a RRULE part.
+ * @param s The cursor, moved past the list (output).
+ * @param min The smallest value.
+ * @param max The largest value.
+ * @param allow_negative Whether -max ~ -1 are accepted too.
+ * @param values The values (output), at most MAX_RULE_VALUES.
+ * @param count The number of values (output).
+ * @return Returns true if the list is valid, otherwise returns false.
+ */
+static bool __parse_rule_numbers(const char **s, int min, int max, bool allow_negative, int *values, int *count) {
+    const char *p = *s;
+    bool negative;
+
+    *count = 0;
+    for (;;) {
+        negative = allow_negative && *p == '-';
+        p += negative || *p == '+';
+        return_value_if_fail(*count < MAX_RULE_VALUES && __parse_number(&p, &values[*count]), false);
+        return_value_if_fail(values[*count] >= (negative ? 1 : min) && values[*count] <= max, false);
+        values[(*count)++] *= negative ? -1 : 1;
+        if (*p != ',') {
+            break;
+        }
+        p++;
+    }
+    *s = p;
+    return true;
+}
+
+/**
+ * @brief Get the bitset of the values.
+ * @param values The values (0 ~ 63).
+ * @param count The number of values.
+ * @return Returns the bitset.
+ */
+static uint64_t __bitset(const int *values, int count) {
+    uint64_t bits = 0;
+    int i;
+
+    for (i = 0; i < count; i++) {
+        bits |= (uint64_t)1 << values[i];
+    }
+    return bits;
+}
+
+/**
+ * @brief Parse the UNTIL part of a RRULE, yyyymmdd or yyyymmddThhmmss with an optional 'Z'.
+ * @param s The cursor, moved past the value (output).
+ * @param until The last datetime an occurrence can have (output). A date means the end of the day.
+ * @return Returns true if the value is valid, otherwise returns false.
+ */
+static bool __parse_rule_until(const char **s, DateTime *until) {
+    const char *p = *s;
+    int fields[6] = {0, 0, 0, 23, 59, 59};
+    int widths[6] = {4, 2, 2, 2, 2, 2};
+    int count = 3;
+    int i;
+    int j;
+
+    if (strlen(p) >= 15 && p[8] == 'T') {
+        count = 6;
+    }
+    for (i = 0; i < count; i++) {
+        p += i == 3; /* 'T' */
+        fields[i] = 0;
+        for (j = 0; j < widths[i]; j++, p++) {
+            return_value_if_fail(isdigit((unsigned char)*p), false);
+            fields[i] = fields[i] * 10 + (*p - '0');
+        }
+    }
+    p += count == 6 && *p == 'Z';
+    return_value_if_fail(datetime_create_checked(fields[0], fields[1], fields[2], fields[3], fields[4], fields[5],
+                                                 count == 6 ? 0 : MILLISECONDS_PER_SECOND - 1, until) == DATETIME_OK,
+                         false);
+    *s = p;
+    return true;
+}
+
+/**
+ * @brief Parse the BYDAY part of a RRULE, without ordinals.
+ * @param s The cursor, moved past the list (output).
+ * @param weekdays The bitset of the weekdays (output).
+ * @return Returns true if the list is valid, otherwise returns false.
+ */
+static bool __parse_rule_weekdays(const char **s, unsigned char *weekdays) {
+    const char *p = *s;
+    int i;
+
+    *weekdays = 0;
+    for (;;) {
+        for (i = 0; i < DAYS_IN_WEEK && __match_word(p, WEEKDAY_CODES[i]) == 0; i++) {
+        }
+        return_value_if_fail(i < DAYS_IN_WEEK, false);
+        *weekdays |= (unsigned char)(1 << i);
+        p += 2;
+        if (*p != ',') {
+            break;
+        }
+        p++;
+    }
+    *s = p;
+    return true;
+}
+
+/**
+ * @brief Compile an iCalendar (RFC 5545) recurrence rule.
+ * @param rule The rule, with or without the "RRULE:" prefix. The parts are FREQ (MINUTELY, HOURLY, DAILY, WEEKLY,
+ *             MONTHLY or YEARLY), INTERVAL, COUNT (at most RECURRENCE_MAX_COUNT) or UNTIL (yyyymmdd or
+ *             yyyymmddThhmmss with an optional 'Z'), BYMONTH, BYMONTHDAY (negative values count from the end of the
+ *             month), BYDAY (without ordinals), BYHOUR, BYMINUTE and WKST=MO.
+ * @param start The first occurrence candidate (DTSTART). The fields not given by the rule default to its fields,
+ *              and every occurrence has its second and millisecond.
+ * @return Returns the Recurrence object, or NULL if the rule is invalid or unsupported, or the allocation fails.
+ * @note O(COUNT) with COUNT, as the COUNT-th occurrence is found when the rule is compiled.
+ *       The caller must destroy the returned rule with recurrence_destroy().
+ */
+Recurrence *recurrence_compile_rrule(const char *rule, DateTime start) {
+    static const char *const FREQUENCIES[] = {"", "MINUTELY", "HOURLY", "DAILY", "WEEKLY", "MONTHLY", "YEARLY"};
+    Recurrence compiled;
+    Recurrence *result = NULL;
+    DateTime occurrence;
+    const char *p = rule;
+    int values[MAX_RULE_VALUES];
+    int count = 0;
+    int occurrences = 0;
+    int value_count;
+    int day_number;
+    int minute;
+    int i;
+    size_t length;
+    bool has[5] = {false, false, false, false, false}; /* BYMINUTE, BYHOUR, BYMONTHDAY, BYMONTH, BYDAY */
+    bool default_day;
+
+    return_value_if_fail(rule != NULL, NULL);
+    return_value_if_fail(datetime_to_ordinal_checked(start, &day_number) == DATETIME_OK, NULL);
+
+    memset(&compiled, 0, sizeof(compiled));
+    compiled.interval = 1;
+    p += __match_word(p, "RRULE:");
+
+    while (*p != '\0') {
+        if ((length = __match_word(p, "FREQ=")) > 0) {
+            p += length;
+            for (i = FREQUENCY_MINUTELY; i <= FREQUENCY_YEARLY && (length = __match_word(p, FREQUENCIES[i])) == 0; i++) {
+            }
+            return_value_if_fail(i <= FREQUENCY_YEARLY, NULL);
+            compiled.frequency = (unsigned char)i;
+            p += length;
+        } else if ((length = __match_word(p, "INTERVAL=")) > 0) {
+            p += length;
+            return_value_if_fail(__parse_number(&p, &compiled.interval) && compiled.interval >= 1, NULL);
+        } else if ((length = __match_word(p, "COUNT=")) > 0) {
+            p += length;
+            return_value_if_fail(__parse_number(&p, &count) && count >= 1 && count <= RECURRENCE_MAX_COUNT, NULL);
+        } else if ((length = __match_word(p, "UNTIL=")) > 0) {
+            p += length;
+            return_value_if_fail(__parse_rule_until(&p, &compiled.until), NULL);
+            compiled.has_until = true;
+        } else if ((length = __match_word(p, "BYMINUTE=")) > 0) {
+            p += length;
+            return_value_if_fail(__parse_rule_numbers(&p, 0, 59, false, values, &value_count), NULL);
+            compiled.minutes = __bitset(values, value_count);
+            has[0] = true;
+        } else if ((length = __match_word(p, "BYHOUR=")) > 0) {
+            p += length;
+            return_value_if_fail(__parse_rule_numbers(&p, 0, 23, false, values, &value_count), NULL);
+            compiled.hours = (uint32_t)__bitset(values, value_count);
+            has[1] = true;
+        } else if ((length = __match_word(p, "BYMONTHDAY=")) > 0) {
+            p += length;
+            return_value_if_fail(__parse_rule_numbers(&p, 1, 31, true, values, &value_count), NULL);
+            for (i = 0; i < value_count; i++) {
+                if (values[i] > 0) {
+                    compiled.month_days |= (uint32_t)1 << values[i];
+                } else {
+                    compiled.last_days |= (uint32_t)1 << -values[i];
+                }
+            }
+            has[2] = true;
+        } else if ((length = __match_word(p, "BYMONTH=")) > 0) {
+            p += length;
+            return_value_if_fail(__parse_rule_numbers(&p, 1, 12, false, values, &value_count), NULL);
+            compiled.months = (uint16_t)__bitset(values, value_count);
+            has[3] = true;
+        } else if ((length = __match_word(p, "BYDAY=")) > 0) {
+            p += length;
+            return_value_if_fail(__parse_rule_weekdays(&p, &compiled.weekdays), NULL);
+            has[4] = true;
+        } else if ((length = __match_word(p, "WKST=MO")) > 0) {
+            p += length;
+        } else {
+            return NULL;
+        }
+
+        return_value_if_fail(*p == '\0' || (*p == ';' && p[1] != '\0'), NULL);
+        p += *p == ';';
+    }
+    return_value_if_fail(compiled.frequency != FREQUENCY_NONE && !(count > 0 && compiled.has_until), NULL);
+
+    /* The fields below the frequency that the rule leaves out are the fields of start. */
+    default_day = !has[2] && !has[4] && (compiled.frequency == FREQUENCY_MONTHLY || compiled.frequency == FREQUENCY_YEARLY);
+    if (!has[0]) {
+        compiled.minutes = compiled.frequency > FREQUENCY_MINUTELY ? (uint64_t)1 << start.time.minute : ALL_MINUTES;
+    }
+    if (!has[1]) {
+        compiled.hours = compiled.frequency > FREQUENCY_HOURLY ? (uint32_t)1 << start.time.hour : ALL_HOURS;
+    }
+    if (!has[2]) {
+        compiled.month_days = default_day ? (uint32_t)1 << start.date.day : ALL_MONTH_DAYS;
+    }
+    if (!has[3]) {
+        compiled.months = compiled.frequency == FREQUENCY_YEARLY && default_day ? (uint16_t)(1 << start.date.month) : (uint16_t)ALL_MONTHS;
+    }
+    if (!has[4]) {
+        compiled.weekdays = compiled.frequency == FREQUENCY_WEEKLY ? (unsigned char)(1 << weekday_from_ordinal_unchecked(day_number)) : (unsigned char)ALL_WEEKDAYS;
+    }
+
+    compiled.start = start;
+    compiled.start_period = __period(compiled.frequency, start.date.year, start.date.month, day_number, start.time.hour,
+                                     start.time.minute);
+    compiled.second = start.time.second;
+    compiled.millisecond = start.time.millisecond;
+
+    /* COUNT is the UNTIL of the COUNT-th occurrence. */
+    if (count > 0) {
+        occurrence = start;
+        minute = start.time.minute;
+        while (occurrences < count && __next_occurrence(&compiled, occurrence.date.year, occurrence.date.month,
+                                                        occurrence.date.day, occurrence.time.hour, minute, &occurrence)) {
+            occurrences++;
+            minute = occurrence.time.minute + 1;
+        }
+        compiled.empty = (unsigned char)(occurrences == 0);
+        compiled.has_until = true;
+        compiled.until = occurrence;
+    }
+
+    result = (Recurrence *)malloc(sizeof(Recurrence));
+    return_value_if_fail(result != NULL, NULL);
+    *result = compiled;
+    return result;
+}
@@ -0,0 +1,140 @@
+#ifndef _DATETIME_RECURRENCE_H_
+#define _DATETIME_RECURRENCE_H_
+
+#include "datetime.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * A recurrence rule compiled into one bitset per field (minutes, hours, days of the month, months, weekdays),
+ * so the next occurrence is found by jumping to the next set bit of each field instead of stepping through time.
+ * Occurrences have a minute resolution. Queries never write to the rule and are safe to run from any number of
+ * threads at once.
+ */
+typedef struct Recurrence Recurrence;
+
+/*
+ * Rules compiled together into one array per bitset, struct-of-arrays, to match all of them on every tick of a
+ * scheduler with recurrence_batch_matches(). Read-only once created, like the rules.
+ */
+typedef struct RecurrenceBatch RecurrenceBatch;
+
+/* The largest COUNT of a recurrence rule: COUNT is resolved when the rule is compiled, one occurrence at a time. */
+#define RECURRENCE_MAX_COUNT 100000
+
+/**
+ * @brief Compile a cron expression.
+ * @param expression The 5 fields "minute hour day-of-month month day-of-week", separated by spaces.
+ *                   Every field is "*" or a comma-separated list of values and ranges "a-b", each with an
+ *                   optional step "/n". Months and weekdays can be names (JAN, MON), and 7 is also Sunday.
+ *                   The macros @yearly, @annually, @monthly, @weekly, @daily, @midnight and @hourly are accepted.
+ * @return Returns the Recurrence object, or NULL if the expression is invalid or the allocation fails.
+ * @note As in cron, when both the day of the month and the day of the week are restricted (do not start with '*'),
+ *       a day matches if either field matches. Occurrences are at second 0.
+ *       The caller must destroy the returned rule with recurrence_destroy().
+ */
+Recurrence *recurrence_compile_cron(const char *expression);
+
+/**
+ * @brief Compile an iCalendar (RFC 5545) recurrence rule.
+ * @param rule The rule, with or without the "RRULE:" prefix. The parts are FREQ (MINUTELY, HOURLY, DAILY, WEEKLY,
+ *             MONTHLY or YEARLY), INTERVAL, COUNT (at most RECURRENCE_MAX_COUNT) or UNTIL (yyyymmdd or
+ *             yyyymmddThhmmss with an optional 'Z'), BYMONTH, BYMONTHDAY (negative values count from the end of the
+ *             month), BYDAY (without ordinals), BYHOUR, BYMINUTE and WKST=MO.
+ * @param start The first occurrence candidate (DTSTART). The fields not given by the rule default to its fields,
+ *              and every occurrence has its second and millisecond.
+ * @return Returns the Recurrence object, or NULL if the rule is invalid or unsupported, or the allocation fails.
+ * @note O(COUNT) with COUNT, as the COUNT-th occurrence is found when the rule is compiled.
+ *       The caller must destroy the returned rule with recurrence_destroy().
+ */
+Recurrence *recurrence_compile_rrule(const char *rule, DateTime start);
+
+/**
+ * @brief Destroy the Recurrence object.
+ * @param rule The Recurrence object.
+ */
+void recurrence_destroy(Recurrence *rule);
+
+/**
+ * @brief Find the first occurrence after the datetime.
+ * @param rule The Recurrence object.
+ * @param after The DateTime object.
+ * @param out The first occurrence strictly after the datetime (output). Unchanged on error.
+ * @return Returns true on success, or false if the datetime is invalid or no occurrence follows it until 9999-12-31.
+ * @note Each step jumps to the next set bit of a field, so the cost depends on the number of fields that roll over,
+ *       not on the distance to the occurrence.
+ */
+bool recurrence_next_occurrence(const Recurrence *rule, DateTime after, DateTime *out);
+
+/**
+ * @brief Find the first occurrence of every rule after the datetime.
+ * @param rules The array of count Recurrence objects.
+ * @param after The DateTime object.
+ * @param results The array of count occurrences (output). Rows without an occurrence are left unchanged.
+ * @param valid The array of count results (output), 1 for a row with an occurrence and 0 otherwise, can be NULL.
+ * @param count The number of rows.
+ * @return Returns the number of rows with an occurrence.
+ */
+size_t recurrence_next_occurrence_many(const Recurrence *const *rules, DateTime after, DateTime *results, int *valid, size_t count);
+
+/**
+ * @brief Determine whether an occurrence falls in the minute of the datetime.
+ * @param rule The Recurrence object.
+ * @param datetime The DateTime object.
+ * @return Returns true if the rule has an occurrence in the minute, otherwise returns false.
+ * @note O(1): a few bit tests. To evaluate many rules on every tick, use recurrence_batch_matches().
+ */
+bool recurrence_matches(const Recurrence *rule, DateTime datetime);
+
+/**
+ * @brief Determine for every rule whether an occurrence falls in the minute of the datetime.
+ * @param rules The array of count Recurrence objects.
+ * @param datetime The DateTime object.
+ * @param matches The array of count results (output), 1 if the rule has an occurrence in the minute and 0 otherwise.
+ * @param count The number of rows.
+ * @return Returns the number of rules with an occurrence in the minute, or 0 if the datetime is invalid.
+ * @note The datetime is broken down once for all the rules, which leaves a few bit tests per rule.
+ */
+size_t recurrence_matches_many(const Recurrence *const *rules, DateTime datetime, int *matches, size_t count);
+
+/**
+ * @brief Create a RecurrenceBatch object, the rules compiled into arrays of bitsets for recurrence_batch_matches().
+ * @param rules The array of count Recurrence objects, copied. NULL rows never match.
+ * @param count The number of rules.
+ * @return Returns the RecurrenceBatch object, or NULL if the allocation fails.
+ * @note The caller must destroy the returned batch with recurrence_batch_destroy().
+ */
+RecurrenceBatch *recurrence_batch_create(const Recurrence *const *rules, size_t count);
+
+/**
+ * @brief Destroy the RecurrenceBatch object.
+ * @param batch The RecurrenceBatch object.
+ */
+void recurrence_batch_destroy(RecurrenceBatch *batch);
+
+/**
+ * @brief Get the number of rules of the batch.
+ * @param batch The RecurrenceBatch object.
+ * @return Returns the number of rules.
+ */
+size_t recurrence_batch_count(const RecurrenceBatch *batch);
+
+/**
+ * @brief Determine for every rule of the batch whether an occurrence falls in the minute of the datetime.
+ * @param batch The RecurrenceBatch object.
+ * @param datetime The DateTime object.
+ * @param mask The array of DATETIME_MASK_WORDS(count) words (output). Bit i % 64 of mask[i / 64] is set if the
+ *             rule i has an occurrence in the minute. The unused bits of the last word are cleared.
+ * @return Returns the number of rules with an occurrence in the minute, or 0 if the datetime is invalid.
+ * @note Same results as recurrence_matches_many(), from arrays of 24 bytes per rule read in order, without a
+ *       branch per rule: the bounds of a RRULE are only checked when its bitsets match.
+ */
+size_t recurrence_batch_matches(const RecurrenceBatch *batch, DateTime datetime, uint64_t *mask);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
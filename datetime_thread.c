@@ -0,0 +1,449 @@
+#define _POSIX_C_SOURCE 200112L
+
+#include "datetime_thread.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define return_if_fail(expr) \
+    if (!(expr)) {           \
+        return;              \
+    }
+
+#define return_value_if_fail(expr, ret) \
+    if (!(expr)) {                      \
+        return (ret);                   \
+    }
+
+/* The chunks not yet taken by a thread, stolen from the back by the other threads. */
+typedef struct ChunkQueue {
+    pthread_mutex_t mutex;
+    size_t next;
+    size_t end;
+} ChunkQueue;
+
+struct DateTimeThreadPool {
+    int size;
+    pthread_t *threads;
+    ChunkQueue *queues;
+
+    pthread_mutex_t run_mutex;
+    pthread_mutex_t mutex;
+    pthread_cond_t start;
+    pthread_cond_t done;
+    unsigned long generation;
+    int running;
+    bool stopping;
+
+    DateTimeRangeTask task;
+    void *context;
+    size_t count;
+    size_t chunk_rows;
+};
+
+typedef struct WorkerArgs {
+    DateTimeThreadPool *pool;
+    int id;
+} WorkerArgs;
+
+static DateTimeThreadPool *shared_pool = NULL;
+static pthread_once_t shared_pool_once = PTHREAD_ONCE_INIT;
+
+/**
+ * @brief Take the next chunk from the front of the queue.
+ * @param queue The ChunkQueue object.
+ * @param chunk The chunk (output).
+ * @return Returns true if a chunk is taken, otherwise returns false.
+ */
+static bool __queue_pop(ChunkQueue *queue, size_t *chunk) {
+    bool taken = false;
+
+    pthread_mutex_lock(&queue->mutex);
+    if (queue->next < queue->end) {
+        *chunk = queue->next++;
+        taken = true;
+    }
+    pthread_mutex_unlock(&queue->mutex);
+    return taken;
+}
+
+/**
+ * @brief Move half of the remaining chunks of another thread to the queue of the thread.
+ * @param pool The DateTimeThreadPool object.
+ * @param id The thread id.
+ * @return Returns true if chunks are stolen, otherwise returns false.
+ */
+static bool __queue_steal(DateTimeThreadPool *pool, int id) {
+    ChunkQueue *victim;
+    size_t stolen;
+    size_t end;
+    int i;
+
+    for (i = 1; i < pool->size; i++) {
+        victim = &pool->queues[(id + i) % pool->size];
+
+        pthread_mutex_lock(&victim->mutex);
+        stolen = (victim->end - victim->next + 1) / 2;
+        end = victim->end;
+        victim->end -= stolen;
+        pthread_mutex_unlock(&victim->mutex);
+
+        if (stolen > 0) {
+            pthread_mutex_lock(&pool->queues[id].mutex);
+            pool->queues[id].next = end - stolen;
+            pool->queues[id].end = end;
+            pthread_mutex_unlock(&pool->queues[id].mutex);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Run the chunks of the current job until no thread has any left.
+ * @param pool The DateTimeThreadPool object.
+ * @param id The thread id.
+ */
+static void __run_chunks(DateTimeThreadPool *pool, int id) {
+    size_t chunk;
+    size_t begin;
+    size_t end;
+
+    do {
+        while (__queue_pop(&pool->queues[id], &chunk)) {
+            begin = chunk * pool->chunk_rows;
+            end = begin + pool->chunk_rows < pool->count ? begin + pool->chunk_rows : pool->count;
+            pool->task(pool->context, begin, end);
+        }
+    } while (__queue_steal(pool, id));
+}
+
+/**
+ * @brief The loop of the background threads.
+ * @param arg The WorkerArgs object, freed by the thread.
+ */
+static void *__worker_main(void *arg) {
+    DateTimeThreadPool *pool = ((WorkerArgs *)arg)->pool;
+    int id = ((WorkerArgs *)arg)->id;
+    unsigned long generation = 0;
+
+    free(arg);
+
+    for (;;) {
+        pthread_mutex_lock(&pool->mutex);
+        while (!pool->stopping && pool->generation == generation) {
+            pthread_cond_wait(&pool->start, &pool->mutex);
+        }
+        if (pool->stopping) {
+            pthread_mutex_unlock(&pool->mutex);
+            return NULL;
+        }
+        generation = pool->generation;
+        pthread_mutex_unlock(&pool->mutex);
+
+        __run_chunks(pool, id);
+
+        pthread_mutex_lock(&pool->mutex);
+        if (--pool->running == 0) {
+            pthread_cond_signal(&pool->done);
+        }
+        pthread_mutex_unlock(&pool->mutex);
+    }
+}
+
+/**
+ * @brief Get the number of online CPUs.
+ * @return Returns the number of online CPUs, at least 1.
+ */
+static int __online_cpus(void) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return cpus > 0 ? (int)cpus : 1;
+}
+
+/**
+ * @brief Stop and join the started threads, then destroy the locks and free the DateTimeThreadPool object.
+ * @param pool The DateTimeThreadPool object, with the locks of all pool->size queues initialized.
+ * @param started The number of threads started, including thread 0: threads 1 ~ started - 1 are joined.
+ */
+static void __pool_teardown(DateTimeThreadPool *pool, int started) {
+    int i;
+
+    pthread_mutex_lock(&pool->mutex);
+    pool->stopping = true;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->mutex);
+
+    for (i = 1; i < started; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+    for (i = 0; i < pool->size; i++) {
+        pthread_mutex_destroy(&pool->queues[i].mutex);
+    }
+    pthread_mutex_destroy(&pool->run_mutex);
+    pthread_mutex_destroy(&pool->mutex);
+    pthread_cond_destroy(&pool->start);
+    pthread_cond_destroy(&pool->done);
+
+    free(pool->threads);
+    free(pool->queues);
+    free(pool);
+}
+
+/**
+ * @brief Create a DateTimeThreadPool object.
+ * @param threads The number of threads, including the thread calling datetime_thread_pool_run().
+ *                If threads <= 0, the number of online CPUs is used.
+ * @return Returns the DateTimeThreadPool object, or NULL if it cannot be created.
+ * @note The caller must destroy the returned pool with datetime_thread_pool_destroy().
+ */
+DateTimeThreadPool *datetime_thread_pool_create(int threads) {
+    DateTimeThreadPool *pool = NULL;
+    WorkerArgs *args = NULL;
+    int i;
+
+    pool = (DateTimeThreadPool *)calloc(1, sizeof(DateTimeThreadPool));
+    return_value_if_fail(pool != NULL, NULL);
+
+    pool->size = threads > 0 ? threads : __online_cpus();
+    pool->threads = (pthread_t *)calloc(pool->size, sizeof(pthread_t));
+    pool->queues = (ChunkQueue *)calloc(pool->size, sizeof(ChunkQueue));
+    if (pool->threads == NULL || pool->queues == NULL) {
+        free(pool->threads);
+        free(pool->queues);
+        free(pool);
+        return NULL;
+    }
+
+    for (i = 0; i < pool->size; i++) {
+        pthread_mutex_init(&pool->queues[i].mutex, NULL);
+    }
+    pthread_mutex_init(&pool->run_mutex, NULL);
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    /* Thread 0 is the caller of datetime_thread_pool_run(). */
+    for (i = 1; i < pool->size; i++) {
+        args = (WorkerArgs *)malloc(sizeof(WorkerArgs));
+        if (args != NULL) {
+            args->pool = pool;
+            args->id = i;
+        }
+        if (args == NULL || pthread_create(&pool->threads[i], NULL, __worker_main, args) != 0) {
+            free(args);
+            __pool_teardown(pool, i);
+            return NULL;
+        }
+    }
+
+    return pool;
+}
+
+/**
+ * @brief Destroy the DateTimeThreadPool object.
+ * @param pool The DateTimeThreadPool object.
+ */
+void datetime_thread_pool_destroy(DateTimeThreadPool *pool) {
+    return_if_fail(pool != NULL);
+    __pool_teardown(pool, pool->size);
+}
+
+/**
+ * @brief Create the shared pool with one thread per online CPU.
+ */
+static void __create_shared_pool(void) {
+    shared_pool = datetime_thread_pool_create(0);
+}
+
+/**
+ * @brief Get the pool to use.
+ * @param pool The DateTimeThreadPool object, or NULL for the shared pool.
+ * @return Returns the pool, or NULL if the shared pool cannot be created.
+ */
+static DateTimeThreadPool *__resolve_pool(DateTimeThreadPool *pool) {
+    if (pool == NULL) {
+        pthread_once(&shared_pool_once, __create_shared_pool);
+        pool = shared_pool;
+    }
+    return pool;
+}
+
+/**
+ * @brief Get the number of threads of the DateTimeThreadPool object.
+ * @param pool The DateTimeThreadPool object, or NULL for the shared pool.
+ * @return Returns the number of threads.
+ */
+int datetime_thread_pool_size(DateTimeThreadPool *pool) {
+    pool = __resolve_pool(pool);
+    return pool != NULL ? pool->size : 1;
+}
+
+/**
+ * @brief Run the task over the rows 0 ~ count - 1 on every thread of the pool and wait for it to finish.
+ * @param pool The DateTimeThreadPool object, or NULL for the shared pool.
+ * @param count The number of rows.
+ * @param chunk_rows The number of rows per chunk, or 0 for DATETIME_CHUNK_ROWS.
+ * @param task The task. It is called once per chunk and must not call datetime_thread_pool_run().
+ * @param context The context passed to the task.
+ * @return Returns true if the task has run over every row, otherwise returns false.
+ */
+bool datetime_thread_pool_run(DateTimeThreadPool *pool, size_t count, size_t chunk_rows, DateTimeRangeTask task, void *context) {
+    size_t chunks;
+    int i;
+
+    return_value_if_fail(task != NULL, false);
+    return_value_if_fail(count > 0, true);
+
+    chunk_rows = chunk_rows > 0 ? chunk_rows : DATETIME_CHUNK_ROWS;
+    pool = __resolve_pool(pool);
+    if (pool == NULL || pool->size == 1 || count <= chunk_rows) {
+        task(context, 0, count);
+        return true;
+    }
+
+    pthread_mutex_lock(&pool->run_mutex);
+
+    chunks = (count + chunk_rows - 1) / chunk_rows;
+    for (i = 0; i < pool->size; i++) {
+        pool->queues[i].next = chunks * i / pool->size;
+        pool->queues[i].end = chunks * (i + 1) / pool->size;
+    }
+    pool->task = task;
+    pool->context = context;
+    pool->count = count;
+    pool->chunk_rows = chunk_rows;
+
+    pthread_mutex_lock(&pool->mutex);
+    pool->running = pool->size - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->mutex);
+
+    __run_chunks(pool, 0);
+
+    pthread_mutex_lock(&pool->mutex);
+    while (pool->running > 0) {
+        pthread_cond_wait(&pool->done, &pool->mutex);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+
+    pthread_mutex_unlock(&pool->run_mutex);
+    return true;
+}
+
+/* The arguments and the merged result of one parallel batch call. */
+typedef struct BatchContext {
+    const void *input;
+    void *output;
+    int *valid;
+    size_t stride;
+    pthread_mutex_t mutex;
+    size_t total;
+    bool all_valid;
+} BatchContext;
+
+/**
+ * @brief Initialize the BatchContext object.
+ */
+static void __batch_init(BatchContext *batch, const void *input, void *output, int *valid, size_t stride) {
+    batch->input = input;
+    batch->output = output;
+    batch->valid = valid;
+    batch->stride = stride;
+    batch->total = 0;
+    batch->all_valid = true;
+    pthread_mutex_init(&batch->mutex, NULL);
+}
+
+static void __from_timestamp_task(void *context, size_t begin, size_t end) {
+    BatchContext *batch = (BatchContext *)context;
+    bool all_valid = datetime_array_from_timestamp((const time_t *)batch->input + begin, (DateTime *)batch->output + begin, end - begin);
+
+    if (!all_valid) {
+        pthread_mutex_lock(&batch->mutex);
+        batch->all_valid = false;
+        pthread_mutex_unlock(&batch->mutex);
+    }
+}
+
+static void __to_timestamp_task(void *context, size_t begin, size_t end) {
+    BatchContext *batch = (BatchContext *)context;
+    datetime_array_to_timestamp((const DateTime *)batch->input + begin, (time_t *)batch->output + begin, end - begin);
+}
+
+static void __to_string_task(void *context, size_t begin, size_t end) {
+    BatchContext *batch = (BatchContext *)context;
+    datetime_array_to_string((const DateTime *)batch->input + begin, (char *)batch->output + begin * batch->stride, batch->stride, end - begin);
+}
+
+static void __parse_task(void *context, size_t begin, size_t end) {
+    BatchContext *batch = (BatchContext *)context;
+    size_t parsed = datetime_array_parse((const char *)batch->input + begin * batch->stride, batch->stride, (DateTime *)batch->output + begin,
+                                         batch->valid != NULL ? batch->valid + begin : NULL, end - begin);
+
+    pthread_mutex_lock(&batch->mutex);
+    batch->total += parsed;
+    pthread_mutex_unlock(&batch->mutex);
+}
+
+/**
+ * @brief Create DateTime objects from the Unix timestamps on every thread of the pool.
+ * @param pool The DateTimeThreadPool object, or NULL for the shared pool.
+ * @see datetime_array_from_timestamp()
+ */
+bool datetime_parallel_from_timestamp(DateTimeThreadPool *pool, const time_t *timestamps, DateTime *datetimes, size_t count) {
+    BatchContext batch;
+
+    return_value_if_fail(timestamps != NULL && datetimes != NULL, false);
+
+    __batch_init(&batch, timestamps, datetimes, NULL, 0);
+    datetime_thread_pool_run(pool, count, 0, __from_timestamp_task, &batch);
+    pthread_mutex_destroy(&batch.mutex);
+    return batch.all_valid;
+}
+
+/**
+ * @brief Convert the DateTime objects to the Unix timestamps on every thread of the pool.
+ * @param pool The DateTimeThreadPool object, or NULL for the shared pool.
+ * @see datetime_array_to_timestamp()
+ */
+void datetime_parallel_to_timestamp(DateTimeThreadPool *pool, const DateTime *datetimes, time_t *timestamps, size_t count) {
+    BatchContext batch;
+
+    return_if_fail(datetimes != NULL && timestamps != NULL);
+
+    __batch_init(&batch, datetimes, timestamps, NULL, 0);
+    datetime_thread_pool_run(pool, count, 0, __to_timestamp_task, &batch);
+    pthread_mutex_destroy(&batch.mutex);
+}
+
+/**
+ * @brief Write the string representations (yyyy-mm-dd hh:mm:ss.fff) of the DateTime objects on every thread of the pool.
+ * @param pool The DateTimeThreadPool object, or NULL for the shared pool.
+ * @see datetime_array_to_string()
+ */
+void datetime_parallel_to_string(DateTimeThreadPool *pool, const DateTime *datetimes, char *buffer, size_t stride, size_t count) {
+    BatchContext batch;
+
+    return_if_fail(datetimes != NULL && buffer != NULL && stride > DATETIME_STRING_LENGTH);
+
+    __batch_init(&batch, datetimes, buffer, NULL, stride);
+    datetime_thread_pool_run(pool, count, 0, __to_string_task, &batch);
+    pthread_mutex_destroy(&batch.mutex);
+}
+
+/**
+ * @brief Parse the string representations (yyyy-mm-dd hh:mm:ss.fff) into DateTime objects on every thread of the pool.
+ * @param pool The DateTimeThreadPool object, or NULL for the shared pool.
+ * @see datetime_array_parse()
+ */
+size_t datetime_parallel_parse(DateTimeThreadPool *pool, const char *buffer, size_t stride, DateTime *datetimes, int *valid, size_t count) {
+    BatchContext batch;
+
+    return_value_if_fail(buffer != NULL && datetimes != NULL && stride >= DATETIME_STRING_LENGTH, 0);
+
+    __batch_init(&batch, buffer, datetimes, valid, stride);
+    datetime_thread_pool_run(pool, count, 0, __parse_task, &batch);
+    pthread_mutex_destroy(&batch.mutex);
+    return batch.total;
+}
@@ -0,0 +1,89 @@
+#ifndef _DATETIME_THREAD_H_
+#define _DATETIME_THREAD_H_
+
+#include "datetime.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DATETIME_CHUNK_ROWS 2048 /* about 64 KiB of DateTime objects, so a chunk stays in L2 cache */
+
+typedef struct DateTimeThreadPool DateTimeThreadPool;
+
+/**
+ * @brief The task run by the thread pool for the rows begin ~ end - 1.
+ * @param context The context passed to datetime_thread_pool_run().
+ * @param begin The first row.
+ * @param end The row after the last row.
+ */
+typedef void (*DateTimeRangeTask)(void *context, size_t begin, size_t end);
+
+/**
+ * @brief Create a DateTimeThreadPool object.
+ * @param threads The number of threads, including the thread calling datetime_thread_pool_run().
+ *                If threads <= 0, the number of online CPUs is used.
+ * @return Returns the DateTimeThreadPool object, or NULL if it cannot be created.
+ * @note The caller must destroy the returned pool with datetime_thread_pool_destroy().
+ */
+DateTimeThreadPool *datetime_thread_pool_create(int threads);
+
+/**
+ * @brief Destroy the DateTimeThreadPool object.
+ * @param pool The DateTimeThreadPool object.
+ */
+void datetime_thread_pool_destroy(DateTimeThreadPool *pool);
+
+/**
+ * @brief Get the number of threads of the DateTimeThreadPool object.
+ * @param pool The DateTimeThreadPool object, or NULL for the shared pool.
+ * @return Returns the number of threads.
+ */
+int datetime_thread_pool_size(DateTimeThreadPool *pool);
+
+/**
+ * @brief Run the task over the rows 0 ~ count - 1 on every thread of the pool and wait for it to finish.
+ * @param pool The DateTimeThreadPool object, or NULL for the shared pool.
+ * @param count The number of rows.
+ * @param chunk_rows The number of rows per chunk, or 0 for DATETIME_CHUNK_ROWS.
+ * @param task The task. It is called once per chunk and must not call datetime_thread_pool_run().
+ * @param context The context passed to the task.
+ * @return Returns true if the task has run over every row, otherwise returns false.
+ * @note Every thread starts with an equal share of the chunks and steals half of the remaining chunks
+ *       of another thread when its own share runs out.
+ */
+bool datetime_thread_pool_run(DateTimeThreadPool *pool, size_t count, size_t chunk_rows, DateTimeRangeTask task, void *context);
+
+/**
+ * @brief Create DateTime objects from the Unix timestamps on every thread of the pool.
+ * @param pool The DateTimeThreadPool object, or NULL for the shared pool.
+ * @see datetime_array_from_timestamp()
+ */
+bool datetime_parallel_from_timestamp(DateTimeThreadPool *pool, const time_t *timestamps, DateTime *datetimes, size_t count);
+
+/**
+ * @brief Convert the DateTime objects to the Unix timestamps on every thread of the pool.
+ * @param pool The DateTimeThreadPool object, or NULL for the shared pool.
+ * @see datetime_array_to_timestamp()
+ */
+void datetime_parallel_to_timestamp(DateTimeThreadPool *pool, const DateTime *datetimes, time_t *timestamps, size_t count);
+
+/**
+ * @brief Write the string representations (yyyy-mm-dd hh:mm:ss.fff) of the DateTime objects on every thread of the pool.
+ * @param pool The DateTimeThreadPool object, or NULL for the shared pool.
+ * @see datetime_array_to_string()
+ */
+void datetime_parallel_to_string(DateTimeThreadPool *pool, const DateTime *datetimes, char *buffer, size_t stride, size_t count);
+
+/**
+ * @brief Parse the string representations (yyyy-mm-dd hh:mm:ss.fff) into DateTime objects on every thread of the pool.
+ * @param pool The DateTimeThreadPool object, or NULL for the shared pool.
+ * @see datetime_array_parse()
+ */
+size_t datetime_parallel_parse(DateTimeThreadPool *pool, const char *buffer, size_t stride, DateTime *datetimes, int *valid, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,519 @@
+#include "datetime_wheel.h"
+#include <stdlib.h>
+
+#define return_if_fail(expr) \
+    if (!(expr)) {           \
+        return;              \
+    }
+
+#define return_value_if_fail(expr, ret) \
+    if (!(expr)) {                      \
+        return (ret);                   \
+    }
+
+#define WHEEL_LEVELS 8
+#define WHEEL_SLOT_BITS 8
+#define WHEEL_SLOTS (1 << WHEEL_SLOT_BITS)
+#define WHEEL_WORDS (WHEEL_SLOTS / 64)
+
+/* The lists of timers: one per slot, then the timers already due, then the timers due on the next advance. */
+#define DUE_LIST (WHEEL_LEVELS * WHEEL_SLOTS)
+#define LATE_LIST (DUE_LIST + 1)
+#define LIST_COUNT (LATE_LIST + 1)
+#define NO_LIST ((uint32_t)-1) /* the timer is free */
+
+#define NIL ((uint32_t)-1)
+#define INITIAL_CAPACITY 1024
+#define MAX_CAPACITY ((uint32_t)0x7FFFFFFF)
+
+/* A timer, linked into one list by index so that the pool can grow without invalidating the links. */
+typedef struct TimerNode {
+    Instant deadline;
+    uint64_t tick; /* the first tick at or after the deadline */
+    void *data;
+    uint32_t next;
+    uint32_t prev;
+    uint32_t list;
+    uint32_t generation; /* incremented every time the node is freed, the high half of the TimerId */
+} TimerNode;
+
+struct TimerWheel {
+    TimerWheelNow now;
+    void *context;
+    int64_t tick_milliseconds;
+    uint64_t current; /* every timer with a tick at or before it has been moved to the due list or expired */
+    uint32_t heads[LIST_COUNT];
+    uint64_t occupied[WHEEL_LEVELS][WHEEL_WORDS]; /* bit s of a level: its slot s is not empty */
+    TimerNode *nodes;
+    uint32_t capacity;
+    uint32_t free;
+    size_t count;
+    bool advancing;
+};
+
+/**
+ * @brief The default source of the current time.
+ * @param context Unused.
+ * @return Returns the Instant of datetime_now().
+ */
+static Instant __datetime_now(void *context) {
+    (void)context;
+    return instant_from_datetime_unchecked(datetime_now());
+}
+
+/**
+ * @brief Find the highest set bit.
+ * @param mask The bitset, not 0.
+ * @return Returns the position of the bit.
+ */
+static int __highest_bit(uint64_t mask) {
+#ifdef __GNUC__
+    return 63 - __builtin_clzll(mask);
+#else
+    int position = 0;
+
+    while (mask >>= 1) {
+        position++;
+    }
+    return position;
+#endif
+}
+
+/**
+ * @brief Find the first occupied slot of a level at or after the slot.
+ * @param occupied The occupancy bitmap of the level.
+ * @param from The slot.
+ * @return Returns the slot, or -1 if there is none.
+ */
+static int __next_slot(const uint64_t *occupied, int from) {
+    uint64_t word;
+    int index;
+
+    for (index = from / 64; index < WHEEL_WORDS; index++) {
+        word = occupied[index];
+        if (index == from / 64) {
+            word &= ~(uint64_t)0 << (from % 64);
+        }
+        if (word != 0) {
+#ifdef __GNUC__
+            return index * 64 + __builtin_ctzll(word);
+#else
+            for (from = 0; !((word >> from) & 1); from++) {
+            }
+            return index * 64 + from;
+#endif
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Clamp the Instant into INSTANT_MIN ~ INSTANT_MAX and count its ticks since INSTANT_MIN, rounding down.
+ * @param wheel The TimerWheel object.
+ * @param instant The Instant.
+ * @return Returns the tick.
+ */
+static uint64_t __tick_floor(const TimerWheel *wheel, Instant instant) {
+    instant = instant < INSTANT_MIN ? INSTANT_MIN : instant > INSTANT_MAX ? INSTANT_MAX : instant;
+    return (uint64_t)(instant - INSTANT_MIN) / (uint64_t)wheel->tick_milliseconds;
+}
+
+/**
+ * @brief Get the Instant of the tick, clamped to INSTANT_MAX.
+ * @param wheel The TimerWheel object.
+ * @param tick The tick.
+ * @return Returns the Instant.
+ */
+static Instant __tick_instant(const TimerWheel *wheel, uint64_t tick) {
+    uint64_t offset = tick * (uint64_t)wheel->tick_milliseconds;
+
+    return offset > (uint64_t)(INSTANT_MAX - INSTANT_MIN) ? INSTANT_MAX : INSTANT_MIN + (Instant)offset;
+}
+
+/**
+ * @brief Push the node to the front of the list.
+ * @param wheel The TimerWheel object.
+ * @param index The index of the node.
+ * @param list The list.
+ */
+static void __link(TimerWheel *wheel, uint32_t index, uint32_t list) {
+    TimerNode *node = &wheel->nodes[index];
+
+    node->list = list;
+    node->prev = NIL;
+    node->next = wheel->heads[list];
+    if (node->next != NIL) {
+        wheel->nodes[node->next].prev = index;
+    }
+    wheel->heads[list] = index;
+    if (list < DUE_LIST) {
+        wheel->occupied[list / WHEEL_SLOTS][list % WHEEL_SLOTS / 64] |= (uint64_t)1 << (list % 64);
+    }
+}
+
+/**
+ * @brief Remove the node from its list.
+ * @param wheel The TimerWheel object.
+ * @param index The index of the node.
+ */
+static void __unlink(TimerWheel *wheel, uint32_t index) {
+    TimerNode *node = &wheel->nodes[index];
+    uint32_t list = node->list;
+
+    if (node->prev != NIL) {
+        wheel->nodes[node->prev].next = node->next;
+    } else {
+        wheel->heads[list] = node->next;
+    }
+    if (node->next != NIL) {
+        wheel->nodes[node->next].prev = node->prev;
+    }
+    if (list < DUE_LIST && wheel->heads[list] == NIL) {
+        wheel->occupied[list / WHEEL_SLOTS][list % WHEEL_SLOTS / 64] &= ~((uint64_t)1 << (list % 64));
+    }
+    node->list = NO_LIST;
+}
+
+/**
+ * @brief Link the node into the slot of the first level its tick and the current tick agree above.
+ * @param wheel The TimerWheel object.
+ * @param index The index of the node.
+ * @param due The list of the node if its tick has been reached, DUE_LIST or LATE_LIST.
+ */
+static void __place(TimerWheel *wheel, uint32_t index, uint32_t due) {
+    uint64_t tick = wheel->nodes[index].tick;
+    int level;
+
+    if (tick <= wheel->current) {
+        __link(wheel, index, due);
+        return;
+    }
+    level = __highest_bit(tick ^ wheel->current) / WHEEL_SLOT_BITS;
+    __link(wheel, index, (uint32_t)(level * WHEEL_SLOTS + (int)((tick >> (level * WHEEL_SLOT_BITS)) & (WHEEL_SLOTS - 1))));
+}
+
+/**
+ * @brief Find the next tick at which a slot of the wheel is reached.
+ * @param wheel The TimerWheel object.
+ * @param tick The tick (output).
+ * @return Returns true if a slot is occupied, otherwise returns false.
+ * @note The occupied slots of a level are after the current slot of the level, in the same block of the level
+ *       above, so the first occupied slot of the lowest level that has one is the next one reached.
+ */
+static bool __next_event(const TimerWheel *wheel, uint64_t *tick) {
+    uint64_t block;
+    int shift;
+    int level;
+    int slot;
+
+    for (level = 0; level < WHEEL_LEVELS; level++) {
+        shift = level * WHEEL_SLOT_BITS;
+        slot = __next_slot(wheel->occupied[level], (int)((wheel->current >> shift) & (WHEEL_SLOTS - 1)) + 1);
+        if (slot >= 0) {
+            block = level + 1 < WHEEL_LEVELS ? wheel->current >> (shift + WHEEL_SLOT_BITS) << (shift + WHEEL_SLOT_BITS) : 0;
+            *tick = block | (uint64_t)slot << shift;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Take a free node from the pool, growing it if needed.
+ * @param wheel The TimerWheel object.
+ * @param index The index of the node (output).
+ * @return Returns true on success, or false if the allocation fails.
+ */
+static bool __allocate(TimerWheel *wheel, uint32_t *index) {
+    TimerNode *nodes;
+    uint32_t capacity;
+    uint32_t i;
+
+    if (wheel->free == NIL) {
+        return_value_if_fail(wheel->capacity < MAX_CAPACITY, false);
+        capacity = wheel->capacity == 0 ? INITIAL_CAPACITY : wheel->capacity > MAX_CAPACITY / 2 ? MAX_CAPACITY : wheel->capacity * 2;
+        nodes = (TimerNode *)realloc(wheel->nodes, sizeof(TimerNode) * capacity);
+        return_value_if_fail(nodes != NULL, false);
+        for (i = capacity; i > wheel->capacity; i--) {
+            nodes[i - 1].list = NO_LIST;
+            nodes[i - 1].generation = 0;
+            nodes[i - 1].next = wheel->free;
+            wheel->free = i - 1;
+        }
+        wheel->nodes = nodes;
+        wheel->capacity = capacity;
+    }
+    *index = wheel->free;
+    wheel->free = wheel->nodes[*index].next;
+    return true;
+}
+
+/**
+ * @brief Return the node to the pool, invalidating its TimerId.
+ * @param wheel The TimerWheel object.
+ * @param index The index of the node.
+ * @note A node whose generation wraps around is retired instead, so that no TimerId is ever handed out twice.
+ */
+static void __release(TimerWheel *wheel, uint32_t index) {
+    wheel->count--;
+    if (++wheel->nodes[index].generation == 0) {
+        return;
+    }
+    wheel->nodes[index].next = wheel->free;
+    wheel->free = index;
+}
+
+/* The state of one advance of the wheel. */
+typedef struct TimerBatch {
+    TimerExpiry expired[TIMER_WHEEL_BATCH];
+    size_t count;
+    size_t total;
+    TimerWheelCallback callback;
+    void *context;
+} TimerBatch;
+
+/**
+ * @brief Pass the collected expired timers to the callback.
+ * @param batch The batch.
+ */
+static void __flush(TimerBatch *batch) {
+    size_t count = batch->count;
+
+    batch->count = 0;
+    if (count > 0 && batch->callback != NULL) {
+        batch->callback(batch->expired, count, batch->context);
+    }
+}
+
+/**
+ * @brief Expire every timer of the list.
+ * @param wheel The TimerWheel object.
+ * @param list The list.
+ * @param batch The batch collecting the expired timers.
+ * @note Timers are taken from the list one at a time, so the callback can cancel the ones still in it.
+ */
+static void __expire_list(TimerWheel *wheel, uint32_t list, TimerBatch *batch) {
+    TimerExpiry *expiry;
+    TimerNode *node;
+    uint32_t index;
+
+    while ((index = wheel->heads[list]) != NIL) {
+        node = &wheel->nodes[index];
+        __unlink(wheel, index);
+        expiry = &batch->expired[batch->count++];
+        expiry->id = (TimerId)node->generation << 32 | (TimerId)(index + 1);
+        expiry->deadline = node->deadline;
+        expiry->data = node->data;
+        __release(wheel, index);
+        batch->total++;
+        if (batch->count == TIMER_WHEEL_BATCH) {
+            __flush(batch);
+        }
+    }
+}
+
+/**
+ * @brief Create a TimerWheel object starting at the current time.
+ * @param tick_milliseconds The resolution of the wheel in milliseconds, at least 1. Timers expire on the first tick
+ *                          at or after their deadline, at most one tick late.
+ * @param now The source of the current time, or NULL for datetime_now().
+ * @param context The context passed to now.
+ * @return Returns the TimerWheel object, or NULL if the tick is invalid or the allocation fails.
+ * @note The caller must destroy the returned wheel with timer_wheel_destroy().
+ */
+TimerWheel *timer_wheel_create(int tick_milliseconds, TimerWheelNow now, void *context) {
+    TimerWheel *wheel;
+    int i;
+
+    return_value_if_fail(tick_milliseconds >= 1, NULL);
+
+    wheel = (TimerWheel *)calloc(1, sizeof(TimerWheel));
+    return_value_if_fail(wheel != NULL, NULL);
+    wheel->now = now != NULL ? now : __datetime_now;
+    wheel->context = context;
+    wheel->tick_milliseconds = tick_milliseconds;
+    for (i = 0; i < LIST_COUNT; i++) {
+        wheel->heads[i] = NIL;
+    }
+    wheel->free = NIL;
+    wheel->current = __tick_floor(wheel, wheel->now(context));
+    return wheel;
+}
+
+/**
+ * @brief Destroy the TimerWheel object, dropping the pending timers.
+ * @param wheel The TimerWheel object.
+ */
+void timer_wheel_destroy(TimerWheel *wheel) {
+    return_if_fail(wheel != NULL);
+
+    free(wheel->nodes);
+    free(wheel);
+}
+
+/**
+ * @brief Get the current time of the wheel from its source.
+ * @param wheel The TimerWheel object.
+ * @return Returns the current Instant.
+ */
+Instant timer_wheel_now(const TimerWheel *wheel) {
+    return wheel->now(wheel->context);
+}
+
+/**
+ * @brief Schedule a timer at the deadline.
+ * @param wheel The TimerWheel object.
+ * @param deadline The DateTime object, on the same scale as the source of the wheel (local time for datetime_now()).
+ * @param data The data of the timer, passed back on expiry.
+ * @return Returns the TimerId of the timer, or 0 if the deadline is invalid or the allocation fails.
+ * @note O(1). A deadline that has already passed expires on the next advance.
+ */
+TimerId timer_wheel_schedule(TimerWheel *wheel, DateTime deadline, void *data) {
+    Instant instant;
+
+    return_value_if_fail(instant_from_datetime_checked(deadline, &instant) == DATETIME_OK, 0);
+    return timer_wheel_schedule_instant(wheel, instant, data);
+}
+
+/**
+ * @brief Schedule a timer at the Instant.
+ * @param wheel The TimerWheel object.
+ * @param deadline The Instant, in INSTANT_MIN ~ INSTANT_MAX.
+ * @param data The data of the timer, passed back on expiry.
+ * @return Returns the TimerId of the timer, or 0 if the deadline is out of range or the allocation fails.
+ * @see timer_wheel_schedule()
+ */
+TimerId timer_wheel_schedule_instant(TimerWheel *wheel, Instant deadline, void *data) {
+    TimerNode *node;
+    uint32_t index;
+
+    return_value_if_fail(wheel != NULL && deadline >= INSTANT_MIN && deadline <= INSTANT_MAX, 0);
+    return_value_if_fail(__allocate(wheel, &index), 0);
+
+    node = &wheel->nodes[index];
+    node->deadline = deadline;
+    node->tick = ((uint64_t)(deadline - INSTANT_MIN) + (uint64_t)wheel->tick_milliseconds - 1) / (uint64_t)wheel->tick_milliseconds;
+    node->data = data;
+    /* Timers scheduled in the past by a callback wait for the next advance, so a callback cannot loop forever */
+    __place(wheel, index, wheel->advancing ? LATE_LIST : DUE_LIST);
+    wheel->count++;
+    return (TimerId)node->generation << 32 | (TimerId)(index + 1);
+}
+
+/**
+ * @brief Cancel the timer.
+ * @param wheel The TimerWheel object.
+ * @param id The TimerId of the timer.
+ * @return Returns true if the timer was pending, or false if it has expired, was cancelled or is unknown.
+ * @note O(1).
+ */
+bool timer_wheel_cancel(TimerWheel *wheel, TimerId id) {
+    uint32_t index = (uint32_t)(id & 0xFFFFFFFF) - 1;
+
+    return_value_if_fail(wheel != NULL && index < wheel->capacity, false);
+    return_value_if_fail(wheel->nodes[index].list != NO_LIST && wheel->nodes[index].generation == (uint32_t)(id >> 32), false);
+
+    __unlink(wheel, index);
+    __release(wheel, index);
+    return true;
+}
+
+/**
+ * @brief Get the number of pending timers.
+ * @param wheel The TimerWheel object.
+ * @return Returns the number of pending timers.
+ */
+size_t timer_wheel_count(const TimerWheel *wheel) {
+    return wheel->count;
+}
+
+/**
+ * @brief Expire every timer whose deadline is at or before the Instant.
+ * @param wheel The TimerWheel object.
+ * @param now The Instant. An Instant before the current tick of the wheel expires nothing.
+ * @param callback The callback, called with batches of up to TIMER_WHEEL_BATCH expired timers.
+ * @param context The context passed to callback.
+ * @return Returns the number of expired timers.
+ * @note Empty slots are skipped with an occupancy bitmap per level, so the cost depends on the number of
+ *       timers moved and expired, not on the time elapsed.
+ */
+size_t timer_wheel_advance(TimerWheel *wheel, Instant now, TimerWheelCallback callback, void *context) {
+    TimerBatch batch;
+    uint64_t target;
+    uint64_t tick;
+    uint32_t index;
+    int level;
+
+    return_value_if_fail(wheel != NULL && !wheel->advancing, 0);
+
+    batch.count = 0;
+    batch.total = 0;
+    batch.callback = callback;
+    batch.context = context;
+    target = __tick_floor(wheel, now);
+    wheel->advancing = true;
+
+    /* The timers scheduled in the past, including by the callbacks of the previous advance */
+    while ((index = wheel->heads[LATE_LIST]) != NIL) {
+        __unlink(wheel, index);
+        __link(wheel, index, DUE_LIST);
+    }
+    __expire_list(wheel, DUE_LIST, &batch);
+    __flush(&batch);
+
+    while (__next_event(wheel, &tick) && tick <= target) {
+        wheel->current = tick;
+        /* Move the timers of the slots reached down, from the highest level whose lower digits are all 0 */
+        for (level = WHEEL_LEVELS - 1; level > 0; level--) {
+            if ((tick & (((uint64_t)1 << (level * WHEEL_SLOT_BITS)) - 1)) == 0) {
+                while ((index = wheel->heads[level * WHEEL_SLOTS + (int)((tick >> (level * WHEEL_SLOT_BITS)) & (WHEEL_SLOTS - 1))]) != NIL) {
+                    __unlink(wheel, index);
+                    __place(wheel, index, DUE_LIST);
+                }
+            }
+        }
+        __expire_list(wheel, (uint32_t)(tick & (WHEEL_SLOTS - 1)), &batch);
+        __expire_list(wheel, DUE_LIST, &batch);
+        __flush(&batch);
+    }
+    if (target > wheel->current) {
+        wheel->current = target;
+    }
+
+    wheel->advancing = false;
+    return batch.total;
+}
+
+/**
+ * @brief Expire every timer whose deadline is at or before the current time of the source of the wheel.
+ * @param wheel The TimerWheel object.
+ * @param callback The callback, called with batches of up to TIMER_WHEEL_BATCH expired timers.
+ * @param context The context passed to callback.
+ * @return Returns the number of expired timers.
+ * @see timer_wheel_advance()
+ */
+size_t timer_wheel_expire(TimerWheel *wheel, TimerWheelCallback callback, void *context) {
+    return_value_if_fail(wheel != NULL, 0);
+
+    return timer_wheel_advance(wheel, wheel->now(wheel->context), callback, context);
+}
+
+/**
+ * @brief Get the earliest time the next timer can expire, to sleep until then.
+ * @param wheel The TimerWheel object.
+ * @param out The Instant (output). Unchanged on error.
+ * @return Returns true on success, or false if no timer is pending.
+ * @note The Instant is exact for the timers of the lowest level, and the start of the first pending slot otherwise,
+ *       so it is never after the next deadline. Advancing to it may expire nothing and only move timers down.
+ */
+bool timer_wheel_next_expiry(const TimerWheel *wheel, Instant *out) {
+    uint64_t tick;
+
+    return_value_if_fail(wheel != NULL && out != NULL && wheel->count > 0, false);
+
+    if (wheel->heads[DUE_LIST] != NIL || wheel->heads[LATE_LIST] != NIL || !__next_event(wheel, &tick)) {
+        tick = wheel->current;
+    }
+    *out = __tick_instant(wheel, tick);
+    return true;
+}
@@ -0,0 +1,149 @@
+#ifndef _DATETIME_WHEEL_H_
+#define _DATETIME_WHEEL_H_
+
+#include "datetime.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The maximum number of expired timers passed to one call of the callback. */
+#define TIMER_WHEEL_BATCH 256
+
+/*
+ * A hierarchical timing wheel of deadlines: 8 levels of 256 slots over the ticks of the Instant of every
+ * deadline, each level 256 times coarser than the one below. A timer sits in the slot of the first level its
+ * tick and the current tick agree above, and is moved down a level when the wheel reaches its slot, so that
+ * scheduling and cancelling are O(1) and every timer is moved at most 7 times before it expires.
+ *
+ * The wheel is not thread-safe: use it from one thread, or serialize the calls.
+ */
+typedef struct TimerWheel TimerWheel;
+
+/*
+ * The handle of a scheduled timer. Never 0, and never reused for another timer of the same wheel: the high half
+ * counts the reuses of the timer's slot, and a slot is retired rather than reused once the count would wrap.
+ */
+typedef uint64_t TimerId;
+
+/* An expired timer. */
+typedef struct TimerExpiry {
+    TimerId id;
+    Instant deadline;
+    void *data;
+} TimerExpiry;
+
+/**
+ * @brief The source of the current time of a wheel.
+ * @param context The context given to timer_wheel_create().
+ * @return Returns the current Instant.
+ */
+typedef Instant (*TimerWheelNow)(void *context);
+
+/**
+ * @brief The callback receiving the timers expired on one tick, the ticks in order.
+ * @param expired The array of count expired timers, at most TIMER_WHEEL_BATCH. Only valid during the call.
+ * @param count The number of expired timers.
+ * @param context The context given to timer_wheel_advance() or timer_wheel_expire().
+ * @note The timers already due when the advance starts come first, in one or more calls of their own.
+ *       The callback can schedule and cancel timers of the wheel, but not advance it.
+ */
+typedef void (*TimerWheelCallback)(const TimerExpiry *expired, size_t count, void *context);
+
+/**
+ * @brief Create a TimerWheel object starting at the current time.
+ * @param tick_milliseconds The resolution of the wheel in milliseconds, at least 1. Timers expire on the first tick
+ *                          at or after their deadline, at most one tick late.
+ * @param now The source of the current time, or NULL for datetime_now().
+ * @param context The context passed to now.
+ * @return Returns the TimerWheel object, or NULL if the tick is invalid or the allocation fails.
+ * @note The caller must destroy the returned wheel with timer_wheel_destroy().
+ */
+TimerWheel *timer_wheel_create(int tick_milliseconds, TimerWheelNow now, void *context);
+
+/**
+ * @brief Destroy the TimerWheel object, dropping the pending timers.
+ * @param wheel The TimerWheel object.
+ */
+void timer_wheel_destroy(TimerWheel *wheel);
+
+/**
+ * @brief Get the current time of the wheel from its source.
+ * @param wheel The TimerWheel object.
+ * @return Returns the current Instant.
+ */
+Instant timer_wheel_now(const TimerWheel *wheel);
+
+/**
+ * @brief Schedule a timer at the deadline.
+ * @param wheel The TimerWheel object.
+ * @param deadline The DateTime object, on the same scale as the source of the wheel (local time for datetime_now()).
+ * @param data The data of the timer, passed back on expiry.
+ * @return Returns the TimerId of the timer, or 0 if the deadline is invalid or the allocation fails.
+ * @note O(1). A deadline that has already passed expires on the next advance.
+ */
+TimerId timer_wheel_schedule(TimerWheel *wheel, DateTime deadline, void *data);
+
+/**
+ * @brief Schedule a timer at the Instant.
+ * @param wheel The TimerWheel object.
+ * @param deadline The Instant, in INSTANT_MIN ~ INSTANT_MAX.
+ * @param data The data of the timer, passed back on expiry.
+ * @return Returns the TimerId of the timer, or 0 if the deadline is out of range or the allocation fails.
+ * @see timer_wheel_schedule()
+ */
+TimerId timer_wheel_schedule_instant(TimerWheel *wheel, Instant deadline, void *data);
+
+/**
+ * @brief Cancel the timer.
+ * @param wheel The TimerWheel object.
+ * @param id The TimerId of the timer.
+ * @return Returns true if the timer was pending, or false if it has expired, was cancelled or is unknown.
+ * @note O(1).
+ */
+bool timer_wheel_cancel(TimerWheel *wheel, TimerId id);
+
+/**
+ * @brief Get the number of pending timers.
+ * @param wheel The TimerWheel object.
+ * @return Returns the number of pending timers.
+ */
+size_t timer_wheel_count(const TimerWheel *wheel);
+
+/**
+ * @brief Expire every timer whose deadline is at or before the Instant.
+ * @param wheel The TimerWheel object.
+ * @param now The Instant. An Instant before the current tick of the wheel expires nothing.
+ * @param callback The callback, called with batches of up to TIMER_WHEEL_BATCH expired timers.
+ * @param context The context passed to callback.
+ * @return Returns the number of expired timers.
+ * @note Empty slots are skipped with an occupancy bitmap per level, so the cost depends on the number of
+ *       timers moved and expired, not on the time elapsed.
+ */
+size_t timer_wheel_advance(TimerWheel *wheel, Instant now, TimerWheelCallback callback, void *context);
+
+/**
+ * @brief Expire every timer whose deadline is at or before the current time of the source of the wheel.
+ * @param wheel The TimerWheel object.
+ * @param callback The callback, called with batches of up to TIMER_WHEEL_BATCH expired timers.
+ * @param context The context passed to callback.
+ * @return Returns the number of expired timers.
+ * @see timer_wheel_advance()
+ */
+size_t timer_wheel_expire(TimerWheel *wheel, TimerWheelCallback callback, void *context);
+
+/**
+ * @brief Get the earliest time the next timer can expire, to sleep until then.
+ * @param wheel The TimerWheel object.
+ * @param out The Instant (output). Unchanged on error.
+ * @return Returns true on success, or false if no timer is pending.
+ * @note The Instant is exact for the timers of the lowest level, and the start of the first pending slot otherwise,
+ *       so it is never after the next deadline. Advancing to it may expire nothing and only move timers down.
+ */
+bool timer_wheel_next_expiry(const TimerWheel *wheel, Instant *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,1671 @@
+/* Generated by gen_year_table.c, do not edit. */
+/* days before January 1:22 | leap:1 | weekday of January 1:3, for the years 0 ~ 10000 */
+static const uint32_t YEAR_TABLE[10001] CACHE_ALIGNED = {
+    0x00000000, 0x00000001, 0x000016d2, 0x00002da3, 0x0000447c, 0x00005b56,
+    0x00007220, 0x000088f1, 0x00009fca, 0x0000b6a4, 0x0000cd75, 0x0000e446,
+    0x0000fb18, 0x000111f2, 0x000128c3, 0x00013f94, 0x0001566d, 0x00016d40,
+    0x00018411, 0x00019ae2, 0x0001b1bb, 0x0001c895, 0x0001df66, 0x0001f630,
+    0x00020d09, 0x000223e3, 0x00023ab4, 0x00025185, 0x0002685e, 0x00027f31,
+    0x00029602, 0x0002acd3, 0x0002c3ac, 0x0002da86, 0x0002f150, 0x00030821,
+    0x00031efa, 0x000335d4, 0x00034ca5, 0x00036376, 0x00037a48, 0x00039122,
+    0x0003a7f3, 0x0003bec4, 0x0003d59d, 0x0003ec70, 0x00040341, 0x00041a12,
+    0x000430eb, 0x000447c5, 0x00045e96, 0x00047560, 0x00048c39, 0x0004a313,
+    0x0004b9e4, 0x0004d0b5, 0x0004e78e, 0x0004fe61, 0x00051532, 0x00052c03,
+    0x000542dc, 0x000559b6, 0x00057080, 0x00058751, 0x00059e2a, 0x0005b504,
+    0x0005cbd5, 0x0005e2a6, 0x0005f978, 0x00061052, 0x00062723, 0x00063df4,
+    0x000654cd, 0x00066ba0, 0x00068271, 0x00069942, 0x0006b01b, 0x0006c6f5,
+    0x0006ddc6, 0x0006f490, 0x00070b69, 0x00072243, 0x00073914, 0x00074fe5,
+    0x000766be, 0x00077d91, 0x00079462, 0x0007ab33, 0x0007c20c, 0x0007d8e6,
+    0x0007efb0, 0x00080681, 0x00081d5a, 0x00083434, 0x00084b05, 0x000861d6,
+    0x000878a8, 0x00088f82, 0x0008a653, 0x0008bd24, 0x0008d3f5, 0x0008eac6,
+    0x00090190, 0x00091861, 0x00092f3a, 0x00094614, 0x00095ce5, 0x000973b6,
+    0x00098a88, 0x0009a162, 0x0009b833, 0x0009cf04, 0x0009e5dd, 0x0009fcb0,
+    0x000a1381, 0x000a2a52, 0x000a412b, 0x000a5805, 0x000a6ed6, 0x000a85a0,
+    0x000a9c79, 0x000ab353, 0x000aca24, 0x000ae0f5, 0x000af7ce, 0x000b0ea1,
+    0x000b2572, 0x000b3c43, 0x000b531c, 0x000b69f6, 0x000b80c0, 0x000b9791,
+    0x000bae6a, 0x000bc544, 0x000bdc15, 0x000bf2e6, 0x000c09b8, 0x000c2092,
+    0x000c3763, 0x000c4e34, 0x000c650d, 0x000c7be0, 0x000c92b1, 0x000ca982,
+    0x000cc05b, 0x000cd735, 0x000cee06, 0x000d04d0, 0x000d1ba9, 0x000d3283,
+    0x000d4954, 0x000d6025, 0x000d76fe, 0x000d8dd1, 0x000da4a2, 0x000dbb73,
+    0x000dd24c, 0x000de926, 0x000dfff0, 0x000e16c1, 0x000e2d9a, 0x000e4474,
+    0x000e5b45, 0x000e7216, 0x000e88e8, 0x000e9fc2, 0x000eb693, 0x000ecd64,
+    0x000ee43d, 0x000efb10, 0x000f11e1, 0x000f28b2, 0x000f3f8b, 0x000f5665,
+    0x000f6d36, 0x000f8400, 0x000f9ad9, 0x000fb1b3, 0x000fc884, 0x000fdf55,
+    0x000ff62e, 0x00100d01, 0x001023d2, 0x00103aa3, 0x0010517c, 0x00106856,
+    0x00107f20, 0x001095f1, 0x0010acca, 0x0010c3a4, 0x0010da75, 0x0010f146,
+    0x00110818, 0x00111ef2, 0x001135c3, 0x00114c94, 0x0011636d, 0x00117a40,
+    0x00119111, 0x0011a7e2, 0x0011beb3, 0x0011d584, 0x0011ec55, 0x00120326,
+    0x001219f8, 0x001230d2, 0x001247a3, 0x00125e74, 0x0012754d, 0x00128c20,
+    0x0012a2f1, 0x0012b9c2, 0x0012d09b, 0x0012e775, 0x0012fe46, 0x00131510,
+    0x00132be9, 0x001342c3, 0x00135994, 0x00137065, 0x0013873e, 0x00139e11,
+    0x0013b4e2, 0x0013cbb3, 0x0013e28c, 0x0013f966, 0x00141030, 0x00142701,
+    0x00143dda, 0x001454b4, 0x00146b85, 0x00148256, 0x00149928, 0x0014b002,
+    0x0014c6d3, 0x0014dda4, 0x0014f47d, 0x00150b50, 0x00152221, 0x001538f2,
+    0x00154fcb, 0x001566a5, 0x00157d76, 0x00159440, 0x0015ab19, 0x0015c1f3,
+    0x0015d8c4, 0x0015ef95, 0x0016066e, 0x00161d41, 0x00163412, 0x00164ae3,
+    0x001661bc, 0x00167896, 0x00168f60, 0x0016a631, 0x0016bd0a, 0x0016d3e4,
+    0x0016eab5, 0x00170186, 0x00171858, 0x00172f32, 0x00174603, 0x00175cd4,
+    0x001773ad, 0x00178a80, 0x0017a151, 0x0017b822, 0x0017cefb, 0x0017e5d5,
+    0x0017fca6, 0x00181370, 0x00182a49, 0x00184123, 0x001857f4, 0x00186ec5,
+    0x0018859e, 0x00189c71, 0x0018b342, 0x0018ca13, 0x0018e0ec, 0x0018f7c6,
+    0x00190e90, 0x00192561, 0x00193c3a, 0x00195314, 0x001969e5, 0x001980b6,
+    0x00199788, 0x0019ae62, 0x0019c533, 0x0019dc04, 0x0019f2dd, 0x001a09b0,
+    0x001a2081, 0x001a3752, 0x001a4e2b, 0x001a6505, 0x001a7bd6, 0x001a92a0,
+    0x001aa971, 0x001ac042, 0x001ad713, 0x001aede4, 0x001b04bd, 0x001b1b90,
+    0x001b3261, 0x001b4932, 0x001b600b, 0x001b76e5, 0x001b8db6, 0x001ba480,
+    0x001bbb59, 0x001bd233, 0x001be904, 0x001bffd5, 0x001c16ae, 0x001c2d81,
+    0x001c4452, 0x001c5b23, 0x001c71fc, 0x001c88d6, 0x001c9fa0, 0x001cb671,
+    0x001ccd4a, 0x001ce424, 0x001cfaf5, 0x001d11c6, 0x001d2898, 0x001d3f72,
+    0x001d5643, 0x001d6d14, 0x001d83ed, 0x001d9ac0, 0x001db191, 0x001dc862,
+    0x001ddf3b, 0x001df615, 0x001e0ce6, 0x001e23b0, 0x001e3a89, 0x001e5163,
+    0x001e6834, 0x001e7f05, 0x001e95de, 0x001eacb1, 0x001ec382, 0x001eda53,
+    0x001ef12c, 0x001f0806, 0x001f1ed0, 0x001f35a1, 0x001f4c7a, 0x001f6354,
+    0x001f7a25, 0x001f90f6, 0x001fa7c8, 0x001fbea2, 0x001fd573, 0x001fec44,
+    0x0020031d, 0x002019f0, 0x002030c1, 0x00204792, 0x00205e6b, 0x00207545,
+    0x00208c16, 0x0020a2e0, 0x0020b9b9, 0x0020d093, 0x0020e764, 0x0020fe35,
+    0x0021150e, 0x00212be1, 0x002142b2, 0x00215983, 0x0021705c, 0x00218736,
+    0x00219e00, 0x0021b4d1, 0x0021cbaa, 0x0021e284, 0x0021f955, 0x00221026,
+    0x002226f8, 0x00223dd2, 0x002254a3, 0x00226b74, 0x0022824d, 0x00229920,
+    0x0022aff1, 0x0022c6c2, 0x0022dd9b, 0x0022f475, 0x00230b46, 0x00232210,
+    0x002338e9, 0x00234fc3, 0x00236694, 0x00237d65, 0x0023943e, 0x0023ab11,
+    0x0023c1e2, 0x0023d8b3, 0x0023ef8c, 0x00240666, 0x00241d30, 0x00243401,
+    0x00244ada, 0x002461b4, 0x00247885, 0x00248f56, 0x0024a628, 0x0024bd02,
+    0x0024d3d3, 0x0024eaa4, 0x0025017d, 0x00251850, 0x00252f21, 0x002545f2,
+    0x00255ccb, 0x002573a5, 0x00258a76, 0x0025a140, 0x0025b819, 0x0025cef3,
+    0x0025e5c4, 0x0025fc95, 0x0026136e, 0x00262a41, 0x00264112, 0x002657e3,
+    0x00266ebc, 0x00268596, 0x00269c60, 0x0026b331, 0x0026ca0a, 0x0026e0e4,
+    0x0026f7b5, 0x00270e86, 0x00272558, 0x00273c32, 0x00275303, 0x002769d4,
+    0x002780ad, 0x00279780, 0x0027ae51, 0x0027c522, 0x0027dbfb, 0x0027f2d5,
+    0x002809a6, 0x00282070, 0x00283749, 0x00284e23, 0x002864f4, 0x00287bc5,
+    0x0028929e, 0x0028a971, 0x0028c042, 0x0028d713, 0x0028edec, 0x002904c6,
+    0x00291b90, 0x00293261, 0x0029493a, 0x00296014, 0x002976e5, 0x00298db6,
+    0x0029a488, 0x0029bb62, 0x0029d233, 0x0029e904, 0x0029ffdd, 0x002a16b0,
+    0x002a2d81, 0x002a4452, 0x002a5b2b, 0x002a7205, 0x002a88d6, 0x002a9fa0,
+    0x002ab679, 0x002acd53, 0x002ae424, 0x002afaf5, 0x002b11ce, 0x002b28a1,
+    0x002b3f72, 0x002b5643, 0x002b6d1c, 0x002b83f6, 0x002b9ac0, 0x002bb191,
+    0x002bc86a, 0x002bdf44, 0x002bf615, 0x002c0ce6, 0x002c23b8, 0x002c3a92,
+    0x002c5163, 0x002c6834, 0x002c7f05, 0x002c95d6, 0x002caca0, 0x002cc371,
+    0x002cda4a, 0x002cf124, 0x002d07f5, 0x002d1ec6, 0x002d3598, 0x002d4c72,
+    0x002d6343, 0x002d7a14, 0x002d90ed, 0x002da7c0, 0x002dbe91, 0x002dd562,
+    0x002dec3b, 0x002e0315, 0x002e19e6, 0x002e30b0, 0x002e4789, 0x002e5e63,
+    0x002e7534, 0x002e8c05, 0x002ea2de, 0x002eb9b1, 0x002ed082, 0x002ee753,
+    0x002efe2c, 0x002f1506, 0x002f2bd0, 0x002f42a1, 0x002f597a, 0x002f7054,
+    0x002f8725, 0x002f9df6, 0x002fb4c8, 0x002fcba2, 0x002fe273, 0x002ff944,
+    0x0030101d, 0x003026f0, 0x00303dc1, 0x00305492, 0x00306b6b, 0x00308245,
+    0x00309916, 0x0030afe0, 0x0030c6b9, 0x0030dd93, 0x0030f464, 0x00310b35,
+    0x0031220e, 0x003138e1, 0x00314fb2, 0x00316683, 0x00317d5c, 0x00319436,
+    0x0031ab00, 0x0031c1d1, 0x0031d8aa, 0x0031ef84, 0x00320655, 0x00321d26,
+    0x003233f8, 0x00324ad2, 0x003261a3, 0x00327874, 0x00328f4d, 0x0032a620,
+    0x0032bcf1, 0x0032d3c2, 0x0032ea9b, 0x00330175, 0x00331846, 0x00332f10,
+    0x003345e9, 0x00335cc3, 0x00337394, 0x00338a65, 0x0033a13e, 0x0033b811,
+    0x0033cee2, 0x0033e5b3, 0x0033fc8c, 0x00341366, 0x00342a30, 0x00344101,
+    0x003457da, 0x00346eb4, 0x00348585, 0x00349c56, 0x0034b328, 0x0034ca02,
+    0x0034e0d3, 0x0034f7a4, 0x00350e7d, 0x00352550, 0x00353c21, 0x003552f2,
+    0x003569c3, 0x00358094, 0x00359765, 0x0035ae36, 0x0035c508, 0x0035dbe2,
+    0x0035f2b3, 0x00360984, 0x0036205d, 0x00363730, 0x00364e01, 0x003664d2,
+    0x00367bab, 0x00369285, 0x0036a956, 0x0036c020, 0x0036d6f9, 0x0036edd3,
+    0x003704a4, 0x00371b75, 0x0037324e, 0x00374921, 0x00375ff2, 0x003776c3,
+    0x00378d9c, 0x0037a476, 0x0037bb40, 0x0037d211, 0x0037e8ea, 0x0037ffc4,
+    0x00381695, 0x00382d66, 0x00384438, 0x00385b12, 0x003871e3, 0x003888b4,
+    0x00389f8d, 0x0038b660, 0x0038cd31, 0x0038e402, 0x0038fadb, 0x003911b5,
+    0x00392886, 0x00393f50, 0x00395629, 0x00396d03, 0x003983d4, 0x00399aa5,
+    0x0039b17e, 0x0039c851, 0x0039df22, 0x0039f5f3, 0x003a0ccc, 0x003a23a6,
+    0x003a3a70, 0x003a5141, 0x003a681a, 0x003a7ef4, 0x003a95c5, 0x003aac96,
+    0x003ac368, 0x003ada42, 0x003af113, 0x003b07e4, 0x003b1ebd, 0x003b3590,
+    0x003b4c61, 0x003b6332, 0x003b7a0b, 0x003b90e5, 0x003ba7b6, 0x003bbe80,
+    0x003bd559, 0x003bec33, 0x003c0304, 0x003c19d5, 0x003c30ae, 0x003c4781,
+    0x003c5e52, 0x003c7523, 0x003c8bfc, 0x003ca2d6, 0x003cb9a0, 0x003cd071,
+    0x003ce74a, 0x003cfe24, 0x003d14f5, 0x003d2bc6, 0x003d4298, 0x003d5972,
+    0x003d7043, 0x003d8714, 0x003d9ded, 0x003db4c0, 0x003dcb91, 0x003de262,
+    0x003df93b, 0x003e1015, 0x003e26e6, 0x003e3db0, 0x003e5481, 0x003e6b52,
+    0x003e8223, 0x003e98f4, 0x003eafcd, 0x003ec6a0, 0x003edd71, 0x003ef442,
+    0x003f0b1b, 0x003f21f5, 0x003f38c6, 0x003f4f90, 0x003f6669, 0x003f7d43,
+    0x003f9414, 0x003faae5, 0x003fc1be, 0x003fd891, 0x003fef62, 0x00400633,
+    0x00401d0c, 0x004033e6, 0x00404ab0, 0x00406181, 0x0040785a, 0x00408f34,
+    0x0040a605, 0x0040bcd6, 0x0040d3a8, 0x0040ea82, 0x00410153, 0x00411824,
+    0x00412efd, 0x004145d0, 0x00415ca1, 0x00417372, 0x00418a4b, 0x0041a125,
+    0x0041b7f6, 0x0041cec0, 0x0041e599, 0x0041fc73, 0x00421344, 0x00422a15,
+    0x004240ee, 0x004257c1, 0x00426e92, 0x00428563, 0x00429c3c, 0x0042b316,
+    0x0042c9e0, 0x0042e0b1, 0x0042f78a, 0x00430e64, 0x00432535, 0x00433c06,
+    0x004352d8, 0x004369b2, 0x00438083, 0x00439754, 0x0043ae2d, 0x0043c500,
+    0x0043dbd1, 0x0043f2a2, 0x0044097b, 0x00442055, 0x00443726, 0x00444df0,
+    0x004464c9, 0x00447ba3, 0x00449274, 0x0044a945, 0x0044c01e, 0x0044d6f1,
+    0x0044edc2, 0x00450493, 0x00451b6c, 0x00453246, 0x00454910, 0x00455fe1,
+    0x004576ba, 0x00458d94, 0x0045a465, 0x0045bb36, 0x0045d208, 0x0045e8e2,
+    0x0045ffb3, 0x00461684, 0x00462d5d, 0x00464430, 0x00465b01, 0x004671d2,
+    0x004688ab, 0x00469f85, 0x0046b656, 0x0046cd20, 0x0046e3f9, 0x0046fad3,
+    0x004711a4, 0x00472875, 0x00473f4e, 0x00475621, 0x00476cf2, 0x004783c3,
+    0x00479a9c, 0x0047b176, 0x0047c840, 0x0047df11, 0x0047f5ea, 0x00480cc4,
+    0x00482395, 0x00483a66, 0x00485138, 0x00486812, 0x00487ee3, 0x004895b4,
+    0x0048ac8d, 0x0048c360, 0x0048da31, 0x0048f102, 0x004907db, 0x00491eb5,
+    0x00493586, 0x00494c50, 0x00496329, 0x00497a03, 0x004990d4, 0x0049a7a5,
+    0x0049be7e, 0x0049d551, 0x0049ec22, 0x004a02f3, 0x004a19cc, 0x004a30a6,
+    0x004a4770, 0x004a5e41, 0x004a751a, 0x004a8bf4, 0x004aa2c5, 0x004ab996,
+    0x004ad068, 0x004ae742, 0x004afe13, 0x004b14e4, 0x004b2bbd, 0x004b4290,
+    0x004b5961, 0x004b7032, 0x004b870b, 0x004b9de5, 0x004bb4b6, 0x004bcb80,
+    0x004be259, 0x004bf933, 0x004c1004, 0x004c26d5, 0x004c3dae, 0x004c5481,
+    0x004c6b52, 0x004c8223, 0x004c98fc, 0x004cafd6, 0x004cc6a0, 0x004cdd71,
+    0x004cf44a, 0x004d0b24, 0x004d21f5, 0x004d38c6, 0x004d4f98, 0x004d6672,
+    0x004d7d43, 0x004d9414, 0x004daaed, 0x004dc1c0, 0x004dd891, 0x004def62,
+    0x004e063b, 0x004e1d15, 0x004e33e6, 0x004e4ab0, 0x004e6189, 0x004e7863,
+    0x004e8f34, 0x004ea605, 0x004ebcde, 0x004ed3b1, 0x004eea82, 0x004f0153,
+    0x004f182c, 0x004f2f06, 0x004f45d0, 0x004f5ca1, 0x004f737a, 0x004f8a54,
+    0x004fa125, 0x004fb7f6, 0x004fcec8, 0x004fe5a2, 0x004ffc73, 0x00501344,
+    0x00502a15, 0x005040e6, 0x005057b0, 0x00506e81, 0x0050855a, 0x00509c34,
+    0x0050b305, 0x0050c9d6, 0x0050e0a8, 0x0050f782, 0x00510e53, 0x00512524,
+    0x00513bfd, 0x005152d0, 0x005169a1, 0x00518072, 0x0051974b, 0x0051ae25,
+    0x0051c4f6, 0x0051dbc0, 0x0051f299, 0x00520973, 0x00522044, 0x00523715,
+    0x00524dee, 0x005264c1, 0x00527b92, 0x00529263, 0x0052a93c, 0x0052c016,
+    0x0052d6e0, 0x0052edb1, 0x0053048a, 0x00531b64, 0x00533235, 0x00534906,
+    0x00535fd8, 0x005376b2, 0x00538d83, 0x0053a454, 0x0053bb2d, 0x0053d200,
+    0x0053e8d1, 0x0053ffa2, 0x0054167b, 0x00542d55, 0x00544426, 0x00545af0,
+    0x005471c9, 0x005488a3, 0x00549f74, 0x0054b645, 0x0054cd1e, 0x0054e3f1,
+    0x0054fac2, 0x00551193, 0x0055286c, 0x00553f46, 0x00555610, 0x00556ce1,
+    0x005583ba, 0x00559a94, 0x0055b165, 0x0055c836, 0x0055df08, 0x0055f5e2,
+    0x00560cb3, 0x00562384, 0x00563a5d, 0x00565130, 0x00566801, 0x00567ed2,
+    0x005695ab, 0x0056ac85, 0x0056c356, 0x0056da20, 0x0056f0f9, 0x005707d3,
+    0x00571ea4, 0x00573575, 0x00574c4e, 0x00576321, 0x005779f2, 0x005790c3,
+    0x0057a79c, 0x0057be76, 0x0057d540, 0x0057ec11, 0x005802ea, 0x005819c4,
+    0x00583095, 0x00584766, 0x00585e38, 0x00587512, 0x00588be3, 0x0058a2b4,
+    0x0058b98d, 0x0058d060, 0x0058e731, 0x0058fe02, 0x005914d3, 0x00592ba4,
+    0x00594275, 0x00595946, 0x00597018, 0x005986f2, 0x00599dc3, 0x0059b494,
+    0x0059cb6d, 0x0059e240, 0x0059f911, 0x005a0fe2, 0x005a26bb, 0x005a3d95,
+    0x005a5466, 0x005a6b30, 0x005a8209, 0x005a98e3, 0x005aafb4, 0x005ac685,
+    0x005add5e, 0x005af431, 0x005b0b02, 0x005b21d3, 0x005b38ac, 0x005b4f86,
+    0x005b6650, 0x005b7d21, 0x005b93fa, 0x005baad4, 0x005bc1a5, 0x005bd876,
+    0x005bef48, 0x005c0622, 0x005c1cf3, 0x005c33c4, 0x005c4a9d, 0x005c6170,
+    0x005c7841, 0x005c8f12, 0x005ca5eb, 0x005cbcc5, 0x005cd396, 0x005cea60,
+    0x005d0139, 0x005d1813, 0x005d2ee4, 0x005d45b5, 0x005d5c8e, 0x005d7361,
+    0x005d8a32, 0x005da103, 0x005db7dc, 0x005dceb6, 0x005de580, 0x005dfc51,
+    0x005e132a, 0x005e2a04, 0x005e40d5, 0x005e57a6, 0x005e6e78, 0x005e8552,
+    0x005e9c23, 0x005eb2f4, 0x005ec9cd, 0x005ee0a0, 0x005ef771, 0x005f0e42,
+    0x005f251b, 0x005f3bf5, 0x005f52c6, 0x005f6990, 0x005f8069, 0x005f9743,
+    0x005fae14, 0x005fc4e5, 0x005fdbbe, 0x005ff291, 0x00600962, 0x00602033,
+    0x0060370c, 0x00604de6, 0x006064b0, 0x00607b81, 0x0060925a, 0x0060a934,
+    0x0060c005, 0x0060d6d6, 0x0060eda8, 0x00610482, 0x00611b53, 0x00613224,
+    0x006148fd, 0x00615fd0, 0x006176a1, 0x00618d72, 0x0061a44b, 0x0061bb25,
+    0x0061d1f6, 0x0061e8c0, 0x0061ff91, 0x00621662, 0x00622d33, 0x00624404,
+    0x00625add, 0x006271b0, 0x00628881, 0x00629f52, 0x0062b62b, 0x0062cd05,
+    0x0062e3d6, 0x0062faa0, 0x00631179, 0x00632853, 0x00633f24, 0x006355f5,
+    0x00636cce, 0x006383a1, 0x00639a72, 0x0063b143, 0x0063c81c, 0x0063def6,
+    0x0063f5c0, 0x00640c91, 0x0064236a, 0x00643a44, 0x00645115, 0x006467e6,
+    0x00647eb8, 0x00649592, 0x0064ac63, 0x0064c334, 0x0064da0d, 0x0064f0e0,
+    0x006507b1, 0x00651e82, 0x0065355b, 0x00654c35, 0x00656306, 0x006579d0,
+    0x006590a9, 0x0065a783, 0x0065be54, 0x0065d525, 0x0065ebfe, 0x006602d1,
+    0x006619a2, 0x00663073, 0x0066474c, 0x00665e26, 0x006674f0, 0x00668bc1,
+    0x0066a29a, 0x0066b974, 0x0066d045, 0x0066e716, 0x0066fde8, 0x006714c2,
+    0x00672b93, 0x00674264, 0x0067593d, 0x00677010, 0x006786e1, 0x00679db2,
+    0x0067b48b, 0x0067cb65, 0x0067e236, 0x0067f900, 0x00680fd9, 0x006826b3,
+    0x00683d84, 0x00685455, 0x00686b2e, 0x00688201, 0x006898d2, 0x0068afa3,
+    0x0068c67c, 0x0068dd56, 0x0068f420, 0x00690af1, 0x006921ca, 0x006938a4,
+    0x00694f75, 0x00696646, 0x00697d18, 0x006993f2, 0x0069aac3, 0x0069c194,
+    0x0069d86d, 0x0069ef40, 0x006a0611, 0x006a1ce2, 0x006a33bb, 0x006a4a95,
+    0x006a6166, 0x006a7830, 0x006a8f09, 0x006aa5e3, 0x006abcb4, 0x006ad385,
+    0x006aea5e, 0x006b0131, 0x006b1802, 0x006b2ed3, 0x006b45ac, 0x006b5c86,
+    0x006b7350, 0x006b8a21, 0x006ba0fa, 0x006bb7d4, 0x006bcea5, 0x006be576,
+    0x006bfc48, 0x006c1322, 0x006c29f3, 0x006c40c4, 0x006c579d, 0x006c6e70,
+    0x006c8541, 0x006c9c12, 0x006cb2eb, 0x006cc9c5, 0x006ce096, 0x006cf760,
+    0x006d0e39, 0x006d2513, 0x006d3be4, 0x006d52b5, 0x006d698e, 0x006d8061,
+    0x006d9732, 0x006dae03, 0x006dc4dc, 0x006ddbb6, 0x006df280, 0x006e0951,
+    0x006e202a, 0x006e3704, 0x006e4dd5, 0x006e64a6, 0x006e7b78, 0x006e9252,
+    0x006ea923, 0x006ebff4, 0x006ed6cd, 0x006eeda0, 0x006f0471, 0x006f1b42,
+    0x006f321b, 0x006f48f5, 0x006f5fc6, 0x006f7690, 0x006f8d69, 0x006fa443,
+    0x006fbb14, 0x006fd1e5, 0x006fe8be, 0x006fff91, 0x00701662, 0x00702d33,
+    0x0070440c, 0x00705ae6, 0x007071b0, 0x00708881, 0x00709f5a, 0x0070b634,
+    0x0070cd05, 0x0070e3d6, 0x0070faa8, 0x00711182, 0x00712853, 0x00713f24,
+    0x007155fd, 0x00716cd0, 0x007183a1, 0x00719a72, 0x0071b14b, 0x0071c825,
+    0x0071def6, 0x0071f5c0, 0x00720c99, 0x00722373, 0x00723a44, 0x00725115,
+    0x007267ee, 0x00727ec1, 0x00729592, 0x0072ac63, 0x0072c33c, 0x0072da16,
+    0x0072f0e0, 0x007307b1, 0x00731e8a, 0x00733564, 0x00734c35, 0x00736306,
+    0x007379d8, 0x007390b2, 0x0073a783, 0x0073be54, 0x0073d525, 0x0073ebf6,
+    0x007402c0, 0x00741991, 0x0074306a, 0x00744744, 0x00745e15, 0x007474e6,
+    0x00748bb8, 0x0074a292, 0x0074b963, 0x0074d034, 0x0074e70d, 0x0074fde0,
+    0x007514b1, 0x00752b82, 0x0075425b, 0x00755935, 0x00757006, 0x007586d0,
+    0x00759da9, 0x0075b483, 0x0075cb54, 0x0075e225, 0x0075f8fe, 0x00760fd1,
+    0x007626a2, 0x00763d73, 0x0076544c, 0x00766b26, 0x007681f0, 0x007698c1,
+    0x0076af9a, 0x0076c674, 0x0076dd45, 0x0076f416, 0x00770ae8, 0x007721c2,
+    0x00773893, 0x00774f64, 0x0077663d, 0x00777d10, 0x007793e1, 0x0077aab2,
+    0x0077c18b, 0x0077d865, 0x0077ef36, 0x00780600, 0x00781cd9, 0x007833b3,
+    0x00784a84, 0x00786155, 0x0078782e, 0x00788f01, 0x0078a5d2, 0x0078bca3,
+    0x0078d37c, 0x0078ea56, 0x00790120, 0x007917f1, 0x00792eca, 0x007945a4,
+    0x00795c75, 0x00797346, 0x00798a18, 0x0079a0f2, 0x0079b7c3, 0x0079ce94,
+    0x0079e56d, 0x0079fc40, 0x007a1311, 0x007a29e2, 0x007a40bb, 0x007a5795,
+    0x007a6e66, 0x007a8530, 0x007a9c09, 0x007ab2e3, 0x007ac9b4, 0x007ae085,
+    0x007af75e, 0x007b0e31, 0x007b2502, 0x007b3bd3, 0x007b52ac, 0x007b6986,
+    0x007b8050, 0x007b9721, 0x007badfa, 0x007bc4d4, 0x007bdba5, 0x007bf276,
+    0x007c0948, 0x007c2022, 0x007c36f3, 0x007c4dc4, 0x007c649d, 0x007c7b70,
+    0x007c9241, 0x007ca912, 0x007cbfe3, 0x007cd6b4, 0x007ced85, 0x007d0456,
+    0x007d1b28, 0x007d3202, 0x007d48d3, 0x007d5fa4, 0x007d767d, 0x007d8d50,
+    0x007da421, 0x007dbaf2, 0x007dd1cb, 0x007de8a5, 0x007dff76, 0x007e1640,
+    0x007e2d19, 0x007e43f3, 0x007e5ac4, 0x007e7195, 0x007e886e, 0x007e9f41,
+    0x007eb612, 0x007ecce3, 0x007ee3bc, 0x007efa96, 0x007f1160, 0x007f2831,
+    0x007f3f0a, 0x007f55e4, 0x007f6cb5, 0x007f8386, 0x007f9a58, 0x007fb132,
+    0x007fc803, 0x007fded4, 0x007ff5ad, 0x00800c80, 0x00802351, 0x00803a22,
+    0x008050fb, 0x008067d5, 0x00807ea6, 0x00809570, 0x0080ac49, 0x0080c323,
+    0x0080d9f4, 0x0080f0c5, 0x0081079e, 0x00811e71, 0x00813542, 0x00814c13,
+    0x008162ec, 0x008179c6, 0x00819090, 0x0081a761, 0x0081be3a, 0x0081d514,
+    0x0081ebe5, 0x008202b6, 0x00821988, 0x00823062, 0x00824733, 0x00825e04,
+    0x008274dd, 0x00828bb0, 0x0082a281, 0x0082b952, 0x0082d02b, 0x0082e705,
+    0x0082fdd6, 0x008314a0, 0x00832b79, 0x00834253, 0x00835924, 0x00836ff5,
+    0x008386ce, 0x00839da1, 0x0083b472, 0x0083cb43, 0x0083e21c, 0x0083f8f6,
+    0x00840fc0, 0x00842691, 0x00843d6a, 0x00845444, 0x00846b15, 0x008481e6,
+    0x008498b8, 0x0084af92, 0x0084c663, 0x0084dd34, 0x0084f40d, 0x00850ae0,
+    0x008521b1, 0x00853882, 0x00854f5b, 0x00856635, 0x00857d06, 0x008593d0,
+    0x0085aaa1, 0x0085c172, 0x0085d843, 0x0085ef14, 0x008605ed, 0x00861cc0,
+    0x00863391, 0x00864a62, 0x0086613b, 0x00867815, 0x00868ee6, 0x0086a5b0,
+    0x0086bc89, 0x0086d363, 0x0086ea34, 0x00870105, 0x008717de, 0x00872eb1,
+    0x00874582, 0x00875c53, 0x0087732c, 0x00878a06, 0x0087a0d0, 0x0087b7a1,
+    0x0087ce7a, 0x0087e554, 0x0087fc25, 0x008812f6, 0x008829c8, 0x008840a2,
+    0x00885773, 0x00886e44, 0x0088851d, 0x00889bf0, 0x0088b2c1, 0x0088c992,
+    0x0088e06b, 0x0088f745, 0x00890e16, 0x008924e0, 0x00893bb9, 0x00895293,
+    0x00896964, 0x00898035, 0x0089970e, 0x0089ade1, 0x0089c4b2, 0x0089db83,
+    0x0089f25c, 0x008a0936, 0x008a2000, 0x008a36d1, 0x008a4daa, 0x008a6484,
+    0x008a7b55, 0x008a9226, 0x008aa8f8, 0x008abfd2, 0x008ad6a3, 0x008aed74,
+    0x008b044d, 0x008b1b20, 0x008b31f1, 0x008b48c2, 0x008b5f9b, 0x008b7675,
+    0x008b8d46, 0x008ba410, 0x008bbae9, 0x008bd1c3, 0x008be894, 0x008bff65,
+    0x008c163e, 0x008c2d11, 0x008c43e2, 0x008c5ab3, 0x008c718c, 0x008c8866,
+    0x008c9f30, 0x008cb601, 0x008cccda, 0x008ce3b4, 0x008cfa85, 0x008d1156,
+    0x008d2828, 0x008d3f02, 0x008d55d3, 0x008d6ca4, 0x008d837d, 0x008d9a50,
+    0x008db121, 0x008dc7f2, 0x008ddecb, 0x008df5a5, 0x008e0c76, 0x008e2340,
+    0x008e3a19, 0x008e50f3, 0x008e67c4, 0x008e7e95, 0x008e956e, 0x008eac41,
+    0x008ec312, 0x008ed9e3, 0x008ef0bc, 0x008f0796, 0x008f1e60, 0x008f3531,
+    0x008f4c0a, 0x008f62e4, 0x008f79b5, 0x008f9086, 0x008fa758, 0x008fbe32,
+    0x008fd503, 0x008febd4, 0x009002ad, 0x00901980, 0x00903051, 0x00904722,
+    0x00905dfb, 0x009074d5, 0x00908ba6, 0x0090a270, 0x0090b949, 0x0090d023,
+    0x0090e6f4, 0x0090fdc5, 0x0091149e, 0x00912b71, 0x00914242, 0x00915913,
+    0x00916fec, 0x009186c6, 0x00919d90, 0x0091b461, 0x0091cb3a, 0x0091e214,
+    0x0091f8e5, 0x00920fb6, 0x00922688, 0x00923d62, 0x00925433, 0x00926b04,
+    0x009281dd, 0x009298b0, 0x0092af81, 0x0092c652, 0x0092dd2b, 0x0092f405,
+    0x00930ad6, 0x009321a0, 0x00933879, 0x00934f53, 0x00936624, 0x00937cf5,
+    0x009393ce, 0x0093aaa1, 0x0093c172, 0x0093d843, 0x0093ef1c, 0x009405f6,
+    0x00941cc0, 0x00943391, 0x00944a6a, 0x00946144, 0x00947815, 0x00948ee6,
+    0x0094a5b8, 0x0094bc92, 0x0094d363, 0x0094ea34, 0x0095010d, 0x009517e0,
+    0x00952eb1, 0x00954582, 0x00955c5b, 0x00957335, 0x00958a06, 0x0095a0d0,
+    0x0095b7a9, 0x0095ce83, 0x0095e554, 0x0095fc25, 0x009612fe, 0x009629d1,
+    0x009640a2, 0x00965773, 0x00966e4c, 0x00968526, 0x00969bf0, 0x0096b2c1,
+    0x0096c99a, 0x0096e074, 0x0096f745, 0x00970e16, 0x009724e8, 0x00973bc2,
+    0x00975293, 0x00976964, 0x00978035, 0x00979706, 0x0097add0, 0x0097c4a1,
+    0x0097db7a, 0x0097f254, 0x00980925, 0x00981ff6, 0x009836c8, 0x00984da2,
+    0x00986473, 0x00987b44, 0x0098921d, 0x0098a8f0, 0x0098bfc1, 0x0098d692,
+    0x0098ed6b, 0x00990445, 0x00991b16, 0x009931e0, 0x009948b9, 0x00995f93,
+    0x00997664, 0x00998d35, 0x0099a40e, 0x0099bae1, 0x0099d1b2, 0x0099e883,
+    0x0099ff5c, 0x009a1636, 0x009a2d00, 0x009a43d1, 0x009a5aaa, 0x009a7184,
+    0x009a8855, 0x009a9f26, 0x009ab5f8, 0x009accd2, 0x009ae3a3, 0x009afa74,
+    0x009b114d, 0x009b2820, 0x009b3ef1, 0x009b55c2, 0x009b6c9b, 0x009b8375,
+    0x009b9a46, 0x009bb110, 0x009bc7e9, 0x009bdec3, 0x009bf594, 0x009c0c65,
+    0x009c233e, 0x009c3a11, 0x009c50e2, 0x009c67b3, 0x009c7e8c, 0x009c9566,
+    0x009cac30, 0x009cc301, 0x009cd9da, 0x009cf0b4, 0x009d0785, 0x009d1e56,
+    0x009d3528, 0x009d4c02, 0x009d62d3, 0x009d79a4, 0x009d907d, 0x009da750,
+    0x009dbe21, 0x009dd4f2, 0x009debcb, 0x009e02a5, 0x009e1976, 0x009e3040,
+    0x009e4719, 0x009e5df3, 0x009e74c4, 0x009e8b95, 0x009ea26e, 0x009eb941,
+    0x009ed012, 0x009ee6e3, 0x009efdbc, 0x009f1496, 0x009f2b60, 0x009f4231,
+    0x009f590a, 0x009f6fe4, 0x009f86b5, 0x009f9d86, 0x009fb458, 0x009fcb32,
+    0x009fe203, 0x009ff8d4, 0x00a00fad, 0x00a02680, 0x00a03d51, 0x00a05422,
+    0x00a06af3, 0x00a081c4, 0x00a09895, 0x00a0af66, 0x00a0c638, 0x00a0dd12,
+    0x00a0f3e3, 0x00a10ab4, 0x00a1218d, 0x00a13860, 0x00a14f31, 0x00a16602,
+    0x00a17cdb, 0x00a193b5, 0x00a1aa86, 0x00a1c150, 0x00a1d829, 0x00a1ef03,
+    0x00a205d4, 0x00a21ca5, 0x00a2337e, 0x00a24a51, 0x00a26122, 0x00a277f3,
+    0x00a28ecc, 0x00a2a5a6, 0x00a2bc70, 0x00a2d341, 0x00a2ea1a, 0x00a300f4,
+    0x00a317c5, 0x00a32e96, 0x00a34568, 0x00a35c42, 0x00a37313, 0x00a389e4,
+    0x00a3a0bd, 0x00a3b790, 0x00a3ce61, 0x00a3e532, 0x00a3fc0b, 0x00a412e5,
+    0x00a429b6, 0x00a44080, 0x00a45759, 0x00a46e33, 0x00a48504, 0x00a49bd5,
+    0x00a4b2ae, 0x00a4c981, 0x00a4e052, 0x00a4f723, 0x00a50dfc, 0x00a524d6,
+    0x00a53ba0, 0x00a55271, 0x00a5694a, 0x00a58024, 0x00a596f5, 0x00a5adc6,
+    0x00a5c498, 0x00a5db72, 0x00a5f243, 0x00a60914, 0x00a61fed, 0x00a636c0,
+    0x00a64d91, 0x00a66462, 0x00a67b3b, 0x00a69215, 0x00a6a8e6, 0x00a6bfb0,
+    0x00a6d689, 0x00a6ed63, 0x00a70434, 0x00a71b05, 0x00a731de, 0x00a748b1,
+    0x00a75f82, 0x00a77653, 0x00a78d2c, 0x00a7a406, 0x00a7bad0, 0x00a7d1a1,
+    0x00a7e87a, 0x00a7ff54, 0x00a81625, 0x00a82cf6, 0x00a843c8, 0x00a85aa2,
+    0x00a87173, 0x00a88844, 0x00a89f1d, 0x00a8b5f0, 0x00a8ccc1, 0x00a8e392,
+    0x00a8fa6b, 0x00a91145, 0x00a92816, 0x00a93ee0, 0x00a955b1, 0x00a96c82,
+    0x00a98353, 0x00a99a24, 0x00a9b0fd, 0x00a9c7d0, 0x00a9dea1, 0x00a9f572,
+    0x00aa0c4b, 0x00aa2325, 0x00aa39f6, 0x00aa50c0, 0x00aa6799, 0x00aa7e73,
+    0x00aa9544, 0x00aaac15, 0x00aac2ee, 0x00aad9c1, 0x00aaf092, 0x00ab0763,
+    0x00ab1e3c, 0x00ab3516, 0x00ab4be0, 0x00ab62b1, 0x00ab798a, 0x00ab9064,
+    0x00aba735, 0x00abbe06, 0x00abd4d8, 0x00abebb2, 0x00ac0283, 0x00ac1954,
+    0x00ac302d, 0x00ac4700, 0x00ac5dd1, 0x00ac74a2, 0x00ac8b7b, 0x00aca255,
+    0x00acb926, 0x00accff0, 0x00ace6c9, 0x00acfda3, 0x00ad1474, 0x00ad2b45,
+    0x00ad421e, 0x00ad58f1, 0x00ad6fc2, 0x00ad8693, 0x00ad9d6c, 0x00adb446,
+    0x00adcb10, 0x00ade1e1, 0x00adf8ba, 0x00ae0f94, 0x00ae2665, 0x00ae3d36,
+    0x00ae5408, 0x00ae6ae2, 0x00ae81b3, 0x00ae9884, 0x00aeaf5d, 0x00aec630,
+    0x00aedd01, 0x00aef3d2, 0x00af0aab, 0x00af2185, 0x00af3856, 0x00af4f20,
+    0x00af65f9, 0x00af7cd3, 0x00af93a4, 0x00afaa75, 0x00afc14e, 0x00afd821,
+    0x00afeef2, 0x00b005c3, 0x00b01c9c, 0x00b03376, 0x00b04a40, 0x00b06111,
+    0x00b077ea, 0x00b08ec4, 0x00b0a595, 0x00b0bc66, 0x00b0d338, 0x00b0ea12,
+    0x00b100e3, 0x00b117b4, 0x00b12e8d, 0x00b14560, 0x00b15c31, 0x00b17302,
+    0x00b189db, 0x00b1a0b5, 0x00b1b786, 0x00b1ce50, 0x00b1e529, 0x00b1fc03,
+    0x00b212d4, 0x00b229a5, 0x00b2407e, 0x00b25751, 0x00b26e22, 0x00b284f3,
+    0x00b29bcc, 0x00b2b2a6, 0x00b2c970, 0x00b2e041, 0x00b2f71a, 0x00b30df4,
+    0x00b324c5, 0x00b33b96, 0x00b35268, 0x00b36942, 0x00b38013, 0x00b396e4,
+    0x00b3adbd, 0x00b3c490, 0x00b3db61, 0x00b3f232, 0x00b4090b, 0x00b41fe5,
+    0x00b436b6, 0x00b44d80, 0x00b46459, 0x00b47b33, 0x00b49204, 0x00b4a8d5,
+    0x00b4bfae, 0x00b4d681, 0x00b4ed52, 0x00b50423, 0x00b51afc, 0x00b531d6,
+    0x00b548a0, 0x00b55f71, 0x00b5764a, 0x00b58d24, 0x00b5a3f5, 0x00b5bac6,
+    0x00b5d198, 0x00b5e872, 0x00b5ff43, 0x00b61614, 0x00b62ced, 0x00b643c0,
+    0x00b65a91, 0x00b67162, 0x00b6883b, 0x00b69f15, 0x00b6b5e6, 0x00b6ccb0,
+    0x00b6e389, 0x00b6fa63, 0x00b71134, 0x00b72805, 0x00b73ede, 0x00b755b1,
+    0x00b76c82, 0x00b78353, 0x00b79a2c, 0x00b7b106, 0x00b7c7d0, 0x00b7dea1,
+    0x00b7f57a, 0x00b80c54, 0x00b82325, 0x00b839f6, 0x00b850c8, 0x00b867a2,
+    0x00b87e73, 0x00b89544, 0x00b8ac1d, 0x00b8c2f0, 0x00b8d9c1, 0x00b8f092,
+    0x00b9076b, 0x00b91e45, 0x00b93516, 0x00b94be0, 0x00b962b9, 0x00b97993,
+    0x00b99064, 0x00b9a735, 0x00b9be0e, 0x00b9d4e1, 0x00b9ebb2, 0x00ba0283,
+    0x00ba195c, 0x00ba3036, 0x00ba4700, 0x00ba5dd1, 0x00ba74aa, 0x00ba8b84,
+    0x00baa255, 0x00bab926, 0x00bacff8, 0x00bae6d2, 0x00bafda3, 0x00bb1474,
+    0x00bb2b45, 0x00bb4216, 0x00bb58e0, 0x00bb6fb1, 0x00bb868a, 0x00bb9d64,
+    0x00bbb435, 0x00bbcb06, 0x00bbe1d8, 0x00bbf8b2, 0x00bc0f83, 0x00bc2654,
+    0x00bc3d2d, 0x00bc5400, 0x00bc6ad1, 0x00bc81a2, 0x00bc987b, 0x00bcaf55,
+    0x00bcc626, 0x00bcdcf0, 0x00bcf3c9, 0x00bd0aa3, 0x00bd2174, 0x00bd3845,
+    0x00bd4f1e, 0x00bd65f1, 0x00bd7cc2, 0x00bd9393, 0x00bdaa6c, 0x00bdc146,
+    0x00bdd810, 0x00bdeee1, 0x00be05ba, 0x00be1c94, 0x00be3365, 0x00be4a36,
+    0x00be6108, 0x00be77e2, 0x00be8eb3, 0x00bea584, 0x00bebc5d, 0x00bed330,
+    0x00beea01, 0x00bf00d2, 0x00bf17ab, 0x00bf2e85, 0x00bf4556, 0x00bf5c20,
+    0x00bf72f9, 0x00bf89d3, 0x00bfa0a4, 0x00bfb775, 0x00bfce4e, 0x00bfe521,
+    0x00bffbf2, 0x00c012c3, 0x00c0299c, 0x00c04076, 0x00c05740, 0x00c06e11,
+    0x00c084ea, 0x00c09bc4, 0x00c0b295, 0x00c0c966, 0x00c0e038, 0x00c0f712,
+    0x00c10de3, 0x00c124b4, 0x00c13b8d, 0x00c15260, 0x00c16931, 0x00c18002,
+    0x00c196db, 0x00c1adb5, 0x00c1c486, 0x00c1db50, 0x00c1f229, 0x00c20903,
+    0x00c21fd4, 0x00c236a5, 0x00c24d7e, 0x00c26451, 0x00c27b22, 0x00c291f3,
+    0x00c2a8cc, 0x00c2bfa6, 0x00c2d670, 0x00c2ed41, 0x00c3041a, 0x00c31af4,
+    0x00c331c5, 0x00c34896, 0x00c35f68, 0x00c37642, 0x00c38d13, 0x00c3a3e4,
+    0x00c3babd, 0x00c3d190, 0x00c3e861, 0x00c3ff32, 0x00c41603, 0x00c42cd4,
+    0x00c443a5, 0x00c45a76, 0x00c47148, 0x00c48822, 0x00c49ef3, 0x00c4b5c4,
+    0x00c4cc9d, 0x00c4e370, 0x00c4fa41, 0x00c51112, 0x00c527eb, 0x00c53ec5,
+    0x00c55596, 0x00c56c60, 0x00c58339, 0x00c59a13, 0x00c5b0e4, 0x00c5c7b5,
+    0x00c5de8e, 0x00c5f561, 0x00c60c32, 0x00c62303, 0x00c639dc, 0x00c650b6,
+    0x00c66780, 0x00c67e51, 0x00c6952a, 0x00c6ac04, 0x00c6c2d5, 0x00c6d9a6,
+    0x00c6f078, 0x00c70752, 0x00c71e23, 0x00c734f4, 0x00c74bcd, 0x00c762a0,
+    0x00c77971, 0x00c79042, 0x00c7a71b, 0x00c7bdf5, 0x00c7d4c6, 0x00c7eb90,
+    0x00c80269, 0x00c81943, 0x00c83014, 0x00c846e5, 0x00c85dbe, 0x00c87491,
+    0x00c88b62, 0x00c8a233, 0x00c8b90c, 0x00c8cfe6, 0x00c8e6b0, 0x00c8fd81,
+    0x00c9145a, 0x00c92b34, 0x00c94205, 0x00c958d6, 0x00c96fa8, 0x00c98682,
+    0x00c99d53, 0x00c9b424, 0x00c9cafd, 0x00c9e1d0, 0x00c9f8a1, 0x00ca0f72,
+    0x00ca264b, 0x00ca3d25, 0x00ca53f6, 0x00ca6ac0, 0x00ca8199, 0x00ca9873,
+    0x00caaf44, 0x00cac615, 0x00cadcee, 0x00caf3c1, 0x00cb0a92, 0x00cb2163,
+    0x00cb383c, 0x00cb4f16, 0x00cb65e0, 0x00cb7cb1, 0x00cb938a, 0x00cbaa64,
+    0x00cbc135, 0x00cbd806, 0x00cbeed8, 0x00cc05b2, 0x00cc1c83, 0x00cc3354,
+    0x00cc4a2d, 0x00cc6100, 0x00cc77d1, 0x00cc8ea2, 0x00cca57b, 0x00ccbc55,
+    0x00ccd326, 0x00cce9f0, 0x00cd00c1, 0x00cd1792, 0x00cd2e63, 0x00cd4534,
+    0x00cd5c0d, 0x00cd72e0, 0x00cd89b1, 0x00cda082, 0x00cdb75b, 0x00cdce35,
+    0x00cde506, 0x00cdfbd0, 0x00ce12a9, 0x00ce2983, 0x00ce4054, 0x00ce5725,
+    0x00ce6dfe, 0x00ce84d1, 0x00ce9ba2, 0x00ceb273, 0x00cec94c, 0x00cee026,
+    0x00cef6f0, 0x00cf0dc1, 0x00cf249a, 0x00cf3b74, 0x00cf5245, 0x00cf6916,
+    0x00cf7fe8, 0x00cf96c2, 0x00cfad93, 0x00cfc464, 0x00cfdb3d, 0x00cff210,
+    0x00d008e1, 0x00d01fb2, 0x00d0368b, 0x00d04d65, 0x00d06436, 0x00d07b00,
+    0x00d091d9, 0x00d0a8b3, 0x00d0bf84, 0x00d0d655, 0x00d0ed2e, 0x00d10401,
+    0x00d11ad2, 0x00d131a3, 0x00d1487c, 0x00d15f56, 0x00d17620, 0x00d18cf1,
+    0x00d1a3ca, 0x00d1baa4, 0x00d1d175, 0x00d1e846, 0x00d1ff18, 0x00d215f2,
+    0x00d22cc3, 0x00d24394, 0x00d25a6d, 0x00d27140, 0x00d28811, 0x00d29ee2,
+    0x00d2b5bb, 0x00d2cc95, 0x00d2e366, 0x00d2fa30, 0x00d31109, 0x00d327e3,
+    0x00d33eb4, 0x00d35585, 0x00d36c5e, 0x00d38331, 0x00d39a02, 0x00d3b0d3,
+    0x00d3c7ac, 0x00d3de86, 0x00d3f550, 0x00d40c21, 0x00d422fa, 0x00d439d4,
+    0x00d450a5, 0x00d46776, 0x00d47e48, 0x00d49522, 0x00d4abf3, 0x00d4c2c4,
+    0x00d4d99d, 0x00d4f070, 0x00d50741, 0x00d51e12, 0x00d534eb, 0x00d54bc5,
+    0x00d56296, 0x00d57960, 0x00d59039, 0x00d5a713, 0x00d5bde4, 0x00d5d4b5,
+    0x00d5eb8e, 0x00d60261, 0x00d61932, 0x00d63003, 0x00d646dc, 0x00d65db6,
+    0x00d67480, 0x00d68b51, 0x00d6a22a, 0x00d6b904, 0x00d6cfd5, 0x00d6e6a6,
+    0x00d6fd78, 0x00d71452, 0x00d72b23, 0x00d741f4, 0x00d758cd, 0x00d76fa0,
+    0x00d78671, 0x00d79d42, 0x00d7b41b, 0x00d7caf5, 0x00d7e1c6, 0x00d7f890,
+    0x00d80f69, 0x00d82643, 0x00d83d14, 0x00d853e5, 0x00d86abe, 0x00d88191,
+    0x00d89862, 0x00d8af33, 0x00d8c60c, 0x00d8dce6, 0x00d8f3b0, 0x00d90a81,
+    0x00d9215a, 0x00d93834, 0x00d94f05, 0x00d965d6, 0x00d97ca8, 0x00d99382,
+    0x00d9aa53, 0x00d9c124, 0x00d9d7fd, 0x00d9eed0, 0x00da05a1, 0x00da1c72,
+    0x00da334b, 0x00da4a25, 0x00da60f6, 0x00da77c0, 0x00da8e99, 0x00daa573,
+    0x00dabc44, 0x00dad315, 0x00dae9ee, 0x00db00c1, 0x00db1792, 0x00db2e63,
+    0x00db453c, 0x00db5c16, 0x00db72e0, 0x00db89b1, 0x00dba08a, 0x00dbb764,
+    0x00dbce35, 0x00dbe506, 0x00dbfbd8, 0x00dc12b2, 0x00dc2983, 0x00dc4054,
+    0x00dc572d, 0x00dc6e00, 0x00dc84d1, 0x00dc9ba2, 0x00dcb27b, 0x00dcc955,
+    0x00dce026, 0x00dcf6f0, 0x00dd0dc9, 0x00dd24a3, 0x00dd3b74, 0x00dd5245,
+    0x00dd691e, 0x00dd7ff1, 0x00dd96c2, 0x00ddad93, 0x00ddc46c, 0x00dddb46,
+    0x00ddf210, 0x00de08e1, 0x00de1fba, 0x00de3694, 0x00de4d65, 0x00de6436,
+    0x00de7b08, 0x00de91e2, 0x00dea8b3, 0x00debf84, 0x00ded655, 0x00deed26,
+    0x00df03f0, 0x00df1ac1, 0x00df319a, 0x00df4874, 0x00df5f45, 0x00df7616,
+    0x00df8ce8, 0x00dfa3c2, 0x00dfba93, 0x00dfd164, 0x00dfe83d, 0x00dfff10,
+    0x00e015e1, 0x00e02cb2, 0x00e0438b, 0x00e05a65, 0x00e07136, 0x00e08800,
+    0x00e09ed9, 0x00e0b5b3, 0x00e0cc84, 0x00e0e355, 0x00e0fa2e, 0x00e11101,
+    0x00e127d2, 0x00e13ea3, 0x00e1557c, 0x00e16c56, 0x00e18320, 0x00e199f1,
+    0x00e1b0ca, 0x00e1c7a4, 0x00e1de75, 0x00e1f546, 0x00e20c18, 0x00e222f2,
+    0x00e239c3, 0x00e25094, 0x00e2676d, 0x00e27e40, 0x00e29511, 0x00e2abe2,
+    0x00e2c2bb, 0x00e2d995, 0x00e2f066, 0x00e30730, 0x00e31e09, 0x00e334e3,
+    0x00e34bb4, 0x00e36285, 0x00e3795e, 0x00e39031, 0x00e3a702, 0x00e3bdd3,
+    0x00e3d4ac, 0x00e3eb86, 0x00e40250, 0x00e41921, 0x00e42ffa, 0x00e446d4,
+    0x00e45da5, 0x00e47476, 0x00e48b48, 0x00e4a222, 0x00e4b8f3, 0x00e4cfc4,
+    0x00e4e69d, 0x00e4fd70, 0x00e51441, 0x00e52b12, 0x00e541eb, 0x00e558c5,
+    0x00e56f96, 0x00e58660, 0x00e59d39, 0x00e5b413, 0x00e5cae4, 0x00e5e1b5,
+    0x00e5f88e, 0x00e60f61, 0x00e62632, 0x00e63d03, 0x00e653dc, 0x00e66ab6,
+    0x00e68180, 0x00e69851, 0x00e6af2a, 0x00e6c604, 0x00e6dcd5, 0x00e6f3a6,
+    0x00e70a78, 0x00e72152, 0x00e73823, 0x00e74ef4, 0x00e765cd, 0x00e77ca0,
+    0x00e79371, 0x00e7aa42, 0x00e7c113, 0x00e7d7e4, 0x00e7eeb5, 0x00e80586,
+    0x00e81c58, 0x00e83332, 0x00e84a03, 0x00e860d4, 0x00e877ad, 0x00e88e80,
+    0x00e8a551, 0x00e8bc22, 0x00e8d2fb, 0x00e8e9d5, 0x00e900a6, 0x00e91770,
+    0x00e92e49, 0x00e94523, 0x00e95bf4, 0x00e972c5, 0x00e9899e, 0x00e9a071,
+    0x00e9b742, 0x00e9ce13, 0x00e9e4ec, 0x00e9fbc6, 0x00ea1290, 0x00ea2961,
+    0x00ea403a, 0x00ea5714, 0x00ea6de5, 0x00ea84b6, 0x00ea9b88, 0x00eab262,
+    0x00eac933, 0x00eae004, 0x00eaf6dd, 0x00eb0db0, 0x00eb2481, 0x00eb3b52,
+    0x00eb522b, 0x00eb6905, 0x00eb7fd6, 0x00eb96a0, 0x00ebad79, 0x00ebc453,
+    0x00ebdb24, 0x00ebf1f5, 0x00ec08ce, 0x00ec1fa1, 0x00ec3672, 0x00ec4d43,
+    0x00ec641c, 0x00ec7af6, 0x00ec91c0, 0x00eca891, 0x00ecbf6a, 0x00ecd644,
+    0x00eced15, 0x00ed03e6, 0x00ed1ab8, 0x00ed3192, 0x00ed4863, 0x00ed5f34,
+    0x00ed760d, 0x00ed8ce0, 0x00eda3b1, 0x00edba82, 0x00edd15b, 0x00ede835,
+    0x00edff06, 0x00ee15d0, 0x00ee2ca9, 0x00ee4383, 0x00ee5a54, 0x00ee7125,
+    0x00ee87fe, 0x00ee9ed1, 0x00eeb5a2, 0x00eecc73, 0x00eee34c, 0x00eefa26,
+    0x00ef10f0, 0x00ef27c1, 0x00ef3e9a, 0x00ef5574, 0x00ef6c45, 0x00ef8316,
+    0x00ef99e8, 0x00efb0c2, 0x00efc793, 0x00efde64, 0x00eff53d, 0x00f00c10,
+    0x00f022e1, 0x00f039b2, 0x00f0508b, 0x00f06765, 0x00f07e36, 0x00f09500,
+    0x00f0abd1, 0x00f0c2a2, 0x00f0d973, 0x00f0f044, 0x00f1071d, 0x00f11df0,
+    0x00f134c1, 0x00f14b92, 0x00f1626b, 0x00f17945, 0x00f19016, 0x00f1a6e0,
+    0x00f1bdb9, 0x00f1d493, 0x00f1eb64, 0x00f20235, 0x00f2190e, 0x00f22fe1,
+    0x00f246b2, 0x00f25d83, 0x00f2745c, 0x00f28b36, 0x00f2a200, 0x00f2b8d1,
+    0x00f2cfaa, 0x00f2e684, 0x00f2fd55, 0x00f31426, 0x00f32af8, 0x00f341d2,
+    0x00f358a3, 0x00f36f74, 0x00f3864d, 0x00f39d20, 0x00f3b3f1, 0x00f3cac2,
+    0x00f3e19b, 0x00f3f875, 0x00f40f46, 0x00f42610, 0x00f43ce9, 0x00f453c3,
+    0x00f46a94, 0x00f48165, 0x00f4983e, 0x00f4af11, 0x00f4c5e2, 0x00f4dcb3,
+    0x00f4f38c, 0x00f50a66, 0x00f52130, 0x00f53801, 0x00f54eda, 0x00f565b4,
+    0x00f57c85, 0x00f59356, 0x00f5aa28, 0x00f5c102, 0x00f5d7d3, 0x00f5eea4,
+    0x00f6057d, 0x00f61c50, 0x00f63321, 0x00f649f2, 0x00f660cb, 0x00f677a5,
+    0x00f68e76, 0x00f6a540, 0x00f6bc19, 0x00f6d2f3, 0x00f6e9c4, 0x00f70095,
+    0x00f7176e, 0x00f72e41, 0x00f74512, 0x00f75be3, 0x00f772bc, 0x00f78996,
+    0x00f7a060, 0x00f7b731, 0x00f7ce0a, 0x00f7e4e4, 0x00f7fbb5, 0x00f81286,
+    0x00f82958, 0x00f84032, 0x00f85703, 0x00f86dd4, 0x00f884ad, 0x00f89b80,
+    0x00f8b251, 0x00f8c922, 0x00f8dffb, 0x00f8f6d5, 0x00f90da6, 0x00f92470,
+    0x00f93b49, 0x00f95223, 0x00f968f4, 0x00f97fc5, 0x00f9969e, 0x00f9ad71,
+    0x00f9c442, 0x00f9db13, 0x00f9f1ec, 0x00fa08c6, 0x00fa1f90, 0x00fa3661,
+    0x00fa4d3a, 0x00fa6414, 0x00fa7ae5, 0x00fa91b6, 0x00faa888, 0x00fabf62,
+    0x00fad633, 0x00faed04, 0x00fb03dd, 0x00fb1ab0, 0x00fb3181, 0x00fb4852,
+    0x00fb5f2b, 0x00fb7605, 0x00fb8cd6, 0x00fba3a0, 0x00fbba79, 0x00fbd153,
+    0x00fbe824, 0x00fbfef5, 0x00fc15ce, 0x00fc2ca1, 0x00fc4372, 0x00fc5a43,
+    0x00fc711c, 0x00fc87f6, 0x00fc9ec0, 0x00fcb591, 0x00fccc6a, 0x00fce344,
+    0x00fcfa15, 0x00fd10e6, 0x00fd27b8, 0x00fd3e92, 0x00fd5563, 0x00fd6c34,
+    0x00fd830d, 0x00fd99e0, 0x00fdb0b1, 0x00fdc782, 0x00fdde5b, 0x00fdf535,
+    0x00fe0c06, 0x00fe22d0, 0x00fe39a9, 0x00fe5083, 0x00fe6754, 0x00fe7e25,
+    0x00fe94fe, 0x00feabd1, 0x00fec2a2, 0x00fed973, 0x00fef04c, 0x00ff0726,
+    0x00ff1df0, 0x00ff34c1, 0x00ff4b9a, 0x00ff6274, 0x00ff7945, 0x00ff9016,
+    0x00ffa6e8, 0x00ffbdc2, 0x00ffd493, 0x00ffeb64, 0x0100023d, 0x01001910,
+    0x01002fe1, 0x010046b2, 0x01005d8b, 0x01007465, 0x01008b36, 0x0100a200,
+    0x0100b8d9, 0x0100cfb3, 0x0100e684, 0x0100fd55, 0x0101142e, 0x01012b01,
+    0x010141d2, 0x010158a3, 0x01016f7c, 0x01018656, 0x01019d20, 0x0101b3f1,
+    0x0101caca, 0x0101e1a4, 0x0101f875, 0x01020f46, 0x01022618, 0x01023cf2,
+    0x010253c3, 0x01026a94, 0x01028165, 0x01029836, 0x0102af00, 0x0102c5d1,
+    0x0102dcaa, 0x0102f384, 0x01030a55, 0x01032126, 0x010337f8, 0x01034ed2,
+    0x010365a3, 0x01037c74, 0x0103934d, 0x0103aa20, 0x0103c0f1, 0x0103d7c2,
+    0x0103ee9b, 0x01040575, 0x01041c46, 0x01043310, 0x010449e9, 0x010460c3,
+    0x01047794, 0x01048e65, 0x0104a53e, 0x0104bc11, 0x0104d2e2, 0x0104e9b3,
+    0x0105008c, 0x01051766, 0x01052e30, 0x01054501, 0x01055bda, 0x010572b4,
+    0x01058985, 0x0105a056, 0x0105b728, 0x0105ce02, 0x0105e4d3, 0x0105fba4,
+    0x0106127d, 0x01062950, 0x01064021, 0x010656f2, 0x01066dcb, 0x010684a5,
+    0x01069b76, 0x0106b240, 0x0106c919, 0x0106dff3, 0x0106f6c4, 0x01070d95,
+    0x0107246e, 0x01073b41, 0x01075212, 0x010768e3, 0x01077fbc, 0x01079696,
+    0x0107ad60, 0x0107c431, 0x0107db0a, 0x0107f1e4, 0x010808b5, 0x01081f86,
+    0x01083658, 0x01084d32, 0x01086403, 0x01087ad4, 0x010891ad, 0x0108a880,
+    0x0108bf51, 0x0108d622, 0x0108ecfb, 0x010903d5, 0x01091aa6, 0x01093170,
+    0x01094849, 0x01095f23, 0x010975f4, 0x01098cc5, 0x0109a39e, 0x0109ba71,
+    0x0109d142, 0x0109e813, 0x0109feec, 0x010a15c6, 0x010a2c90, 0x010a4361,
+    0x010a5a3a, 0x010a7114, 0x010a87e5, 0x010a9eb6, 0x010ab588, 0x010acc62,
+    0x010ae333, 0x010afa04, 0x010b10dd, 0x010b27b0, 0x010b3e81, 0x010b5552,
+    0x010b6c23, 0x010b82f4, 0x010b99c5, 0x010bb096, 0x010bc768, 0x010bde42,
+    0x010bf513, 0x010c0be4, 0x010c22bd, 0x010c3990, 0x010c5061, 0x010c6732,
+    0x010c7e0b, 0x010c94e5, 0x010cabb6, 0x010cc280, 0x010cd959, 0x010cf033,
+    0x010d0704, 0x010d1dd5, 0x010d34ae, 0x010d4b81, 0x010d6252, 0x010d7923,
+    0x010d8ffc, 0x010da6d6, 0x010dbda0, 0x010dd471, 0x010deb4a, 0x010e0224,
+    0x010e18f5, 0x010e2fc6, 0x010e4698, 0x010e5d72, 0x010e7443, 0x010e8b14,
+    0x010ea1ed, 0x010eb8c0, 0x010ecf91, 0x010ee662, 0x010efd3b, 0x010f1415,
+    0x010f2ae6, 0x010f41b0, 0x010f5889, 0x010f6f63, 0x010f8634, 0x010f9d05,
+    0x010fb3de, 0x010fcab1, 0x010fe182, 0x010ff853, 0x01100f2c, 0x01102606,
+    0x01103cd0, 0x011053a1, 0x01106a7a, 0x01108154, 0x01109825, 0x0110aef6,
+    0x0110c5c8, 0x0110dca2, 0x0110f373, 0x01110a44, 0x0111211d, 0x011137f0,
+    0x01114ec1, 0x01116592, 0x01117c6b, 0x01119345, 0x0111aa16, 0x0111c0e0,
+    0x0111d7b9, 0x0111ee93, 0x01120564, 0x01121c35, 0x0112330e, 0x011249e1,
+    0x011260b2, 0x01127783, 0x01128e5c, 0x0112a536, 0x0112bc00, 0x0112d2d1,
+    0x0112e9aa, 0x01130084, 0x01131755, 0x01132e26, 0x011344f8, 0x01135bd2,
+    0x011372a3, 0x01138974, 0x0113a04d, 0x0113b720, 0x0113cdf1, 0x0113e4c2,
+    0x0113fb9b, 0x01141275, 0x01142946, 0x01144010, 0x011456e1, 0x01146db2,
+    0x01148483, 0x01149b54, 0x0114b22d, 0x0114c900, 0x0114dfd1, 0x0114f6a2,
+    0x01150d7b, 0x01152455, 0x01153b26, 0x011551f0, 0x011568c9, 0x01157fa3,
+    0x01159674, 0x0115ad45, 0x0115c41e, 0x0115daf1, 0x0115f1c2, 0x01160893,
+    0x01161f6c, 0x01163646, 0x01164d10, 0x011663e1, 0x01167aba, 0x01169194,
+    0x0116a865, 0x0116bf36, 0x0116d608, 0x0116ece2, 0x011703b3, 0x01171a84,
+    0x0117315d, 0x01174830, 0x01175f01, 0x011775d2, 0x01178cab, 0x0117a385,
+    0x0117ba56, 0x0117d120, 0x0117e7f9, 0x0117fed3, 0x011815a4, 0x01182c75,
+    0x0118434e, 0x01185a21, 0x011870f2, 0x011887c3, 0x01189e9c, 0x0118b576,
+    0x0118cc40, 0x0118e311, 0x0118f9ea, 0x011910c4, 0x01192795, 0x01193e66,
+    0x01195538, 0x01196c12, 0x011982e3, 0x011999b4, 0x0119b08d, 0x0119c760,
+    0x0119de31, 0x0119f502, 0x011a0bdb, 0x011a22b5, 0x011a3986, 0x011a5050,
+    0x011a6729, 0x011a7e03, 0x011a94d4, 0x011aaba5, 0x011ac27e, 0x011ad951,
+    0x011af022, 0x011b06f3, 0x011b1dcc, 0x011b34a6, 0x011b4b70, 0x011b6241,
+    0x011b791a, 0x011b8ff4, 0x011ba6c5, 0x011bbd96, 0x011bd468, 0x011beb42,
+    0x011c0213, 0x011c18e4, 0x011c2fbd, 0x011c4690, 0x011c5d61, 0x011c7432,
+    0x011c8b0b, 0x011ca1e5, 0x011cb8b6, 0x011ccf80, 0x011ce659, 0x011cfd33,
+    0x011d1404, 0x011d2ad5, 0x011d41ae, 0x011d5881, 0x011d6f52, 0x011d8623,
+    0x011d9cfc, 0x011db3d6, 0x011dcaa0, 0x011de171, 0x011df84a, 0x011e0f24,
+    0x011e25f5, 0x011e3cc6, 0x011e5398, 0x011e6a72, 0x011e8143, 0x011e9814,
+    0x011eaeed, 0x011ec5c0, 0x011edc91, 0x011ef362, 0x011f0a3b, 0x011f2115,
+    0x011f37e6, 0x011f4eb0, 0x011f6589, 0x011f7c63, 0x011f9334, 0x011faa05,
+    0x011fc0de, 0x011fd7b1, 0x011fee82, 0x01200553, 0x01201c2c, 0x01203306,
+    0x012049d0, 0x012060a1, 0x0120777a, 0x01208e54, 0x0120a525, 0x0120bbf6,
+    0x0120d2c8, 0x0120e9a2, 0x01210073, 0x01211744, 0x01212e1d, 0x012144f0,
+    0x01215bc1, 0x01217292, 0x0121896b, 0x0121a045, 0x0121b716, 0x0121cde0,
+    0x0121e4b9, 0x0121fb93, 0x01221264, 0x01222935, 0x0122400e, 0x012256e1,
+    0x01226db2, 0x01228483, 0x01229b5c, 0x0122b236, 0x0122c900, 0x0122dfd1,
+    0x0122f6aa, 0x01230d84, 0x01232455, 0x01233b26, 0x012351f8, 0x012368d2,
+    0x01237fa3, 0x01239674, 0x0123ad4d, 0x0123c420, 0x0123daf1, 0x0123f1c2,
+    0x0124089b, 0x01241f75, 0x01243646, 0x01244d10, 0x012463e9, 0x01247ac3,
+    0x01249194, 0x0124a865, 0x0124bf3e, 0x0124d611, 0x0124ece2, 0x012503b3,
+    0x01251a8c, 0x01253166, 0x01254830, 0x01255f01, 0x012575da, 0x01258cb4,
+    0x0125a385, 0x0125ba56, 0x0125d128, 0x0125e802, 0x0125fed3, 0x012615a4,
+    0x01262c75, 0x01264346, 0x01265a10, 0x012670e1, 0x012687ba, 0x01269e94,
+    0x0126b565, 0x0126cc36, 0x0126e308, 0x0126f9e2, 0x012710b3, 0x01272784,
+    0x01273e5d, 0x01275530, 0x01276c01, 0x012782d2, 0x012799ab, 0x0127b085,
+    0x0127c756, 0x0127de20, 0x0127f4f9, 0x01280bd3, 0x012822a4, 0x01283975,
+    0x0128504e, 0x01286721, 0x01287df2, 0x012894c3, 0x0128ab9c, 0x0128c276,
+    0x0128d940, 0x0128f011, 0x012906ea, 0x01291dc4, 0x01293495, 0x01294b66,
+    0x01296238, 0x01297912, 0x01298fe3, 0x0129a6b4, 0x0129bd8d, 0x0129d460,
+    0x0129eb31, 0x012a0202, 0x012a18db, 0x012a2fb5, 0x012a4686, 0x012a5d50,
+    0x012a7429, 0x012a8b03, 0x012aa1d4, 0x012ab8a5, 0x012acf7e, 0x012ae651,
+    0x012afd22, 0x012b13f3, 0x012b2acc, 0x012b41a6, 0x012b5870, 0x012b6f41,
+    0x012b861a, 0x012b9cf4, 0x012bb3c5, 0x012bca96, 0x012be168, 0x012bf842,
+    0x012c0f13, 0x012c25e4, 0x012c3cbd, 0x012c5390, 0x012c6a61, 0x012c8132,
+    0x012c980b, 0x012caee5, 0x012cc5b6, 0x012cdc80, 0x012cf359, 0x012d0a33,
+    0x012d2104, 0x012d37d5, 0x012d4eae, 0x012d6581, 0x012d7c52, 0x012d9323,
+    0x012da9fc, 0x012dc0d6, 0x012dd7a0, 0x012dee71, 0x012e054a, 0x012e1c24,
+    0x012e32f5, 0x012e49c6, 0x012e6098, 0x012e7772, 0x012e8e43, 0x012ea514,
+    0x012ebbed, 0x012ed2c0, 0x012ee991, 0x012f0062, 0x012f1733, 0x012f2e04,
+    0x012f44d5, 0x012f5ba6, 0x012f7278, 0x012f8952, 0x012fa023, 0x012fb6f4,
+    0x012fcdcd, 0x012fe4a0, 0x012ffb71, 0x01301242, 0x0130291b, 0x01303ff5,
+    0x013056c6, 0x01306d90, 0x01308469, 0x01309b43, 0x0130b214, 0x0130c8e5,
+    0x0130dfbe, 0x0130f691, 0x01310d62, 0x01312433, 0x01313b0c, 0x013151e6,
+    0x013168b0, 0x01317f81, 0x0131965a, 0x0131ad34, 0x0131c405, 0x0131dad6,
+    0x0131f1a8, 0x01320882, 0x01321f53, 0x01323624, 0x01324cfd, 0x013263d0,
+    0x01327aa1, 0x01329172, 0x0132a84b, 0x0132bf25, 0x0132d5f6, 0x0132ecc0,
+    0x01330399, 0x01331a73, 0x01333144, 0x01334815, 0x01335eee, 0x013375c1,
+    0x01338c92, 0x0133a363, 0x0133ba3c, 0x0133d116, 0x0133e7e0, 0x0133feb1,
+    0x0134158a, 0x01342c64, 0x01344335, 0x01345a06, 0x013470d8, 0x013487b2,
+    0x01349e83, 0x0134b554, 0x0134cc2d, 0x0134e300, 0x0134f9d1, 0x013510a2,
+    0x0135277b, 0x01353e55, 0x01355526, 0x01356bf0, 0x013582c9, 0x013599a3,
+    0x0135b074, 0x0135c745, 0x0135de1e, 0x0135f4f1, 0x01360bc2, 0x01362293,
+    0x0136396c, 0x01365046, 0x01366710, 0x01367de1, 0x013694ba, 0x0136ab94,
+    0x0136c265, 0x0136d936, 0x0136f008, 0x013706e2, 0x01371db3, 0x01373484,
+    0x01374b5d, 0x01376230, 0x01377901, 0x01378fd2, 0x0137a6ab, 0x0137bd85,
+    0x0137d456, 0x0137eb20, 0x013801f1, 0x013818c2, 0x01382f93, 0x01384664,
+    0x01385d3d, 0x01387410, 0x01388ae1, 0x0138a1b2, 0x0138b88b, 0x0138cf65,
+    0x0138e636, 0x0138fd00, 0x013913d9, 0x01392ab3, 0x01394184, 0x01395855,
+    0x01396f2e, 0x01398601, 0x01399cd2, 0x0139b3a3, 0x0139ca7c, 0x0139e156,
+    0x0139f820, 0x013a0ef1, 0x013a25ca, 0x013a3ca4, 0x013a5375, 0x013a6a46,
+    0x013a8118, 0x013a97f2, 0x013aaec3, 0x013ac594, 0x013adc6d, 0x013af340,
+    0x013b0a11, 0x013b20e2, 0x013b37bb, 0x013b4e95, 0x013b6566, 0x013b7c30,
+    0x013b9309, 0x013ba9e3, 0x013bc0b4, 0x013bd785, 0x013bee5e, 0x013c0531,
+    0x013c1c02, 0x013c32d3, 0x013c49ac, 0x013c6086, 0x013c7750, 0x013c8e21,
+    0x013ca4fa, 0x013cbbd4, 0x013cd2a5, 0x013ce976, 0x013d0048, 0x013d1722,
+    0x013d2df3, 0x013d44c4, 0x013d5b9d, 0x013d7270, 0x013d8941, 0x013da012,
+    0x013db6eb, 0x013dcdc5, 0x013de496, 0x013dfb60, 0x013e1239, 0x013e2913,
+    0x013e3fe4, 0x013e56b5, 0x013e6d8e, 0x013e8461, 0x013e9b32, 0x013eb203,
+    0x013ec8dc, 0x013edfb6, 0x013ef680, 0x013f0d51, 0x013f242a, 0x013f3b04,
+    0x013f51d5, 0x013f68a6, 0x013f7f78, 0x013f9652, 0x013fad23, 0x013fc3f4,
+    0x013fdacd, 0x013ff1a0, 0x01400871, 0x01401f42, 0x0140361b, 0x01404cf5,
+    0x014063c6, 0x01407a90, 0x01409169, 0x0140a843, 0x0140bf14, 0x0140d5e5,
+    0x0140ecbe, 0x01410391, 0x01411a62, 0x01413133, 0x0141480c, 0x01415ee6,
+    0x014175b0, 0x01418c81, 0x0141a35a, 0x0141ba34, 0x0141d105, 0x0141e7d6,
+    0x0141fea8, 0x01421582, 0x01422c53, 0x01424324, 0x014259fd, 0x014270d0,
+    0x014287a1, 0x01429e72, 0x0142b54b, 0x0142cc25, 0x0142e2f6, 0x0142f9c0,
+    0x01431099, 0x01432773, 0x01433e44, 0x01435515, 0x01436bee, 0x014382c1,
+    0x01439992, 0x0143b063, 0x0143c73c, 0x0143de16, 0x0143f4e0, 0x01440bb1,
+    0x0144228a, 0x01443964, 0x01445035, 0x01446706, 0x01447dd8, 0x014494b2,
+    0x0144ab83, 0x0144c254, 0x0144d92d, 0x0144f000, 0x014506d1, 0x01451da2,
+    0x0145347b, 0x01454b55, 0x01456226, 0x014578f0, 0x01458fc9, 0x0145a6a3,
+    0x0145bd74, 0x0145d445, 0x0145eb1e, 0x014601f1, 0x014618c2, 0x01462f93,
+    0x0146466c, 0x01465d46, 0x01467410, 0x01468ae1, 0x0146a1ba, 0x0146b894,
+    0x0146cf65, 0x0146e636, 0x0146fd08, 0x014713e2, 0x01472ab3, 0x01474184,
+    0x0147585d, 0x01476f30, 0x01478601, 0x01479cd2, 0x0147b3ab, 0x0147ca85,
+    0x0147e156, 0x0147f820, 0x01480ef9, 0x014825d3, 0x01483ca4, 0x01485375,
+    0x01486a4e, 0x01488121, 0x014897f2, 0x0148aec3, 0x0148c59c, 0x0148dc76,
+    0x0148f340, 0x01490a11, 0x014920ea, 0x014937c4, 0x01494e95, 0x01496566,
+    0x01497c38, 0x01499312, 0x0149a9e3, 0x0149c0b4, 0x0149d785, 0x0149ee56,
+    0x014a0520, 0x014a1bf1, 0x014a32ca, 0x014a49a4, 0x014a6075, 0x014a7746,
+    0x014a8e18, 0x014aa4f2, 0x014abbc3, 0x014ad294, 0x014ae96d, 0x014b0040,
+    0x014b1711, 0x014b2de2, 0x014b44bb, 0x014b5b95, 0x014b7266, 0x014b8930,
+    0x014ba009, 0x014bb6e3, 0x014bcdb4, 0x014be485, 0x014bfb5e, 0x014c1231,
+    0x014c2902, 0x014c3fd3, 0x014c56ac, 0x014c6d86, 0x014c8450, 0x014c9b21,
+    0x014cb1fa, 0x014cc8d4, 0x014cdfa5, 0x014cf676, 0x014d0d48, 0x014d2422,
+    0x014d3af3, 0x014d51c4, 0x014d689d, 0x014d7f70, 0x014d9641, 0x014dad12,
+    0x014dc3eb, 0x014ddac5, 0x014df196, 0x014e0860, 0x014e1f39, 0x014e3613,
+    0x014e4ce4, 0x014e63b5, 0x014e7a8e, 0x014e9161, 0x014ea832, 0x014ebf03,
+    0x014ed5dc, 0x014eecb6, 0x014f0380, 0x014f1a51, 0x014f312a, 0x014f4804,
+    0x014f5ed5, 0x014f75a6, 0x014f8c78, 0x014fa352, 0x014fba23, 0x014fd0f4,
+    0x014fe7cd, 0x014ffea0, 0x01501571, 0x01502c42, 0x0150431b, 0x015059f5,
+    0x015070c6, 0x01508790, 0x01509e69, 0x0150b543, 0x0150cc14, 0x0150e2e5,
+    0x0150f9be, 0x01511091, 0x01512762, 0x01513e33, 0x0151550c, 0x01516be6,
+    0x015182b0, 0x01519981, 0x0151b05a, 0x0151c734, 0x0151de05, 0x0151f4d6,
+    0x01520ba8, 0x01522282, 0x01523953, 0x01525024, 0x015266fd, 0x01527dd0,
+    0x015294a1, 0x0152ab72, 0x0152c243, 0x0152d914, 0x0152efe5, 0x015306b6,
+    0x01531d88, 0x01533462, 0x01534b33, 0x01536204, 0x015378dd, 0x01538fb0,
+    0x0153a681, 0x0153bd52, 0x0153d42b, 0x0153eb05, 0x015401d6, 0x015418a0,
+    0x01542f79, 0x01544653, 0x01545d24, 0x015473f5, 0x01548ace, 0x0154a1a1,
+    0x0154b872, 0x0154cf43, 0x0154e61c, 0x0154fcf6, 0x015513c0, 0x01552a91,
+    0x0155416a, 0x01555844, 0x01556f15, 0x015585e6, 0x01559cb8, 0x0155b392,
+    0x0155ca63, 0x0155e134, 0x0155f80d, 0x01560ee0, 0x015625b1, 0x01563c82,
+    0x0156535b, 0x01566a35, 0x01568106, 0x015697d0, 0x0156aea9, 0x0156c583,
+    0x0156dc54, 0x0156f325, 0x015709fe, 0x015720d1, 0x015737a2, 0x01574e73,
+    0x0157654c, 0x01577c26, 0x015792f0, 0x0157a9c1, 0x0157c09a, 0x0157d774,
+    0x0157ee45, 0x01580516, 0x01581be8, 0x015832c2, 0x01584993, 0x01586064,
+    0x0158773d, 0x01588e10, 0x0158a4e1, 0x0158bbb2, 0x0158d28b, 0x0158e965,
+    0x01590036, 0x01591700, 0x01592dd9, 0x015944b3, 0x01595b84, 0x01597255,
+    0x0159892e, 0x0159a001, 0x0159b6d2, 0x0159cda3, 0x0159e47c, 0x0159fb56,
+    0x015a1220, 0x015a28f1, 0x015a3fca, 0x015a56a4, 0x015a6d75, 0x015a8446,
+    0x015a9b18, 0x015ab1f2, 0x015ac8c3, 0x015adf94, 0x015af66d, 0x015b0d40,
+    0x015b2411, 0x015b3ae2, 0x015b51bb, 0x015b6895, 0x015b7f66, 0x015b9630,
+    0x015bad01, 0x015bc3d2, 0x015bdaa3, 0x015bf174, 0x015c084d, 0x015c1f20,
+    0x015c35f1, 0x015c4cc2, 0x015c639b, 0x015c7a75, 0x015c9146, 0x015ca810,
+    0x015cbee9, 0x015cd5c3, 0x015cec94, 0x015d0365, 0x015d1a3e, 0x015d3111,
+    0x015d47e2, 0x015d5eb3, 0x015d758c, 0x015d8c66, 0x015da330, 0x015dba01,
+    0x015dd0da, 0x015de7b4, 0x015dfe85, 0x015e1556, 0x015e2c28, 0x015e4302,
+    0x015e59d3, 0x015e70a4, 0x015e877d, 0x015e9e50, 0x015eb521, 0x015ecbf2,
+    0x015ee2cb, 0x015ef9a5, 0x015f1076, 0x015f2740, 0x015f3e19, 0x015f54f3,
+    0x015f6bc4, 0x015f8295, 0x015f996e, 0x015fb041, 0x015fc712, 0x015fdde3,
+    0x015ff4bc, 0x01600b96, 0x01602260, 0x01603931, 0x0160500a, 0x016066e4,
+    0x01607db5, 0x01609486, 0x0160ab58, 0x0160c232, 0x0160d903, 0x0160efd4,
+    0x016106ad, 0x01611d80, 0x01613451, 0x01614b22, 0x016161fb, 0x016178d5,
+    0x01618fa6, 0x0161a670, 0x0161bd49, 0x0161d423, 0x0161eaf4, 0x016201c5,
+    0x0162189e, 0x01622f71, 0x01624642, 0x01625d13, 0x016273ec, 0x01628ac6,
+    0x0162a190, 0x0162b861, 0x0162cf3a, 0x0162e614, 0x0162fce5, 0x016313b6,
+    0x01632a88, 0x01634162, 0x01635833, 0x01636f04, 0x016385dd, 0x01639cb0,
+    0x0163b381, 0x0163ca52, 0x0163e12b, 0x0163f805, 0x01640ed6, 0x016425a0,
+    0x01643c79, 0x01645353, 0x01646a24, 0x016480f5, 0x016497ce, 0x0164aea1,
+    0x0164c572, 0x0164dc43, 0x0164f31c, 0x016509f6, 0x016520c0, 0x01653791,
+    0x01654e6a, 0x01656544, 0x01657c15, 0x016592e6, 0x0165a9b8, 0x0165c092,
+    0x0165d763, 0x0165ee34, 0x0166050d, 0x01661be0, 0x016632b1, 0x01664982,
+    0x0166605b, 0x01667735, 0x01668e06, 0x0166a4d0, 0x0166bba9, 0x0166d283,
+    0x0166e954, 0x01670025, 0x016716fe, 0x01672dd1, 0x016744a2, 0x01675b73,
+    0x0167724c, 0x01678926, 0x01679ff0, 0x0167b6c1, 0x0167cd9a, 0x0167e474,
+    0x0167fb45, 0x01681216, 0x016828e8, 0x01683fc2, 0x01685693, 0x01686d64,
+    0x0168843d, 0x01689b10, 0x0168b1e1, 0x0168c8b2, 0x0168df8b, 0x0168f665,
+    0x01690d36, 0x01692400, 0x01693ad9, 0x016951b3, 0x01696884, 0x01697f55,
+    0x0169962e, 0x0169ad01, 0x0169c3d2, 0x0169daa3, 0x0169f17c, 0x016a0856,
+    0x016a1f20, 0x016a35f1, 0x016a4cca, 0x016a63a4, 0x016a7a75, 0x016a9146,
+    0x016aa818, 0x016abef2, 0x016ad5c3, 0x016aec94, 0x016b036d, 0x016b1a40,
+    0x016b3111, 0x016b47e2, 0x016b5ebb, 0x016b7595, 0x016b8c66, 0x016ba330,
+    0x016bba09, 0x016bd0e3, 0x016be7b4, 0x016bfe85, 0x016c155e, 0x016c2c31,
+    0x016c4302, 0x016c59d3, 0x016c70ac, 0x016c8786, 0x016c9e50, 0x016cb521,
+    0x016ccbfa, 0x016ce2d4, 0x016cf9a5, 0x016d1076, 0x016d2748, 0x016d3e22,
+    0x016d54f3, 0x016d6bc4, 0x016d8295, 0x016d9966, 0x016db030, 0x016dc701,
+    0x016dddda, 0x016df4b4, 0x016e0b85, 0x016e2256, 0x016e3928, 0x016e5002,
+    0x016e66d3, 0x016e7da4, 0x016e947d, 0x016eab50, 0x016ec221, 0x016ed8f2,
+    0x016eefcb, 0x016f06a5, 0x016f1d76, 0x016f3440, 0x016f4b19, 0x016f61f3,
+    0x016f78c4, 0x016f8f95, 0x016fa66e, 0x016fbd41, 0x016fd412, 0x016feae3,
+    0x017001bc, 0x01701896, 0x01702f60, 0x01704631, 0x01705d0a, 0x017073e4,
+    0x01708ab5, 0x0170a186, 0x0170b858, 0x0170cf32, 0x0170e603, 0x0170fcd4,
+    0x017113ad, 0x01712a80, 0x01714151, 0x01715822, 0x01716efb, 0x017185d5,
+    0x01719ca6, 0x0171b370, 0x0171ca49, 0x0171e123, 0x0171f7f4, 0x01720ec5,
+    0x0172259e, 0x01723c71, 0x01725342, 0x01726a13, 0x017280ec, 0x017297c6,
+    0x0172ae90, 0x0172c561, 0x0172dc3a, 0x0172f314, 0x017309e5, 0x017320b6,
+    0x01733788, 0x01734e62, 0x01736533, 0x01737c04, 0x017392dd, 0x0173a9b0,
+    0x0173c081, 0x0173d752, 0x0173ee2b, 0x01740505, 0x01741bd6, 0x017432a0,
+    0x01744979, 0x01746053, 0x01747724, 0x01748df5, 0x0174a4ce, 0x0174bba1,
+    0x0174d272, 0x0174e943, 0x0175001c, 0x017516f6, 0x01752dc0, 0x01754491,
+    0x01755b6a, 0x01757244, 0x01758915, 0x01759fe6, 0x0175b6b8, 0x0175cd92,
+    0x0175e463, 0x0175fb34, 0x0176120d, 0x017628e0, 0x01763fb1, 0x01765682,
+    0x01766d53, 0x01768424, 0x01769af5, 0x0176b1c6, 0x0176c898, 0x0176df72,
+    0x0176f643, 0x01770d14, 0x017723ed, 0x01773ac0, 0x01775191, 0x01776862,
+    0x01777f3b, 0x01779615, 0x0177ace6, 0x0177c3b0, 0x0177da89, 0x0177f163,
+    0x01780834, 0x01781f05, 0x017835de, 0x01784cb1, 0x01786382, 0x01787a53,
+    0x0178912c, 0x0178a806, 0x0178bed0, 0x0178d5a1, 0x0178ec7a, 0x01790354,
+    0x01791a25, 0x017930f6, 0x017947c8, 0x01795ea2, 0x01797573, 0x01798c44,
+    0x0179a31d, 0x0179b9f0, 0x0179d0c1, 0x0179e792, 0x0179fe6b, 0x017a1545,
+    0x017a2c16, 0x017a42e0, 0x017a59b9, 0x017a7093, 0x017a8764, 0x017a9e35,
+    0x017ab50e, 0x017acbe1, 0x017ae2b2, 0x017af983, 0x017b105c, 0x017b2736,
+    0x017b3e00, 0x017b54d1, 0x017b6baa, 0x017b8284, 0x017b9955, 0x017bb026,
+    0x017bc6f8, 0x017bddd2, 0x017bf4a3, 0x017c0b74, 0x017c224d, 0x017c3920,
+    0x017c4ff1, 0x017c66c2, 0x017c7d9b, 0x017c9475, 0x017cab46, 0x017cc210,
+    0x017cd8e9, 0x017cefc3, 0x017d0694, 0x017d1d65, 0x017d343e, 0x017d4b11,
+    0x017d61e2, 0x017d78b3, 0x017d8f8c, 0x017da666, 0x017dbd30, 0x017dd401,
+    0x017deada, 0x017e01b4, 0x017e1885, 0x017e2f56, 0x017e4628, 0x017e5d02,
+    0x017e73d3, 0x017e8aa4, 0x017ea17d, 0x017eb850, 0x017ecf21, 0x017ee5f2,
+    0x017efccb, 0x017f13a5, 0x017f2a76, 0x017f4140, 0x017f5811, 0x017f6ee2,
+    0x017f85b3, 0x017f9c84, 0x017fb35d, 0x017fca30, 0x017fe101, 0x017ff7d2,
+    0x01800eab, 0x01802585, 0x01803c56, 0x01805320, 0x018069f9, 0x018080d3,
+    0x018097a4, 0x0180ae75, 0x0180c54e, 0x0180dc21, 0x0180f2f2, 0x018109c3,
+    0x0181209c, 0x01813776, 0x01814e40, 0x01816511, 0x01817bea, 0x018192c4,
+    0x0181a995, 0x0181c066, 0x0181d738, 0x0181ee12, 0x018204e3, 0x01821bb4,
+    0x0182328d, 0x01824960, 0x01826031, 0x01827702, 0x01828ddb, 0x0182a4b5,
+    0x0182bb86, 0x0182d250, 0x0182e929, 0x01830003, 0x018316d4, 0x01832da5,
+    0x0183447e, 0x01835b51, 0x01837222, 0x018388f3, 0x01839fcc, 0x0183b6a6,
+    0x0183cd70, 0x0183e441, 0x0183fb1a, 0x018411f4, 0x018428c5, 0x01843f96,
+    0x01845668, 0x01846d42, 0x01848413, 0x01849ae4, 0x0184b1bd, 0x0184c890,
+    0x0184df61, 0x0184f632, 0x01850d0b, 0x018523e5, 0x01853ab6, 0x01855180,
+    0x01856859, 0x01857f33, 0x01859604, 0x0185acd5, 0x0185c3ae, 0x0185da81,
+    0x0185f152, 0x01860823, 0x01861efc, 0x018635d6, 0x01864ca0, 0x01866371,
+    0x01867a4a, 0x01869124, 0x0186a7f5, 0x0186bec6, 0x0186d598, 0x0186ec72,
+    0x01870343, 0x01871a14, 0x018730ed, 0x018747c0, 0x01875e91, 0x01877562,
+    0x01878c3b, 0x0187a315, 0x0187b9e6, 0x0187d0b0, 0x0187e789, 0x0187fe63,
+    0x01881534, 0x01882c05, 0x018842de, 0x018859b1, 0x01887082, 0x01888753,
+    0x01889e2c, 0x0188b506, 0x0188cbd0, 0x0188e2a1, 0x0188f97a, 0x01891054,
+    0x01892725, 0x01893df6, 0x018954c8, 0x01896ba2, 0x01898273, 0x01899944,
+    0x0189b01d, 0x0189c6f0, 0x0189ddc1, 0x0189f492, 0x018a0b6b, 0x018a2245,
+    0x018a3916, 0x018a4fe0, 0x018a66b9, 0x018a7d93, 0x018a9464, 0x018aab35,
+    0x018ac20e, 0x018ad8e1, 0x018aefb2, 0x018b0683, 0x018b1d5c, 0x018b3436,
+    0x018b4b00, 0x018b61d1, 0x018b78aa, 0x018b8f84, 0x018ba655, 0x018bbd26,
+    0x018bd3f8, 0x018bead2, 0x018c01a3, 0x018c1874, 0x018c2f4d, 0x018c4620,
+    0x018c5cf1, 0x018c73c2, 0x018c8a9b, 0x018ca175, 0x018cb846, 0x018ccf10,
+    0x018ce5e9, 0x018cfcc3, 0x018d1394, 0x018d2a65, 0x018d413e, 0x018d5811,
+    0x018d6ee2, 0x018d85b3, 0x018d9c8c, 0x018db366, 0x018dca30, 0x018de101,
+    0x018df7da, 0x018e0eb4, 0x018e2585, 0x018e3c56, 0x018e5328, 0x018e6a02,
+    0x018e80d3, 0x018e97a4, 0x018eae7d, 0x018ec550, 0x018edc21, 0x018ef2f2,
+    0x018f09cb, 0x018f20a5, 0x018f3776, 0x018f4e40, 0x018f6519, 0x018f7bf3,
+    0x018f92c4, 0x018fa995, 0x018fc06e, 0x018fd741, 0x018fee12, 0x019004e3,
+    0x01901bbc, 0x01903296, 0x01904960, 0x01906031, 0x0190770a, 0x01908de4,
+    0x0190a4b5, 0x0190bb86, 0x0190d258, 0x0190e932, 0x01910003, 0x019116d4,
+    0x01912da5, 0x01914476, 0x01915b40, 0x01917211, 0x019188ea, 0x01919fc4,
+    0x0191b695, 0x0191cd66, 0x0191e438, 0x0191fb12, 0x019211e3, 0x019228b4,
+    0x01923f8d, 0x01925660, 0x01926d31, 0x01928402, 0x01929adb, 0x0192b1b5,
+    0x0192c886, 0x0192df50, 0x0192f629, 0x01930d03, 0x019323d4, 0x01933aa5,
+    0x0193517e, 0x01936851, 0x01937f22, 0x019395f3, 0x0193accc, 0x0193c3a6,
+    0x0193da70, 0x0193f141, 0x0194081a, 0x01941ef4, 0x019435c5, 0x01944c96,
+    0x01946368, 0x01947a42, 0x01949113, 0x0194a7e4, 0x0194bebd, 0x0194d590,
+    0x0194ec61, 0x01950332, 0x01951a0b, 0x019530e5, 0x019547b6, 0x01955e80,
+    0x01957559, 0x01958c33, 0x0195a304, 0x0195b9d5, 0x0195d0ae, 0x0195e781,
+    0x0195fe52, 0x01961523, 0x01962bfc, 0x019642d6, 0x019659a0, 0x01967071,
+    0x0196874a, 0x01969e24, 0x0196b4f5, 0x0196cbc6, 0x0196e298, 0x0196f972,
+    0x01971043, 0x01972714, 0x01973ded, 0x019754c0, 0x01976b91, 0x01978262,
+    0x0197993b, 0x0197b015, 0x0197c6e6, 0x0197ddb0, 0x0197f489, 0x01980b63,
+    0x01982234, 0x01983905, 0x01984fde, 0x019866b1, 0x01987d82, 0x01989453,
+    0x0198ab2c, 0x0198c206, 0x0198d8d0, 0x0198efa1, 0x0199067a, 0x01991d54,
+    0x01993425, 0x01994af6, 0x019961c8, 0x019978a2, 0x01998f73, 0x0199a644,
+    0x0199bd1d, 0x0199d3f0, 0x0199eac1, 0x019a0192, 0x019a1863, 0x019a2f34,
+    0x019a4605, 0x019a5cd6, 0x019a73a8, 0x019a8a82, 0x019aa153, 0x019ab824,
+    0x019acefd, 0x019ae5d0, 0x019afca1, 0x019b1372, 0x019b2a4b, 0x019b4125,
+    0x019b57f6, 0x019b6ec0, 0x019b8599, 0x019b9c73, 0x019bb344, 0x019bca15,
+    0x019be0ee, 0x019bf7c1, 0x019c0e92, 0x019c2563, 0x019c3c3c, 0x019c5316,
+    0x019c69e0, 0x019c80b1, 0x019c978a, 0x019cae64, 0x019cc535, 0x019cdc06,
+    0x019cf2d8, 0x019d09b2, 0x019d2083, 0x019d3754, 0x019d4e2d, 0x019d6500,
+    0x019d7bd1, 0x019d92a2, 0x019da97b, 0x019dc055, 0x019dd726, 0x019dedf0,
+    0x019e04c9, 0x019e1ba3, 0x019e3274, 0x019e4945, 0x019e601e, 0x019e76f1,
+    0x019e8dc2, 0x019ea493, 0x019ebb6c, 0x019ed246, 0x019ee910, 0x019effe1,
+    0x019f16ba, 0x019f2d94, 0x019f4465, 0x019f5b36, 0x019f7208, 0x019f88e2,
+    0x019f9fb3, 0x019fb684, 0x019fcd5d, 0x019fe430, 0x019ffb01, 0x01a011d2,
+    0x01a028ab, 0x01a03f85, 0x01a05656, 0x01a06d20, 0x01a083f9, 0x01a09ad3,
+    0x01a0b1a4, 0x01a0c875, 0x01a0df4e, 0x01a0f621, 0x01a10cf2, 0x01a123c3,
+    0x01a13a9c, 0x01a15176, 0x01a16840, 0x01a17f11, 0x01a195ea, 0x01a1acc4,
+    0x01a1c395, 0x01a1da66, 0x01a1f138, 0x01a20812, 0x01a21ee3, 0x01a235b4,
+    0x01a24c8d, 0x01a26360, 0x01a27a31, 0x01a29102, 0x01a2a7db, 0x01a2beb5,
+    0x01a2d586, 0x01a2ec50, 0x01a30321, 0x01a319f2, 0x01a330c3, 0x01a34794,
+    0x01a35e6d, 0x01a37540, 0x01a38c11, 0x01a3a2e2, 0x01a3b9bb, 0x01a3d095,
+    0x01a3e766, 0x01a3fe30, 0x01a41509, 0x01a42be3, 0x01a442b4, 0x01a45985,
+    0x01a4705e, 0x01a48731, 0x01a49e02, 0x01a4b4d3, 0x01a4cbac, 0x01a4e286,
+    0x01a4f950, 0x01a51021, 0x01a526fa, 0x01a53dd4, 0x01a554a5, 0x01a56b76,
+    0x01a58248, 0x01a59922, 0x01a5aff3, 0x01a5c6c4, 0x01a5dd9d, 0x01a5f470,
+    0x01a60b41, 0x01a62212, 0x01a638eb, 0x01a64fc5, 0x01a66696, 0x01a67d60,
+    0x01a69439, 0x01a6ab13, 0x01a6c1e4, 0x01a6d8b5, 0x01a6ef8e, 0x01a70661,
+    0x01a71d32, 0x01a73403, 0x01a74adc, 0x01a761b6, 0x01a77880, 0x01a78f51,
+    0x01a7a62a, 0x01a7bd04, 0x01a7d3d5, 0x01a7eaa6, 0x01a80178, 0x01a81852,
+    0x01a82f23, 0x01a845f4, 0x01a85ccd, 0x01a873a0, 0x01a88a71, 0x01a8a142,
+    0x01a8b81b, 0x01a8cef5, 0x01a8e5c6, 0x01a8fc90, 0x01a91369, 0x01a92a43,
+    0x01a94114, 0x01a957e5, 0x01a96ebe, 0x01a98591, 0x01a99c62, 0x01a9b333,
+    0x01a9ca0c, 0x01a9e0e6, 0x01a9f7b0, 0x01aa0e81, 0x01aa255a, 0x01aa3c34,
+    0x01aa5305, 0x01aa69d6, 0x01aa80a8, 0x01aa9782, 0x01aaae53, 0x01aac524,
+    0x01aadbfd, 0x01aaf2d0, 0x01ab09a1, 0x01ab2072, 0x01ab374b, 0x01ab4e25,
+    0x01ab64f6, 0x01ab7bc0, 0x01ab9299, 0x01aba973, 0x01abc044, 0x01abd715,
+    0x01abedee, 0x01ac04c1, 0x01ac1b92, 0x01ac3263, 0x01ac493c, 0x01ac6016,
+    0x01ac76e0, 0x01ac8db1, 0x01aca48a, 0x01acbb64, 0x01acd235, 0x01ace906,
+    0x01acffd8, 0x01ad16b2, 0x01ad2d83, 0x01ad4454, 0x01ad5b2d, 0x01ad7200,
+    0x01ad88d1, 0x01ad9fa2, 0x01adb67b, 0x01adcd55, 0x01ade426, 0x01adfaf0,
+    0x01ae11c9, 0x01ae28a3, 0x01ae3f74, 0x01ae5645, 0x01ae6d1e, 0x01ae83f1,
+    0x01ae9ac2, 0x01aeb193, 0x01aec86c, 0x01aedf46, 0x01aef610, 0x01af0ce1,
+    0x01af23ba, 0x01af3a94, 0x01af5165, 0x01af6836, 0x01af7f08, 0x01af95e2,
+    0x01afacb3, 0x01afc384, 0x01afda5d, 0x01aff130, 0x01b00801, 0x01b01ed2,
+    0x01b035ab, 0x01b04c85, 0x01b06356, 0x01b07a20, 0x01b090f9, 0x01b0a7d3,
+    0x01b0bea4, 0x01b0d575, 0x01b0ec4e, 0x01b10321, 0x01b119f2, 0x01b130c3,
+    0x01b1479c, 0x01b15e76, 0x01b17540, 0x01b18c11, 0x01b1a2ea, 0x01b1b9c4,
+    0x01b1d095, 0x01b1e766, 0x01b1fe38, 0x01b21512, 0x01b22be3, 0x01b242b4,
+    0x01b2598d, 0x01b27060, 0x01b28731, 0x01b29e02, 0x01b2b4db, 0x01b2cbb5,
+    0x01b2e286, 0x01b2f950, 0x01b31029, 0x01b32703, 0x01b33dd4, 0x01b354a5,
+    0x01b36b7e, 0x01b38251, 0x01b39922, 0x01b3aff3, 0x01b3c6cc, 0x01b3dda6,
+    0x01b3f470, 0x01b40b41, 0x01b4221a, 0x01b438f4, 0x01b44fc5, 0x01b46696,
+    0x01b47d68, 0x01b49442, 0x01b4ab13, 0x01b4c1e4, 0x01b4d8b5, 0x01b4ef86,
+    0x01b50650, 0x01b51d21, 0x01b533fa, 0x01b54ad4, 0x01b561a5, 0x01b57876,
+    0x01b58f48, 0x01b5a622, 0x01b5bcf3, 0x01b5d3c4, 0x01b5ea9d, 0x01b60170,
+    0x01b61841, 0x01b62f12, 0x01b645eb, 0x01b65cc5, 0x01b67396, 0x01b68a60,
+    0x01b6a139, 0x01b6b813, 0x01b6cee4, 0x01b6e5b5, 0x01b6fc8e, 0x01b71361,
+    0x01b72a32, 0x01b74103, 0x01b757dc, 0x01b76eb6, 0x01b78580, 0x01b79c51,
+    0x01b7b32a, 0x01b7ca04, 0x01b7e0d5, 0x01b7f7a6, 0x01b80e78, 0x01b82552,
+    0x01b83c23, 0x01b852f4, 0x01b869cd, 0x01b880a0, 0x01b89771, 0x01b8ae42,
+    0x01b8c51b, 0x01b8dbf5, 0x01b8f2c6, 0x01b90990, 0x01b92069, 0x01b93743,
+    0x01b94e14, 0x01b964e5, 0x01b97bbe, 0x01b99291, 0x01b9a962, 0x01b9c033,
+    0x01b9d70c, 0x01b9ede6, 0x01ba04b0, 0x01ba1b81, 0x01ba325a, 0x01ba4934,
+    0x01ba6005, 0x01ba76d6, 0x01ba8da8, 0x01baa482, 0x01babb53, 0x01bad224,
+    0x01bae8fd, 0x01baffd0, 0x01bb16a1, 0x01bb2d72, 0x01bb444b, 0x01bb5b25,
+    0x01bb71f6, 0x01bb88c0, 0x01bb9f99, 0x01bbb673, 0x01bbcd44, 0x01bbe415,
+    0x01bbfaee, 0x01bc11c1, 0x01bc2892, 0x01bc3f63, 0x01bc563c, 0x01bc6d16,
+    0x01bc83e0, 0x01bc9ab1, 0x01bcb18a, 0x01bcc864, 0x01bcdf35, 0x01bcf606,
+    0x01bd0cd8, 0x01bd23b2, 0x01bd3a83, 0x01bd5154, 0x01bd682d, 0x01bd7f00,
+    0x01bd95d1, 0x01bdaca2, 0x01bdc373, 0x01bdda44, 0x01bdf115, 0x01be07e6,
+    0x01be1eb8, 0x01be3592, 0x01be4c63, 0x01be6334, 0x01be7a0d, 0x01be90e0,
+    0x01bea7b1, 0x01bebe82, 0x01bed55b, 0x01beec35, 0x01bf0306, 0x01bf19d0,
+    0x01bf30a9, 0x01bf4783, 0x01bf5e54, 0x01bf7525, 0x01bf8bfe, 0x01bfa2d1,
+    0x01bfb9a2, 0x01bfd073, 0x01bfe74c, 0x01bffe26, 0x01c014f0, 0x01c02bc1,
+    0x01c0429a, 0x01c05974, 0x01c07045, 0x01c08716, 0x01c09de8, 0x01c0b4c2,
+    0x01c0cb93, 0x01c0e264, 0x01c0f93d, 0x01c11010, 0x01c126e1, 0x01c13db2,
+    0x01c1548b, 0x01c16b65, 0x01c18236, 0x01c19900, 0x01c1afd9, 0x01c1c6b3,
+    0x01c1dd84, 0x01c1f455, 0x01c20b2e, 0x01c22201, 0x01c238d2, 0x01c24fa3,
+    0x01c2667c, 0x01c27d56, 0x01c29420, 0x01c2aaf1, 0x01c2c1ca, 0x01c2d8a4,
+    0x01c2ef75, 0x01c30646, 0x01c31d18, 0x01c333f2, 0x01c34ac3, 0x01c36194,
+    0x01c3786d, 0x01c38f40, 0x01c3a611, 0x01c3bce2, 0x01c3d3bb, 0x01c3ea95,
+    0x01c40166, 0x01c41830, 0x01c42f09, 0x01c445e3, 0x01c45cb4, 0x01c47385,
+    0x01c48a5e, 0x01c4a131, 0x01c4b802, 0x01c4ced3, 0x01c4e5ac, 0x01c4fc86,
+    0x01c51350, 0x01c52a21, 0x01c540fa, 0x01c557d4, 0x01c56ea5, 0x01c58576,
+    0x01c59c48, 0x01c5b322, 0x01c5c9f3, 0x01c5e0c4, 0x01c5f79d, 0x01c60e70,
+    0x01c62541, 0x01c63c12, 0x01c652eb, 0x01c669c5, 0x01c68096, 0x01c69760,
+    0x01c6ae31, 0x01c6c502, 0x01c6dbd3, 0x01c6f2a4, 0x01c7097d, 0x01c72050,
+    0x01c73721, 0x01c74df2, 0x01c764cb, 0x01c77ba5, 0x01c79276, 0x01c7a940,
+    0x01c7c019, 0x01c7d6f3, 0x01c7edc4, 0x01c80495, 0x01c81b6e, 0x01c83241,
+    0x01c84912, 0x01c85fe3, 0x01c876bc, 0x01c88d96, 0x01c8a460, 0x01c8bb31,
+    0x01c8d20a, 0x01c8e8e4, 0x01c8ffb5, 0x01c91686, 0x01c92d58, 0x01c94432,
+    0x01c95b03, 0x01c971d4, 0x01c988ad, 0x01c99f80, 0x01c9b651, 0x01c9cd22,
+    0x01c9e3fb, 0x01c9fad5, 0x01ca11a6, 0x01ca2870, 0x01ca3f49, 0x01ca5623,
+    0x01ca6cf4, 0x01ca83c5, 0x01ca9a9e, 0x01cab171, 0x01cac842, 0x01cadf13,
+    0x01caf5ec, 0x01cb0cc6, 0x01cb2390, 0x01cb3a61, 0x01cb513a, 0x01cb6814,
+    0x01cb7ee5, 0x01cb95b6, 0x01cbac88, 0x01cbc362, 0x01cbda33, 0x01cbf104,
+    0x01cc07dd, 0x01cc1eb0, 0x01cc3581, 0x01cc4c52, 0x01cc632b, 0x01cc7a05,
+    0x01cc90d6, 0x01cca7a0, 0x01ccbe79, 0x01ccd553, 0x01ccec24, 0x01cd02f5,
+    0x01cd19ce, 0x01cd30a1, 0x01cd4772, 0x01cd5e43, 0x01cd751c, 0x01cd8bf6,
+    0x01cda2c0, 0x01cdb991, 0x01cdd06a, 0x01cde744, 0x01cdfe15, 0x01ce14e6,
+    0x01ce2bb8, 0x01ce4292, 0x01ce5963, 0x01ce7034, 0x01ce870d, 0x01ce9de0,
+    0x01ceb4b1, 0x01cecb82, 0x01cee25b, 0x01cef935, 0x01cf1006, 0x01cf26d0,
+    0x01cf3da9, 0x01cf5483, 0x01cf6b54, 0x01cf8225, 0x01cf98fe, 0x01cfafd1,
+    0x01cfc6a2, 0x01cfdd73, 0x01cff44c, 0x01d00b26, 0x01d021f0, 0x01d038c1,
+    0x01d04f9a, 0x01d06674, 0x01d07d45, 0x01d09416, 0x01d0aae8, 0x01d0c1c2,
+    0x01d0d893, 0x01d0ef64, 0x01d1063d, 0x01d11d10, 0x01d133e1, 0x01d14ab2,
+    0x01d1618b, 0x01d17865, 0x01d18f36, 0x01d1a600, 0x01d1bcd9, 0x01d1d3b3,
+    0x01d1ea84, 0x01d20155, 0x01d2182e, 0x01d22f01, 0x01d245d2, 0x01d25ca3,
+    0x01d2737c, 0x01d28a56, 0x01d2a120, 0x01d2b7f1, 0x01d2ceca, 0x01d2e5a4,
+    0x01d2fc75, 0x01d31346, 0x01d32a18, 0x01d340f2, 0x01d357c3, 0x01d36e94,
+    0x01d3856d, 0x01d39c40, 0x01d3b311, 0x01d3c9e2, 0x01d3e0bb, 0x01d3f795,
+    0x01d40e66, 0x01d42530, 0x01d43c09, 0x01d452e3, 0x01d469b4, 0x01d48085,
+    0x01d4975e, 0x01d4ae31, 0x01d4c502, 0x01d4dbd3, 0x01d4f2ac, 0x01d50986,
+    0x01d52050, 0x01d53721, 0x01d54dfa, 0x01d564d4, 0x01d57ba5, 0x01d59276,
+    0x01d5a948, 0x01d5c022, 0x01d5d6f3, 0x01d5edc4, 0x01d6049d, 0x01d61b70,
+    0x01d63241, 0x01d64912, 0x01d65feb, 0x01d676c5, 0x01d68d96, 0x01d6a460,
+    0x01d6bb39, 0x01d6d213, 0x01d6e8e4, 0x01d6ffb5, 0x01d7168e, 0x01d72d61,
+    0x01d74432, 0x01d75b03, 0x01d771dc, 0x01d788b6, 0x01d79f80, 0x01d7b651,
+    0x01d7cd2a, 0x01d7e404, 0x01d7fad5, 0x01d811a6, 0x01d82878, 0x01d83f52,
+    0x01d85623, 0x01d86cf4, 0x01d883c5, 0x01d89a96, 0x01d8b160, 0x01d8c831,
+    0x01d8df0a, 0x01d8f5e4, 0x01d90cb5, 0x01d92386, 0x01d93a58, 0x01d95132,
+    0x01d96803, 0x01d97ed4, 0x01d995ad, 0x01d9ac80, 0x01d9c351, 0x01d9da22,
+    0x01d9f0fb, 0x01da07d5, 0x01da1ea6, 0x01da3570, 0x01da4c49, 0x01da6323,
+    0x01da79f4, 0x01da90c5, 0x01daa79e, 0x01dabe71, 0x01dad542, 0x01daec13,
+    0x01db02ec, 0x01db19c6, 0x01db3090, 0x01db4761, 0x01db5e3a, 0x01db7514,
+    0x01db8be5, 0x01dba2b6, 0x01dbb988, 0x01dbd062, 0x01dbe733, 0x01dbfe04,
+    0x01dc14dd, 0x01dc2bb0, 0x01dc4281, 0x01dc5952, 0x01dc702b, 0x01dc8705,
+    0x01dc9dd6, 0x01dcb4a0, 0x01dccb79, 0x01dce253, 0x01dcf924, 0x01dd0ff5,
+    0x01dd26ce, 0x01dd3da1, 0x01dd5472, 0x01dd6b43, 0x01dd821c, 0x01dd98f6,
+    0x01ddafc0, 0x01ddc691, 0x01dddd6a, 0x01ddf444, 0x01de0b15, 0x01de21e6,
+    0x01de38b8, 0x01de4f92, 0x01de6663, 0x01de7d34, 0x01de940d, 0x01deaae0,
+    0x01dec1b1, 0x01ded882, 0x01deef5b, 0x01df0635, 0x01df1d06, 0x01df33d0,
+    0x01df4aa9, 0x01df6183, 0x01df7854, 0x01df8f25, 0x01dfa5fe, 0x01dfbcd1,
+    0x01dfd3a2, 0x01dfea73, 0x01e0014c, 0x01e01826, 0x01e02ef0, 0x01e045c1,
+    0x01e05c9a, 0x01e07374, 0x01e08a45, 0x01e0a116, 0x01e0b7e8, 0x01e0cec2,
+    0x01e0e593, 0x01e0fc64, 0x01e1133d, 0x01e12a10, 0x01e140e1, 0x01e157b2,
+    0x01e16e83, 0x01e18554, 0x01e19c25, 0x01e1b2f6, 0x01e1c9c8, 0x01e1e0a2,
+    0x01e1f773, 0x01e20e44, 0x01e2251d, 0x01e23bf0, 0x01e252c1, 0x01e26992,
+    0x01e2806b, 0x01e29745, 0x01e2ae16, 0x01e2c4e0, 0x01e2dbb9, 0x01e2f293,
+    0x01e30964, 0x01e32035, 0x01e3370e, 0x01e34de1, 0x01e364b2, 0x01e37b83,
+    0x01e3925c, 0x01e3a936, 0x01e3c000, 0x01e3d6d1, 0x01e3edaa, 0x01e40484,
+    0x01e41b55, 0x01e43226, 0x01e448f8, 0x01e45fd2, 0x01e476a3, 0x01e48d74,
+    0x01e4a44d, 0x01e4bb20, 0x01e4d1f1, 0x01e4e8c2, 0x01e4ff9b, 0x01e51675,
+    0x01e52d46, 0x01e54410, 0x01e55ae9, 0x01e571c3, 0x01e58894, 0x01e59f65,
+    0x01e5b63e, 0x01e5cd11, 0x01e5e3e2, 0x01e5fab3, 0x01e6118c, 0x01e62866,
+    0x01e63f30, 0x01e65601, 0x01e66cda, 0x01e683b4, 0x01e69a85, 0x01e6b156,
+    0x01e6c828, 0x01e6df02, 0x01e6f5d3, 0x01e70ca4, 0x01e7237d, 0x01e73a50,
+    0x01e75121, 0x01e767f2, 0x01e77ecb, 0x01e795a5, 0x01e7ac76, 0x01e7c340,
+    0x01e7da19, 0x01e7f0f3, 0x01e807c4, 0x01e81e95, 0x01e8356e, 0x01e84c41,
+    0x01e86312, 0x01e879e3, 0x01e890bc, 0x01e8a796, 0x01e8be60, 0x01e8d531,
+    0x01e8ec0a, 0x01e902e4, 0x01e919b5, 0x01e93086, 0x01e94758, 0x01e95e32,
+    0x01e97503, 0x01e98bd4, 0x01e9a2ad, 0x01e9b980, 0x01e9d051, 0x01e9e722,
+    0x01e9fdfb, 0x01ea14d5, 0x01ea2ba6, 0x01ea4270, 0x01ea5941, 0x01ea7012,
+    0x01ea86e3, 0x01ea9db4, 0x01eab48d, 0x01eacb60, 0x01eae231, 0x01eaf902,
+    0x01eb0fdb, 0x01eb26b5, 0x01eb3d86, 0x01eb5450, 0x01eb6b29, 0x01eb8203,
+    0x01eb98d4, 0x01ebafa5, 0x01ebc67e, 0x01ebdd51, 0x01ebf422, 0x01ec0af3,
+    0x01ec21cc, 0x01ec38a6, 0x01ec4f70, 0x01ec6641, 0x01ec7d1a, 0x01ec93f4,
+    0x01ecaac5, 0x01ecc196, 0x01ecd868, 0x01ecef42, 0x01ed0613, 0x01ed1ce4,
+    0x01ed33bd, 0x01ed4a90, 0x01ed6161, 0x01ed7832, 0x01ed8f0b, 0x01eda5e5,
+    0x01edbcb6, 0x01edd380, 0x01edea59, 0x01ee0133, 0x01ee1804, 0x01ee2ed5,
+    0x01ee45ae, 0x01ee5c81, 0x01ee7352, 0x01ee8a23, 0x01eea0fc, 0x01eeb7d6,
+    0x01eecea0, 0x01eee571, 0x01eefc4a, 0x01ef1324, 0x01ef29f5, 0x01ef40c6,
+    0x01ef5798, 0x01ef6e72, 0x01ef8543, 0x01ef9c14, 0x01efb2ed, 0x01efc9c0,
+    0x01efe091, 0x01eff762, 0x01f00e3b, 0x01f02515, 0x01f03be6, 0x01f052b0,
+    0x01f06989, 0x01f08063, 0x01f09734, 0x01f0ae05, 0x01f0c4de, 0x01f0dbb1,
+    0x01f0f282, 0x01f10953, 0x01f1202c, 0x01f13706, 0x01f14dd0, 0x01f164a1,
+    0x01f17b7a, 0x01f19254, 0x01f1a925, 0x01f1bff6, 0x01f1d6c8, 0x01f1eda2,
+    0x01f20473, 0x01f21b44, 0x01f2321d, 0x01f248f0, 0x01f25fc1, 0x01f27692,
+    0x01f28d6b, 0x01f2a445, 0x01f2bb16, 0x01f2d1e0, 0x01f2e8b9, 0x01f2ff93,
+    0x01f31664, 0x01f32d35, 0x01f3440e, 0x01f35ae1, 0x01f371b2, 0x01f38883,
+    0x01f39f5c, 0x01f3b636, 0x01f3cd00, 0x01f3e3d1, 0x01f3faaa, 0x01f41184,
+    0x01f42855, 0x01f43f26, 0x01f455f8, 0x01f46cd2, 0x01f483a3, 0x01f49a74,
+    0x01f4b14d, 0x01f4c820, 0x01f4def1, 0x01f4f5c2, 0x01f50c9b, 0x01f52375,
+    0x01f53a46, 0x01f55110, 0x01f567e9, 0x01f57ec3, 0x01f59594, 0x01f5ac65,
+    0x01f5c33e, 0x01f5da11, 0x01f5f0e2, 0x01f607b3, 0x01f61e8c, 0x01f63566,
+    0x01f64c30, 0x01f66301, 0x01f679da, 0x01f690b4, 0x01f6a785, 0x01f6be56,
+    0x01f6d528, 0x01f6ec02, 0x01f702d3, 0x01f719a4, 0x01f7307d, 0x01f74750,
+    0x01f75e21, 0x01f774f2, 0x01f78bcb, 0x01f7a2a5, 0x01f7b976, 0x01f7d040,
+    0x01f7e719, 0x01f7fdf3, 0x01f814c4, 0x01f82b95, 0x01f8426e, 0x01f85941,
+    0x01f87012, 0x01f886e3, 0x01f89dbc, 0x01f8b496, 0x01f8cb60, 0x01f8e231,
+    0x01f8f90a, 0x01f90fe4, 0x01f926b5, 0x01f93d86, 0x01f95458, 0x01f96b32,
+    0x01f98203, 0x01f998d4, 0x01f9afad, 0x01f9c680, 0x01f9dd51, 0x01f9f422,
+    0x01fa0afb, 0x01fa21d5, 0x01fa38a6, 0x01fa4f70, 0x01fa6649, 0x01fa7d23,
+    0x01fa93f4, 0x01faaac5, 0x01fac19e, 0x01fad871, 0x01faef42, 0x01fb0613,
+    0x01fb1cec, 0x01fb33c6, 0x01fb4a90, 0x01fb6161, 0x01fb783a, 0x01fb8f14,
+    0x01fba5e5, 0x01fbbcb6, 0x01fbd388, 0x01fbea62, 0x01fc0133, 0x01fc1804,
+    0x01fc2ed5, 0x01fc45a6, 0x01fc5c70, 0x01fc7341, 0x01fc8a1a, 0x01fca0f4,
+    0x01fcb7c5, 0x01fcce96, 0x01fce568, 0x01fcfc42, 0x01fd1313, 0x01fd29e4,
+    0x01fd40bd, 0x01fd5790, 0x01fd6e61, 0x01fd8532, 0x01fd9c0b, 0x01fdb2e5,
+    0x01fdc9b6, 0x01fde080, 0x01fdf759, 0x01fe0e33, 0x01fe2504, 0x01fe3bd5,
+    0x01fe52ae, 0x01fe6981, 0x01fe8052, 0x01fe9723, 0x01feadfc, 0x01fec4d6,
+    0x01fedba0, 0x01fef271, 0x01ff094a, 0x01ff2024, 0x01ff36f5, 0x01ff4dc6,
+    0x01ff6498, 0x01ff7b72, 0x01ff9243, 0x01ffa914, 0x01ffbfed, 0x01ffd6c0,
+    0x01ffed91, 0x02000462, 0x02001b3b, 0x02003215, 0x020048e6, 0x02005fb0,
+    0x02007689, 0x02008d63, 0x0200a434, 0x0200bb05, 0x0200d1de, 0x0200e8b1,
+    0x0200ff82, 0x02011653, 0x02012d2c, 0x02014406, 0x02015ad0, 0x020171a1,
+    0x0201887a, 0x02019f54, 0x0201b625, 0x0201ccf6, 0x0201e3c8, 0x0201faa2,
+    0x02021173, 0x02022844, 0x02023f1d, 0x020255f0, 0x02026cc1, 0x02028392,
+    0x02029a6b, 0x0202b145, 0x0202c816, 0x0202dee0, 0x0202f5b9, 0x02030c93,
+    0x02032364, 0x02033a35, 0x0203510e, 0x020367e1, 0x02037eb2, 0x02039583,
+    0x0203ac5c, 0x0203c336, 0x0203da00, 0x0203f0d1, 0x020407aa, 0x02041e84,
+    0x02043555, 0x02044c26, 0x020462f8, 0x020479d2, 0x020490a3, 0x0204a774,
+    0x0204be4d, 0x0204d520, 0x0204ebf1, 0x020502c2, 0x02051993, 0x02053064,
+    0x02054735, 0x02055e06, 0x020574d8, 0x02058bb2, 0x0205a283, 0x0205b954,
+    0x0205d02d, 0x0205e700, 0x0205fdd1, 0x020614a2, 0x02062b7b, 0x02064255,
+    0x02065926, 0x02066ff0, 0x020686c9, 0x02069da3, 0x0206b474, 0x0206cb45,
+    0x0206e21e, 0x0206f8f1, 0x02070fc2, 0x02072693, 0x02073d6c, 0x02075446,
+    0x02076b10, 0x020781e1, 0x020798ba, 0x0207af94, 0x0207c665, 0x0207dd36,
+    0x0207f408, 0x02080ae2, 0x020821b3, 0x02083884, 0x02084f5d, 0x02086630,
+    0x02087d01, 0x020893d2, 0x0208aaab, 0x0208c185, 0x0208d856, 0x0208ef20,
+    0x020905f9, 0x02091cd3, 0x020933a4, 0x02094a75, 0x0209614e, 0x02097821,
+    0x02098ef2, 0x0209a5c3, 0x0209bc9c, 0x0209d376, 0x0209ea40, 0x020a0111,
+    0x020a17ea, 0x020a2ec4, 0x020a4595, 0x020a5c66, 0x020a7338, 0x020a8a12,
+    0x020aa0e3, 0x020ab7b4, 0x020ace8d, 0x020ae560, 0x020afc31, 0x020b1302,
+    0x020b29db, 0x020b40b5, 0x020b5786, 0x020b6e50, 0x020b8529, 0x020b9c03,
+    0x020bb2d4, 0x020bc9a5, 0x020be07e, 0x020bf751, 0x020c0e22, 0x020c24f3,
+    0x020c3bcc, 0x020c52a6, 0x020c6970, 0x020c8041, 0x020c971a, 0x020cadf4,
+    0x020cc4c5, 0x020cdb96, 0x020cf268, 0x020d0942, 0x020d2013, 0x020d36e4,
+    0x020d4dbd, 0x020d6490, 0x020d7b61, 0x020d9232, 0x020da90b, 0x020dbfe5,
+    0x020dd6b6, 0x020ded80, 0x020e0451, 0x020e1b22, 0x020e31f3, 0x020e48c4,
+    0x020e5f9d, 0x020e7670, 0x020e8d41, 0x020ea412, 0x020ebaeb, 0x020ed1c5,
+    0x020ee896, 0x020eff60, 0x020f1639, 0x020f2d13, 0x020f43e4, 0x020f5ab5,
+    0x020f718e, 0x020f8861, 0x020f9f32, 0x020fb603, 0x020fccdc, 0x020fe3b6,
+    0x020ffa80, 0x02101151, 0x0210282a, 0x02103f04, 0x021055d5, 0x02106ca6,
+    0x02108378, 0x02109a52, 0x0210b123, 0x0210c7f4, 0x0210decd, 0x0210f5a0,
+    0x02110c71, 0x02112342, 0x02113a1b, 0x021150f5, 0x021167c6, 0x02117e90,
+    0x02119569, 0x0211ac43, 0x0211c314, 0x0211d9e5, 0x0211f0be, 0x02120791,
+    0x02121e62, 0x02123533, 0x02124c0c, 0x021262e6, 0x021279b0, 0x02129081,
+    0x0212a75a, 0x0212be34, 0x0212d505, 0x0212ebd6, 0x021302a8, 0x02131982,
+    0x02133053, 0x02134724, 0x02135dfd, 0x021374d0, 0x02138ba1, 0x0213a272,
+    0x0213b94b, 0x0213d025, 0x0213e6f6, 0x0213fdc0, 0x02141499, 0x02142b73,
+    0x02144244, 0x02145915, 0x02146fee, 0x021486c1, 0x02149d92, 0x0214b463,
+    0x0214cb3c, 0x0214e216, 0x0214f8e0, 0x02150fb1, 0x0215268a, 0x02153d64,
+    0x02155435, 0x02156b06, 0x021581d8, 0x021598b2, 0x0215af83, 0x0215c654,
+    0x0215dd2d, 0x0215f400, 0x02160ad1, 0x021621a2, 0x0216387b, 0x02164f55,
+    0x02166626, 0x02167cf0, 0x021693c9, 0x0216aaa3, 0x0216c174, 0x0216d845,
+    0x0216ef1e, 0x021705f1, 0x02171cc2, 0x02173393, 0x02174a6c, 0x02176146,
+    0x02177810, 0x02178ee1, 0x0217a5ba, 0x0217bc94, 0x0217d365, 0x0217ea36,
+    0x02180108, 0x021817e2, 0x02182eb3, 0x02184584, 0x02185c5d, 0x02187330,
+    0x02188a01, 0x0218a0d2, 0x0218b7ab, 0x0218ce85, 0x0218e556, 0x0218fc20,
+    0x021912f9, 0x021929d3, 0x021940a4, 0x02195775, 0x02196e4e, 0x02198521,
+    0x02199bf2, 0x0219b2c3, 0x0219c99c, 0x0219e076, 0x0219f740, 0x021a0e11,
+    0x021a24ea, 0x021a3bc4, 0x021a5295, 0x021a6966, 0x021a8038, 0x021a9712,
+    0x021aade3, 0x021ac4b4, 0x021adb8d, 0x021af260, 0x021b0931, 0x021b2002,
+    0x021b36db, 0x021b4db5, 0x021b6486, 0x021b7b50, 0x021b9229, 0x021ba903,
+    0x021bbfd4, 0x021bd6a5, 0x021bed7e, 0x021c0451, 0x021c1b22, 0x021c31f3,
+    0x021c48cc, 0x021c5fa6, 0x021c7670, 0x021c8d41, 0x021ca41a, 0x021cbaf4,
+    0x021cd1c5, 0x021ce896, 0x021cff68, 0x021d1642, 0x021d2d13, 0x021d43e4,
+    0x021d5abd, 0x021d7190, 0x021d8861, 0x021d9f32, 0x021db60b, 0x021dcce5,
+    0x021de3b6, 0x021dfa80, 0x021e1159, 0x021e2833, 0x021e3f04, 0x021e55d5,
+    0x021e6cae, 0x021e8381, 0x021e9a52, 0x021eb123, 0x021ec7fc, 0x021eded6,
+    0x021ef5a0, 0x021f0c71, 0x021f234a, 0x021f3a24, 0x021f50f5, 0x021f67c6,
+    0x021f7e98, 0x021f9572, 0x021fac43, 0x021fc314, 0x021fd9e5, 0x021ff0b6,
+    0x02200780, 0x02201e51, 0x0220352a, 0x02204c04, 0x022062d5, 0x022079a6,
+    0x02209078, 0x0220a752, 0x0220be23, 0x0220d4f4, 0x0220ebcd, 0x022102a0,
+    0x02211971, 0x02213042, 0x0221471b, 0x02215df5, 0x022174c6, 0x02218b90,
+    0x0221a269, 0x0221b943, 0x0221d014, 0x0221e6e5, 0x0221fdbe, 0x02221491,
+    0x02222b62, 0x02224233, 0x0222590c, 0x02226fe6, 0x022286b0, 0x02229d81,
+    0x0222b45a, 0x0222cb34, 0x0222e205, 0x0222f8d6, 0x02230fa8, 0x02232682,
+    0x02233d53, 0x02235424, 0x02236afd, 0x022381d0, 0x022398a1, 0x0223af72,
+    0x0223c64b, 0x0223dd25, 0x0223f3f6, 0x02240ac0, 0x02242199, 0x02243873,
+    0x02244f44, 0x02246615, 0x02247cee, 0x022493c1, 0x0224aa92, 0x0224c163,
+    0x0224d83c, 0x0224ef16, 0x022505e0, 0x02251cb1, 0x0225338a, 0x02254a64,
+    0x02256135, 0x02257806, 0x02258ed8, 0x0225a5b2, 0x0225bc83, 0x0225d354,
+    0x0225ea2d, 0x02260100, 0x022617d1, 0x02262ea2, 0x0226457b, 0x02265c55,
+    0x02267326, 0x022689f0, 0x0226a0c9, 0x0226b7a3, 0x0226ce74, 0x0226e545,
+    0x0226fc1e, 0x022712f1, 0x022729c2, 0x02274093, 0x0227576c, 0x02276e46,
+    0x02278510, 0x02279be1, 0x0227b2ba, 0x0227c994, 0x0227e065, 0x0227f736,
+    0x02280e08, 0x022824e2, 0x02283bb3, 0x02285284, 0x0228695d, 0x02288030,
+    0x02289701, 0x0228add2, 0x0228c4a3, 0x0228db74, 0x0228f245, 0x02290916,
+    0x02291fe8, 0x022936c2, 0x02294d93, 0x02296464, 0x02297b3d, 0x02299210,
+    0x0229a8e1, 0x0229bfb2, 0x0229d68b, 0x0229ed65, 0x022a0436, 0x022a1b00,
+    0x022a31d9, 0x022a48b3, 0x022a5f84, 0x022a7655, 0x022a8d2e, 0x022aa401,
+    0x022abad2, 0x022ad1a3, 0x022ae87c, 0x022aff56, 0x022b1620, 0x022b2cf1,
+    0x022b43ca, 0x022b5aa4, 0x022b7175, 0x022b8846, 0x022b9f18, 0x022bb5f2,
+    0x022bccc3, 0x022be394, 0x022bfa6d, 0x022c1140, 0x022c2811, 0x022c3ee2,
+    0x022c55bb, 0x022c6c95, 0x022c8366, 0x022c9a30, 0x022cb109, 0x022cc7e3,
+    0x022cdeb4, 0x022cf585, 0x022d0c5e, 0x022d2331, 0x022d3a02, 0x022d50d3,
+    0x022d67ac, 0x022d7e86, 0x022d9550, 0x022dac21, 0x022dc2fa, 0x022dd9d4,
+    0x022df0a5, 0x022e0776, 0x022e1e48, 0x022e3522, 0x022e4bf3, 0x022e62c4,
+    0x022e799d, 0x022e9070, 0x022ea741, 0x022ebe12, 0x022ed4eb, 0x022eebc5,
+    0x022f0296, 0x022f1960, 0x022f3039, 0x022f4713, 0x022f5de4, 0x022f74b5,
+    0x022f8b8e, 0x022fa261, 0x022fb932, 0x022fd003, 0x022fe6dc, 0x022ffdb6,
+    0x02301480, 0x02302b51, 0x0230422a, 0x02305904, 0x02306fd5, 0x023086a6,
+    0x02309d78, 0x0230b452, 0x0230cb23, 0x0230e1f4, 0x0230f8cd, 0x02310fa0,
+    0x02312671, 0x02313d42, 0x0231541b, 0x02316af5, 0x023181c6, 0x02319890,
+    0x0231af61, 0x0231c632, 0x0231dd03, 0x0231f3d4, 0x02320aad, 0x02322180,
+    0x02323851, 0x02324f22, 0x023265fb, 0x02327cd5, 0x023293a6, 0x0232aa70,
+    0x0232c149, 0x0232d823, 0x0232eef4, 0x023305c5, 0x02331c9e, 0x02333371,
+    0x02334a42, 0x02336113, 0x023377ec, 0x02338ec6, 0x0233a590, 0x0233bc61,
+    0x0233d33a, 0x0233ea14, 0x023400e5, 0x023417b6, 0x02342e88, 0x02344562,
+    0x02345c33, 0x02347304, 0x023489dd, 0x0234a0b0, 0x0234b781, 0x0234ce52,
+    0x0234e52b, 0x0234fc05, 0x023512d6, 0x023529a0, 0x02354079, 0x02355753,
+    0x02356e24, 0x023584f5, 0x02359bce, 0x0235b2a1, 0x0235c972, 0x0235e043,
+    0x0235f71c, 0x02360df6, 0x023624c0, 0x02363b91, 0x0236526a, 0x02366944,
+    0x02368015, 0x023696e6, 0x0236adb8, 0x0236c492, 0x0236db63, 0x0236f234,
+    0x0237090d, 0x02371fe0, 0x023736b1, 0x02374d82, 0x0237645b, 0x02377b35,
+    0x02379206, 0x0237a8d0, 0x0237bfa9, 0x0237d683, 0x0237ed54, 0x02380425,
+    0x02381afe, 0x023831d1, 0x023848a2, 0x02385f73, 0x0238764c, 0x02388d26,
+    0x0238a3f0, 0x0238bac1, 0x0238d19a, 0x0238e874, 0x0238ff45, 0x02391616,
+    0x02392ce8, 0x023943c2, 0x02395a93, 0x02397164, 0x0239883d, 0x02399f10,
+    0x0239b5e1, 0x0239ccb2, 0x0239e38b, 0x0239fa65, 0x023a1136, 0x023a2800,
+    0x023a3ed9, 0x023a55b3, 0x023a6c84, 0x023a8355, 0x023a9a2e, 0x023ab101,
+    0x023ac7d2, 0x023adea3, 0x023af57c, 0x023b0c56, 0x023b2320, 0x023b39f1,
+    0x023b50ca, 0x023b67a4, 0x023b7e75, 0x023b9546, 0x023bac18, 0x023bc2f2,
+    0x023bd9c3, 0x023bf094, 0x023c076d, 0x023c1e40, 0x023c3511, 0x023c4be2,
+    0x023c62bb, 0x023c7995, 0x023c9066, 0x023ca730, 0x023cbe09, 0x023cd4e3,
+    0x023cebb4, 0x023d0285, 0x023d195e, 0x023d3031, 0x023d4702, 0x023d5dd3,
+    0x023d74ac, 0x023d8b86, 0x023da250, 0x023db921, 0x023dcffa, 0x023de6d4,
+    0x023dfda5, 0x023e1476, 0x023e2b48, 0x023e4222, 0x023e58f3, 0x023e6fc4,
+    0x023e869d, 0x023e9d70, 0x023eb441, 0x023ecb12, 0x023ee1eb, 0x023ef8c5,
+    0x023f0f96, 0x023f2660, 0x023f3d39, 0x023f5413, 0x023f6ae4, 0x023f81b5,
+    0x023f988e, 0x023faf61, 0x023fc632, 0x023fdd03, 0x023ff3dc, 0x02400ab6,
+    0x02402180, 0x02403851, 0x02404f2a, 0x02406604, 0x02407cd5, 0x024093a6,
+    0x0240aa78, 0x0240c152, 0x0240d823, 0x0240eef4, 0x024105cd, 0x02411ca0,
+    0x02413371, 0x02414a42, 0x0241611b, 0x024177f5, 0x02418ec6, 0x0241a590,
+    0x0241bc69, 0x0241d343, 0x0241ea14, 0x024200e5, 0x024217be, 0x02422e91,
+    0x02424562, 0x02425c33, 0x0242730c, 0x024289e6, 0x0242a0b0, 0x0242b781,
+    0x0242ce5a, 0x0242e534, 0x0242fc05, 0x024312d6, 0x024329a8, 0x02434082,
+    0x02435753, 0x02436e24, 0x024384f5, 0x02439bc6, 0x0243b290, 0x0243c961,
+    0x0243e03a, 0x0243f714, 0x02440de5, 0x024424b6, 0x02443b88, 0x02445262,
+    0x02446933, 0x02448004, 0x024496dd, 0x0244adb0, 0x0244c481, 0x0244db52,
+    0x0244f22b, 0x02450905, 0x02451fd6, 0x024536a0, 0x02454d79, 0x02456453,
+    0x02457b24, 0x024591f5, 0x0245a8ce, 0x0245bfa1, 0x0245d672, 0x0245ed43,
+    0x0246041c, 0x02461af6, 0x024631c0, 0x02464891, 0x02465f6a, 0x02467644,
+    0x02468d15, 0x0246a3e6, 0x0246bab8, 0x0246d192, 0x0246e863, 0x0246ff34,
+    0x0247160d, 0x02472ce0, 0x024743b1, 0x02475a82, 0x0247715b, 0x02478835,
+    0x02479f06, 0x0247b5d0, 0x0247cca9, 0x0247e383, 0x0247fa54, 0x02481125,
+    0x024827fe, 0x02483ed1, 0x024855a2, 0x02486c73, 0x0248834c, 0x02489a26,
+    0x0248b0f0, 0x0248c7c1, 0x0248de9a, 0x0248f574, 0x02490c45, 0x02492316,
+    0x024939e8, 0x024950c2, 0x02496793, 0x02497e64, 0x0249953d, 0x0249ac10,
+    0x0249c2e1, 0x0249d9b2, 0x0249f08b, 0x024a0765, 0x024a1e36, 0x024a3500,
+    0x024a4bd9, 0x024a62b3, 0x024a7984, 0x024a9055, 0x024aa72e, 0x024abe01,
+    0x024ad4d2, 0x024aeba3, 0x024b027c, 0x024b1956, 0x024b3020, 0x024b46f1,
+    0x024b5dca, 0x024b74a4, 0x024b8b75, 0x024ba246, 0x024bb918, 0x024bcff2,
+    0x024be6c3, 0x024bfd94, 0x024c146d, 0x024c2b40, 0x024c4211, 0x024c58e2,
+    0x024c6fb3, 0x024c8684, 0x024c9d55, 0x024cb426, 0x024ccaf8, 0x024ce1d2,
+    0x024cf8a3, 0x024d0f74, 0x024d264d, 0x024d3d20, 0x024d53f1, 0x024d6ac2,
+    0x024d819b, 0x024d9875, 0x024daf46, 0x024dc610, 0x024ddce9, 0x024df3c3,
+    0x024e0a94, 0x024e2165, 0x024e383e, 0x024e4f11, 0x024e65e2, 0x024e7cb3,
+    0x024e938c, 0x024eaa66, 0x024ec130, 0x024ed801, 0x024eeeda, 0x024f05b4,
+    0x024f1c85, 0x024f3356, 0x024f4a28, 0x024f6102, 0x024f77d3, 0x024f8ea4,
+    0x024fa57d, 0x024fbc50, 0x024fd321, 0x024fe9f2, 0x025000cb, 0x025017a5,
+    0x02502e76, 0x02504540, 0x02505c19, 0x025072f3, 0x025089c4, 0x0250a095,
+    0x0250b76e, 0x0250ce41, 0x0250e512, 0x0250fbe3, 0x025112bc, 0x02512996,
+    0x02514060, 0x02515731, 0x02516e0a, 0x025184e4, 0x02519bb5, 0x0251b286,
+    0x0251c958, 0x0251e032, 0x0251f703, 0x02520dd4, 0x025224ad, 0x02523b80,
+    0x02525251, 0x02526922, 0x02527ffb, 0x025296d5, 0x0252ada6, 0x0252c470,
+    0x0252db49, 0x0252f223, 0x025308f4, 0x02531fc5, 0x0253369e, 0x02534d71,
+    0x02536442, 0x02537b13, 0x025391ec, 0x0253a8c6, 0x0253bf90, 0x0253d661,
+    0x0253ed3a, 0x02540414, 0x02541ae5, 0x025431b6, 0x02544888, 0x02545f62,
+    0x02547633, 0x02548d04, 0x0254a3dd, 0x0254bab0, 0x0254d181, 0x0254e852,
+    0x0254ff2b, 0x02551605, 0x02552cd6, 0x025543a0, 0x02555a71, 0x02557142,
+    0x02558813, 0x02559ee4, 0x0255b5bd, 0x0255cc90, 0x0255e361, 0x0255fa32,
+    0x0256110b, 0x025627e5, 0x02563eb6, 0x02565580, 0x02566c59, 0x02568333,
+    0x02569a04, 0x0256b0d5, 0x0256c7ae, 0x0256de81, 0x0256f552, 0x02570c23,
+    0x025722fc, 0x025739d6, 0x025750a0, 0x02576771, 0x02577e4a, 0x02579524,
+    0x0257abf5, 0x0257c2c6, 0x0257d998, 0x0257f072, 0x02580743, 0x02581e14,
+    0x025834ed, 0x02584bc0, 0x02586291, 0x02587962, 0x0258903b, 0x0258a715,
+    0x0258bde6, 0x0258d4b0, 0x0258eb89, 0x02590263, 0x02591934, 0x02593005,
+    0x025946de, 0x02595db1, 0x02597482, 0x02598b53, 0x0259a22c, 0x0259b906,
+    0x0259cfd0, 0x0259e6a1, 0x0259fd7a, 0x025a1454, 0x025a2b25, 0x025a41f6,
+    0x025a58c8, 0x025a6fa2, 0x025a8673, 0x025a9d44, 0x025ab41d, 0x025acaf0,
+    0x025ae1c1, 0x025af892, 0x025b0f6b, 0x025b2645, 0x025b3d16, 0x025b53e0,
+    0x025b6ab9, 0x025b8193, 0x025b9864, 0x025baf35, 0x025bc60e, 0x025bdce1,
+    0x025bf3b2, 0x025c0a83, 0x025c215c, 0x025c3836, 0x025c4f00, 0x025c65d1,
+    0x025c7caa, 0x025c9384, 0x025caa55, 0x025cc126, 0x025cd7f8, 0x025ceed2,
+    0x025d05a3, 0x025d1c74, 0x025d334d, 0x025d4a20, 0x025d60f1, 0x025d77c2,
+    0x025d8e9b, 0x025da575, 0x025dbc46, 0x025dd310, 0x025de9e9, 0x025e00c3,
+    0x025e1794, 0x025e2e65, 0x025e453e, 0x025e5c11, 0x025e72e2, 0x025e89b3,
+    0x025ea08c, 0x025eb766, 0x025ece30, 0x025ee501, 0x025efbda, 0x025f12b4,
+    0x025f2985, 0x025f4056, 0x025f5728, 0x025f6e02, 0x025f84d3, 0x025f9ba4,
+    0x025fb27d, 0x025fc950, 0x025fe021, 0x025ff6f2, 0x02600dcb, 0x026024a5,
+    0x02603b76, 0x02605240, 0x02606919, 0x02607ff3, 0x026096c4, 0x0260ad95,
+    0x0260c46e, 0x0260db41, 0x0260f212, 0x026108e3, 0x02611fbc, 0x02613696,
+    0x02614d60, 0x02616431, 0x02617b0a, 0x026191e4, 0x0261a8b5, 0x0261bf86,
+    0x0261d658, 0x0261ed32, 0x02620403, 0x02621ad4, 0x026231ad, 0x02624880,
+    0x02625f51, 0x02627622, 0x02628cfb, 0x0262a3d5, 0x0262baa6, 0x0262d170,
+    0x0262e849, 0x0262ff23, 0x026315f4, 0x02632cc5, 0x0263439e, 0x02635a71,
+    0x02637142, 0x02638813, 0x02639eec, 0x0263b5c6, 0x0263cc90, 0x0263e361,
+    0x0263fa3a, 0x02641114, 0x026427e5, 0x02643eb6, 0x02645588, 0x02646c62,
+    0x02648333, 0x02649a04, 0x0264b0dd, 0x0264c7b0, 0x0264de81, 0x0264f552,
+    0x02650c2b, 0x02652305, 0x026539d6, 0x026550a0, 0x02656779, 0x02657e53,
+    0x02659524, 0x0265abf5, 0x0265c2ce, 0x0265d9a1, 0x0265f072, 0x02660743,
+    0x02661e1c, 0x026634f6, 0x02664bc0, 0x02666291, 0x0266796a, 0x02669044,
+    0x0266a715, 0x0266bde6, 0x0266d4b8, 0x0266eb92, 0x02670263, 0x02671934,
+    0x02673005, 0x026746d6, 0x02675da0, 0x02677471, 0x02678b4a, 0x0267a224,
+    0x0267b8f5, 0x0267cfc6, 0x0267e698, 0x0267fd72, 0x02681443, 0x02682b14,
+    0x026841ed, 0x026858c0, 0x02686f91, 0x02688662, 0x02689d3b, 0x0268b415,
+    0x0268cae6, 0x0268e1b0, 0x0268f889, 0x02690f63, 0x02692634, 0x02693d05,
+    0x026953de, 0x02696ab1, 0x02698182, 0x02699853, 0x0269af2c, 0x0269c606,
+    0x0269dcd0, 0x0269f3a1, 0x026a0a7a, 0x026a2154, 0x026a3825, 0x026a4ef6,
+    0x026a65c8, 0x026a7ca2, 0x026a9373, 0x026aaa44, 0x026ac11d, 0x026ad7f0,
+    0x026aeec1, 0x026b0592, 0x026b1c6b, 0x026b3345, 0x026b4a16, 0x026b60e0,
+    0x026b77b9, 0x026b8e93, 0x026ba564, 0x026bbc35, 0x026bd30e, 0x026be9e1,
+    0x026c00b2, 0x026c1783, 0x026c2e5c, 0x026c4536, 0x026c5c00, 0x026c72d1,
+    0x026c89aa, 0x026ca084, 0x026cb755, 0x026cce26, 0x026ce4f8, 0x026cfbd2,
+    0x026d12a3, 0x026d2974, 0x026d404d, 0x026d5720, 0x026d6df1, 0x026d84c2,
+    0x026d9b9b, 0x026db275, 0x026dc946, 0x026de010, 0x026df6e9, 0x026e0dc3,
+    0x026e2494, 0x026e3b65, 0x026e523e, 0x026e6911, 0x026e7fe2, 0x026e96b3,
+    0x026ead8c, 0x026ec466, 0x026edb30, 0x026ef201, 0x026f08da, 0x026f1fb4,
+    0x026f3685, 0x026f4d56, 0x026f6428, 0x026f7b02, 0x026f91d3, 0x026fa8a4,
+    0x026fbf7d, 0x026fd650, 0x026fed21, 0x027003f2, 0x02701ac3, 0x02703194,
+    0x02704865, 0x02705f36, 0x02707608, 0x02708ce2, 0x0270a3b3, 0x0270ba84,
+    0x0270d15d, 0x0270e830, 0x0270ff01, 0x027115d2, 0x02712cab, 0x02714385,
+    0x02715a56, 0x02717120, 0x027187f9, 0x02719ed3, 0x0271b5a4, 0x0271cc75,
+    0x0271e34e, 0x0271fa21, 0x027210f2, 0x027227c3, 0x02723e9c, 0x02725576,
+    0x02726c40, 0x02728311, 0x027299ea, 0x0272b0c4, 0x0272c795, 0x0272de66,
+    0x0272f538, 0x02730c12, 0x027322e3, 0x027339b4, 0x0273508d, 0x02736760,
+    0x02737e31, 0x02739502, 0x0273abdb, 0x0273c2b5, 0x0273d986, 0x0273f050,
+    0x02740729, 0x02741e03, 0x027434d4, 0x02744ba5, 0x0274627e, 0x02747951,
+    0x02749022, 0x0274a6f3, 0x0274bdcc, 0x0274d4a6, 0x0274eb70, 0x02750241,
+    0x0275191a, 0x02752ff4, 0x027546c5, 0x02755d96, 0x02757468, 0x02758b42,
+    0x0275a213, 0x0275b8e4, 0x0275cfbd, 0x0275e690, 0x0275fd61, 0x02761432,
+    0x02762b0b, 0x027641e5, 0x027658b6, 0x02766f80, 0x02768659, 0x02769d33,
+    0x0276b404, 0x0276cad5, 0x0276e1ae, 0x0276f881, 0x02770f52, 0x02772623,
+    0x02773cfc, 0x027753d6, 0x02776aa0, 0x02778171, 0x0277984a, 0x0277af24,
+    0x0277c5f5, 0x0277dcc6, 0x0277f398, 0x02780a72, 0x02782143, 0x02783814,
+    0x02784eed, 0x027865c0, 0x02787c91, 0x02789362, 0x0278aa3b, 0x0278c115,
+    0x0278d7e6, 0x0278eeb0, 0x02790581, 0x02791c52, 0x02793323, 0x027949f4,
+    0x027960cd, 0x027977a0, 0x02798e71, 0x0279a542, 0x0279bc1b, 0x0279d2f5,
+    0x0279e9c6, 0x027a0090, 0x027a1769, 0x027a2e43, 0x027a4514, 0x027a5be5,
+    0x027a72be, 0x027a8991, 0x027aa062, 0x027ab733, 0x027ace0c, 0x027ae4e6,
+    0x027afbb0, 0x027b1281, 0x027b295a, 0x027b4034, 0x027b5705, 0x027b6dd6,
+    0x027b84a8, 0x027b9b82, 0x027bb253, 0x027bc924, 0x027bdffd, 0x027bf6d0,
+    0x027c0da1, 0x027c2472, 0x027c3b4b, 0x027c5225, 0x027c68f6, 0x027c7fc0,
+    0x027c9699, 0x027cad73, 0x027cc444, 0x027cdb15, 0x027cf1ee, 0x027d08c1,
+    0x027d1f92, 0x027d3663, 0x027d4d3c, 0x027d6416, 0x027d7ae0, 0x027d91b1,
+    0x027da88a, 0x027dbf64, 0x027dd635, 0x027ded06, 0x027e03d8, 0x027e1ab2,
+    0x027e3183, 0x027e4854, 0x027e5f2d, 0x027e7600, 0x027e8cd1, 0x027ea3a2,
+    0x027eba7b, 0x027ed155, 0x027ee826, 0x027efef0, 0x027f15c9, 0x027f2ca3,
+    0x027f4374, 0x027f5a45, 0x027f711e, 0x027f87f1, 0x027f9ec2, 0x027fb593,
+    0x027fcc6c, 0x027fe346, 0x027ffa10, 0x028010e1, 0x028027ba, 0x02803e94,
+    0x02805565, 0x02806c36, 0x02808308, 0x028099e2, 0x0280b0b3, 0x0280c784,
+    0x0280de5d, 0x0280f530, 0x02810c01, 0x028122d2, 0x028139ab, 0x02815085,
+    0x02816756, 0x02817e20, 0x028194f9, 0x0281abd3, 0x0281c2a4, 0x0281d975,
+    0x0281f04e, 0x02820721, 0x02821df2, 0x028234c3, 0x02824b9c, 0x02826276,
+    0x02827940, 0x02829011, 0x0282a6ea, 0x0282bdc4, 0x0282d495, 0x0282eb66,
+    0x02830238, 0x02831912, 0x02832fe3, 0x028346b4, 0x02835d8d, 0x02837460,
+    0x02838b31, 0x0283a202, 0x0283b8db, 0x0283cfb5, 0x0283e686, 0x0283fd50,
+    0x02841429, 0x02842b03, 0x028441d4, 0x028458a5, 0x02846f7e, 0x02848651,
+    0x02849d22, 0x0284b3f3, 0x0284cacc, 0x0284e1a6, 0x0284f870, 0x02850f41,
+    0x0285261a, 0x02853cf4, 0x028553c5, 0x02856a96, 0x02858168, 0x02859842,
+    0x0285af13, 0x0285c5e4, 0x0285dcbd, 0x0285f390, 0x02860a61, 0x02862132,
+    0x0286380b, 0x02864ee5, 0x028665b6, 0x02867c80, 0x02869359, 0x0286aa33,
+    0x0286c104, 0x0286d7d5, 0x0286eeae, 0x02870581, 0x02871c52, 0x02873323,
+    0x028749fc, 0x028760d6, 0x028777a0, 0x02878e71, 0x0287a54a, 0x0287bc24,
+    0x0287d2f5, 0x0287e9c6, 0x02880098, 0x02881772, 0x02882e43, 0x02884514,
+    0x02885bed, 0x028872c0, 0x02888991, 0x0288a062, 0x0288b73b, 0x0288ce15,
+    0x0288e4e6, 0x0288fbb0, 0x02891289, 0x02892963, 0x02894034, 0x02895705,
+    0x02896dde, 0x028984b1, 0x02899b82, 0x0289b253, 0x0289c92c, 0x0289e006,
+    0x0289f6d0, 0x028a0da1, 0x028a247a, 0x028a3b54, 0x028a5225, 0x028a68f6,
+    0x028a7fc8, 0x028a96a2, 0x028aad73, 0x028ac444, 0x028adb15, 0x028af1e6,
+    0x028b08b0, 0x028b1f81, 0x028b365a, 0x028b4d34, 0x028b6405, 0x028b7ad6,
+    0x028b91a8, 0x028ba882, 0x028bbf53, 0x028bd624, 0x028becfd, 0x028c03d0,
+    0x028c1aa1, 0x028c3172, 0x028c484b, 0x028c5f25, 0x028c75f6, 0x028c8cc0,
+    0x028ca399, 0x028cba73, 0x028cd144, 0x028ce815, 0x028cfeee, 0x028d15c1,
+    0x028d2c92, 0x028d4363, 0x028d5a3c, 0x028d7116, 0x028d87e0, 0x028d9eb1,
+    0x028db58a, 0x028dcc64, 0x028de335, 0x028dfa06, 0x028e10d8, 0x028e27b2,
+    0x028e3e83, 0x028e5554, 0x028e6c2d, 0x028e8300, 0x028e99d1, 0x028eb0a2,
+    0x028ec77b, 0x028ede55, 0x028ef526, 0x028f0bf0, 0x028f22c9, 0x028f39a3,
+    0x028f5074, 0x028f6745, 0x028f7e1e, 0x028f94f1, 0x028fabc2, 0x028fc293,
+    0x028fd96c, 0x028ff046, 0x02900710, 0x02901de1, 0x029034ba, 0x02904b94,
+    0x02906265, 0x02907936, 0x02909008, 0x0290a6e2, 0x0290bdb3, 0x0290d484,
+    0x0290eb5d, 0x02910230, 0x02911901, 0x02912fd2, 0x029146ab, 0x02915d85,
+    0x02917456, 0x02918b20, 0x0291a1f9, 0x0291b8d3, 0x0291cfa4, 0x0291e675,
+    0x0291fd4e, 0x02921421, 0x02922af2, 0x029241c3, 0x0292589c, 0x02926f76,
+    0x02928640, 0x02929d11, 0x0292b3ea, 0x0292cac4, 0x0292e195, 0x0292f866,
+    0x02930f38, 0x02932612, 0x02933ce3, 0x029353b4, 0x02936a8d, 0x02938160,
+    0x02939831, 0x0293af02, 0x0293c5d3, 0x0293dca4, 0x0293f375, 0x02940a46,
+    0x02942118, 0x029437f2, 0x02944ec3, 0x02946594, 0x02947c6d, 0x02949340,
+    0x0294aa11, 0x0294c0e2, 0x0294d7bb, 0x0294ee95, 0x02950566, 0x02951c30,
+    0x02953309, 0x029549e3, 0x029560b4, 0x02957785, 0x02958e5e, 0x0295a531,
+    0x0295bc02, 0x0295d2d3, 0x0295e9ac, 0x02960086, 0x02961750, 0x02962e21,
+    0x029644fa, 0x02965bd4, 0x029672a5, 0x02968976, 0x0296a048, 0x0296b722,
+    0x0296cdf3, 0x0296e4c4, 0x0296fb9d, 0x02971270, 0x02972941, 0x02974012,
+    0x029756eb, 0x02976dc5, 0x02978496, 0x02979b60, 0x0297b239, 0x0297c913,
+    0x0297dfe4, 0x0297f6b5, 0x02980d8e, 0x02982461, 0x02983b32, 0x02985203,
+    0x029868dc, 0x02987fb6, 0x02989680, 0x0298ad51, 0x0298c42a, 0x0298db04,
+    0x0298f1d5, 0x029908a6, 0x02991f78, 0x02993652, 0x02994d23, 0x029963f4,
+    0x02997acd, 0x029991a0, 0x0299a871, 0x0299bf42, 0x0299d61b, 0x0299ecf5,
+    0x029a03c6, 0x029a1a90, 0x029a3169, 0x029a4843, 0x029a5f14, 0x029a75e5,
+    0x029a8cbe, 0x029aa391, 0x029aba62, 0x029ad133, 0x029ae80c, 0x029afee6,
+    0x029b15b0, 0x029b2c81, 0x029b435a, 0x029b5a34, 0x029b7105, 0x029b87d6,
+    0x029b9ea8, 0x029bb582, 0x029bcc53, 0x029be324, 0x029bf9fd, 0x029c10d0,
+    0x029c27a1, 0x029c3e72, 0x029c554b, 0x029c6c25, 0x029c82f6, 0x029c99c0,
+    0x029cb091, 0x029cc762, 0x029cde33, 0x029cf504, 0x029d0bdd, 0x029d22b0,
+    0x029d3981, 0x029d5052, 0x029d672b, 0x029d7e05, 0x029d94d6, 0x029daba0,
+    0x029dc279, 0x029dd953, 0x029df024, 0x029e06f5, 0x029e1dce, 0x029e34a1,
+    0x029e4b72, 0x029e6243, 0x029e791c, 0x029e8ff6, 0x029ea6c0, 0x029ebd91,
+    0x029ed46a, 0x029eeb44, 0x029f0215, 0x029f18e6, 0x029f2fb8, 0x029f4692,
+    0x029f5d63, 0x029f7434, 0x029f8b0d, 0x029fa1e0, 0x029fb8b1, 0x029fcf82,
+    0x029fe65b, 0x029ffd35, 0x02a01406, 0x02a02ad0, 0x02a041a9, 0x02a05883,
+    0x02a06f54, 0x02a08625, 0x02a09cfe, 0x02a0b3d1, 0x02a0caa2, 0x02a0e173,
+    0x02a0f84c, 0x02a10f26, 0x02a125f0, 0x02a13cc1, 0x02a1539a, 0x02a16a74,
+    0x02a18145, 0x02a19816, 0x02a1aee8, 0x02a1c5c2, 0x02a1dc93, 0x02a1f364,
+    0x02a20a3d, 0x02a22110, 0x02a237e1, 0x02a24eb2, 0x02a2658b, 0x02a27c65,
+    0x02a29336, 0x02a2aa00, 0x02a2c0d9, 0x02a2d7b3, 0x02a2ee84, 0x02a30555,
+    0x02a31c2e, 0x02a33301, 0x02a349d2, 0x02a360a3, 0x02a3777c, 0x02a38e56,
+    0x02a3a520, 0x02a3bbf1, 0x02a3d2ca, 0x02a3e9a4, 0x02a40075, 0x02a41746,
+    0x02a42e18, 0x02a444f2, 0x02a45bc3, 0x02a47294, 0x02a4896d, 0x02a4a040,
+    0x02a4b711, 0x02a4cde2, 0x02a4e4bb, 0x02a4fb95, 0x02a51266, 0x02a52930,
+    0x02a54009, 0x02a556e3, 0x02a56db4, 0x02a58485, 0x02a59b5e, 0x02a5b231,
+    0x02a5c902, 0x02a5dfd3, 0x02a5f6ac, 0x02a60d86, 0x02a62450, 0x02a63b21,
+    0x02a651fa, 0x02a668d4, 0x02a67fa5, 0x02a69676, 0x02a6ad48, 0x02a6c422,
+    0x02a6daf3, 0x02a6f1c4, 0x02a7089d, 0x02a71f70, 0x02a73641, 0x02a74d12,
+    0x02a763eb, 0x02a77ac5, 0x02a79196, 0x02a7a860, 0x02a7bf39, 0x02a7d613,
+    0x02a7ece4, 0x02a803b5, 0x02a81a8e, 0x02a83161, 0x02a84832, 0x02a85f03,
+    0x02a875dc, 0x02a88cb6, 0x02a8a380, 0x02a8ba51, 0x02a8d12a, 0x02a8e804,
+    0x02a8fed5, 0x02a915a6, 0x02a92c78, 0x02a94352, 0x02a95a23, 0x02a970f4,
+    0x02a987cd, 0x02a99ea0, 0x02a9b571, 0x02a9cc42, 0x02a9e31b, 0x02a9f9f5,
+    0x02aa10c6, 0x02aa2790, 0x02aa3e69, 0x02aa5543, 0x02aa6c14, 0x02aa82e5,
+    0x02aa99be, 0x02aab091, 0x02aac762, 0x02aade33, 0x02aaf50c, 0x02ab0be6,
+    0x02ab22b0, 0x02ab3981, 0x02ab505a, 0x02ab6734, 0x02ab7e05, 0x02ab94d6,
+    0x02ababa8, 0x02abc282, 0x02abd953, 0x02abf024, 0x02ac06fd, 0x02ac1dd0,
+    0x02ac34a1, 0x02ac4b72, 0x02ac624b, 0x02ac7925, 0x02ac8ff6, 0x02aca6c0,
+    0x02acbd99, 0x02acd473, 0x02aceb44, 0x02ad0215, 0x02ad18ee, 0x02ad2fc1,
+    0x02ad4692, 0x02ad5d63, 0x02ad743c, 0x02ad8b16, 0x02ada1e0, 0x02adb8b1,
+    0x02adcf8a, 0x02ade664, 0x02adfd35, 0x02ae1406, 0x02ae2ad8, 0x02ae41b2,
+    0x02ae5883, 0x02ae6f54, 0x02ae8625, 0x02ae9cf6, 0x02aeb3c0, 0x02aeca91,
+    0x02aee16a, 0x02aef844, 0x02af0f15, 0x02af25e6, 0x02af3cb8, 0x02af5392,
+    0x02af6a63, 0x02af8134, 0x02af980d, 0x02afaee0, 0x02afc5b1, 0x02afdc82,
+    0x02aff35b, 0x02b00a35, 0x02b02106, 0x02b037d0, 0x02b04ea9, 0x02b06583,
+    0x02b07c54, 0x02b09325, 0x02b0a9fe, 0x02b0c0d1, 0x02b0d7a2, 0x02b0ee73,
+    0x02b1054c, 0x02b11c26, 0x02b132f0, 0x02b149c1, 0x02b1609a, 0x02b17774,
+    0x02b18e45, 0x02b1a516, 0x02b1bbe8, 0x02b1d2c2, 0x02b1e993, 0x02b20064,
+    0x02b2173d, 0x02b22e10, 0x02b244e1, 0x02b25bb2, 0x02b2728b, 0x02b28965,
+    0x02b2a036, 0x02b2b700, 0x02b2cdd9, 0x02b2e4b3, 0x02b2fb84, 0x02b31255,
+    0x02b3292e, 0x02b34001, 0x02b356d2, 0x02b36da3, 0x02b3847c, 0x02b39b56,
+    0x02b3b220, 0x02b3c8f1, 0x02b3dfca, 0x02b3f6a4, 0x02b40d75, 0x02b42446,
+    0x02b43b18, 0x02b451f2, 0x02b468c3, 0x02b47f94, 0x02b4966d, 0x02b4ad40,
+    0x02b4c411, 0x02b4dae2, 0x02b4f1bb, 0x02b50895, 0x02b51f66, 0x02b53630,
+    0x02b54d09, 0x02b563e3, 0x02b57ab4, 0x02b59185, 0x02b5a85e, 0x02b5bf31,
+    0x02b5d602, 0x02b5ecd3, 0x02b603ac, 0x02b61a86, 0x02b63150, 0x02b64821,
+    0x02b65efa, 0x02b675d4, 0x02b68ca5, 0x02b6a376, 0x02b6ba48, 0x02b6d122,
+    0x02b6e7f3, 0x02b6fec4, 0x02b7159d, 0x02b72c70, 0x02b74341, 0x02b75a12,
+    0x02b770e3, 0x02b787b4, 0x02b79e85, 0x02b7b556, 0x02b7cc28, 0x02b7e302,
+    0x02b7f9d3, 0x02b810a4, 0x02b8277d, 0x02b83e50, 0x02b85521, 0x02b86bf2,
+    0x02b882cb, 0x02b899a5, 0x02b8b076, 0x02b8c740, 0x02b8de19, 0x02b8f4f3,
+    0x02b90bc4, 0x02b92295, 0x02b9396e, 0x02b95041, 0x02b96712, 0x02b97de3,
+    0x02b994bc, 0x02b9ab96, 0x02b9c260, 0x02b9d931, 0x02b9f00a, 0x02ba06e4,
+    0x02ba1db5, 0x02ba3486, 0x02ba4b58, 0x02ba6232, 0x02ba7903, 0x02ba8fd4,
+    0x02baa6ad, 0x02babd80, 0x02bad451, 0x02baeb22, 0x02bb01fb, 0x02bb18d5,
+    0x02bb2fa6, 0x02bb4670, 0x02bb5d49, 0x02bb7423, 0x02bb8af4, 0x02bba1c5,
+    0x02bbb89e, 0x02bbcf71, 0x02bbe642, 0x02bbfd13, 0x02bc13ec, 0x02bc2ac6,
+    0x02bc4190, 0x02bc5861, 0x02bc6f3a, 0x02bc8614, 0x02bc9ce5, 0x02bcb3b6,
+    0x02bcca88, 0x02bce162, 0x02bcf833, 0x02bd0f04, 0x02bd25dd, 0x02bd3cb0,
+    0x02bd5381, 0x02bd6a52, 0x02bd812b, 0x02bd9805, 0x02bdaed6, 0x02bdc5a0,
+    0x02bddc79, 0x02bdf353, 0x02be0a24, 0x02be20f5, 0x02be37ce, 0x02be4ea1,
+    0x02be6572, 0x02be7c43, 0x02be931c, 0x02bea9f6, 0x02bec0c0, 0x02bed791,
+    0x02beee6a, 0x02bf0544, 0x02bf1c15, 0x02bf32e6, 0x02bf49b8, 0x02bf6092,
+    0x02bf7763, 0x02bf8e34, 0x02bfa50d, 0x02bfbbe0, 0x02bfd2b1, 0x02bfe982,
+    0x02c0005b, 0x02c01735, 0x02c02e06, 0x02c044d0, 0x02c05ba1, 0x02c07272,
+    0x02c08943, 0x02c0a014, 0x02c0b6ed, 0x02c0cdc0, 0x02c0e491, 0x02c0fb62,
+    0x02c1123b, 0x02c12915, 0x02c13fe6, 0x02c156b0, 0x02c16d89, 0x02c18463,
+    0x02c19b34, 0x02c1b205, 0x02c1c8de, 0x02c1dfb1, 0x02c1f682, 0x02c20d53,
+    0x02c2242c, 0x02c23b06, 0x02c251d0, 0x02c268a1, 0x02c27f7a, 0x02c29654,
+    0x02c2ad25, 0x02c2c3f6, 0x02c2dac8, 0x02c2f1a2, 0x02c30873, 0x02c31f44,
+    0x02c3361d, 0x02c34cf0, 0x02c363c1, 0x02c37a92, 0x02c3916b, 0x02c3a845,
+    0x02c3bf16, 0x02c3d5e0, 0x02c3ecb9, 0x02c40393, 0x02c41a64, 0x02c43135,
+    0x02c4480e, 0x02c45ee1, 0x02c475b2, 0x02c48c83, 0x02c4a35c, 0x02c4ba36,
+    0x02c4d100, 0x02c4e7d1, 0x02c4feaa, 0x02c51584, 0x02c52c55, 0x02c54326,
+    0x02c559f8, 0x02c570d2, 0x02c587a3, 0x02c59e74, 0x02c5b54d, 0x02c5cc20,
+    0x02c5e2f1, 0x02c5f9c2, 0x02c6109b, 0x02c62775, 0x02c63e46, 0x02c65510,
+    0x02c66be9, 0x02c682c3, 0x02c69994, 0x02c6b065, 0x02c6c73e, 0x02c6de11,
+    0x02c6f4e2, 0x02c70bb3, 0x02c7228c, 0x02c73966, 0x02c75030, 0x02c76701,
+    0x02c77dda, 0x02c794b4, 0x02c7ab85, 0x02c7c256, 0x02c7d928, 0x02c7f002,
+    0x02c806d3, 0x02c81da4, 0x02c8347d, 0x02c84b50, 0x02c86221, 0x02c878f2,
+    0x02c88fcb, 0x02c8a6a5, 0x02c8bd76, 0x02c8d440, 0x02c8eb19, 0x02c901f3,
+    0x02c918c4, 0x02c92f95, 0x02c9466e, 0x02c95d41, 0x02c97412, 0x02c98ae3,
+    0x02c9a1bc, 0x02c9b896, 0x02c9cf60, 0x02c9e631, 0x02c9fd0a, 0x02ca13e4,
+    0x02ca2ab5, 0x02ca4186, 0x02ca5858, 0x02ca6f32, 0x02ca8603, 0x02ca9cd4,
+    0x02cab3ad, 0x02caca80, 0x02cae151, 0x02caf822, 0x02cb0efb, 0x02cb25d5,
+    0x02cb3ca6, 0x02cb5370, 0x02cb6a49, 0x02cb8123, 0x02cb97f4, 0x02cbaec5,
+    0x02cbc59e, 0x02cbdc71, 0x02cbf342, 0x02cc0a13, 0x02cc20ec, 0x02cc37c6,
+    0x02cc4e90, 0x02cc6561, 0x02cc7c3a, 0x02cc9314, 0x02cca9e5, 0x02ccc0b6,
+    0x02ccd788, 0x02ccee62, 0x02cd0533, 0x02cd1c04, 0x02cd32dd, 0x02cd49b0,
+    0x02cd6081, 0x02cd7752, 0x02cd8e2b, 0x02cda505, 0x02cdbbd6, 0x02cdd2a0,
+    0x02cde979, 0x02ce0053, 0x02ce1724, 0x02ce2df5, 0x02ce44ce, 0x02ce5ba1,
+    0x02ce7272, 0x02ce8943, 0x02cea01c, 0x02ceb6f6, 0x02cecdc0, 0x02cee491,
+    0x02cefb6a, 0x02cf1244, 0x02cf2915, 0x02cf3fe6, 0x02cf56b8, 0x02cf6d92,
+    0x02cf8463, 0x02cf9b34, 0x02cfb20d, 0x02cfc8e0, 0x02cfdfb1, 0x02cff682,
+    0x02d00d5b, 0x02d02435, 0x02d03b06, 0x02d051d0, 0x02d068a9, 0x02d07f83,
+    0x02d09654, 0x02d0ad25, 0x02d0c3fe, 0x02d0dad1, 0x02d0f1a2, 0x02d10873,
+    0x02d11f4c, 0x02d13626, 0x02d14cf0, 0x02d163c1, 0x02d17a9a, 0x02d19174,
+    0x02d1a845, 0x02d1bf16, 0x02d1d5e8, 0x02d1ecc2, 0x02d20393, 0x02d21a64,
+    0x02d23135, 0x02d24806, 0x02d25ed0, 0x02d275a1, 0x02d28c7a, 0x02d2a354,
+    0x02d2ba25, 0x02d2d0f6, 0x02d2e7c8, 0x02d2fea2, 0x02d31573, 0x02d32c44,
+    0x02d3431d, 0x02d359f0, 0x02d370c1, 0x02d38792, 0x02d39e6b, 0x02d3b545,
+    0x02d3cc16, 0x02d3e2e0, 0x02d3f9b9, 0x02d41093, 0x02d42764, 0x02d43e35,
+    0x02d4550e, 0x02d46be1, 0x02d482b2, 0x02d49983, 0x02d4b05c, 0x02d4c736,
+    0x02d4de00, 0x02d4f4d1, 0x02d50baa, 0x02d52284, 0x02d53955, 0x02d55026,
+    0x02d566f8, 0x02d57dd2, 0x02d594a3, 0x02d5ab74, 0x02d5c24d, 0x02d5d920,
+    0x02d5eff1, 0x02d606c2, 0x02d61d9b, 0x02d63475, 0x02d64b46, 0x02d66210,
+    0x02d678e9, 0x02d68fc3, 0x02d6a694, 0x02d6bd65, 0x02d6d43e, 0x02d6eb11,
+    0x02d701e2, 0x02d718b3, 0x02d72f8c, 0x02d74666, 0x02d75d30, 0x02d77401,
+    0x02d78ada, 0x02d7a1b4, 0x02d7b885, 0x02d7cf56, 0x02d7e628, 0x02d7fd02,
+    0x02d813d3, 0x02d82aa4, 0x02d8417d, 0x02d85850, 0x02d86f21, 0x02d885f2,
+    0x02d89ccb, 0x02d8b3a5, 0x02d8ca76, 0x02d8e140, 0x02d8f819, 0x02d90ef3,
+    0x02d925c4, 0x02d93c95, 0x02d9536e, 0x02d96a41, 0x02d98112, 0x02d997e3,
+    0x02d9aebc, 0x02d9c596, 0x02d9dc60, 0x02d9f331, 0x02da0a0a, 0x02da20e4,
+    0x02da37b5, 0x02da4e86, 0x02da6558, 0x02da7c32, 0x02da9303, 0x02daa9d4,
+    0x02dac0ad, 0x02dad780, 0x02daee51, 0x02db0522, 0x02db1bf3, 0x02db32c4,
+    0x02db4995, 0x02db6066, 0x02db7738, 0x02db8e12, 0x02dba4e3, 0x02dbbbb4,
+    0x02dbd28d, 0x02dbe960, 0x02dc0031, 0x02dc1702, 0x02dc2ddb, 0x02dc44b5,
+    0x02dc5b86, 0x02dc7250, 0x02dc8929, 0x02dca003, 0x02dcb6d4, 0x02dccda5,
+    0x02dce47e, 0x02dcfb51, 0x02dd1222, 0x02dd28f3, 0x02dd3fcc, 0x02dd56a6,
+    0x02dd6d70, 0x02dd8441, 0x02dd9b1a, 0x02ddb1f4, 0x02ddc8c5, 0x02dddf96,
+    0x02ddf668, 0x02de0d42, 0x02de2413, 0x02de3ae4, 0x02de51bd, 0x02de6890,
+    0x02de7f61, 0x02de9632, 0x02dead0b, 0x02dec3e5, 0x02dedab6, 0x02def180,
+    0x02df0859, 0x02df1f33, 0x02df3604, 0x02df4cd5, 0x02df63ae, 0x02df7a81,
+    0x02df9152, 0x02dfa823, 0x02dfbefc, 0x02dfd5d6, 0x02dfeca0, 0x02e00371,
+    0x02e01a4a, 0x02e03124, 0x02e047f5, 0x02e05ec6, 0x02e07598, 0x02e08c72,
+    0x02e0a343, 0x02e0ba14, 0x02e0d0ed, 0x02e0e7c0, 0x02e0fe91, 0x02e11562,
+    0x02e12c3b, 0x02e14315, 0x02e159e6, 0x02e170b0, 0x02e18789, 0x02e19e63,
+    0x02e1b534, 0x02e1cc05, 0x02e1e2de, 0x02e1f9b1, 0x02e21082, 0x02e22753,
+    0x02e23e2c, 0x02e25506, 0x02e26bd0, 0x02e282a1, 0x02e2997a, 0x02e2b054,
+    0x02e2c725, 0x02e2ddf6, 0x02e2f4c8, 0x02e30ba2, 0x02e32273, 0x02e33944,
+    0x02e3501d, 0x02e366f0, 0x02e37dc1, 0x02e39492, 0x02e3ab6b, 0x02e3c245,
+    0x02e3d916, 0x02e3efe0, 0x02e406b1, 0x02e41d82, 0x02e43453, 0x02e44b24,
+    0x02e461fd, 0x02e478d0, 0x02e48fa1, 0x02e4a672, 0x02e4bd4b, 0x02e4d425,
+    0x02e4eaf6, 0x02e501c0, 0x02e51899, 0x02e52f73, 0x02e54644, 0x02e55d15,
+    0x02e573ee, 0x02e58ac1, 0x02e5a192, 0x02e5b863, 0x02e5cf3c, 0x02e5e616,
+    0x02e5fce0, 0x02e613b1, 0x02e62a8a, 0x02e64164, 0x02e65835, 0x02e66f06,
+    0x02e685d8, 0x02e69cb2, 0x02e6b383, 0x02e6ca54, 0x02e6e12d, 0x02e6f800,
+    0x02e70ed1, 0x02e725a2, 0x02e73c7b, 0x02e75355, 0x02e76a26, 0x02e780f0,
+    0x02e797c9, 0x02e7aea3, 0x02e7c574, 0x02e7dc45, 0x02e7f31e, 0x02e809f1,
+    0x02e820c2, 0x02e83793, 0x02e84e6c, 0x02e86546, 0x02e87c10, 0x02e892e1,
+    0x02e8a9ba, 0x02e8c094, 0x02e8d765, 0x02e8ee36, 0x02e90508, 0x02e91be2,
+    0x02e932b3, 0x02e94984, 0x02e9605d, 0x02e97730, 0x02e98e01, 0x02e9a4d2,
+    0x02e9bbab, 0x02e9d285, 0x02e9e956, 0x02ea0020, 0x02ea16f9, 0x02ea2dd3,
+    0x02ea44a4, 0x02ea5b75, 0x02ea724e, 0x02ea8921, 0x02ea9ff2, 0x02eab6c3,
+    0x02eacd9c, 0x02eae476, 0x02eafb40, 0x02eb1211, 0x02eb28ea, 0x02eb3fc4,
+    0x02eb5695, 0x02eb6d66, 0x02eb8438, 0x02eb9b12, 0x02ebb1e3, 0x02ebc8b4,
+    0x02ebdf8d, 0x02ebf660, 0x02ec0d31, 0x02ec2402, 0x02ec3adb, 0x02ec51b5,
+    0x02ec6886, 0x02ec7f50, 0x02ec9629, 0x02ecad03, 0x02ecc3d4, 0x02ecdaa5,
+    0x02ecf17e, 0x02ed0851, 0x02ed1f22, 0x02ed35f3, 0x02ed4ccc, 0x02ed63a6,
+    0x02ed7a70, 0x02ed9141, 0x02eda81a, 0x02edbef4, 0x02edd5c5, 0x02edec96,
+    0x02ee0368, 0x02ee1a42, 0x02ee3113, 0x02ee47e4, 0x02ee5ebd, 0x02ee7590,
+    0x02ee8c61, 0x02eea332, 0x02eeba0b, 0x02eed0e5, 0x02eee7b6, 0x02eefe80,
+    0x02ef1559, 0x02ef2c33, 0x02ef4304, 0x02ef59d5, 0x02ef70ae, 0x02ef8781,
+    0x02ef9e52, 0x02efb523, 0x02efcbfc, 0x02efe2d6, 0x02eff9a0, 0x02f01071,
+    0x02f0274a, 0x02f03e24, 0x02f054f5, 0x02f06bc6, 0x02f08298, 0x02f09972,
+    0x02f0b043, 0x02f0c714, 0x02f0dded, 0x02f0f4c0, 0x02f10b91, 0x02f12262,
+    0x02f1393b, 0x02f15015, 0x02f166e6, 0x02f17db0, 0x02f19489, 0x02f1ab63,
+    0x02f1c234, 0x02f1d905, 0x02f1efde, 0x02f206b1, 0x02f21d82, 0x02f23453,
+    0x02f24b2c, 0x02f26206, 0x02f278d0, 0x02f28fa1, 0x02f2a67a, 0x02f2bd54,
+    0x02f2d425, 0x02f2eaf6, 0x02f301c8, 0x02f318a2, 0x02f32f73, 0x02f34644,
+    0x02f35d1d, 0x02f373f0, 0x02f38ac1, 0x02f3a192, 0x02f3b86b, 0x02f3cf45,
+    0x02f3e616, 0x02f3fce0, 0x02f413b9, 0x02f42a93, 0x02f44164, 0x02f45835,
+    0x02f46f0e, 0x02f485e1, 0x02f49cb2, 0x02f4b383, 0x02f4ca5c, 0x02f4e136,
+    0x02f4f800, 0x02f50ed1, 0x02f525aa, 0x02f53c84, 0x02f55355, 0x02f56a26,
+    0x02f580f8, 0x02f597d2, 0x02f5aea3, 0x02f5c574, 0x02f5dc45, 0x02f5f316,
+    0x02f609e0, 0x02f620b1, 0x02f6378a, 0x02f64e64, 0x02f66535, 0x02f67c06,
+    0x02f692d8, 0x02f6a9b2, 0x02f6c083, 0x02f6d754, 0x02f6ee2d, 0x02f70500,
+    0x02f71bd1, 0x02f732a2, 0x02f7497b, 0x02f76055, 0x02f77726, 0x02f78df0,
+    0x02f7a4c9, 0x02f7bba3, 0x02f7d274, 0x02f7e945, 0x02f8001e, 0x02f816f1,
+    0x02f82dc2, 0x02f84493, 0x02f85b6c, 0x02f87246, 0x02f88910, 0x02f89fe1,
+    0x02f8b6ba, 0x02f8cd94, 0x02f8e465, 0x02f8fb36, 0x02f91208, 0x02f928e2,
+    0x02f93fb3, 0x02f95684, 0x02f96d5d, 0x02f98430, 0x02f99b01, 0x02f9b1d2,
+    0x02f9c8ab, 0x02f9df85, 0x02f9f656, 0x02fa0d20, 0x02fa23f9, 0x02fa3ad3,
+    0x02fa51a4, 0x02fa6875, 0x02fa7f4e, 0x02fa9621, 0x02faacf2, 0x02fac3c3,
+    0x02fada9c, 0x02faf176, 0x02fb0840, 0x02fb1f11, 0x02fb35ea, 0x02fb4cc4,
+    0x02fb6395, 0x02fb7a66, 0x02fb9138, 0x02fba812, 0x02fbbee3, 0x02fbd5b4,
+    0x02fbec8d, 0x02fc0360, 0x02fc1a31, 0x02fc3102, 0x02fc47db, 0x02fc5eb5,
+    0x02fc7586, 0x02fc8c50, 0x02fca329, 0x02fcba03, 0x02fcd0d4, 0x02fce7a5,
+    0x02fcfe7e, 0x02fd1551, 0x02fd2c22, 0x02fd42f3, 0x02fd59cc, 0x02fd70a6,
+    0x02fd8770, 0x02fd9e41, 0x02fdb51a, 0x02fdcbf4, 0x02fde2c5, 0x02fdf996,
+    0x02fe1068, 0x02fe2742, 0x02fe3e13, 0x02fe54e4, 0x02fe6bbd, 0x02fe8290,
+    0x02fe9961, 0x02feb032, 0x02fec703, 0x02feddd4, 0x02fef4a5, 0x02ff0b76,
+    0x02ff2248, 0x02ff3922, 0x02ff4ff3, 0x02ff66c4, 0x02ff7d9d, 0x02ff9470,
+    0x02ffab41, 0x02ffc212, 0x02ffd8eb, 0x02ffefc5, 0x03000696, 0x03001d60,
+    0x03003439, 0x03004b13, 0x030061e4, 0x030078b5, 0x03008f8e, 0x0300a661,
+    0x0300bd32, 0x0300d403, 0x0300eadc, 0x030101b6, 0x03011880, 0x03012f51,
+    0x0301462a, 0x03015d04, 0x030173d5, 0x03018aa6, 0x0301a178, 0x0301b852,
+    0x0301cf23, 0x0301e5f4, 0x0301fccd, 0x030213a0, 0x03022a71, 0x03024142,
+    0x0302581b, 0x03026ef5, 0x030285c6, 0x03029c90, 0x0302b369, 0x0302ca43,
+    0x0302e114, 0x0302f7e5, 0x03030ebe, 0x03032591, 0x03033c62, 0x03035333,
+    0x03036a0c, 0x030380e6, 0x030397b0, 0x0303ae81, 0x0303c55a, 0x0303dc34,
+    0x0303f305, 0x030409d6, 0x030420a8, 0x03043782, 0x03044e53, 0x03046524,
+    0x03047bfd, 0x030492d0, 0x0304a9a1, 0x0304c072, 0x0304d74b, 0x0304ee25,
+    0x030504f6, 0x03051bc0, 0x03053299, 0x03054973, 0x03056044, 0x03057715,
+    0x03058dee, 0x0305a4c1, 0x0305bb92, 0x0305d263, 0x0305e93c, 0x03060016,
+    0x030616e0, 0x03062db1, 0x0306448a, 0x03065b64, 0x03067235, 0x03068906,
+    0x03069fd8, 0x0306b6b2, 0x0306cd83, 0x0306e454, 0x0306fb2d, 0x03071200,
+    0x030728d1, 0x03073fa2, 0x0307567b, 0x03076d55, 0x03078426, 0x03079af0,
+    0x0307b1c1, 0x0307c892, 0x0307df63, 0x0307f634, 0x03080d0d, 0x030823e0,
+    0x03083ab1, 0x03085182, 0x0308685b, 0x03087f35, 0x03089606, 0x0308acd0,
+    0x0308c3a9, 0x0308da83, 0x0308f154, 0x03090825, 0x03091efe, 0x030935d1,
+    0x03094ca2, 0x03096373, 0x03097a4c, 0x03099126, 0x0309a7f0, 0x0309bec1,
+    0x0309d59a, 0x0309ec74, 0x030a0345, 0x030a1a16, 0x030a30e8, 0x030a47c2,
+    0x030a5e93, 0x030a7564, 0x030a8c3d, 0x030aa310, 0x030ab9e1, 0x030ad0b2,
+    0x030ae78b, 0x030afe65, 0x030b1536, 0x030b2c00, 0x030b42d9, 0x030b59b3,
+    0x030b7084, 0x030b8755, 0x030b9e2e, 0x030bb501, 0x030bcbd2, 0x030be2a3,
+    0x030bf97c, 0x030c1056, 0x030c2720, 0x030c3df1, 0x030c54ca, 0x030c6ba4,
+    0x030c8275, 0x030c9946, 0x030cb018, 0x030cc6f2, 0x030cddc3, 0x030cf494,
+    0x030d0b6d, 0x030d2240, 0x030d3911, 0x030d4fe2, 0x030d66bb, 0x030d7d95,
+    0x030d9466, 0x030dab30, 0x030dc209, 0x030dd8e3, 0x030defb4, 0x030e0685,
+    0x030e1d5e, 0x030e3431, 0x030e4b02, 0x030e61d3, 0x030e78ac, 0x030e8f86,
+    0x030ea650, 0x030ebd21, 0x030ed3fa, 0x030eead4, 0x030f01a5, 0x030f1876,
+    0x030f2f48, 0x030f4622, 0x030f5cf3, 0x030f73c4, 0x030f8a9d, 0x030fa170,
+    0x030fb841, 0x030fcf12, 0x030fe5eb, 0x030ffcc5, 0x03101396, 0x03102a60,
+    0x03104139, 0x03105813, 0x03106ee4, 0x031085b5, 0x03109c8e, 0x0310b361,
+    0x0310ca32, 0x0310e103, 0x0310f7dc, 0x03110eb6, 0x03112580, 0x03113c51,
+    0x0311532a, 0x03116a04, 0x031180d5, 0x031197a6, 0x0311ae78, 0x0311c552,
+    0x0311dc23, 0x0311f2f4, 0x031209cd, 0x031220a0, 0x03123771, 0x03124e42,
+    0x0312651b, 0x03127bf5, 0x031292c6, 0x0312a990, 0x0312c069, 0x0312d743,
+    0x0312ee14, 0x031304e5, 0x03131bbe, 0x03133291, 0x03134962, 0x03136033,
+    0x0313770c, 0x03138de6, 0x0313a4b0, 0x0313bb81, 0x0313d25a, 0x0313e934,
+    0x03140005, 0x031416d6, 0x03142da8, 0x03144482, 0x03145b53, 0x03147224,
+    0x031488fd, 0x03149fd0, 0x0314b6a1, 0x0314cd72, 0x0314e44b, 0x0314fb25,
+    0x031511f6, 0x031528c0, 0x03153f99, 0x03155673, 0x03156d44, 0x03158415,
+    0x03159aee, 0x0315b1c1, 0x0315c892, 0x0315df63, 0x0315f63c, 0x03160d16,
+    0x031623e0, 0x03163ab1, 0x0316518a, 0x03166864, 0x03167f35, 0x03169606,
+    0x0316acd8, 0x0316c3b2, 0x0316da83, 0x0316f154, 0x0317082d, 0x03171f00,
+    0x031735d1, 0x03174ca2, 0x0317637b, 0x03177a55, 0x03179126, 0x0317a7f0,
+    0x0317bec9, 0x0317d5a3, 0x0317ec74, 0x03180345, 0x03181a1e, 0x031830f1,
+    0x031847c2, 0x03185e93, 0x0318756c, 0x03188c46, 0x0318a310, 0x0318b9e1,
+    0x0318d0ba, 0x0318e794, 0x0318fe65, 0x03191536, 0x03192c08, 0x031942e2,
+    0x031959b3, 0x03197084, 0x03198755, 0x03199e26, 0x0319b4f0, 0x0319cbc1,
+    0x0319e29a, 0x0319f974, 0x031a1045, 0x031a2716, 0x031a3de8, 0x031a54c2,
+    0x031a6b93, 0x031a8264, 0x031a993d, 0x031ab010, 0x031ac6e1, 0x031addb2,
+    0x031af48b, 0x031b0b65, 0x031b2236, 0x031b3900, 0x031b4fd9, 0x031b66b3,
+    0x031b7d84, 0x031b9455, 0x031bab2e, 0x031bc201, 0x031bd8d2, 0x031befa3,
+    0x031c067c, 0x031c1d56, 0x031c3420, 0x031c4af1, 0x031c61ca, 0x031c78a4,
+    0x031c8f75, 0x031ca646, 0x031cbd18, 0x031cd3f2, 0x031ceac3, 0x031d0194,
+    0x031d186d, 0x031d2f40, 0x031d4611, 0x031d5ce2, 0x031d73bb, 0x031d8a95,
+    0x031da166, 0x031db830, 0x031dcf09, 0x031de5e3, 0x031dfcb4, 0x031e1385,
+    0x031e2a5e, 0x031e4131, 0x031e5802, 0x031e6ed3, 0x031e85ac, 0x031e9c86,
+    0x031eb350, 0x031eca21, 0x031ee0fa, 0x031ef7d4, 0x031f0ea5, 0x031f2576,
+    0x031f3c48, 0x031f5322, 0x031f69f3, 0x031f80c4, 0x031f979d, 0x031fae70,
+    0x031fc541, 0x031fdc12, 0x031ff2eb, 0x032009c5, 0x03202096, 0x03203760,
+    0x03204e39, 0x03206513, 0x03207be4, 0x032092b5, 0x0320a98e, 0x0320c061,
+    0x0320d732, 0x0320ee03, 0x032104dc, 0x03211bb6, 0x03213280, 0x03214951,
+    0x0321602a, 0x03217704, 0x03218dd5, 0x0321a4a6, 0x0321bb78, 0x0321d252,
+    0x0321e923, 0x0321fff4, 0x032216cd, 0x03222da0, 0x03224471, 0x03225b42,
+    0x03227213, 0x032288e4, 0x03229fb5, 0x0322b686, 0x0322cd58, 0x0322e432,
+    0x0322fb03, 0x032311d4, 0x032328ad, 0x03233f80, 0x03235651, 0x03236d22,
+    0x032383fb, 0x03239ad5, 0x0323b1a6, 0x0323c870, 0x0323df49, 0x0323f623,
+    0x03240cf4, 0x032423c5, 0x03243a9e, 0x03245171, 0x03246842, 0x03247f13,
+    0x032495ec, 0x0324acc6, 0x0324c390, 0x0324da61, 0x0324f13a, 0x03250814,
+    0x03251ee5, 0x032535b6, 0x03254c88, 0x03256362, 0x03257a33, 0x03259104,
+    0x0325a7dd, 0x0325beb0, 0x0325d581, 0x0325ec52, 0x0326032b, 0x03261a05,
+    0x032630d6, 0x032647a0, 0x03265e79, 0x03267553, 0x03268c24, 0x0326a2f5,
+    0x0326b9ce, 0x0326d0a1, 0x0326e772, 0x0326fe43, 0x0327151c, 0x03272bf6,
+    0x032742c0, 0x03275991, 0x0327706a, 0x03278744, 0x03279e15, 0x0327b4e6,
+    0x0327cbb8, 0x0327e292, 0x0327f963, 0x03281034, 0x0328270d, 0x03283de0,
+    0x032854b1, 0x03286b82, 0x0328825b, 0x03289935, 0x0328b006, 0x0328c6d0,
+    0x0328dda9, 0x0328f483, 0x03290b54, 0x03292225, 0x032938fe, 0x03294fd1,
+    0x032966a2, 0x03297d73, 0x0329944c, 0x0329ab26, 0x0329c1f0, 0x0329d8c1,
+    0x0329ef9a, 0x032a0674, 0x032a1d45, 0x032a3416, 0x032a4ae8, 0x032a61c2,
+    0x032a7893, 0x032a8f64, 0x032aa63d, 0x032abd10, 0x032ad3e1, 0x032aeab2,
+    0x032b018b, 0x032b1865, 0x032b2f36, 0x032b4600, 0x032b5cd1, 0x032b73a2,
+    0x032b8a73, 0x032ba144, 0x032bb81d, 0x032bcef0, 0x032be5c1, 0x032bfc92,
+    0x032c136b, 0x032c2a45, 0x032c4116, 0x032c57e0, 0x032c6eb9, 0x032c8593,
+    0x032c9c64, 0x032cb335, 0x032cca0e, 0x032ce0e1, 0x032cf7b2, 0x032d0e83,
+    0x032d255c, 0x032d3c36, 0x032d5300, 0x032d69d1, 0x032d80aa, 0x032d9784,
+    0x032dae55, 0x032dc526, 0x032ddbf8, 0x032df2d2, 0x032e09a3, 0x032e2074,
+    0x032e374d, 0x032e4e20, 0x032e64f1, 0x032e7bc2, 0x032e929b, 0x032ea975,
+    0x032ec046, 0x032ed710, 0x032eede9, 0x032f04c3, 0x032f1b94, 0x032f3265,
+    0x032f493e, 0x032f6011, 0x032f76e2, 0x032f8db3, 0x032fa48c, 0x032fbb66,
+    0x032fd230, 0x032fe901, 0x032fffda, 0x033016b4, 0x03302d85, 0x03304456,
+    0x03305b28, 0x03307202, 0x033088d3, 0x03309fa4, 0x0330b67d, 0x0330cd50,
+    0x0330e421, 0x0330faf2, 0x033111cb, 0x033128a5, 0x03313f76, 0x03315640,
+    0x03316d19, 0x033183f3, 0x03319ac4, 0x0331b195, 0x0331c86e, 0x0331df41,
+    0x0331f612, 0x03320ce3, 0x033223bc, 0x03323a96, 0x03325160, 0x03326831,
+    0x03327f0a, 0x033295e4, 0x0332acb5, 0x0332c386, 0x0332da58, 0x0332f132,
+    0x03330803, 0x03331ed4, 0x033335ad, 0x03334c80, 0x03336351, 0x03337a22,
+    0x033390fb, 0x0333a7d5, 0x0333bea6, 0x0333d570, 0x0333ec49, 0x03340323,
+    0x033419f4, 0x033430c5, 0x0334479e, 0x03345e71, 0x03347542, 0x03348c13,
+    0x0334a2ec, 0x0334b9c6, 0x0334d090, 0x0334e761, 0x0334fe3a, 0x03351514,
+    0x03352be5, 0x033542b6, 0x03355988, 0x03357062, 0x03358733, 0x03359e04,
+    0x0335b4dd, 0x0335cbb0, 0x0335e281, 0x0335f952, 0x0336102b, 0x03362705,
+    0x03363dd6, 0x033654a0, 0x03366b79, 0x03368253, 0x03369924, 0x0336aff5,
+    0x0336c6ce, 0x0336dda1, 0x0336f472, 0x03370b43, 0x0337221c, 0x033738f6,
+    0x03374fc0, 0x03376691, 0x03377d6a, 0x03379444, 0x0337ab15, 0x0337c1e6,
+    0x0337d8b8, 0x0337ef92, 0x03380663, 0x03381d34, 0x0338340d, 0x03384ae0,
+    0x033861b1, 0x03387882, 0x03388f5b, 0x0338a635, 0x0338bd06, 0x0338d3d0,
+    0x0338eaa9, 0x03390183, 0x03391854, 0x03392f25, 0x033945fe, 0x03395cd1,
+    0x033973a2, 0x03398a73, 0x0339a14c, 0x0339b826, 0x0339cef0, 0x0339e5c1,
+    0x0339fc9a, 0x033a1374, 0x033a2a45, 0x033a4116, 0x033a57e8, 0x033a6ec2,
+    0x033a8593, 0x033a9c64, 0x033ab33d, 0x033aca10, 0x033ae0e1, 0x033af7b2,
+    0x033b0e8b, 0x033b2565, 0x033b3c36, 0x033b5300, 0x033b69d9, 0x033b80b3,
+    0x033b9784, 0x033bae55, 0x033bc52e, 0x033bdc01, 0x033bf2d2, 0x033c09a3,
+    0x033c207c, 0x033c3756, 0x033c4e20, 0x033c64f1, 0x033c7bca, 0x033c92a4,
+    0x033ca975, 0x033cc046, 0x033cd718, 0x033cedf2, 0x033d04c3, 0x033d1b94,
+    0x033d3265, 0x033d4936, 0x033d6000, 0x033d76d1, 0x033d8daa, 0x033da484,
+    0x033dbb55, 0x033dd226, 0x033de8f8, 0x033dffd2, 0x033e16a3, 0x033e2d74,
+    0x033e444d, 0x033e5b20, 0x033e71f1, 0x033e88c2, 0x033e9f9b, 0x033eb675,
+    0x033ecd46, 0x033ee410, 0x033efae9, 0x033f11c3, 0x033f2894, 0x033f3f65,
+    0x033f563e, 0x033f6d11, 0x033f83e2, 0x033f9ab3, 0x033fb18c, 0x033fc866,
+    0x033fdf30, 0x033ff601, 0x03400cda, 0x034023b4, 0x03403a85, 0x03405156,
+    0x03406828, 0x03407f02, 0x034095d3, 0x0340aca4, 0x0340c37d, 0x0340da50,
+    0x0340f121, 0x034107f2, 0x03411ecb, 0x034135a5, 0x03414c76, 0x03416340,
+    0x03417a19, 0x034190f3, 0x0341a7c4, 0x0341be95, 0x0341d56e, 0x0341ec41,
+    0x03420312, 0x034219e3, 0x034230bc, 0x03424796, 0x03425e60, 0x03427531,
+    0x03428c0a, 0x0342a2e4, 0x0342b9b5, 0x0342d086, 0x0342e758, 0x0342fe32,
+    0x03431503, 0x03432bd4, 0x034342ad, 0x03435980, 0x03437051, 0x03438722,
+    0x03439dfb, 0x0343b4d5, 0x0343cba6, 0x0343e270, 0x0343f949, 0x03441023,
+    0x034426f4, 0x03443dc5, 0x0344549e, 0x03446b71, 0x03448242, 0x03449913,
+    0x0344afec, 0x0344c6c6, 0x0344dd90, 0x0344f461, 0x03450b3a, 0x03452214,
+    0x034538e5, 0x03454fb6, 0x03456688, 0x03457d62, 0x03459433, 0x0345ab04,
+    0x0345c1dd, 0x0345d8b0, 0x0345ef81, 0x03460652, 0x03461d23, 0x034633f4,
+    0x03464ac5, 0x03466196, 0x03467868, 0x03468f42, 0x0346a613, 0x0346bce4,
+    0x0346d3bd, 0x0346ea90, 0x03470161, 0x03471832, 0x03472f0b, 0x034745e5,
+    0x03475cb6, 0x03477380, 0x03478a59, 0x0347a133, 0x0347b804, 0x0347ced5,
+    0x0347e5ae, 0x0347fc81, 0x03481352, 0x03482a23, 0x034840fc, 0x034857d6,
+    0x03486ea0, 0x03488571, 0x03489c4a, 0x0348b324, 0x0348c9f5, 0x0348e0c6,
+    0x0348f798, 0x03490e72, 0x03492543, 0x03493c14, 0x034952ed, 0x034969c0,
+    0x03498091, 0x03499762, 0x0349ae3b, 0x0349c515, 0x0349dbe6, 0x0349f2b0,
+    0x034a0989, 0x034a2063, 0x034a3734, 0x034a4e05, 0x034a64de, 0x034a7bb1,
+    0x034a9282, 0x034aa953, 0x034ac02c, 0x034ad706, 0x034aedd0, 0x034b04a1,
+    0x034b1b7a, 0x034b3254, 0x034b4925, 0x034b5ff6, 0x034b76c8, 0x034b8da2,
+    0x034ba473, 0x034bbb44, 0x034bd21d, 0x034be8f0, 0x034bffc1, 0x034c1692,
+    0x034c2d6b, 0x034c4445, 0x034c5b16, 0x034c71e0, 0x034c88b9, 0x034c9f93,
+    0x034cb664, 0x034ccd35, 0x034ce40e, 0x034cfae1, 0x034d11b2, 0x034d2883,
+    0x034d3f5c, 0x034d5636, 0x034d6d00, 0x034d83d1, 0x034d9aaa, 0x034db184,
+    0x034dc855, 0x034ddf26, 0x034df5f8, 0x034e0cd2, 0x034e23a3, 0x034e3a74,
+    0x034e514d, 0x034e6820, 0x034e7ef1, 0x034e95c2, 0x034eac9b, 0x034ec375,
+    0x034eda46, 0x034ef110, 0x034f07e1, 0x034f1eb2, 0x034f3583, 0x034f4c54,
+    0x034f632d, 0x034f7a00, 0x034f90d1, 0x034fa7a2, 0x034fbe7b, 0x034fd555,
+    0x034fec26, 0x035002f0, 0x035019c9, 0x035030a3, 0x03504774, 0x03505e45,
+    0x0350751e, 0x03508bf1, 0x0350a2c2, 0x0350b993, 0x0350d06c, 0x0350e746,
+    0x0350fe10, 0x035114e1, 0x03512bba, 0x03514294, 0x03515965, 0x03517036,
+    0x03518708, 0x03519de2, 0x0351b4b3, 0x0351cb84, 0x0351e25d, 0x0351f930,
+    0x03521001, 0x035226d2, 0x03523dab, 0x03525485, 0x03526b56, 0x03528220,
+    0x035298f9, 0x0352afd3, 0x0352c6a4, 0x0352dd75, 0x0352f44e, 0x03530b21,
+    0x035321f2, 0x035338c3, 0x03534f9c, 0x03536676, 0x03537d40, 0x03539411,
+    0x0353aaea, 0x0353c1c4, 0x0353d895, 0x0353ef66, 0x03540638, 0x03541d12,
+    0x035433e3, 0x03544ab4, 0x0354618d, 0x03547860, 0x03548f31, 0x0354a602,
+    0x0354bcdb, 0x0354d3b5, 0x0354ea86, 0x03550150, 0x03551829, 0x03552f03,
+    0x035545d4, 0x03555ca5, 0x0355737e, 0x03558a51, 0x0355a122, 0x0355b7f3,
+    0x0355cecc, 0x0355e5a6, 0x0355fc70, 0x03561341, 0x03562a1a, 0x035640f4,
+    0x035657c5, 0x03566e96, 0x03568568, 0x03569c42, 0x0356b313, 0x0356c9e4,
+    0x0356e0bd, 0x0356f790, 0x03570e61, 0x03572532, 0x03573c0b, 0x035752e5,
+    0x035769b6, 0x03578080, 0x03579759, 0x0357ae33, 0x0357c504, 0x0357dbd5,
+    0x0357f2ae, 0x03580981, 0x03582052, 0x03583723, 0x03584dfc, 0x035864d6,
+    0x03587ba0, 0x03589271, 0x0358a94a, 0x0358c024, 0x0358d6f5, 0x0358edc6,
+    0x03590498, 0x03591b72, 0x03593243, 0x03594914, 0x03595fed, 0x035976c0,
+    0x03598d91, 0x0359a462, 0x0359bb3b, 0x0359d215, 0x0359e8e6, 0x0359ffb0,
+    0x035a1689, 0x035a2d63, 0x035a4434, 0x035a5b05, 0x035a71de, 0x035a88b1,
+    0x035a9f82, 0x035ab653, 0x035acd2c, 0x035ae406, 0x035afad0, 0x035b11a1,
+    0x035b287a, 0x035b3f54, 0x035b5625, 0x035b6cf6, 0x035b83c8, 0x035b9aa2,
+    0x035bb173, 0x035bc844, 0x035bdf1d, 0x035bf5f0, 0x035c0cc1, 0x035c2392,
+    0x035c3a6b, 0x035c5145, 0x035c6816, 0x035c7ee0, 0x035c95b9, 0x035cac93,
+    0x035cc364, 0x035cda35, 0x035cf10e, 0x035d07e1, 0x035d1eb2, 0x035d3583,
+    0x035d4c5c, 0x035d6336, 0x035d7a00, 0x035d90d1, 0x035da7aa, 0x035dbe84,
+    0x035dd555, 0x035dec26, 0x035e02f8, 0x035e19d2, 0x035e30a3, 0x035e4774,
+    0x035e5e4d, 0x035e7520, 0x035e8bf1, 0x035ea2c2, 0x035eb99b, 0x035ed075,
+    0x035ee746, 0x035efe10, 0x035f14e9, 0x035f2bc3, 0x035f4294, 0x035f5965,
+    0x035f703e, 0x035f8711, 0x035f9de2, 0x035fb4b3, 0x035fcb8c, 0x035fe266,
+    0x035ff930, 0x03601001, 0x036026da, 0x03603db4, 0x03605485, 0x03606b56,
+    0x03608228, 0x03609902, 0x0360afd3, 0x0360c6a4, 0x0360dd75, 0x0360f446,
+    0x03610b10, 0x036121e1, 0x036138ba, 0x03614f94, 0x03616665, 0x03617d36,
+    0x03619408, 0x0361aae2, 0x0361c1b3, 0x0361d884, 0x0361ef5d, 0x03620630,
+    0x03621d01, 0x036233d2, 0x03624aab, 0x03626185, 0x03627856, 0x03628f20,
+    0x0362a5f9, 0x0362bcd3, 0x0362d3a4, 0x0362ea75, 0x0363014e, 0x03631821,
+    0x03632ef2, 0x036345c3, 0x03635c9c, 0x03637376, 0x03638a40, 0x0363a111,
+    0x0363b7ea, 0x0363cec4, 0x0363e595, 0x0363fc66, 0x03641338, 0x03642a12,
+    0x036440e3, 0x036457b4, 0x03646e8d, 0x03648560, 0x03649c31, 0x0364b302,
+    0x0364c9db, 0x0364e0b5, 0x0364f786, 0x03650e50, 0x03652529, 0x03653c03,
+    0x036552d4, 0x036569a5, 0x0365807e, 0x03659751, 0x0365ae22, 0x0365c4f3,
+    0x0365dbcc, 0x0365f2a6, 0x03660970, 0x03662041, 0x0366371a, 0x03664df4,
+    0x036664c5, 0x03667b96, 0x03669268, 0x0366a942, 0x0366c013, 0x0366d6e4,
+    0x0366edbd, 0x03670490, 0x03671b61, 0x03673232, 0x0367490b, 0x03675fe5,
+    0x036776b6, 0x03678d80, 0x0367a459, 0x0367bb33, 0x0367d204, 0x0367e8d5,
+    0x0367ffae, 0x03681681, 0x03682d52, 0x03684423, 0x03685afc, 0x036871d6,
+    0x036888a0, 0x03689f71, 0x0368b64a, 0x0368cd24, 0x0368e3f5, 0x0368fac6,
+    0x03691198, 0x03692872, 0x03693f43, 0x03695614, 0x03696ced, 0x036983c0,
+    0x03699a91, 0x0369b162, 0x0369c833, 0x0369df04, 0x0369f5d5, 0x036a0ca6,
+    0x036a2378, 0x036a3a52, 0x036a5123, 0x036a67f4, 0x036a7ecd, 0x036a95a0,
+    0x036aac71, 0x036ac342, 0x036ada1b, 0x036af0f5, 0x036b07c6, 0x036b1e90,
+    0x036b3569, 0x036b4c43, 0x036b6314, 0x036b79e5, 0x036b90be, 0x036ba791,
+    0x036bbe62, 0x036bd533, 0x036bec0c, 0x036c02e6, 0x036c19b0, 0x036c3081,
+    0x036c475a, 0x036c5e34, 0x036c7505, 0x036c8bd6, 0x036ca2a8, 0x036cb982,
+    0x036cd053, 0x036ce724, 0x036cfdfd, 0x036d14d0, 0x036d2ba1, 0x036d4272,
+    0x036d594b, 0x036d7025, 0x036d86f6, 0x036d9dc0, 0x036db499, 0x036dcb73,
+    0x036de244, 0x036df915, 0x036e0fee, 0x036e26c1, 0x036e3d92, 0x036e5463,
+    0x036e6b3c, 0x036e8216, 0x036e98e0, 0x036eafb1, 0x036ec68a, 0x036edd64,
+    0x036ef435, 0x036f0b06, 0x036f21d8, 0x036f38b2, 0x036f4f83, 0x036f6654,
+    0x036f7d2d, 0x036f9400, 0x036faad1, 0x036fc1a2, 0x036fd87b, 0x036fef55,
+    0x03700626, 0x03701cf0, 0x037033c9, 0x03704aa3, 0x03706174, 0x03707845,
+    0x03708f1e, 0x0370a5f1, 0x0370bcc2, 0x0370d393, 0x0370ea6c, 0x03710146,
+    0x03711810, 0x03712ee1, 0x037145ba, 0x03715c94, 0x03717365, 0x03718a36,
+    0x0371a108, 0x0371b7e2, 0x0371ceb3, 0x0371e584, 0x0371fc5d, 0x03721330,
+    0x03722a01, 0x037240d2, 0x037257ab, 0x03726e85, 0x03728556, 0x03729c20,
+    0x0372b2f1, 0x0372c9c2, 0x0372e093, 0x0372f764, 0x03730e3d, 0x03732510,
+    0x03733be1, 0x037352b2, 0x0373698b, 0x03738065, 0x03739736, 0x0373ae00,
+    0x0373c4d9, 0x0373dbb3, 0x0373f284, 0x03740955, 0x0374202e, 0x03743701,
+    0x03744dd2, 0x037464a3, 0x03747b7c, 0x03749256, 0x0374a920, 0x0374bff1,
+    0x0374d6ca, 0x0374eda4, 0x03750475, 0x03751b46, 0x03753218, 0x037548f2,
+    0x03755fc3, 0x03757694, 0x03758d6d, 0x0375a440, 0x0375bb11, 0x0375d1e2,
+    0x0375e8bb, 0x0375ff95, 0x03761666, 0x03762d30, 0x03764409, 0x03765ae3,
+    0x037671b4, 0x03768885, 0x03769f5e, 0x0376b631, 0x0376cd02, 0x0376e3d3,
+    0x0376faac, 0x03771186, 0x03772850, 0x03773f21, 0x037755fa, 0x03776cd4,
+    0x037783a5, 0x03779a76, 0x0377b148, 0x0377c822, 0x0377def3, 0x0377f5c4,
+    0x03780c9d, 0x03782370, 0x03783a41, 0x03785112, 0x037867eb, 0x03787ec5,
+    0x03789596, 0x0378ac60, 0x0378c339, 0x0378da13, 0x0378f0e4, 0x037907b5,
+    0x03791e8e, 0x03793561, 0x03794c32, 0x03796303, 0x037979dc, 0x037990b6,
+    0x0379a780, 0x0379be51, 0x0379d52a, 0x0379ec04, 0x037a02d5, 0x037a19a6,
+    0x037a3078, 0x037a4752, 0x037a5e23, 0x037a74f4, 0x037a8bcd, 0x037aa2a0,
+    0x037ab971, 0x037ad042, 0x037ae71b, 0x037afdf5, 0x037b14c6, 0x037b2b90,
+    0x037b4269, 0x037b5943, 0x037b7014, 0x037b86e5, 0x037b9db0,
+};
@@ -0,0 +1,43 @@
+/*
+ * Generate datetime_year_table.h, the per-year table used by datetime.c.
+ *
+ * Every entry packs the facts of one year (0 ~ 9999 + 1) into 32 bits:
+ *     days before January 1 (0001-01-01 is day 1):22 | leap:1 | weekday of January 1:3
+ * The entry of year 10000 only holds the days before it, so the last year has an upper bound.
+ * The facts are computed year by year without datetime.c, so the table does not depend on
+ * the code it replaces.
+ */
+#include <stdio.h>
+
+#define FIRST_YEAR 1
+#define LAST_YEAR 9999
+#define ENTRIES_PER_LINE 6
+
+static int is_leap(int year) {
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+int main(void) {
+    unsigned long days_before = 0;
+    unsigned long entry;
+    int weekday = 1; /* 0001-01-01 is a Monday */
+    int year;
+
+    printf("/* Generated by gen_year_table.c, do not edit. */\n");
+    printf("/* days before January 1:22 | leap:1 | weekday of January 1:3, for the years 0 ~ %d */\n", LAST_YEAR + 1);
+    printf("static const uint32_t YEAR_TABLE[%d] CACHE_ALIGNED = {\n    0x00000000,", LAST_YEAR + 2);
+
+    for (year = FIRST_YEAR; year <= LAST_YEAR + 1; year++) {
+        entry = days_before << 4;
+        if (year <= LAST_YEAR) {
+            entry |= (unsigned long)is_leap(year) << 3 | (unsigned long)weekday;
+        }
+        printf(year % ENTRIES_PER_LINE == 0 ? "\n    0x%08lx," : " 0x%08lx,", entry);
+
+        days_before += is_leap(year) ? 366 : 365;
+        weekday = (weekday + (is_leap(year) ? 366 : 365)) % 7;
+    }
+
+    printf("\n};\n");
+    return 0;
+}
@@ -0,0 +1,228 @@
+/*
+ * Tests of datetime_coro.hpp, and of the C API seen from C++. Build with `make test_coro` (needs a C++20 compiler).
+ */
+
+#include "datetime_coro.hpp"
+#include "datetime_alarm.h"
+#include "datetime_business.h"
+#include "datetime_clock.h"
+#include "datetime_recurrence.h"
+#include "datetime_thread.h"
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+namespace {
+
+int64_t elapsed_ms(const struct timespec &start) {
+    struct timespec end;
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (int64_t)(end.tv_sec - start.tv_sec) * MILLISECONDS_PER_SECOND + (end.tv_nsec - start.tv_nsec) / NANOSECONDS_PER_MILLISECOND;
+}
+
+/* A coroutine kept suspended at its end, so that the test can destroy it whenever it likes. */
+struct Handle {
+    struct promise_type {
+        Handle get_return_object() noexcept {
+            return Handle{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        std::suspend_never initial_suspend() noexcept {
+            return {};
+        }
+        std::suspend_always final_suspend() noexcept {
+            return {};
+        }
+        void return_void() noexcept {
+        }
+        void unhandled_exception() noexcept {
+            std::terminate();
+        }
+    };
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+datetime::Task sleep_twice(int *steps) {
+    TimeInterval interval = {0, 0, 0, 0, 20};
+
+    co_await datetime::sleep_for(interval);
+    (*steps)++;
+    co_await datetime::sleep_until(datetime_add(datetime_now(), 0, 10));
+    (*steps)++;
+}
+
+datetime::Task sleep_or_error(DateTime deadline, int *error) {
+    try {
+        co_await datetime::sleep_until(deadline);
+        *error = 0;
+    } catch (const std::system_error &e) {
+        *error = e.code().value();
+    }
+}
+
+datetime::Task sleep_for_or_error(int *error) {
+    TimeInterval interval = {0, 0, 0, 0, 1};
+
+    try {
+        co_await datetime::sleep_for(interval);
+        *error = 0;
+    } catch (const std::system_error &e) {
+        *error = e.code().value();
+    }
+}
+
+Handle sleep_long(datetime::Loop &loop, bool *woken) {
+    TimeInterval interval = {0, 0, 0, 10, 0};
+
+    co_await datetime::sleep_for(loop, interval);
+    *woken = true;
+}
+
+} // namespace
+
+void test_coro_sleep() {
+    datetime::Loop loop;
+    struct timespec start;
+    int steps = 0;
+
+    assert(datetime::Loop::current() == &loop);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    sleep_twice(&steps);
+    assert(steps == 0 && loop.count() == 1);
+    loop.run();
+    assert(steps == 2 && loop.count() == 0);
+    assert(elapsed_ms(start) >= 25 && elapsed_ms(start) < 2000);
+
+    printf("[PASS] coro_sleep\n");
+}
+
+void test_coro_error() {
+    DateTime invalid = datetime_create(2024, JAN, 1, 0, 0, 0, 0);
+    int error = -1;
+
+    {
+        datetime::Loop loop;
+
+        /* Thrown from co_await, without suspending */
+        invalid.date.day = 32;
+        sleep_or_error(invalid, &error);
+        assert(error == EINVAL && loop.count() == 0);
+        error = -1;
+        sleep_or_error(datetime_create(2000, JAN, 1, 0, 0, 0, 0), &error);
+        assert(error == -1 && loop.count() == 1);
+        loop.run();
+        assert(error == 0);
+    }
+
+    /* No current loop once the loop is destroyed */
+    assert(datetime::Loop::current() == nullptr);
+    error = -1;
+    sleep_for_or_error(&error);
+    assert(error == EINVAL);
+    error = -1;
+    sleep_or_error(datetime_now(), &error);
+    assert(error == EINVAL);
+
+    printf("[PASS] coro_error\n");
+}
+
+void test_coro_cancel() {
+    datetime::Loop loop;
+    bool woken[2] = {false, false};
+    Handle first = sleep_long(loop, &woken[0]);
+    Handle second = sleep_long(loop, &woken[1]);
+
+    assert(loop.count() == 2);
+    /* Destroying a suspended coroutine cancels its sleeper */
+    first.handle.destroy();
+    assert(loop.count() == 1);
+    second.handle.destroy();
+    assert(loop.count() == 0);
+    loop.run();
+    assert(!woken[0] && !woken[1]);
+
+    printf("[PASS] coro_cancel\n");
+}
+
+void test_coro_c_api() {
+    const char BUFFER[] = "2024-02-29 12:00:00.0002023-02-29 12:00:00.000";
+    DateTimeColumn *column;
+    DateTime datetimes[2];
+    int valid[3] = {-1, -1, -1};
+
+    /* The int arrays of valid rows have the same layout in C and C++ */
+    assert(datetime_array_parse(BUFFER, DATETIME_STRING_LENGTH, datetimes, valid, 2) == 1);
+    assert(valid[0] == 1 && valid[1] == 0 && valid[2] == -1);
+    assert(datetime_compare(datetimes[0], datetime_create(2024, FEB, 29, 12, 0, 0, 0)) == 0);
+
+    column = datetime_column_create(2);
+    assert(column != nullptr);
+    datetime_column_set(column, 0, datetimes[0]);
+    column->days[1] = 30;
+    column->months[1] = FEB;
+    column->years[1] = 2024;
+    valid[0] = valid[1] = valid[2] = -1;
+    assert(datetime_column_validate(column, valid) == 1);
+    assert(valid[0] == 1 && valid[1] == 0 && valid[2] == -1);
+    datetime_column_destroy(column);
+
+    printf("[PASS] coro_c_api\n");
+}
+
+void test_coro_c_headers() {
+    const char BUFFER[] = "2024-02-29 12:00:00.0002023-02-29 12:00:00.0002024-03-01 00:00:00.000";
+    const Date DATES[3] = {{2024, JAN, 5}, {2024, JAN, 6}, {2025, JAN, 1}};
+    BusinessCalendar *calendar;
+    Recurrence *rules[2];
+    TscClock *clock;
+    DateTimeAlarm *alarm;
+    DateTime datetimes[3];
+    Date results[3];
+    int valid[4] = {-1, -1, -1, -1};
+
+    /* Every public header declares its functions extern "C", with int arrays and flags */
+    assert(datetime_parallel_parse(nullptr, BUFFER, DATETIME_STRING_LENGTH, datetimes, valid, 3) == 2);
+    assert(valid[0] == 1 && valid[1] == 0 && valid[2] == 1 && valid[3] == -1);
+
+    calendar = business_calendar_create(date_create(2024, JAN, 1), date_create(2024, DEC, 31), BUSINESS_WEEKEND_SAT_SUN);
+    assert(calendar != nullptr);
+    valid[0] = valid[1] = valid[2] = -1;
+    assert(business_calendar_add_many(calendar, DATES, 1, results, valid, 3) == 2);
+    assert(valid[0] == 1 && valid[1] == 1 && valid[2] == 0 && valid[3] == -1);
+    assert(date_compare(results[0], date_create(2024, JAN, 8)) == 0);
+    business_calendar_destroy(calendar);
+
+    rules[0] = recurrence_compile_cron("0 12 * * *");
+    rules[1] = recurrence_compile_rrule("FREQ=DAILY;COUNT=1", datetime_create(2024, FEB, 28, 12, 0, 0, 0));
+    assert(rules[0] != nullptr && rules[1] != nullptr);
+    valid[0] = valid[1] = -1;
+    assert(recurrence_matches_many(rules, datetimes[0], valid, 2) == 1);
+    assert(valid[0] == 1 && valid[1] == 0 && valid[2] == 0);
+    valid[0] = valid[1] = -1;
+    assert(recurrence_next_occurrence_many(rules, datetimes[0], datetimes, valid, 2) == 1);
+    assert(valid[0] == 1 && valid[1] == 0);
+    recurrence_destroy(rules[0]);
+    recurrence_destroy(rules[1]);
+
+    clock = tsc_clock_create(1000, 0);
+    assert(clock != nullptr && !tsc_clock_is_tsc(clock));
+    tsc_clock_destroy(clock);
+    alarm = datetime_alarm_create(1);
+    assert(alarm != nullptr && !datetime_alarm_armed(alarm, nullptr));
+    datetime_alarm_destroy(alarm);
+
+    printf("[PASS] coro_c_headers\n");
+}
+
+int main() {
+    test_coro_sleep();
+    test_coro_error();
+    test_coro_cancel();
+    test_coro_c_api();
+    test_coro_c_headers();
+    printf("[PASS] All\n");
+    return 0;
+}
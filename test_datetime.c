@@ -1,9 +1,21 @@
+#define _POSIX_C_SOURCE 200112L
+
+#include <errno.h>
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
 #include <assert.h>
+#include <pthread.h>
 #include "datetime.h"
+#include "datetime_thread.h"
+#include "datetime_business.h"
+#include "datetime_recurrence.h"
+#include "datetime_wheel.h"
+#include "datetime_alarm.h"
+#include "datetime_loop.h"
+#include "datetime_clock.h"
 
 void test_is_leap_year() {
     assert(is_leap_year(1) == false);
@@ -21,6 +33,44 @@ void test_is_leap_year() {
     printf("[PASS] is_leap_year\n");
 }
 
+void test_year_table() {
+    int ordinal = 1;
+    int year;
+    int month;
+    int day;
+    int day_of_year;
+    Weekday day_of_week = MON;
+    DateTime datetime;
+
+    /* Walk every day of 0001-01-01 ~ 9999-12-31 by plain counting and compare with the table lookups */
+    for (year = 1; year <= 9999; year++) {
+        assert(is_leap_year(year) == ((year % 4 == 0 && year % 100 != 0) || year % 400 == 0));
+        day_of_year = 0;
+        for (month = JAN; month <= DEC; month++) {
+            for (day = 1; day <= days_in_month(year, month); day++) {
+                day_of_year++;
+                assert(nth_day_of_year_unchecked(year, month, day) == day_of_year);
+                assert(weekday_unchecked(year, month, day) == day_of_week);
+                datetime = datetime_from_ordinal_unchecked(ordinal);
+                assert(datetime.date.year == year && datetime.date.month == month && datetime.date.day == day);
+                assert(datetime_to_ordinal_unchecked(datetime) == ordinal);
+                ordinal++;
+                day_of_week = (Weekday)((day_of_week + 1) % DAYS_IN_WEEK);
+            }
+        }
+        assert(day_of_year == days_in_year(year));
+    }
+    assert(ordinal == 3652060);
+
+    /* Years outside the table still follow the Gregorian rules */
+    assert(is_leap_year(0) == true);
+    assert(is_leap_year(-4) == true);
+    assert(is_leap_year(10000) == true);
+    assert(is_leap_year(10100) == false);
+
+    printf("[PASS] year_table\n");
+}
+
 void test_month_name() {
     assert(strcmp(month_name(JAN), "January") == 0);
     assert(strcmp(month_name(FEB), "February") == 0);
@@ -138,6 +188,177 @@ void test_weekday() {
     printf("[PASS] weekday\n");
 }
 
+void test_weekday_from_ordinal() {
+    Weekday day_of_week = SUN;
+
+    assert(weekday_from_ordinal(1) == MON);
+    assert(weekday_from_ordinal(7) == SUN);
+    assert(weekday_from_ordinal(738945) == THU); /* 2024-02-29 */
+    assert(weekday_from_ordinal(3652059) == FRI);
+    assert(weekday_from_ordinal_unchecked(719163) == THU); /* 1970-01-01 */
+    assert(weekday_from_ordinal_checked(3652059, &day_of_week) == DATETIME_OK && day_of_week == FRI);
+    assert(weekday_from_ordinal_checked(0, &day_of_week) == DATETIME_ERROR_RANGE && day_of_week == FRI);
+    assert(weekday_from_ordinal_checked(3652060, &day_of_week) == DATETIME_ERROR_RANGE);
+    assert(weekday_from_ordinal_checked(1, NULL) == DATETIME_ERROR_ARGUMENT);
+
+    printf("[PASS] weekday_from_ordinal\n");
+}
+
+void test_weekday_many() {
+    const size_t COUNT = 3652059;
+    Date *dates;
+    Weekday *weekdays;
+    size_t i;
+
+    dates = (Date *)malloc(COUNT * sizeof(Date));
+    weekdays = (Weekday *)malloc(COUNT * sizeof(Weekday));
+    assert(dates != NULL && weekdays != NULL);
+
+    for (i = 0; i < COUNT; i++) {
+        dates[i] = datetime_from_ordinal((int)i + 1).date;
+        weekdays[i] = (Weekday)-1;
+    }
+
+    /* Start off the 8-row grid and end with a partial block */
+    weekday_many(dates + 3, weekdays + 3, COUNT - 3);
+    weekday_many(dates, weekdays, 3);
+    for (i = 0; i < COUNT; i++) {
+        assert(weekdays[i] == weekday(dates[i].year, dates[i].month, dates[i].day));
+        assert(weekdays[i] == weekday_from_ordinal((int)i + 1));
+    }
+    weekday_many(dates, NULL, COUNT);
+    weekday_many(NULL, weekdays, COUNT);
+
+    free(weekdays);
+    free(dates);
+
+    printf("[PASS] weekday_many\n");
+}
+
+void test_iso_weeks_in_year() {
+    assert(iso_weeks_in_year(2004) == 53); /* leap, starts on a Thursday */
+    assert(iso_weeks_in_year(2015) == 53); /* starts on a Thursday */
+    assert(iso_weeks_in_year(2020) == 53); /* leap, starts on a Wednesday */
+    assert(iso_weeks_in_year(2019) == 52); /* starts on a Tuesday */
+    assert(iso_weeks_in_year(2014) == 52); /* starts on a Wednesday, not leap */
+    assert(iso_weeks_in_year(1) == 52);
+
+    /* Years out of the calendar repeat every 400 years */
+    assert(iso_weeks_in_year(0) == iso_weeks_in_year(400));
+    assert(iso_weeks_in_year(-396) == iso_weeks_in_year(4));
+    assert(iso_weeks_in_year(10004) == iso_weeks_in_year(2004));
+
+    printf("[PASS] iso_weeks_in_year\n");
+}
+
+void test_iso_week() {
+    IsoWeek iso;
+    Date date;
+
+    iso = iso_week(date_create(2005, JAN, 1));
+    assert(iso.year == 2004 && iso.week == 53 && iso.weekday == 6);
+    iso = iso_week(date_create(2007, JAN, 1));
+    assert(iso.year == 2007 && iso.week == 1 && iso.weekday == 1);
+    iso = iso_week(date_create(2008, DEC, 29));
+    assert(iso.year == 2009 && iso.week == 1 && iso.weekday == 1);
+    iso = iso_week(date_create(2010, JAN, 3));
+    assert(iso.year == 2009 && iso.week == 53 && iso.weekday == 7);
+    iso = iso_week(date_create(1, JAN, 1));
+    assert(iso.year == 1 && iso.week == 1 && iso.weekday == 1);
+    iso = iso_week(date_create(9999, DEC, 31));
+    assert(iso.year == 9999 && iso.week == 52 && iso.weekday == 5);
+
+    assert(iso_week_checked(date_create(2020, DEC, 31), &iso) == DATETIME_OK);
+    assert(iso.year == 2020 && iso.week == 53 && iso.weekday == 4);
+    assert(iso_week_checked(date_create(2020, DEC, 31), NULL) == DATETIME_ERROR_ARGUMENT);
+    date.year = 2023;
+    date.month = FEB;
+    date.day = 29;
+    assert(iso_week_checked(date, &iso) == DATETIME_ERROR_RANGE);
+    assert(iso.year == 2020 && iso.week == 53 && iso.weekday == 4);
+
+    printf("[PASS] iso_week\n");
+}
+
+void test_date_from_iso_week() {
+    Date date;
+
+    date = date_from_iso_week(2004, 53, 6);
+    assert(date.year == 2005 && date.month == JAN && date.day == 1);
+    date = date_from_iso_week(2009, 1, 1);
+    assert(date.year == 2008 && date.month == DEC && date.day == 29);
+    date = date_from_iso_week(1, 1, 1);
+    assert(date.year == 1 && date.month == JAN && date.day == 1);
+    date = date_from_iso_week_unchecked(2009, 53, 7);
+    assert(date.year == 2010 && date.month == JAN && date.day == 3);
+
+    assert(date_from_iso_week_checked(9999, 52, 5, &date) == DATETIME_OK);
+    assert(date.year == 9999 && date.month == DEC && date.day == 31);
+    assert(date_from_iso_week_checked(9999, 52, 6, &date) == DATETIME_ERROR_RANGE); /* 10000-01-01 */
+    assert(date_from_iso_week_checked(2010, 53, 1, &date) == DATETIME_ERROR_RANGE);
+    assert(date_from_iso_week_checked(2009, 0, 1, &date) == DATETIME_ERROR_RANGE);
+    assert(date_from_iso_week_checked(2009, 1, 0, &date) == DATETIME_ERROR_RANGE);
+    assert(date_from_iso_week_checked(2009, 1, 8, &date) == DATETIME_ERROR_RANGE);
+    assert(date_from_iso_week_checked(0, 1, 1, &date) == DATETIME_ERROR_RANGE);
+    assert(date_from_iso_week_checked(2009, 1, 1, NULL) == DATETIME_ERROR_ARGUMENT);
+    assert(date.year == 9999 && date.month == DEC && date.day == 31);
+
+    printf("[PASS] date_from_iso_week\n");
+}
+
+void test_iso_week_many() {
+    const size_t COUNT = 3652059;
+    const char *ISO = "%G %V %u";
+    Date *dates;
+    Date *round_trip;
+    IsoWeek *weeks;
+    struct tm tm = {0};
+    char expected[32];
+    char buffer[32];
+    size_t i;
+
+    dates = (Date *)malloc(COUNT * sizeof(Date));
+    round_trip = (Date *)malloc(COUNT * sizeof(Date));
+    weeks = (IsoWeek *)malloc(COUNT * sizeof(IsoWeek));
+    assert(dates != NULL && round_trip != NULL && weeks != NULL);
+
+    for (i = 0; i < COUNT; i++) {
+        dates[i] = datetime_from_ordinal((int)i + 1).date;
+    }
+    iso_week_many(dates, weeks, COUNT);
+    date_from_iso_week_many(weeks, round_trip, COUNT);
+
+    /* Every day follows the day before it, and the week dates match strftime() */
+    for (i = 0; i < COUNT; i++) {
+        assert(date_compare(round_trip[i], dates[i]) == 0);
+        if (i > 0 && weeks[i].weekday > 1) {
+            assert(weeks[i].year == weeks[i - 1].year && weeks[i].week == weeks[i - 1].week);
+            assert(weeks[i].weekday == weeks[i - 1].weekday + 1);
+        } else if (i > 0) {
+            assert(weeks[i - 1].weekday == 7);
+            assert(weeks[i].week == 1 ? weeks[i - 1].week == iso_weeks_in_year(weeks[i - 1].year) && weeks[i].year == weeks[i - 1].year + 1
+                                      : weeks[i].week == weeks[i - 1].week + 1 && weeks[i].year == weeks[i - 1].year);
+        }
+
+        if (i % 97 == 0) {
+            tm.tm_year = dates[i].year - 1900;
+            tm.tm_wday = weekday(dates[i].year, dates[i].month, dates[i].day);
+            tm.tm_yday = nth_day_of_year(dates[i].year, dates[i].month, dates[i].day) - 1;
+            strftime(expected, sizeof(expected), ISO, &tm);
+            sprintf(buffer, "%d %02d %d", weeks[i].year, weeks[i].week, weeks[i].weekday);
+            assert(strcmp(buffer, expected) == 0);
+        }
+    }
+    iso_week_many(dates, NULL, COUNT);
+    date_from_iso_week_many(NULL, dates, COUNT);
+
+    free(weeks);
+    free(round_trip);
+    free(dates);
+
+    printf("[PASS] iso_week_many\n");
+}
+
 void test_calendar() {
     time_t t = time(NULL);
     struct tm tm = *localtime(&t);
@@ -150,6 +371,51 @@ void test_calendar() {
     printf("[PASS] calendar\n");
 }
 
+void test_calendar_buffer() {
+    const char *JUNE_2024 = "            June 2024\n"
+                            " Sun  Mon  Tue  Wed  Thu  Fri  Sat\n"
+                            "                                 1 \n"
+                            "   2    3    4    5    6    7    8 \n"
+                            "   9   10   11   12   13   14   15 \n"
+                            "  16   17   18   19   20   21   22 \n"
+                            "  23   24   25   26   27   28   29 \n"
+                            "  30 \n";
+    char buffer[CALENDAR_STRING_LENGTH + 1];
+    size_t length;
+    int year;
+    int month;
+
+    assert(calendar_buffer(2024, JUN, buffer, sizeof(buffer)) == strlen(JUNE_2024));
+    assert(strcmp(buffer, JUNE_2024) == 0);
+    assert(calendar_buffer(2024, JUN, buffer, 10) == strlen(JUNE_2024));
+    assert(strcmp(buffer, "         ") == 0);
+    assert(calendar_buffer(2024, JUN, NULL, 0) == strlen(JUNE_2024));
+
+    for (year = 1; year <= 9999; year += 7) {
+        for (month = JAN; month <= DEC; month++) {
+            assert(calendar_buffer(year, month, buffer, sizeof(buffer)) <= CALENDAR_STRING_LENGTH);
+        }
+    }
+
+    /* Invalid input is reported, not fatal */
+    assert(calendar_buffer(2023, 0, buffer, sizeof(buffer)) == 0 && buffer[0] == '\0');
+    assert(calendar_buffer(2023, 13, buffer, sizeof(buffer)) == 0 && buffer[0] == '\0');
+    assert(calendar_buffer(0, JAN, buffer, sizeof(buffer)) == 0);
+    assert(calendar_buffer(10000, DEC, NULL, 0) == 0);
+    assert(calendar(2023, 13) == NULL && calendar(0, JAN) == NULL);
+
+    length = 1;
+    strcpy(buffer, "unchanged");
+    assert(calendar_buffer_checked(2023, 13, buffer, sizeof(buffer), &length) == DATETIME_ERROR_RANGE);
+    assert(datetime_last_error() == DATETIME_ERROR_RANGE && length == 1 && strcmp(buffer, "unchanged") == 0);
+    assert(calendar_buffer_checked(2024, JUN, buffer, sizeof(buffer), NULL) == DATETIME_ERROR_ARGUMENT);
+    assert(calendar_buffer_checked(2024, JUN, NULL, 10, &length) == DATETIME_ERROR_ARGUMENT);
+    assert(calendar_buffer_checked(2024, JUN, buffer, sizeof(buffer), &length) == DATETIME_OK);
+    assert(datetime_last_error() == DATETIME_OK && length == strlen(JUNE_2024) && strcmp(buffer, JUNE_2024) == 0);
+
+    printf("[PASS] calendar_buffer\n");
+}
+
 void test_time_interval_create() {
     TimeInterval time_interval;
 
@@ -187,6 +453,18 @@ void test_time_interval_to_string() {
     printf("[PASS] time_interval_to_string\n");
 }
 
+void test_time_interval_to_string_buffer() {
+    char buffer[128];
+
+    assert(time_interval_to_string_buffer(time_interval_create(1, 2, 3, 4, 5), buffer, sizeof(buffer)) == 59);
+    assert(strcmp(buffer, "1 day(s) 2 hour(s) 3 minute(s) 4 second(s) 5 millisecond(s)") == 0);
+    assert(time_interval_to_string_buffer(time_interval_create(1, 2, 3, 4, 5), buffer, 9) == 59);
+    assert(strcmp(buffer, "1 day(s)") == 0);
+    assert(time_interval_to_string_buffer(time_interval_create(1, 2, 3, 4, 5), NULL, 0) == 59);
+
+    printf("[PASS] time_interval_to_string_buffer\n");
+}
+
 void test_date_create() {
     Date date;
 
@@ -331,6 +609,24 @@ void test_date_add() {
     assert(new_date.month == JAN);
     assert(new_date.day == 11);
 
+    date = date_create(1600, FEB, 28);
+    new_date = date_add(date, 1);
+    assert(new_date.year == 1600);
+    assert(new_date.month == FEB);
+    assert(new_date.day == 29);
+
+    date = date_create(1900, FEB, 28);
+    new_date = date_add(date, 1);
+    assert(new_date.year == 1900);
+    assert(new_date.month == MAR);
+    assert(new_date.day == 1);
+
+    date = date_create(1, JAN, 1);
+    new_date = date_add(date, 3652058);
+    assert(new_date.year == 9999);
+    assert(new_date.month == DEC);
+    assert(new_date.day == 31);
+
     printf("[PASS] date_add\n");
 }
 
@@ -362,6 +658,10 @@ void test_date_diff() {
     date2 = date_create(2023, MAY, 29);
     assert(date_diff(date1, date2) == 356842);
 
+    date1 = date_create(1, JAN, 1);
+    date2 = date_create(9999, DEC, 31);
+    assert(date_diff(date1, date2) == -3652058);
+
     printf("[PASS] date_diff\n");
 }
 
@@ -392,6 +692,20 @@ void test_date_to_string() {
     printf("[PASS] date_to_string\n");
 }
 
+void test_date_to_string_buffer() {
+    char buffer[DATE_STRING_LENGTH + 1];
+
+    assert(date_to_string_buffer(date_create(2024, DEC, 4), buffer, sizeof(buffer)) == DATE_STRING_LENGTH);
+    assert(strcmp(buffer, "2024-12-04") == 0);
+    assert(date_to_string_buffer(date_create(1, JAN, 1), buffer, sizeof(buffer)) == DATE_STRING_LENGTH);
+    assert(strcmp(buffer, "0001-01-01") == 0);
+    assert(date_to_string_buffer(date_create(2024, DEC, 4), buffer, 5) == DATE_STRING_LENGTH);
+    assert(strcmp(buffer, "2024") == 0);
+    assert(date_to_string_buffer(date_create(2024, DEC, 4), NULL, 0) == DATE_STRING_LENGTH);
+
+    printf("[PASS] date_to_string_buffer\n");
+}
+
 void test_date_ascii_string() {
     Date date;
     char *str;
@@ -419,6 +733,19 @@ void test_date_ascii_string() {
     printf("[PASS] date_ascii_string\n");
 }
 
+void test_date_ascii_string_buffer() {
+    char buffer[DATE_ASCII_STRING_LENGTH + 1];
+
+    assert(date_ascii_string_buffer(date_create(2024, DEC, 4), buffer, sizeof(buffer)) == DATE_ASCII_STRING_LENGTH);
+    assert(strcmp(buffer, "Wed Dec 04 2024") == 0);
+    assert(date_ascii_string_buffer(date_create(999, JAN, 1), buffer, sizeof(buffer)) == 14);
+    assert(strcmp(buffer, "Tue Jan 01 999") == 0);
+    assert(date_ascii_string_buffer(date_create(2024, DEC, 4), buffer, 4) == DATE_ASCII_STRING_LENGTH);
+    assert(strcmp(buffer, "Wed") == 0);
+
+    printf("[PASS] date_ascii_string_buffer\n");
+}
+
 void test_time_create() {
     Time time;
 
@@ -618,6 +945,19 @@ void test_time_to_string() {
     printf("[PASS] time_to_string\n");
 }
 
+void test_time_to_string_buffer() {
+    char buffer[TIME_STRING_LENGTH + 1];
+
+    assert(time_to_string_buffer(time_create(23, 59, 59, 999), buffer, sizeof(buffer)) == TIME_STRING_LENGTH);
+    assert(strcmp(buffer, "23:59:59.999") == 0);
+    assert(time_to_string_buffer(time_create(0, 0, 0, 7), buffer, sizeof(buffer)) == TIME_STRING_LENGTH);
+    assert(strcmp(buffer, "00:00:00.007") == 0);
+    assert(time_to_string_buffer(time_create(23, 59, 59, 999), buffer, TIME_STRING_LENGTH) == TIME_STRING_LENGTH);
+    assert(strcmp(buffer, "23:59:59.99") == 0);
+
+    printf("[PASS] time_to_string_buffer\n");
+}
+
 void test_time_ascii_string() {
     Time time;
     char *str;
@@ -655,6 +995,17 @@ void test_time_ascii_string() {
     printf("[PASS] time_ascii_string\n");
 }
 
+void test_time_ascii_string_buffer() {
+    char buffer[TIME_ASCII_STRING_LENGTH + 1];
+
+    assert(time_ascii_string_buffer(time_create(23, 59, 59, 999), buffer, sizeof(buffer)) == TIME_ASCII_STRING_LENGTH);
+    assert(strcmp(buffer, "23:59:59") == 0);
+    assert(time_ascii_string_buffer(time_create(1, 2, 3, 4), buffer, 3) == TIME_ASCII_STRING_LENGTH);
+    assert(strcmp(buffer, "01") == 0);
+
+    printf("[PASS] time_ascii_string_buffer\n");
+}
+
 void test_datetime_create() {
     DateTime datetime;
 
@@ -696,6 +1047,73 @@ void test_datetime_now() {
     printf("[PASS] datetime_now\n");
 }
 
+/* Check that every field of a snapshot comes from the same reading, in the time zone of localtime(). */
+static void *__check_snapshot(void *arg) {
+    DateTimeSnapshot snapshot = datetime_now_snapshot(DATETIME_CLOCK_REALTIME);
+    time_t t = (time_t)(snapshot.instant / MILLISECONDS_PER_SECOND);
+    struct tm tm;
+
+    localtime_r(&t, &tm);
+    assert(instant_from_datetime(snapshot.utc) == snapshot.instant);
+    assert(instant_from_datetime(snapshot.local) == snapshot.instant + (Instant)snapshot.utc_offset * MILLISECONDS_PER_SECOND);
+    assert(snapshot.local.date.year == tm.tm_year + 1900 && snapshot.local.date.month == tm.tm_mon + 1 && snapshot.local.date.day == tm.tm_mday);
+    assert(snapshot.local.time.hour == tm.tm_hour && snapshot.local.time.minute == tm.tm_min && snapshot.local.time.second == tm.tm_sec);
+    assert(snapshot.local.time.millisecond == snapshot.utc.time.millisecond);
+    if (arg != NULL) {
+        assert(snapshot.utc_offset == *(const int *)arg);
+    }
+    return NULL;
+}
+
+void test_datetime_now_snapshot() {
+    const int INDIA = 5 * SECONDS_PER_HOUR + 30 * SECONDS_PER_MINUTE;
+    DateTimeSnapshot snapshot;
+    DateTimeSnapshot coarse;
+    struct timespec ts;
+    Instant before;
+    Instant after;
+    pthread_t thread;
+    char *tz = getenv("TZ");
+    char saved[64];
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    before = (Instant)ts.tv_sec * MILLISECONDS_PER_SECOND + ts.tv_nsec / NANOSECONDS_PER_MILLISECOND;
+    snapshot = datetime_now_snapshot(DATETIME_CLOCK_REALTIME);
+    coarse = datetime_now_snapshot(DATETIME_CLOCK_REALTIME_COARSE);
+    clock_gettime(CLOCK_REALTIME, &ts);
+    after = (Instant)ts.tv_sec * MILLISECONDS_PER_SECOND + ts.tv_nsec / NANOSECONDS_PER_MILLISECOND;
+    assert(snapshot.instant >= before && snapshot.instant <= after);
+    assert(coarse.instant >= before - 100 && coarse.instant <= after);
+    assert(coarse.utc_offset == snapshot.utc_offset);
+    assert(instant_from_datetime(coarse.utc) == coarse.instant);
+    __check_snapshot(NULL);
+
+    assert(instant_from_datetime(datetime_now_utc()) >= snapshot.instant);
+    assert(instant_from_datetime(datetime_now()) >= instant_from_datetime(snapshot.local));
+
+    /* Another zone, in a new thread whose UTC offset is not cached yet */
+    saved[0] = '\0';
+    if (tz != NULL) {
+        strncat(saved, tz, sizeof(saved) - 1);
+    }
+    setenv("TZ", "IST-5:30", 1);
+    tzset();
+    assert(pthread_create(&thread, NULL, __check_snapshot, (void *)&INDIA) == 0);
+    pthread_join(thread, NULL);
+    setenv("TZ", "EST5EDT,M3.2.0,M11.1.0", 1);
+    tzset();
+    assert(pthread_create(&thread, NULL, __check_snapshot, NULL) == 0);
+    pthread_join(thread, NULL);
+    if (tz != NULL) {
+        setenv("TZ", saved, 1);
+    } else {
+        unsetenv("TZ");
+    }
+    tzset();
+
+    printf("[PASS] datetime_now_snapshot\n");
+}
+
 void test_datetime_from_timestamp() {
     DateTime datetime;
 
@@ -762,10 +1180,48 @@ void test_datetime_from_timestamp() {
     assert(datetime.time.second == 7);
     assert(datetime.time.millisecond == 0);
 
+    datetime = datetime_from_timestamp((time_t)2147483647 + 1);
+    assert(datetime.date.year == 2038);
+    assert(datetime.date.month == JAN);
+    assert(datetime.date.day == 19);
+    assert(datetime.time.hour == 3);
+    assert(datetime.time.minute == 14);
+    assert(datetime.time.second == 8);
+    assert(datetime.time.millisecond == 0);
+
+    datetime = datetime_from_timestamp(-1);
+    assert(datetime.date.year == 1969);
+    assert(datetime.date.month == DEC);
+    assert(datetime.date.day == 31);
+    assert(datetime.time.hour == 23);
+    assert(datetime.time.minute == 59);
+    assert(datetime.time.second == 59);
+    assert(datetime.time.millisecond == 0);
+
+    datetime = datetime_from_timestamp(-(time_t)62135596800);
+    assert(datetime.date.year == 1);
+    assert(datetime.date.month == JAN);
+    assert(datetime.date.day == 1);
+    assert(datetime.time.hour == 0);
+    assert(datetime.time.minute == 0);
+    assert(datetime.time.second == 0);
+    assert(datetime.time.millisecond == 0);
+
+    datetime = datetime_from_timestamp((time_t)253402300799);
+    assert(datetime.date.year == 9999);
+    assert(datetime.date.month == DEC);
+    assert(datetime.date.day == 31);
+    assert(datetime.time.hour == 23);
+    assert(datetime.time.minute == 59);
+    assert(datetime.time.second == 59);
+    assert(datetime.time.millisecond == 0);
+
     printf("[PASS] datetime_from_timestamp\n");
 }
 
 void test_datetime_to_timestamp() {
+    time_t timestamp;
+
     assert(datetime_to_timestamp(datetime_create(1970, JAN, 1, 0, 0, 0, 0)) == 0);
     assert(datetime_to_timestamp(datetime_create(1970, JAN, 2, 0, 0, 0, 0)) == 86400);
     assert(datetime_to_timestamp(datetime_create(1970, FEB, 1, 0, 0, 0, 0)) == 2678400);
@@ -773,6 +1229,14 @@ void test_datetime_to_timestamp() {
     assert(datetime_to_timestamp(datetime_create(2000, DEC, 31, 0, 0, 0, 0)) == 978220800);
     assert(datetime_to_timestamp(datetime_create(2023, MAY, 29, 0, 0, 0, 0)) == 1685318400);
     assert(datetime_to_timestamp(datetime_create(9999, DEC, 31, 0, 0, 0, 0)) == 253402214400);
+    assert(datetime_to_timestamp(datetime_create(2038, JAN, 19, 3, 14, 8, 0)) == (time_t)2147483647 + 1);
+    assert(datetime_to_timestamp(datetime_create(1969, DEC, 31, 23, 59, 59, 0)) == -1);
+    assert(datetime_to_timestamp(datetime_create(1, JAN, 1, 0, 0, 0, 0)) == -(time_t)62135596800);
+    assert(datetime_to_timestamp(datetime_create(9999, DEC, 31, 23, 59, 59, 999)) == (time_t)253402300799);
+
+    for (timestamp = -(time_t)62135596800; timestamp <= (time_t)253402300799; timestamp += 86399 * 97) {
+        assert(datetime_to_timestamp(datetime_from_timestamp(timestamp)) == timestamp);
+    }
 
     printf("[PASS] datetime_to_timestamp\n");
 }
@@ -843,10 +1307,32 @@ void test_datetime_from_ordinal() {
     assert(datetime.time.second == 0);
     assert(datetime.time.millisecond == 0);
 
+    datetime = datetime_from_ordinal(365);
+    assert(datetime.date.year == 1);
+    assert(datetime.date.month == DEC);
+    assert(datetime.date.day == 31);
+
+    datetime = datetime_from_ordinal(730179);
+    assert(datetime.date.year == 2000);
+    assert(datetime.date.month == FEB);
+    assert(datetime.date.day == 29);
+
+    datetime = datetime_from_ordinal(584389);
+    assert(datetime.date.year == 1601);
+    assert(datetime.date.month == JAN);
+    assert(datetime.date.day == 1);
+
+    datetime = datetime_from_ordinal(3652059);
+    assert(datetime.date.year == 9999);
+    assert(datetime.date.month == DEC);
+    assert(datetime.date.day == 31);
+
     printf("[PASS] datetime_from_ordinal\n");
 }
 
 void test_datetime_to_ordinal() {
+    int ordinal;
+
     assert(datetime_to_ordinal(datetime_create(1, JAN, 1, 0, 0, 0, 0)) == 1);
     assert(datetime_to_ordinal(datetime_create(1, APR, 10, 0, 0, 0, 0)) == 100);
     assert(datetime_to_ordinal(datetime_create(3, SEP, 27, 0, 0, 0, 0)) == 1000);
@@ -854,6 +1340,13 @@ void test_datetime_to_ordinal() {
     assert(datetime_to_ordinal(datetime_create(274, OCT, 16, 0, 0, 0, 0)) == 100000);
     assert(datetime_to_ordinal(datetime_create(2002, MAR, 11, 0, 0, 0, 0)) == 730920);
     assert(datetime_to_ordinal(datetime_create(2027, JAN, 19, 0, 0, 0, 0)) == 740000);
+    assert(datetime_to_ordinal(datetime_create(1600, MAR, 1, 0, 0, 0, 0)) == 584083);
+    assert(datetime_to_ordinal(datetime_create(2000, FEB, 29, 0, 0, 0, 0)) == 730179);
+    assert(datetime_to_ordinal(datetime_create(9999, DEC, 31, 0, 0, 0, 0)) == 3652059);
+
+    for (ordinal = 1; ordinal <= 3652059; ordinal += 97) {
+        assert(datetime_to_ordinal(datetime_from_ordinal(ordinal)) == ordinal);
+    }
 
     printf("[PASS] datetime_to_ordinal\n");
 }
@@ -950,6 +1443,26 @@ void test_datetime_add() {
     assert(datetime.time.second == 59);
     assert(datetime.time.millisecond == 900);
 
+    datetime = datetime_create(2023, MAY, 29, 14, 40, 1, 0);
+    datetime = datetime_add(datetime, -1, 2000000000);
+    assert(datetime.date.year == 2023);
+    assert(datetime.date.month == JUN);
+    assert(datetime.date.day == 20);
+    assert(datetime.time.hour == 18);
+    assert(datetime.time.minute == 13);
+    assert(datetime.time.second == 21);
+    assert(datetime.time.millisecond == 0);
+
+    datetime = datetime_create(2023, MAY, 29, 14, 40, 1, 0);
+    datetime = datetime_add(datetime, 1, -2000000000);
+    assert(datetime.date.year == 2023);
+    assert(datetime.date.month == MAY);
+    assert(datetime.date.day == 7);
+    assert(datetime.time.hour == 11);
+    assert(datetime.time.minute == 6);
+    assert(datetime.time.second == 41);
+    assert(datetime.time.millisecond == 0);
+
     printf("[PASS] datetime_add\n");
 }
 
@@ -976,6 +1489,15 @@ void test_datetime_diff() {
     assert(time_interval.seconds == 0);
     assert(time_interval.milliseconds == 1);
 
+    datetime1 = datetime_create(2000, FEB, 29, 23, 0, 0, 0);
+    datetime2 = datetime_create(2023, MAY, 31, 22, 59, 29, 100);
+    time_interval = datetime_diff(datetime1, datetime2);
+    assert(time_interval.days == 8491);
+    assert(time_interval.hours == 23);
+    assert(time_interval.minutes == 59);
+    assert(time_interval.seconds == 29);
+    assert(time_interval.milliseconds == 100);
+
     printf("[PASS] datetime_diff\n");
 }
 
@@ -996,6 +1518,34 @@ void test_datetime_to_string() {
     printf("[PASS] datetime_to_string\n");
 }
 
+void test_datetime_to_string_buffer() {
+    char buffer[DATETIME_STRING_LENGTH + 1];
+    char expected[32];
+    DateTime datetime;
+    char *str;
+    int i;
+
+    datetime = datetime_create(2024, DEC, 4, 12, 30, 0, 5);
+    assert(datetime_to_string_buffer(datetime, buffer, sizeof(buffer)) == DATETIME_STRING_LENGTH);
+    assert(strcmp(buffer, "2024-12-04 12:30:00.005") == 0);
+    str = datetime_to_string(datetime);
+    assert(strcmp(buffer, str) == 0);
+    free(str);
+    assert(datetime_to_string_buffer(datetime, buffer, 11) == DATETIME_STRING_LENGTH);
+    assert(strcmp(buffer, "2024-12-04") == 0);
+    assert(datetime_to_string_buffer(datetime, NULL, 0) == DATETIME_STRING_LENGTH);
+
+    for (i = 0; i < 100000; i++) {
+        datetime = datetime_create(1 + i % 9999, 1 + i % 12, 1 + i % 28, i % 24, i % 60, i / 60 % 60, i % 1000);
+        sprintf(expected, "%04d-%02d-%02d %02d:%02d:%02d.%03d", datetime.date.year, datetime.date.month, datetime.date.day,
+                datetime.time.hour, datetime.time.minute, datetime.time.second, datetime.time.millisecond);
+        assert(datetime_to_string_buffer(datetime, buffer, sizeof(buffer)) == DATETIME_STRING_LENGTH);
+        assert(strcmp(buffer, expected) == 0);
+    }
+
+    printf("[PASS] datetime_to_string_buffer\n");
+}
+
 void test_datetime_ascii_string() {
     DateTime datetime;
     char *str;
@@ -1023,6 +1573,19 @@ void test_datetime_ascii_string() {
     printf("[PASS] datetime_ascii_string\n");
 }
 
+void test_datetime_ascii_string_buffer() {
+    char buffer[DATETIME_ASCII_STRING_LENGTH + 1];
+
+    assert(datetime_ascii_string_buffer(datetime_create(2024, DEC, 4, 12, 30, 0, 0), buffer, sizeof(buffer)) == DATETIME_ASCII_STRING_LENGTH);
+    assert(strcmp(buffer, "Wed Dec 04 12:30:00 2024") == 0);
+    assert(datetime_ascii_string_buffer(datetime_create(5, MAR, 9, 1, 2, 3, 4), buffer, sizeof(buffer)) == 21);
+    assert(strcmp(buffer, "Wed Mar 09 01:02:03 5") == 0);
+    assert(datetime_ascii_string_buffer(datetime_create(2024, DEC, 4, 12, 30, 0, 0), buffer, 11) == DATETIME_ASCII_STRING_LENGTH);
+    assert(strcmp(buffer, "Wed Dec 04") == 0);
+
+    printf("[PASS] datetime_ascii_string_buffer\n");
+}
+
 void test_datetime_format_string() {
     DateTime datetime;
     char *str;
@@ -1047,11 +1610,2297 @@ void test_datetime_format_string() {
     assert(strcmp(str, "Wednesday, 04. December 2024 12:30PM") == 0);
     free(str);
 
+    str = datetime_format_string(datetime, "%F %T|%D|%R|%r|%h%n%t");
+    assert(strcmp(str, "2024-12-04 12:30:00|12/04/24|12:30|12:30:00 PM|Dec\n\t") == 0);
+    free(str);
+
+    /* Through strftime(): flags, widths and the specifiers without a plan */
+    str = datetime_format_string(datetime, "%-d.%-m.%C|%10Y|%a %j");
+    assert(strcmp(str, "4.12.20|0000002024|Wed 339") == 0);
+    free(str);
+    str = datetime_format_string(datetime, "%Z");
+    assert(str != NULL);
+    free(str);
+    str = datetime_format_string(datetime, "%1000Y");
+    assert(strlen(str) == 1000 && strcmp(str + 996, "2024") == 0);
+    free(str);
+
     printf("[PASS] datetime_format_string\n");
 }
 
+void test_datetime_format_render() {
+    const char *ALL = "%a %A %b %B %c %d %D %e %F %G %h %H %I %j %m %M %n %p %r %R %S %t %T %u %U %V %w %W %x %X %y %Y %z %%";
+    DateTimeFormat *format;
+    DateTime datetime;
+    struct tm tm = {0};
+    char expected[256];
+    char buffer[256];
+    int days;
+
+    format = datetime_format_create("%Y-%m-%d %H:%M:%S");
+    assert(format != NULL);
+    assert(datetime_format_max_length(format) == 19);
+    datetime = datetime_create(2024, FEB, 29, 23, 59, 59, 999);
+    assert(datetime_format_render(format, datetime, buffer, sizeof(buffer)) == 19);
+    assert(strcmp(buffer, "2024-02-29 23:59:59") == 0);
+    assert(datetime_format_render(format, datetime, NULL, 0) == 19);
+    assert(datetime_format_render(format, datetime, buffer, 8) == 19);
+    assert(strcmp(buffer, "2024-02") == 0);
+    assert(datetime_format_render(format, datetime, buffer, 1) == 19);
+    assert(strcmp(buffer, "") == 0);
+    datetime_format_destroy(format);
+
+    format = datetime_format_create("%c|%e|%j|%U|%W|%w|%z|100%%");
+    assert(format != NULL);
+    datetime = datetime_create(1, JAN, 7, 0, 0, 0, 0);
+    assert(datetime_format_render(format, datetime, buffer, sizeof(buffer)) == strlen(buffer));
+    assert(strcmp(buffer, "Sun Jan  7 00:00:00 1| 7|007|01|01|0|+0000|100%") == 0);
+    datetime_format_destroy(format);
+
+    format = datetime_format_create("%G-W%V-%u");
+    assert(format != NULL);
+    assert(datetime_format_max_length(format) == 10);
+    datetime = datetime_create(2010, JAN, 3, 0, 0, 0, 0);
+    assert(datetime_format_render(format, datetime, buffer, sizeof(buffer)) == 10);
+    assert(strcmp(buffer, "2009-W53-7") == 0);
+    datetime = datetime_create(2008, DEC, 29, 0, 0, 0, 0);
+    datetime_format_render(format, datetime, buffer, sizeof(buffer));
+    assert(strcmp(buffer, "2009-W01-1") == 0);
+    datetime_format_destroy(format);
+
+    assert(datetime_format_create("%Q") == NULL);
+    assert(datetime_format_create("%") == NULL);
+    assert(datetime_format_create(NULL) == NULL);
+
+    format = datetime_format_create("");
+    assert(format != NULL);
+    assert(datetime_format_render(format, datetime, buffer, sizeof(buffer)) == 0);
+    assert(strcmp(buffer, "") == 0);
+    datetime_format_destroy(format);
+
+    /* Same output as strftime() in the "C" locale */
+    format = datetime_format_create(ALL);
+    assert(format != NULL);
+    for (days = 0; days < 80000; days += 13) {
+        datetime = datetime_add(datetime_create(1900, JAN, 1, 0, 0, 0, 0), days, days % 1000 * 86399);
+        tm.tm_year = datetime.date.year - 1900;
+        tm.tm_mon = datetime.date.month - 1;
+        tm.tm_mday = datetime.date.day;
+        tm.tm_hour = datetime.time.hour;
+        tm.tm_min = datetime.time.minute;
+        tm.tm_sec = datetime.time.second;
+        tm.tm_wday = weekday(datetime.date.year, datetime.date.month, datetime.date.day);
+        tm.tm_yday = nth_day_of_year(datetime.date.year, datetime.date.month, datetime.date.day) - 1;
+        strftime(expected, sizeof(expected), ALL, &tm);
+
+        assert(datetime_format_render(format, datetime, buffer, sizeof(buffer)) == strlen(expected));
+        assert(strlen(buffer) <= datetime_format_max_length(format));
+        assert(strcmp(buffer, expected) == 0);
+    }
+    datetime_format_destroy(format);
+
+    printf("[PASS] datetime_format_render\n");
+}
+
+void test_instant_from_datetime() {
+    assert(instant_from_datetime(datetime_create(1970, JAN, 1, 0, 0, 0, 0)) == 0);
+    assert(instant_from_datetime(datetime_create(1969, DEC, 31, 23, 59, 59, 999)) == -1);
+    assert(instant_from_datetime(datetime_create(2023, MAY, 29, 14, 40, 1, 123)) == (Instant)1685371201 * MILLISECONDS_PER_SECOND + 123);
+    assert(instant_from_datetime(datetime_create(1, JAN, 1, 0, 0, 0, 0)) == INSTANT_MIN);
+    assert(instant_from_datetime(datetime_create(9999, DEC, 31, 23, 59, 59, 999)) == INSTANT_MAX);
+
+    printf("[PASS] instant_from_datetime\n");
+}
+
+void test_instant_to_datetime() {
+    DateTime datetime;
+    Instant instant;
+
+    datetime = instant_to_datetime(0);
+    assert(datetime_compare(datetime, datetime_create(1970, JAN, 1, 0, 0, 0, 0)) == 0);
+
+    datetime = instant_to_datetime(-1);
+    assert(datetime_compare(datetime, datetime_create(1969, DEC, 31, 23, 59, 59, 999)) == 0);
+
+    datetime = instant_to_datetime((Instant)1685371201 * MILLISECONDS_PER_SECOND + 123);
+    assert(datetime_compare(datetime, datetime_create(2023, MAY, 29, 14, 40, 1, 123)) == 0);
+
+    datetime = instant_to_datetime(INSTANT_MIN);
+    assert(datetime_compare(datetime, datetime_create(1, JAN, 1, 0, 0, 0, 0)) == 0);
+
+    datetime = instant_to_datetime(INSTANT_MAX);
+    assert(datetime_compare(datetime, datetime_create(9999, DEC, 31, 23, 59, 59, 999)) == 0);
+
+    for (instant = INSTANT_MIN; instant <= INSTANT_MAX; instant += (Instant)MILLISECONDS_PER_DAY * 97 + 12345) {
+        assert(instant_from_datetime(instant_to_datetime(instant)) == instant);
+    }
+
+    printf("[PASS] instant_to_datetime\n");
+}
+
+void test_instant_compare() {
+    Instant instant1;
+    Instant instant2;
+
+    instant1 = instant_from_datetime(datetime_create(2000, JAN, 1, 0, 0, 0, 0));
+    instant2 = instant_from_datetime(datetime_create(2000, JAN, 1, 0, 0, 0, 0));
+    assert(instant_compare(instant1, instant2) == 0);
+
+    instant2 = instant_from_datetime(datetime_create(2000, JAN, 1, 0, 0, 0, 1));
+    assert(instant_compare(instant1, instant2) < 0);
+    assert(instant_compare(instant2, instant1) > 0);
+
+    instant2 = instant_from_datetime(datetime_create(1999, DEC, 31, 23, 59, 59, 999));
+    assert(instant_compare(instant1, instant2) > 0);
+
+    printf("[PASS] instant_compare\n");
+}
+
+void test_instant_add() {
+    Instant instant;
+
+    instant = instant_from_datetime(datetime_create(2023, MAY, 29, 23, 59, 59, 900));
+    instant = instant_add(instant, 100);
+    assert(instant == instant_from_datetime(datetime_create(2023, MAY, 30, 0, 0, 0, 0)));
+
+    instant = instant_add(instant, -(int64_t)MILLISECONDS_PER_DAY * 365);
+    assert(instant == instant_from_datetime(datetime_create(2022, MAY, 30, 0, 0, 0, 0)));
+
+    printf("[PASS] instant_add\n");
+}
+
+void test_instant_diff() {
+    Instant instant1;
+    Instant instant2;
+
+    instant1 = instant_from_datetime(datetime_create(2023, MAY, 31, 22, 59, 29, 100));
+    instant2 = instant_from_datetime(datetime_create(2023, MAY, 30, 22, 57, 28, 0));
+    assert(instant_diff(instant1, instant2) == MILLISECONDS_PER_DAY + 2 * MILLISECONDS_PER_MINUTE + 1100);
+    assert(instant_diff(instant2, instant1) == -(MILLISECONDS_PER_DAY + 2 * MILLISECONDS_PER_MINUTE + 1100));
+
+    printf("[PASS] instant_diff\n");
+}
+
+void test_instant_min_max() {
+    Instant instant1;
+    Instant instant2;
+
+    instant1 = instant_from_datetime(datetime_create(1, JAN, 1, 0, 0, 0, 0));
+    instant2 = instant_from_datetime(datetime_create(2023, MAY, 31, 22, 59, 29, 100));
+    assert(instant_min(instant1, instant2) == instant1);
+    assert(instant_min(instant2, instant1) == instant1);
+    assert(instant_max(instant1, instant2) == instant2);
+    assert(instant_max(instant2, instant1) == instant2);
+
+    printf("[PASS] instant_min_max\n");
+}
+
+void test_date_pack() {
+    Date date;
+    PackedDate packed_date;
+
+    assert(sizeof(PackedDate) == 4);
+    assert(date_pack(date_create(1, JAN, 1)) == (1 << 9 | 1 << 5 | 1));
+    assert(date_pack(date_create(2000, FEB, 29)) < date_pack(date_create(2000, MAR, 1)));
+    assert(date_pack(date_create(1999, DEC, 31)) < date_pack(date_create(2000, JAN, 1)));
+    assert(date_pack(date_create(2023, MAY, 17)) == date_pack(date_create(2023, MAY, 17)));
+
+    date = date_create(9999, DEC, 31);
+    packed_date = date_pack(date);
+    date = date_unpack(packed_date);
+    assert(date.year == 9999);
+    assert(date.month == DEC);
+    assert(date.day == 31);
+
+    printf("[PASS] date_pack\n");
+}
+
+void test_time_pack() {
+    Time time;
+
+    assert(sizeof(PackedTime) == 4);
+    assert(time_pack(time_create(0, 0, 0, 0)) == 0);
+    assert(time_pack(time_create(23, 59, 59, 999)) == MILLISECONDS_PER_DAY - 1);
+    assert(time_pack(time_create(7, 30, 59, 999)) < time_pack(time_create(7, 31, 0, 0)));
+
+    time = time_unpack(time_pack(time_create(17, 35, 23, 643)));
+    assert(time.hour == 17);
+    assert(time.minute == 35);
+    assert(time.second == 23);
+    assert(time.millisecond == 643);
+
+    printf("[PASS] time_pack\n");
+}
+
+void test_datetime_pack() {
+    DateTime datetime;
+
+    assert(sizeof(PackedDateTime) == 8);
+    assert(datetime_pack(datetime_create(2000, JAN, 1, 23, 59, 59, 999)) < datetime_pack(datetime_create(2000, JAN, 2, 0, 0, 0, 0)));
+    assert(datetime_pack(datetime_create(2000, JAN, 1, 0, 0, 0, 0)) < datetime_pack(datetime_create(2000, JAN, 1, 0, 0, 0, 1)));
+
+    datetime = datetime_unpack(datetime_pack(datetime_create(2023, MAY, 29, 14, 40, 1, 123)));
+    assert(datetime_compare(datetime, datetime_create(2023, MAY, 29, 14, 40, 1, 123)) == 0);
+
+    printf("[PASS] datetime_pack\n");
+}
+
+void test_datetime_column_create() {
+    DateTimeColumn *column;
+    DateTime datetimes[3];
+    DateTime datetime;
+
+    column = datetime_column_create(2);
+    assert(column != NULL);
+    assert(column->length == 2);
+    assert(column->years[1] == 0);
+    datetime_column_set(column, 1, datetime_create(2023, MAY, 29, 14, 40, 1, 123));
+    datetime = datetime_column_get(column, 1);
+    assert(datetime_compare(datetime, datetime_create(2023, MAY, 29, 14, 40, 1, 123)) == 0);
+    datetime_column_destroy(column);
+
+    datetimes[0] = datetime_create(1, JAN, 1, 0, 0, 0, 0);
+    datetimes[1] = datetime_create(2000, FEB, 29, 12, 0, 0, 0);
+    datetimes[2] = datetime_create(9999, DEC, 31, 23, 59, 59, 999);
+    column = datetime_column_from_array(datetimes, 3);
+    assert(column != NULL);
+    assert(column->length == 3);
+    assert(column->years[2] == 9999);
+    assert(column->months[1] == FEB);
+    assert(column->days[1] == 29);
+    assert(column->hours[1] == 12);
+    assert(column->milliseconds[2] == 999);
+    datetime_column_destroy(column);
+
+    column = datetime_column_create(0);
+    assert(column != NULL);
+    assert(column->length == 0);
+    datetime_column_destroy(column);
+
+    /* The size of the fields would wrap */
+    assert(datetime_column_create(SIZE_MAX / 7 + 1) == NULL);
+    assert(datetime_column_create(SIZE_MAX) == NULL);
+
+    printf("[PASS] datetime_column_create\n");
+}
+
+void test_datetime_column_validate() {
+    DateTimeColumn *column;
+    bool valid[5];
+
+    column = datetime_column_create(5);
+    datetime_column_set(column, 0, datetime_create(2000, FEB, 29, 0, 0, 0, 0));
+    datetime_column_set(column, 1, datetime_create(2023, DEC, 31, 23, 59, 59, 999));
+    datetime_column_set(column, 2, datetime_create(2023, FEB, 28, 0, 0, 0, 0));
+    column->days[2] = 29;
+    datetime_column_set(column, 3, datetime_create(2023, JAN, 1, 0, 0, 0, 0));
+    column->months[3] = 13;
+    datetime_column_set(column, 4, datetime_create(2023, JAN, 1, 0, 0, 0, 0));
+    column->milliseconds[4] = 1000;
+
+    assert(datetime_column_validate(column, valid) == 2);
+    assert(valid[0] == true);
+    assert(valid[1] == true);
+    assert(valid[2] == false);
+    assert(valid[3] == false);
+    assert(valid[4] == false);
+    assert(datetime_column_validate(column, NULL) == 2);
+    datetime_column_destroy(column);
+
+    printf("[PASS] datetime_column_validate\n");
+}
+
+void test_datetime_column_validate_mask() {
+    const size_t ROWS = 20011;
+    DateTimeColumn *column;
+    uint64_t *mask;
+    bool *valid;
+    DateTime datetime;
+    size_t count = 0;
+    size_t i;
+    unsigned int seed = 12345;
+    bool row_valid;
+
+    column = datetime_column_create(ROWS);
+    mask = (uint64_t *)malloc(DATETIME_MASK_WORDS(ROWS) * sizeof(uint64_t));
+    valid = (bool *)malloc(ROWS * sizeof(bool));
+    assert(column != NULL && mask != NULL && valid != NULL);
+
+    /* February 29 of every year, then fields around every limit */
+    for (i = 0; i < ROWS; i++) {
+        seed = seed * 1103515245 + 12345;
+        column->years[i] = i < 10001 ? (int)i : (int)(seed >> 8) % 10003 - 1;
+        column->months[i] = i < 10001 ? FEB : (int)(seed >> 12) % 15 - 1;
+        column->days[i] = i < 10001 ? 29 : (int)(seed >> 16) % 34 - 1;
+        column->hours[i] = (int)(seed >> 4) % 1000 == 0 ? 24 : 23;
+        column->minutes[i] = (int)(seed >> 6) % 1000 == 0 ? -1 : 59;
+        column->seconds[i] = (int)(seed >> 7) % 1000 == 0 ? 60 : 0;
+        column->milliseconds[i] = (int)(seed >> 9) % 1000 == 0 ? 1000 : 999;
+    }
+
+    assert(datetime_column_validate_mask(column, mask) == datetime_column_validate(column, valid));
+    for (i = 0; i < ROWS; i++) {
+        row_valid = datetime_create_checked(column->years[i], column->months[i], column->days[i], column->hours[i],
+                                            column->minutes[i], column->seconds[i], column->milliseconds[i], &datetime) == DATETIME_OK;
+        assert((bool)((mask[i / 64] >> (i % 64)) & 1) == row_valid);
+        assert(valid[i] == row_valid);
+        count += row_valid;
+    }
+    assert(datetime_column_validate_mask(column, mask) == count);
+    assert(count > 2000 && count < ROWS - 2000);
+    assert((mask[(ROWS - 1) / 64] >> (ROWS % 64)) == 0);
+    assert(((mask[0] >> 4) & 1) == 1 && ((mask[0] >> 1) & 1) == 0 && ((mask[1600 / 64] >> (1600 % 64)) & 1) == 1);
+    assert(datetime_column_validate_mask(column, NULL) == 0);
+    assert(datetime_column_validate_mask(NULL, mask) == 0);
+
+    free(valid);
+    free(mask);
+    datetime_column_destroy(column);
+
+    printf("[PASS] datetime_column_validate_mask\n");
+}
+
+void test_datetime_column_timestamp() {
+    DateTimeColumn *column;
+    time_t timestamps[4] = {0, -1, 1685318400, 253402300799};
+    time_t results[4];
+    time_t *all_timestamps;
+    int i;
+
+    column = datetime_column_create(4);
+    assert(datetime_column_from_timestamp(column, timestamps) == true);
+    assert(datetime_column_validate(column, NULL) == 4);
+    for (i = 0; i < 4; i++) {
+        assert(datetime_compare(datetime_column_get(column, i), datetime_from_timestamp(timestamps[i])) == 0);
+    }
+
+    datetime_column_to_timestamp(column, results);
+    for (i = 0; i < 4; i++) {
+        assert(results[i] == timestamps[i]);
+    }
+
+    timestamps[1] = 253402300800;
+    assert(datetime_column_from_timestamp(column, timestamps) == false);
+    datetime_column_destroy(column);
+
+    column = datetime_column_create(3652059);
+    all_timestamps = (time_t *)malloc(sizeof(time_t) * 3652059);
+    assert(column != NULL && all_timestamps != NULL);
+    for (i = 0; i < 3652059; i++) {
+        all_timestamps[i] = -(time_t)62135596800 + (time_t)i * SECONDS_PER_DAY + i % SECONDS_PER_DAY;
+    }
+    assert(datetime_column_from_timestamp(column, all_timestamps) == true);
+    for (i = 0; i < 3652059; i += 7) {
+        assert(datetime_compare(datetime_column_get(column, i), datetime_from_timestamp(all_timestamps[i])) == 0);
+    }
+    assert(datetime_column_validate(column, NULL) == 3652059);
+    datetime_column_to_timestamp(column, all_timestamps);
+    for (i = 0; i < 3652059; i++) {
+        assert(all_timestamps[i] == -(time_t)62135596800 + (time_t)i * SECONDS_PER_DAY + i % SECONDS_PER_DAY);
+    }
+    datetime_column_destroy(column);
+    free(all_timestamps);
+
+    printf("[PASS] datetime_column_timestamp\n");
+}
+
+void test_datetime_column_weekday() {
+    DateTimeColumn *column;
+    Weekday weekdays[4];
+    Weekday *many;
+    size_t i;
+
+    column = datetime_column_create(4);
+    datetime_column_set(column, 0, datetime_create(1, JAN, 1, 0, 0, 0, 0));
+    datetime_column_set(column, 1, datetime_create(1900, JAN, 1, 0, 0, 0, 0));
+    datetime_column_set(column, 2, datetime_create(2000, FEB, 29, 0, 0, 0, 0));
+    datetime_column_set(column, 3, datetime_create(2023, DEC, 31, 0, 0, 0, 0));
+    datetime_column_weekday(column, weekdays);
+    assert(weekdays[0] == MON);
+    assert(weekdays[1] == MON);
+    assert(weekdays[2] == TUE);
+    assert(weekdays[3] == SUN);
+    datetime_column_destroy(column);
+
+    column = datetime_column_create(1003);
+    many = (Weekday *)malloc(1003 * sizeof(Weekday));
+    assert(column != NULL && many != NULL);
+    for (i = 0; i < 1003; i++) {
+        datetime_column_set(column, i, datetime_from_ordinal((int)i * 3637 + 1));
+    }
+    datetime_column_weekday(column, many);
+    for (i = 0; i < 1003; i++) {
+        assert(many[i] == weekday(column->years[i], column->months[i], column->days[i]));
+    }
+    free(many);
+    datetime_column_destroy(column);
+
+    printf("[PASS] datetime_column_weekday\n");
+}
+
+void test_datetime_column_compare() {
+    DateTimeColumn *column1;
+    DateTimeColumn *column2;
+    int results[3];
+
+    column1 = datetime_column_create(3);
+    column2 = datetime_column_create(3);
+    datetime_column_set(column1, 0, datetime_create(2000, JAN, 1, 0, 0, 0, 0));
+    datetime_column_set(column2, 0, datetime_create(2000, JAN, 1, 0, 0, 0, 0));
+    datetime_column_set(column1, 1, datetime_create(2000, JAN, 1, 0, 0, 0, 0));
+    datetime_column_set(column2, 1, datetime_create(2000, JAN, 1, 0, 0, 0, 1));
+    datetime_column_set(column1, 2, datetime_create(2001, JAN, 1, 0, 0, 0, 0));
+    datetime_column_set(column2, 2, datetime_create(2000, DEC, 31, 23, 59, 59, 999));
+    datetime_column_compare(column1, column2, results);
+    assert(results[0] == 0);
+    assert(results[1] < 0);
+    assert(results[2] > 0);
+    datetime_column_destroy(column1);
+    datetime_column_destroy(column2);
+
+    printf("[PASS] datetime_column_compare\n");
+}
+
+void test_datetime_column_instant() {
+    const size_t ROWS = 100003;
+    DateTimeColumn *column;
+    Instant *instants;
+    Instant *results;
+    Instant step;
+    size_t i;
+
+    column = datetime_column_create(ROWS);
+    instants = (Instant *)malloc(sizeof(Instant) * ROWS);
+    results = (Instant *)malloc(sizeof(Instant) * ROWS);
+    assert(column != NULL && instants != NULL && results != NULL);
+
+    step = (INSTANT_MAX - INSTANT_MIN) / (Instant)(ROWS - 1);
+    for (i = 0; i < ROWS; i++) {
+        instants[i] = INSTANT_MIN + step * (Instant)i + (Instant)(i % 1000);
+    }
+    instants[ROWS - 1] = INSTANT_MAX;
+    instants[1] = -1;
+    instants[2] = 0;
+
+    assert(datetime_column_from_instant(column, instants) == true);
+    for (i = 0; i < ROWS; i++) {
+        assert(datetime_compare(datetime_column_get(column, i), instant_to_datetime(instants[i])) == 0);
+    }
+
+    datetime_column_to_instant(column, results);
+    for (i = 0; i < ROWS; i++) {
+        assert(results[i] == instants[i]);
+    }
+
+    datetime_column_set(column, 3, datetime_create(2000, JAN, 1, 0, 0, 0, 0));
+    instants[3] = INSTANT_MAX + 1;
+    assert(datetime_column_from_instant(column, instants) == false);
+    assert(datetime_compare(datetime_column_get(column, 3), datetime_create(2000, JAN, 1, 0, 0, 0, 0)) == 0);
+    assert(datetime_compare(datetime_column_get(column, 4), instant_to_datetime(instants[4])) == 0);
+
+    datetime_column_destroy(column);
+    free(instants);
+    free(results);
+
+    printf("[PASS] datetime_column_instant\n");
+}
+
+void test_datetime_parse_iso8601() {
+    const char *span = "2024-02-29T23:59:59.999Z|2024-03-01T00:00:00Z";
+    DateTime datetime;
+    DateTime sentinel = datetime_create(2000, JAN, 1, 0, 0, 0, 0);
+
+    assert(datetime_parse_iso8601("2024-02-29T23:59:59.999Z", DATETIME_ISO8601_LENGTH, &datetime) == DATETIME_OK);
+    assert(datetime_compare(datetime, datetime_create(2024, FEB, 29, 23, 59, 59, 999)) == 0);
+    assert(datetime_parse_iso8601("0001-01-01T00:00:00.000Z", 24, &datetime) == DATETIME_OK);
+    assert(datetime_compare(datetime, datetime_create(1, JAN, 1, 0, 0, 0, 0)) == 0);
+    assert(datetime_parse_iso8601("9999-12-31t23:59:59z", 20, &datetime) == DATETIME_OK);
+    assert(datetime_compare(datetime, datetime_create(9999, DEC, 31, 23, 59, 59, 0)) == 0);
+    assert(datetime_parse_iso8601("1970-01-01 12:34:56", 19, &datetime) == DATETIME_OK);
+    assert(datetime_compare(datetime, datetime_create(1970, JAN, 1, 12, 34, 56, 0)) == 0);
+    assert(datetime_parse_iso8601("1970-01-01T12:34:56.5Z", 22, &datetime) == DATETIME_OK);
+    assert(datetime.time.millisecond == 500);
+    assert(datetime_parse_iso8601("1970-01-01T12:34:56,123456789Z", 30, &datetime) == DATETIME_OK);
+    assert(datetime.time.millisecond == 123);
+
+    /* Zone offsets are converted to UTC */
+    assert(datetime_parse_iso8601("2024-01-01T01:30:00.000+02:00", 29, &datetime) == DATETIME_OK);
+    assert(datetime_compare(datetime, datetime_create(2023, DEC, 31, 23, 30, 0, 0)) == 0);
+    assert(datetime_parse_iso8601("2024-02-28T20:00:00-05:30", 25, &datetime) == DATETIME_OK);
+    assert(datetime_compare(datetime, datetime_create(2024, FEB, 29, 1, 30, 0, 0)) == 0);
+    assert(datetime_parse_iso8601("2024-02-28T20:00:00+00:00", 25, &datetime) == DATETIME_OK);
+    assert(datetime_compare(datetime, datetime_create(2024, FEB, 28, 20, 0, 0, 0)) == 0);
+
+    /* Spans need no NUL terminator */
+    assert(datetime_parse_iso8601(span, 24, &datetime) == DATETIME_OK);
+    assert(datetime_compare(datetime, datetime_create(2024, FEB, 29, 23, 59, 59, 999)) == 0);
+    assert(datetime_parse_iso8601(span + 25, 20, &datetime) == DATETIME_OK);
+    assert(datetime_compare(datetime, datetime_create(2024, MAR, 1, 0, 0, 0, 0)) == 0);
+    assert(datetime_parse_iso8601(span, 25, &datetime) == DATETIME_ERROR_SYNTAX);
+
+    datetime = sentinel;
+    assert(datetime_parse_iso8601(NULL, 24, &datetime) == DATETIME_ERROR_ARGUMENT);
+    assert(datetime_parse_iso8601("2024-02-29T23:59:59.999Z", 24, NULL) == DATETIME_ERROR_ARGUMENT);
+    assert(datetime_parse_iso8601("2024-02-29T23:59:59.999Z", 18, &datetime) == DATETIME_ERROR_SYNTAX);
+    assert(datetime_parse_iso8601("2024-02-29X23:59:59.999Z", 24, &datetime) == DATETIME_ERROR_SYNTAX);
+    assert(datetime_parse_iso8601("2024/02-29T23:59:59.999Z", 24, &datetime) == DATETIME_ERROR_SYNTAX);
+    assert(datetime_parse_iso8601("2024-02-29T23:59:5a.999Z", 24, &datetime) == DATETIME_ERROR_SYNTAX);
+    assert(datetime_parse_iso8601("2024-02-29T23:59:59;999Z", 24, &datetime) == DATETIME_ERROR_SYNTAX);
+    assert(datetime_parse_iso8601("2024-02-29T23:59:59.Z", 21, &datetime) == DATETIME_ERROR_SYNTAX);
+    assert(datetime_parse_iso8601("2024-02-29T23:59:59+0100", 24, &datetime) == DATETIME_ERROR_SYNTAX);
+    assert(datetime_parse_iso8601("2024-02-29T23:59:59ZZ", 21, &datetime) == DATETIME_ERROR_SYNTAX);
+    assert(datetime_parse_iso8601("2023-02-29T23:59:59.999Z", 24, &datetime) == DATETIME_ERROR_RANGE);
+    assert(datetime_parse_iso8601("2024-13-01T00:00:00Z", 20, &datetime) == DATETIME_ERROR_RANGE);
+    assert(datetime_parse_iso8601("2024-01-01T24:00:00Z", 20, &datetime) == DATETIME_ERROR_RANGE);
+    assert(datetime_parse_iso8601("2024-01-01T23:59:60Z", 20, &datetime) == DATETIME_ERROR_RANGE);
+    assert(datetime_parse_iso8601("0000-12-31T00:00:00Z", 20, &datetime) == DATETIME_ERROR_RANGE);
+    assert(datetime_parse_iso8601("2024-01-01T00:00:00+24:00", 25, &datetime) == DATETIME_ERROR_RANGE);
+    assert(datetime_parse_iso8601("9999-12-31T23:00:00-02:00", 25, &datetime) == DATETIME_ERROR_RANGE);
+    assert(datetime_parse_iso8601("0001-01-01T00:00:00+00:01", 25, &datetime) == DATETIME_ERROR_RANGE);
+    assert(datetime_compare(datetime, sentinel) == 0);
+
+    printf("[PASS] datetime_parse_iso8601\n");
+}
+
+static void *__fail_checked_call(void *arg) {
+    Date date;
+    (void)arg;
+    assert(date_create_checked(2023, FEB, 29, &date) == DATETIME_ERROR_RANGE);
+    assert(datetime_last_error() == DATETIME_ERROR_RANGE);
+    return NULL;
+}
+
+void test_datetime_error() {
+    pthread_t thread;
+    DateTime datetime;
+    Date date;
+
+    assert(strcmp(datetime_error_string(DATETIME_OK), "success") == 0);
+    assert(strcmp(datetime_error_string(DATETIME_ERROR_ARGUMENT), datetime_error_string(DATETIME_ERROR_RANGE)) != 0);
+    assert(strcmp(datetime_error_string(DATETIME_ERROR_SYNTAX), datetime_error_string(DATETIME_ERROR_RANGE)) != 0);
+    assert(strcmp(datetime_error_string((DateTimeError)100), "unknown error") == 0);
+
+    datetime_clear_error();
+    assert(datetime_last_error() == DATETIME_OK);
+    assert(date_create_checked(2023, FEB, 29, &date) == DATETIME_ERROR_RANGE);
+    assert(datetime_last_error() == DATETIME_ERROR_RANGE);
+    assert(date_create_checked(2024, FEB, 29, NULL) == DATETIME_ERROR_ARGUMENT);
+    assert(datetime_last_error() == DATETIME_ERROR_ARGUMENT);
+    assert(datetime_parse_iso8601("2024-02-29", 10, &datetime) == DATETIME_ERROR_SYNTAX);
+    assert(datetime_last_error() == DATETIME_ERROR_SYNTAX);
+    assert(date_create_checked(2024, FEB, 29, &date) == DATETIME_OK);
+    assert(datetime_last_error() == DATETIME_OK);
+
+    /* The last error is per thread */
+    assert(date_create_checked(2023, FEB, 29, &date) == DATETIME_ERROR_RANGE);
+    datetime_clear_error();
+    assert(pthread_create(&thread, NULL, __fail_checked_call, NULL) == 0);
+    assert(pthread_join(thread, NULL) == 0);
+    assert(datetime_last_error() == DATETIME_OK);
+
+    printf("[PASS] datetime_error\n");
+}
+
+void test_date_checked() {
+    const char *name = NULL;
+    Weekday day_of_week = SUN;
+    Date sentinel = date_create(2000, JAN, 1);
+    Date date = sentinel;
+    int result = -1;
+
+    assert(month_name_checked(DEC, &name) == DATETIME_OK && strcmp(name, "December") == 0);
+    assert(month_name_checked((Month)13, &name) == DATETIME_ERROR_RANGE);
+    assert(weekday_full_name_checked(SAT, &name) == DATETIME_OK && strcmp(name, "Saturday") == 0);
+    assert(weekday_full_name_checked((Weekday)7, &name) == DATETIME_ERROR_RANGE);
+    assert(weekday_abbr_name_checked(SUN, &name) == DATETIME_OK && strcmp(name, "Sun") == 0);
+    assert(weekday_abbr_name_checked((Weekday)-1, &name) == DATETIME_ERROR_RANGE);
+    assert(weekday_abbr_name_checked(SUN, NULL) == DATETIME_ERROR_ARGUMENT);
+
+    assert(days_in_month_checked(2024, FEB, &result) == DATETIME_OK && result == 29);
+    assert(days_in_month_checked(2024, 0, &result) == DATETIME_ERROR_RANGE && result == 29);
+    assert(nth_day_of_year_checked(2024, DEC, 31, &result) == DATETIME_OK && result == 366);
+    assert(nth_day_of_year_checked(2023, FEB, 29, &result) == DATETIME_ERROR_RANGE && result == 366);
+    assert(weekday_checked(2024, FEB, 29, &day_of_week) == DATETIME_OK && day_of_week == THU);
+    assert(weekday_checked(10000, JAN, 1, &day_of_week) == DATETIME_ERROR_RANGE && day_of_week == THU);
+
+    assert(date_create_checked(2023, JUN, 31, &date) == DATETIME_ERROR_RANGE);
+    assert(date_create_checked(0, JAN, 1, &date) == DATETIME_ERROR_RANGE);
+    assert(date_compare(date, sentinel) == 0);
+    assert(date_create_checked(2023, JUN, 30, &date) == DATETIME_OK);
+    assert(date.year == 2023 && date.month == JUN && date.day == 30);
+
+    assert(date_compare_checked(date, sentinel, &result) == DATETIME_OK && result == 1);
+    assert(date_compare_checked(sentinel, date, &result) == DATETIME_OK && result == -1);
+    assert(date_compare_checked(date, date_create(2023, JUN, 30), &result) == DATETIME_OK && result == 0);
+    sentinel.day = 32;
+    assert(date_compare_checked(date, sentinel, &result) == DATETIME_ERROR_RANGE && result == 0);
+    assert(date_diff_checked(date, sentinel, &result) == DATETIME_ERROR_RANGE && result == 0);
+    assert(date_add_checked(sentinel, 1, &date) == DATETIME_ERROR_RANGE);
+    sentinel.day = 1;
+    assert(date_diff_checked(date, sentinel, &result) == DATETIME_OK && result == 8581);
+
+    assert(date_add_checked(date_create(9999, DEC, 30), 1, &date) == DATETIME_OK);
+    assert(date.year == 9999 && date.month == DEC && date.day == 31);
+    assert(date_add_checked(date, 1, &date) == DATETIME_ERROR_RANGE);
+    assert(date_add_checked(date_create(1, JAN, 1), -1, &date) == DATETIME_ERROR_RANGE);
+    assert(date_add_checked(date_create(1, JAN, 1), 2147483647, &date) == DATETIME_ERROR_RANGE);
+    assert(date.year == 9999 && date.month == DEC && date.day == 31);
+    assert(date_add_checked(date, 0, NULL) == DATETIME_ERROR_ARGUMENT);
+
+    printf("[PASS] date_checked\n");
+}
+
+void test_time_checked() {
+    TimeInterval time_interval;
+    Time time = time_create(12, 0, 0, 0);
+    int result = -1;
+
+    assert(time_interval_create_checked(0, 0, 0, 0, 86400000, &time_interval) == DATETIME_OK);
+    assert(time_interval.days == 1 && time_interval.hours == 0 && time_interval.milliseconds == 0);
+    assert(time_interval_create_checked(0, -1, 0, 0, 0, &time_interval) == DATETIME_ERROR_RANGE);
+    assert(time_interval.days == 1);
+    assert(time_interval_create_checked(0, 0, 0, 0, 0, NULL) == DATETIME_ERROR_ARGUMENT);
+
+    assert(time_create_checked(24, 0, 0, 0, &time) == DATETIME_ERROR_RANGE);
+    assert(time_create_checked(0, 0, 60, 0, &time) == DATETIME_ERROR_RANGE);
+    assert(time_create_checked(0, 0, 0, -1, &time) == DATETIME_ERROR_RANGE);
+    assert(time.hour == 12);
+    assert(time_create_checked(23, 59, 59, 999, &time) == DATETIME_OK);
+    assert(time.hour == 23 && time.minute == 59 && time.second == 59 && time.millisecond == 999);
+
+    assert(time_compare_checked(time, time_create(0, 0, 0, 0), &result) == DATETIME_OK && result == 1);
+    assert(time_diff_checked(time, time_create(0, 0, 0, 0), &result) == DATETIME_OK && result == 86399999);
+    assert(time_add_checked(time, 1, &time) == DATETIME_OK);
+    assert(time.hour == 0 && time.minute == 0 && time.second == 0 && time.millisecond == 0);
+
+    time.minute = 60;
+    assert(time_compare_checked(time, time, &result) == DATETIME_ERROR_RANGE && result == 86399999);
+    assert(time_diff_checked(time, time, &result) == DATETIME_ERROR_RANGE);
+    assert(time_add_checked(time, 1, &time) == DATETIME_ERROR_RANGE);
+    assert(time.minute == 60);
+
+    printf("[PASS] time_checked\n");
+}
+
+void test_datetime_checked() {
+    DateTime sentinel = datetime_create(2000, JAN, 1, 0, 0, 0, 0);
+    DateTime datetime = sentinel;
+    DateTime invalid = sentinel;
+    TimeInterval time_interval;
+    PackedDateTime packed_datetime;
+    PackedDate packed_date;
+    PackedTime packed_time;
+    Instant instant;
+    time_t timestamp;
+    Date date;
+    Time time;
+    int result;
+
+    invalid.time.second = 60;
+
+    assert(datetime_create_checked(2024, FEB, 30, 0, 0, 0, 0, &datetime) == DATETIME_ERROR_RANGE);
+    assert(datetime_create_checked(2024, FEB, 29, 0, 0, 0, 1000, &datetime) == DATETIME_ERROR_RANGE);
+    assert(datetime_compare(datetime, sentinel) == 0);
+    assert(datetime_create_checked(2024, FEB, 29, 23, 59, 59, 999, &datetime) == DATETIME_OK);
+    assert(datetime_compare(datetime, datetime_create(2024, FEB, 29, 23, 59, 59, 999)) == 0);
+
+    assert(datetime_from_timestamp_checked((time_t)253402300799, &datetime) == DATETIME_OK);
+    assert(datetime_compare(datetime, datetime_create(9999, DEC, 31, 23, 59, 59, 0)) == 0);
+    assert(datetime_from_timestamp_checked((time_t)253402300800, &datetime) == DATETIME_ERROR_RANGE);
+    assert(datetime_from_timestamp_checked(-(time_t)62135596801, &datetime) == DATETIME_ERROR_RANGE);
+    assert(datetime_to_timestamp_checked(datetime, &timestamp) == DATETIME_OK && timestamp == (time_t)253402300799);
+    assert(datetime_to_timestamp_checked(invalid, &timestamp) == DATETIME_ERROR_RANGE);
+
+    assert(datetime_from_ordinal_checked(3652059, &datetime) == DATETIME_OK);
+    assert(datetime_compare(datetime, datetime_create(9999, DEC, 31, 0, 0, 0, 0)) == 0);
+    assert(datetime_from_ordinal_checked(3652060, &datetime) == DATETIME_ERROR_RANGE);
+    assert(datetime_from_ordinal_checked(0, &datetime) == DATETIME_ERROR_RANGE);
+    assert(datetime_to_ordinal_checked(datetime, &result) == DATETIME_OK && result == 3652059);
+    assert(datetime_to_ordinal_checked(invalid, &result) == DATETIME_ERROR_RANGE);
+
+    assert(datetime_compare_checked(datetime, sentinel, &result) == DATETIME_OK && result == 1);
+    assert(datetime_compare_checked(datetime, invalid, &result) == DATETIME_ERROR_RANGE && result == 1);
+    assert(datetime_diff_checked(datetime_create(2023, MAY, 31, 22, 59, 29, 100), datetime_create(2023, MAY, 30, 22, 57, 28, 0), &time_interval) == DATETIME_OK);
+    assert(time_interval.days == 1 && time_interval.hours == 0 && time_interval.minutes == 2 && time_interval.seconds == 1 && time_interval.milliseconds == 100);
+    assert(datetime_diff_checked(invalid, sentinel, &time_interval) == DATETIME_ERROR_RANGE);
+
+    assert(datetime_add_checked(datetime_create(9999, DEC, 31, 23, 59, 59, 900), 0, 99, &datetime) == DATETIME_OK);
+    assert(datetime_compare(datetime, datetime_create(9999, DEC, 31, 23, 59, 59, 999)) == 0);
+    assert(datetime_add_checked(datetime, 0, 1, &datetime) == DATETIME_ERROR_RANGE);
+    assert(datetime_add_checked(datetime_create(1, JAN, 1, 0, 0, 0, 0), 0, -1, &datetime) == DATETIME_ERROR_RANGE);
+    assert(datetime_add_checked(invalid, 0, 0, &datetime) == DATETIME_ERROR_RANGE);
+    assert(datetime_compare(datetime, datetime_create(9999, DEC, 31, 23, 59, 59, 999)) == 0);
+
+    assert(instant_from_datetime_checked(datetime, &instant) == DATETIME_OK && instant == INSTANT_MAX);
+    assert(instant_from_datetime_checked(invalid, &instant) == DATETIME_ERROR_RANGE);
+    assert(instant_to_datetime_checked(INSTANT_MIN, &datetime) == DATETIME_OK);
+    assert(datetime_compare(datetime, datetime_create(1, JAN, 1, 0, 0, 0, 0)) == 0);
+    assert(instant_to_datetime_checked(INSTANT_MAX + 1, &datetime) == DATETIME_ERROR_RANGE);
+    assert(instant_to_datetime_checked(INSTANT_MIN - 1, &datetime) == DATETIME_ERROR_RANGE);
+
+    assert(date_pack_checked(sentinel.date, &packed_date) == DATETIME_OK && packed_date == date_pack(sentinel.date));
+    assert(date_pack_checked(date_unpack_unchecked(0), &packed_date) == DATETIME_ERROR_RANGE);
+    assert(date_unpack_checked(packed_date, &date) == DATETIME_OK && date_compare(date, sentinel.date) == 0);
+    assert(date_unpack_checked(0, &date) == DATETIME_ERROR_RANGE);
+    assert(time_pack_checked(invalid.time, &packed_time) == DATETIME_ERROR_RANGE);
+    assert(time_pack_checked(sentinel.time, &packed_time) == DATETIME_OK && packed_time == 0);
+    assert(time_unpack_checked(86399999, &time) == DATETIME_OK && time_compare(time, time_create(23, 59, 59, 999)) == 0);
+    assert(time_unpack_checked(86400000, &time) == DATETIME_ERROR_RANGE);
+    assert(datetime_pack_checked(invalid, &packed_datetime) == DATETIME_ERROR_RANGE);
+    assert(datetime_pack_checked(sentinel, &packed_datetime) == DATETIME_OK && packed_datetime == datetime_pack(sentinel));
+    assert(datetime_unpack_checked(packed_datetime, &datetime) == DATETIME_OK && datetime_compare(datetime, sentinel) == 0);
+    assert(datetime_unpack_checked(packed_datetime | 86400000, &datetime) == DATETIME_ERROR_RANGE);
+    assert(datetime_unpack_checked(packed_datetime & 0xFFFFFFFF, &datetime) == DATETIME_ERROR_RANGE);
+    assert(datetime_unpack_checked(packed_datetime, NULL) == DATETIME_ERROR_ARGUMENT);
+
+    printf("[PASS] datetime_checked\n");
+}
+
+void test_datetime_unchecked() {
+    DateTime datetime1;
+    DateTime datetime2;
+    TimeInterval interval1;
+    TimeInterval interval2;
+    int ordinal;
+    int step;
+
+    /* The unchecked variants agree with the validating functions on valid values */
+    for (ordinal = 1, step = 0; ordinal <= 3652059; ordinal += 997, step++) {
+        datetime1 = datetime_add(datetime_from_ordinal(ordinal), 0, step * 7919 % 86400000);
+        datetime2 = datetime_add(datetime_from_ordinal(3652060 - ordinal), 0, step * 104729 % 86400000);
+
+        assert(date_compare_unchecked(datetime1.date, datetime2.date) == date_compare(datetime1.date, datetime2.date));
+        assert(date_diff_unchecked(datetime1.date, datetime2.date) == date_diff(datetime1.date, datetime2.date));
+        assert(time_compare_unchecked(datetime1.time, datetime2.time) == time_compare(datetime1.time, datetime2.time));
+        assert(time_diff_unchecked(datetime1.time, datetime2.time) == time_diff(datetime1.time, datetime2.time));
+        assert(time_compare(time_add_unchecked(datetime1.time, -step * 7), time_add(datetime1.time, -step * 7)) == 0);
+        assert(datetime_compare_unchecked(datetime1, datetime2) == datetime_compare(datetime1, datetime2));
+        assert(datetime_compare_unchecked(datetime1, datetime1) == 0);
+        assert(nth_day_of_year_unchecked(datetime1.date.year, datetime1.date.month, datetime1.date.day) ==
+               nth_day_of_year(datetime1.date.year, datetime1.date.month, datetime1.date.day));
+        assert(weekday_unchecked(datetime1.date.year, datetime1.date.month, datetime1.date.day) ==
+               weekday(datetime1.date.year, datetime1.date.month, datetime1.date.day));
+        assert(datetime_to_ordinal_unchecked(datetime1) == ordinal);
+        assert(datetime_compare(datetime_from_ordinal_unchecked(ordinal), datetime_from_ordinal(ordinal)) == 0);
+        assert(datetime_to_timestamp_unchecked(datetime1) == datetime_to_timestamp(datetime1));
+        assert(datetime_compare(datetime_from_timestamp_unchecked(datetime_to_timestamp(datetime1)), datetime_from_timestamp(datetime_to_timestamp(datetime1))) == 0);
+        assert(instant_from_datetime_unchecked(datetime1) == instant_from_datetime(datetime1));
+        assert(datetime_compare(instant_to_datetime_unchecked(instant_from_datetime(datetime1)), datetime1) == 0);
+        assert(datetime_pack_unchecked(datetime1) == datetime_pack(datetime1));
+        assert(datetime_compare(datetime_unpack_unchecked(datetime_pack(datetime1)), datetime1) == 0);
+        assert(date_compare(date_add_unchecked(datetime2.date, ordinal - 1), date_add(datetime2.date, ordinal - 1)) == 0);
+        assert(datetime_compare(datetime_add_unchecked(datetime2, ordinal - 1, -step), datetime_add(datetime2, ordinal - 1, -step)) == 0);
+
+        interval1 = datetime_diff_unchecked(datetime1, datetime2);
+        interval2 = datetime_diff(datetime1, datetime2);
+        assert(memcmp(&interval1, &interval2, sizeof(TimeInterval)) == 0);
+    }
+
+    printf("[PASS] datetime_unchecked\n");
+}
+
+void test_datetime_array_timestamp() {
+    time_t timestamps[4] = {0, -(time_t)62135596800, (time_t)253402300799, 951825600};
+    time_t results[4];
+    DateTime datetimes[4];
+
+    assert(datetime_array_from_timestamp(timestamps, datetimes, 4) == true);
+    assert(datetime_compare(datetimes[0], datetime_create(1970, JAN, 1, 0, 0, 0, 0)) == 0);
+    assert(datetime_compare(datetimes[1], datetime_create(1, JAN, 1, 0, 0, 0, 0)) == 0);
+    assert(datetime_compare(datetimes[2], datetime_create(9999, DEC, 31, 23, 59, 59, 0)) == 0);
+    assert(datetime_compare(datetimes[3], datetime_create(2000, FEB, 29, 12, 0, 0, 0)) == 0);
+
+    datetime_array_to_timestamp(datetimes, results, 4);
+    assert(memcmp(timestamps, results, sizeof(results)) == 0);
+
+    timestamps[1] = -(time_t)62135596801;
+    datetimes[1] = datetime_create(2000, JAN, 1, 0, 0, 0, 0);
+    assert(datetime_array_from_timestamp(timestamps, datetimes, 4) == false);
+    assert(datetime_compare(datetimes[1], datetime_create(2000, JAN, 1, 0, 0, 0, 0)) == 0);
+
+    printf("[PASS] datetime_array_timestamp\n");
+}
+
+void test_datetime_array_string() {
+    const size_t STRIDE = 32;
+    DateTime datetimes[3];
+    DateTime results[3];
+    char buffer[3 * 32];
+    bool valid[3];
+
+    datetimes[0] = datetime_create(1, JAN, 1, 0, 0, 0, 0);
+    datetimes[1] = datetime_create(2024, FEB, 29, 23, 59, 59, 999);
+    datetimes[2] = datetime_create(9999, DEC, 31, 12, 34, 56, 7);
+    datetime_array_to_string(datetimes, buffer, STRIDE, 3);
+    assert(strcmp(buffer, "0001-01-01 00:00:00.000") == 0);
+    assert(strcmp(buffer + STRIDE, "2024-02-29 23:59:59.999") == 0);
+    assert(strcmp(buffer + 2 * STRIDE, "9999-12-31 12:34:56.007") == 0);
+
+    assert(datetime_array_parse(buffer, STRIDE, results, valid, 3) == 3);
+    assert(valid[0] && valid[1] && valid[2]);
+    assert(datetime_compare(results[0], datetimes[0]) == 0);
+    assert(datetime_compare(results[1], datetimes[1]) == 0);
+    assert(datetime_compare(results[2], datetimes[2]) == 0);
+
+    /* Rows need no NUL terminator */
+    assert(datetime_array_parse("2000-01-01 00:00:00.0002000-12-31 23:59:59.999", DATETIME_STRING_LENGTH, results, valid, 2) == 2);
+    assert(datetime_compare(results[1], datetime_create(2000, DEC, 31, 23, 59, 59, 999)) == 0);
+
+    memcpy(buffer, "2023-02-29 00:00:00.000", DATETIME_STRING_LENGTH);
+    memcpy(buffer + STRIDE, "2023-01-01T00:00:00.000", DATETIME_STRING_LENGTH);
+    memcpy(buffer + 2 * STRIDE, "2023-01-01 24:00:00.0x0", DATETIME_STRING_LENGTH);
+    results[0] = datetimes[0];
+    assert(datetime_array_parse(buffer, STRIDE, results, valid, 3) == 0);
+    assert(!valid[0] && !valid[1] && !valid[2]);
+    assert(datetime_compare(results[0], datetimes[0]) == 0);
+
+    printf("[PASS] datetime_array_string\n");
+}
+
+static void __count_rows_task(void *context, size_t begin, size_t end) {
+    int *counts = (int *)context;
+    size_t i;
+
+    for (i = begin; i < end; i++) {
+        counts[i]++;
+    }
+}
+
+void test_datetime_thread_pool_run() {
+    const size_t ROWS = 100003;
+    DateTimeThreadPool *pool;
+    int *counts;
+    size_t i;
+
+    pool = datetime_thread_pool_create(4);
+    counts = (int *)calloc(ROWS, sizeof(int));
+    assert(pool != NULL && counts != NULL);
+    assert(datetime_thread_pool_size(pool) == 4);
+    assert(datetime_thread_pool_size(NULL) >= 1);
+
+    assert(datetime_thread_pool_run(pool, ROWS, 7, __count_rows_task, counts) == true);
+    assert(datetime_thread_pool_run(pool, ROWS, 0, __count_rows_task, counts) == true);
+    assert(datetime_thread_pool_run(NULL, ROWS, 100, __count_rows_task, counts) == true);
+    assert(datetime_thread_pool_run(pool, 0, 0, __count_rows_task, counts) == true);
+    assert(datetime_thread_pool_run(pool, ROWS, 0, NULL, counts) == false);
+    for (i = 0; i < ROWS; i++) {
+        assert(counts[i] == 3);
+    }
+
+    free(counts);
+    datetime_thread_pool_destroy(pool);
+
+    printf("[PASS] datetime_thread_pool_run\n");
+}
+
+void test_datetime_parallel() {
+    const size_t ROWS = 50021;
+    const size_t STRIDE = 24;
+    DateTimeThreadPool *pool;
+    time_t *timestamps;
+    time_t *results;
+    DateTime *datetimes;
+    DateTime *parsed;
+    char *buffer;
+    char *expected;
+    bool *valid;
+    size_t i;
+
+    pool = datetime_thread_pool_create(3);
+    timestamps = (time_t *)malloc(sizeof(time_t) * ROWS);
+    results = (time_t *)malloc(sizeof(time_t) * ROWS);
+    datetimes = (DateTime *)malloc(sizeof(DateTime) * ROWS);
+    parsed = (DateTime *)malloc(sizeof(DateTime) * ROWS);
+    buffer = (char *)malloc(STRIDE * ROWS);
+    expected = (char *)malloc(STRIDE * ROWS);
+    valid = (bool *)malloc(sizeof(bool) * ROWS);
+    assert(pool != NULL && timestamps != NULL && results != NULL && datetimes != NULL && parsed != NULL && buffer != NULL &&
+           expected != NULL && valid != NULL);
+
+    for (i = 0; i < ROWS; i++) {
+        timestamps[i] = -(time_t)62135596800 + (time_t)i * 6308233;
+    }
+
+    assert(datetime_parallel_from_timestamp(pool, timestamps, datetimes, ROWS) == true);
+    for (i = 0; i < ROWS; i += 97) {
+        assert(datetime_compare(datetimes[i], datetime_from_timestamp(timestamps[i])) == 0);
+    }
+
+    datetime_parallel_to_timestamp(pool, datetimes, results, ROWS);
+    assert(memcmp(timestamps, results, sizeof(time_t) * ROWS) == 0);
+
+    datetime_parallel_to_string(pool, datetimes, buffer, STRIDE, ROWS);
+    datetime_array_to_string(datetimes, expected, STRIDE, ROWS);
+    assert(memcmp(buffer, expected, STRIDE * ROWS) == 0);
+
+    buffer[STRIDE * (ROWS / 2) + 4] = '/';
+    assert(datetime_parallel_parse(pool, buffer, STRIDE, parsed, valid, ROWS) == ROWS - 1);
+    for (i = 0; i < ROWS; i++) {
+        assert(valid[i] == (i != ROWS / 2));
+        assert(!valid[i] || datetime_compare(parsed[i], datetimes[i]) == 0);
+    }
+
+    timestamps[ROWS - 1] = (time_t)253402300800;
+    assert(datetime_parallel_from_timestamp(pool, timestamps, datetimes, ROWS) == false);
+
+    free(timestamps);
+    free(results);
+    free(datetimes);
+    free(parsed);
+    free(buffer);
+    free(expected);
+    free(valid);
+    datetime_thread_pool_destroy(pool);
+
+    printf("[PASS] datetime_parallel\n");
+}
+
+void test_business_calendar_create() {
+    Date holidays[4];
+    BusinessCalendar *calendar;
+
+    calendar = business_calendar_create(date_create(2024, JAN, 1), date_create(2024, DEC, 31), BUSINESS_WEEKEND_SAT_SUN);
+    assert(calendar != NULL);
+    assert(date_compare(business_calendar_first(calendar), date_create(2024, JAN, 1)) == 0);
+    assert(date_compare(business_calendar_last(calendar), date_create(2024, DEC, 31)) == 0);
+    assert(business_calendar_weekend_mask(calendar) == BUSINESS_WEEKEND_SAT_SUN);
+    assert(business_calendar_is_business_day(calendar, date_create(2024, JAN, 1)) == true);
+    assert(business_calendar_is_business_day(calendar, date_create(2024, JAN, 6)) == false);
+    assert(business_calendar_is_business_day(calendar, date_create(2024, JAN, 7)) == false);
+    assert(business_calendar_is_business_day(calendar, date_create(2023, DEC, 29)) == false);
+
+    holidays[0] = date_create(2024, JAN, 1);
+    holidays[1] = date_create(2024, DEC, 25);
+    holidays[2] = date_create(2024, DEC, 28); /* Saturday */
+    holidays[3] = date_create(2025, JAN, 1);  /* out of the calendar */
+    assert(business_calendar_add_holidays(calendar, holidays, 4) == 3);
+    assert(business_calendar_is_business_day(calendar, date_create(2024, JAN, 1)) == false);
+    assert(business_calendar_is_business_day(calendar, date_create(2024, DEC, 25)) == false);
+    assert(business_calendar_remove_holidays(calendar, holidays + 1, 2) == 2);
+    assert(business_calendar_is_business_day(calendar, date_create(2024, DEC, 25)) == true);
+    assert(business_calendar_is_business_day(calendar, date_create(2024, DEC, 28)) == false);
+    assert(business_calendar_add_holidays(calendar, NULL, 1) == 0);
+    business_calendar_destroy(calendar);
+
+    calendar = business_calendar_create(date_create(2024, JAN, 1), date_create(2024, JAN, 7), BUSINESS_WEEKEND_FRI_SAT);
+    assert(calendar != NULL);
+    assert(business_calendar_is_business_day(calendar, date_create(2024, JAN, 5)) == false);
+    assert(business_calendar_is_business_day(calendar, date_create(2024, JAN, 7)) == true);
+    business_calendar_destroy(calendar);
+
+    holidays[0].year = 2023;
+    holidays[0].month = FEB;
+    holidays[0].day = 29;
+    assert(business_calendar_create(date_create(2024, JAN, 2), date_create(2024, JAN, 1), BUSINESS_WEEKEND_NONE) == NULL);
+    assert(business_calendar_create(holidays[0], date_create(2024, JAN, 1), BUSINESS_WEEKEND_NONE) == NULL);
+    assert(business_calendar_create(date_create(2024, JAN, 1), date_create(2024, JAN, 1), 1 << DAYS_IN_WEEK) == NULL);
+    business_calendar_destroy(NULL);
+
+    printf("[PASS] business_calendar_create\n");
+}
+
+void test_business_calendar_add() {
+    const int FIRST = 738000; /* 2021-07-23 */
+    const int LAST = 739500;
+    BusinessCalendar *calendar;
+    Date holidays[2];
+    Date dates[3];
+    Date results[3];
+    bool valid[3];
+    Date date;
+    int ordinal;
+    int expected;
+    int days;
+    int step;
+
+    calendar = business_calendar_create(date_create(2024, JAN, 1), date_create(2024, DEC, 31), BUSINESS_WEEKEND_SAT_SUN);
+    assert(calendar != NULL);
+    holidays[0] = date_create(2024, DEC, 25);
+    holidays[1] = date_create(2024, DEC, 26);
+    assert(business_calendar_add_holidays(calendar, holidays, 2) == 2);
+
+    assert(business_calendar_add(calendar, date_create(2024, DEC, 23), 2, &date) == true);
+    assert(date_compare(date, date_create(2024, DEC, 27)) == 0);
+    assert(business_calendar_add(calendar, date_create(2024, DEC, 28), 1, &date) == true);
+    assert(date_compare(date, date_create(2024, DEC, 30)) == 0);
+    assert(business_calendar_add(calendar, date_create(2024, DEC, 28), 0, &date) == true);
+    assert(date_compare(date, date_create(2024, DEC, 30)) == 0);
+    assert(business_calendar_add(calendar, date_create(2024, DEC, 27), 0, &date) == true);
+    assert(date_compare(date, date_create(2024, DEC, 27)) == 0);
+    assert(business_calendar_add(calendar, date_create(2024, DEC, 30), -1, &date) == true);
+    assert(date_compare(date, date_create(2024, DEC, 27)) == 0);
+    assert(business_calendar_add(calendar, date_create(2024, DEC, 28), -1, &date) == true);
+    assert(date_compare(date, date_create(2024, DEC, 27)) == 0);
+    assert(business_calendar_add(calendar, date_create(2024, DEC, 27), -1, &date) == true);
+    assert(date_compare(date, date_create(2024, DEC, 24)) == 0);
+
+    /* Results out of the calendar */
+    assert(business_calendar_add(calendar, date_create(2024, DEC, 31), 1, &date) == false);
+    assert(business_calendar_add(calendar, date_create(2024, JAN, 1), -1, &date) == false);
+    assert(business_calendar_add(calendar, date_create(2025, JAN, 1), 0, &date) == false);
+    assert(business_calendar_add(calendar, date_create(2024, JAN, 1), 1, NULL) == false);
+    assert(business_calendar_add(calendar, date_create(2024, JUN, 3), INT_MIN, &date) == false);
+    assert(business_calendar_add(calendar, date_create(2024, JUN, 3), INT_MAX, &date) == false);
+    assert(date_compare(date, date_create(2024, DEC, 24)) == 0);
+
+    dates[0] = date_create(2024, DEC, 23);
+    dates[1] = date_create(2024, DEC, 31);
+    dates[2] = date_create(2024, DEC, 24);
+    results[1] = date_create(2000, JAN, 1);
+    assert(business_calendar_add_many(calendar, dates, 2, results, valid, 3) == 2);
+    assert(valid[0] == true && date_compare(results[0], date_create(2024, DEC, 27)) == 0);
+    assert(valid[1] == false && date_compare(results[1], date_create(2000, JAN, 1)) == 0);
+    assert(valid[2] == true && date_compare(results[2], date_create(2024, DEC, 30)) == 0);
+    assert(business_calendar_add_many(calendar, dates, 2, results, NULL, 3) == 2);
+    business_calendar_destroy(calendar);
+
+    /* Same as stepping one day at a time, across many 64-day words */
+    calendar = business_calendar_create(datetime_from_ordinal(FIRST).date, datetime_from_ordinal(LAST).date, BUSINESS_WEEKEND_SAT_SUN);
+    assert(calendar != NULL);
+    for (ordinal = FIRST; ordinal <= LAST; ordinal += 13) {
+        date = datetime_from_ordinal(ordinal).date;
+        assert(business_calendar_add_holidays(calendar, &date, 1) == 1);
+    }
+    for (ordinal = FIRST; ordinal <= LAST; ordinal += 7) {
+        for (days = -150; days <= 150; days += 11) {
+            expected = ordinal;
+            if (days == 0) {
+                while (expected <= LAST && !business_calendar_is_business_day(calendar, datetime_from_ordinal(expected).date)) {
+                    expected++;
+                }
+            }
+            for (step = days; step != 0; step += days > 0 ? -1 : 1) {
+                do {
+                    expected += days > 0 ? 1 : -1;
+                } while (expected >= FIRST && expected <= LAST &&
+                         !business_calendar_is_business_day(calendar, datetime_from_ordinal(expected).date));
+            }
+
+            if (expected < FIRST || expected > LAST) {
+                assert(business_calendar_add(calendar, datetime_from_ordinal(ordinal).date, days, &date) == false);
+            } else {
+                assert(business_calendar_add(calendar, datetime_from_ordinal(ordinal).date, days, &date) == true);
+                assert(date_compare(date, datetime_from_ordinal(expected).date) == 0);
+            }
+        }
+    }
+    business_calendar_destroy(calendar);
+
+    printf("[PASS] business_calendar_add\n");
+}
+
+void test_business_calendar_count() {
+    const int FIRST = 738000;
+    const int LAST = 738700;
+    BusinessCalendar *calendar;
+    Date date;
+    int from;
+    int to;
+    int ordinal;
+    int expected;
+    int count;
+
+    calendar = business_calendar_create(datetime_from_ordinal(FIRST).date, datetime_from_ordinal(LAST).date, BUSINESS_WEEKEND_SUN);
+    assert(calendar != NULL);
+    for (ordinal = FIRST; ordinal <= LAST; ordinal += 17) {
+        date = datetime_from_ordinal(ordinal).date;
+        assert(business_calendar_add_holidays(calendar, &date, 1) == 1);
+    }
+
+    for (from = FIRST; from <= LAST + 1; from += 5) {
+        for (to = FIRST; to <= LAST + 1; to += 23) {
+            expected = 0;
+            for (ordinal = from < to ? from : to; ordinal < (from < to ? to : from); ordinal++) {
+                expected += business_calendar_is_business_day(calendar, datetime_from_ordinal(ordinal).date);
+            }
+            assert(business_calendar_count(calendar, datetime_from_ordinal(from).date, datetime_from_ordinal(to).date, &count) == true);
+            assert(count == (from <= to ? expected : -expected));
+        }
+    }
+
+    assert(business_calendar_count(calendar, datetime_from_ordinal(FIRST - 1).date, datetime_from_ordinal(FIRST).date, &count) == false);
+    assert(business_calendar_count(calendar, datetime_from_ordinal(FIRST).date, datetime_from_ordinal(LAST + 2).date, &count) == false);
+    assert(business_calendar_count(calendar, datetime_from_ordinal(FIRST).date, datetime_from_ordinal(LAST).date, NULL) == false);
+    business_calendar_destroy(calendar);
+
+    printf("[PASS] business_calendar_count\n");
+}
+
+void test_business_calendar_image() {
+    const char *PATH = "test_business_calendar.bin";
+    BusinessCalendar *calendar;
+    BusinessCalendar *mapped;
+    BusinessCalendar *view;
+    Date holiday = date_create(2024, JUL, 4);
+    Date date;
+    const void *image;
+    uint64_t *copy;
+    size_t size;
+    size_t mapped_size;
+    size_t words;
+    int count;
+
+    calendar = business_calendar_create(date_create(2000, JAN, 1), date_create(2099, DEC, 31), BUSINESS_WEEKEND_SAT_SUN);
+    assert(calendar != NULL);
+    assert(business_calendar_add_holidays(calendar, &holiday, 1) == 1);
+    image = business_calendar_image(calendar, &size);
+    assert(image != NULL && size > 0);
+
+    assert(business_calendar_save(calendar, PATH) == true);
+    mapped = business_calendar_map(PATH);
+    assert(mapped != NULL);
+    assert(memcmp(business_calendar_image(mapped, &mapped_size), image, size) == 0 && mapped_size == size);
+    assert(date_compare(business_calendar_last(mapped), date_create(2099, DEC, 31)) == 0);
+    assert(business_calendar_is_business_day(mapped, holiday) == false);
+    assert(business_calendar_add(mapped, date_create(2024, JUL, 3), 1, &date) == true);
+    assert(date_compare(date, date_create(2024, JUL, 5)) == 0);
+    assert(business_calendar_count(mapped, date_create(2024, JUL, 1), date_create(2024, JUL, 8), &count) == true && count == 4);
+    /* Mapped calendars are read-only */
+    assert(business_calendar_add_holidays(mapped, &date, 1) == 0);
+    business_calendar_destroy(mapped);
+    remove(PATH);
+    assert(business_calendar_map(PATH) == NULL);
+
+    copy = (uint64_t *)malloc(size);
+    assert(copy != NULL);
+    memcpy(copy, image, size);
+    view = business_calendar_from_image(copy, size);
+    assert(view != NULL);
+    assert(business_calendar_count(view, date_create(2024, JUL, 1), date_create(2024, JUL, 8), &count) == true && count == 4);
+    business_calendar_destroy(view);
+    assert(business_calendar_from_image(copy, size - 1) == NULL);
+    copy[0] ^= 1;
+    assert(business_calendar_from_image(copy, size) == NULL);
+    copy[0] ^= 1;
+    /* The bitmap must match the index: a cleared bitmap, a business day added, and a day after the last one */
+    words = (size - sizeof(uint64_t) * 3 - sizeof(uint32_t)) / (sizeof(uint64_t) + sizeof(uint32_t));
+    memset(copy + 3, 0, sizeof(uint64_t) * words);
+    assert(business_calendar_from_image(copy, size) == NULL);
+    memcpy(copy, image, size);
+    copy[3 + words / 2] ^= (uint64_t)1 << 5;
+    assert(business_calendar_from_image(copy, size) == NULL);
+    memcpy(copy, image, size);
+    copy[3 + words - 1] |= (uint64_t)1 << 63;
+    assert(business_calendar_from_image(copy, size) == NULL);
+    free(copy);
+
+    business_calendar_destroy(calendar);
+
+    printf("[PASS] business_calendar_image\n");
+}
+
+void test_recurrence_compile_cron() {
+    const char *VALID[] = {"* * * * *", "0 0 1 1 *", "*/15 9-17 * * MON-FRI", "0,30 8-18/2 1-7 jan,Jul 1-5", "5/20 * * * 7",
+                           "  0 12  * * *  ", "@yearly", "@annually", "@monthly", "@weekly", "@daily", "@midnight", "@hourly"};
+    const char *INVALID[] = {"", "* * * *", "* * * * * *", "60 * * * *", "* 24 * * *", "* * 0 * *", "* * * 13 *", "* * * * 8",
+                             "5-1 * * * *", "*/0 * * * *", "* * * JANX *", "* * * * MONDAY", "1,,2 * * * *", "@foo", "@daily *", "a * * * *"};
+    Recurrence *rule;
+    size_t i;
+
+    for (i = 0; i < sizeof(VALID) / sizeof(VALID[0]); i++) {
+        rule = recurrence_compile_cron(VALID[i]);
+        assert(rule != NULL);
+        recurrence_destroy(rule);
+    }
+    for (i = 0; i < sizeof(INVALID) / sizeof(INVALID[0]); i++) {
+        assert(recurrence_compile_cron(INVALID[i]) == NULL);
+    }
+    assert(recurrence_compile_cron(NULL) == NULL);
+    recurrence_destroy(NULL);
+
+    printf("[PASS] recurrence_compile_cron\n");
+}
+
+void test_recurrence_compile_rrule() {
+    const char *VALID[] = {"FREQ=DAILY", "RRULE:FREQ=WEEKLY;BYDAY=MO,WE,FR", "freq=monthly;bymonthday=-1,15", "FREQ=YEARLY;BYMONTH=6,7;COUNT=10",
+                           "FREQ=HOURLY;INTERVAL=3;UNTIL=19970902T170000Z", "FREQ=MINUTELY;INTERVAL=15;UNTIL=19971231;WKST=MO",
+                           "FREQ=MINUTELY;COUNT=100000"};
+    const char *INVALID[] = {"", "INTERVAL=2", "FREQ=SECONDLY", "FREQ=DAILY;INTERVAL=0", "FREQ=DAILY;COUNT=0", "FREQ=DAILY;COUNT=2;UNTIL=19971231",
+                             "FREQ=WEEKLY;BYDAY=1MO", "FREQ=WEEKLY;BYDAY=XX", "FREQ=MONTHLY;BYMONTHDAY=32", "FREQ=MONTHLY;BYMONTHDAY=0",
+                             "FREQ=DAILY;BYHOUR=24", "FREQ=DAILY;UNTIL=19970231", "FREQ=DAILY;BYSETPOS=1", "FREQ=DAILY;WKST=SU", "FREQ=DAILY;",
+                             "FREQ=MINUTELY;COUNT=100001", "FREQ=MINUTELY;COUNT=999999999"};
+    DateTime start = datetime_create(1997, SEP, 2, 9, 0, 0, 0);
+    DateTime invalid = start;
+    Recurrence *rule;
+    size_t i;
+
+    for (i = 0; i < sizeof(VALID) / sizeof(VALID[0]); i++) {
+        rule = recurrence_compile_rrule(VALID[i], start);
+        assert(rule != NULL);
+        recurrence_destroy(rule);
+    }
+    for (i = 0; i < sizeof(INVALID) / sizeof(INVALID[0]); i++) {
+        assert(recurrence_compile_rrule(INVALID[i], start) == NULL);
+    }
+    invalid.time.hour = 24;
+    assert(recurrence_compile_rrule("FREQ=DAILY", invalid) == NULL);
+    assert(recurrence_compile_rrule(NULL, start) == NULL);
+
+    printf("[PASS] recurrence_compile_rrule\n");
+}
+
+void test_recurrence_next_occurrence() {
+    Recurrence *rule;
+    DateTime datetime;
+    DateTime expected[10];
+    int i;
+
+    rule = recurrence_compile_cron("*/15 9-17 * * MON-FRI");
+    assert(recurrence_next_occurrence(rule, datetime_create(2024, JAN, 5, 17, 45, 0, 0), &datetime) == true);
+    assert(datetime_compare(datetime, datetime_create(2024, JAN, 8, 9, 0, 0, 0)) == 0);
+    assert(recurrence_next_occurrence(rule, datetime_create(2024, JAN, 8, 9, 14, 59, 999), &datetime) == true);
+    assert(datetime_compare(datetime, datetime_create(2024, JAN, 8, 9, 15, 0, 0)) == 0);
+    recurrence_destroy(rule);
+
+    rule = recurrence_compile_cron("0 0 29 2 *");
+    assert(recurrence_next_occurrence(rule, datetime_create(2024, MAR, 1, 0, 0, 0, 0), &datetime) == true);
+    assert(datetime_compare(datetime, datetime_create(2028, FEB, 29, 0, 0, 0, 0)) == 0);
+    recurrence_destroy(rule);
+
+    /* Both day fields restricted: either matches */
+    rule = recurrence_compile_cron("0 12 13 * 5");
+    assert(recurrence_next_occurrence(rule, datetime_create(2024, JAN, 1, 0, 0, 0, 0), &datetime) == true);
+    assert(datetime_compare(datetime, datetime_create(2024, JAN, 5, 12, 0, 0, 0)) == 0);
+    assert(recurrence_next_occurrence(rule, datetime_create(2024, JAN, 12, 12, 0, 0, 0), &datetime) == true);
+    assert(datetime_compare(datetime, datetime_create(2024, JAN, 13, 12, 0, 0, 0)) == 0);
+    recurrence_destroy(rule);
+
+    rule = recurrence_compile_cron("@yearly");
+    assert(recurrence_next_occurrence(rule, datetime_create(2024, JUN, 1, 0, 0, 0, 0), &datetime) == true);
+    assert(datetime_compare(datetime, datetime_create(2025, JAN, 1, 0, 0, 0, 0)) == 0);
+    assert(recurrence_next_occurrence(rule, datetime_create(9999, JAN, 1, 0, 0, 0, 0), &datetime) == false);
+    recurrence_destroy(rule);
+
+    rule = recurrence_compile_cron("0 0 31 2 *");
+    assert(recurrence_next_occurrence(rule, datetime_create(2024, JAN, 1, 0, 0, 0, 0), &datetime) == false);
+    recurrence_destroy(rule);
+
+    /* RFC 5545 examples, DTSTART 1997-09-02 09:00 */
+    rule = recurrence_compile_rrule("FREQ=DAILY;COUNT=10", datetime_create(1997, SEP, 2, 9, 0, 0, 0));
+    datetime = datetime_create(1997, JAN, 1, 0, 0, 0, 0);
+    for (i = 0; i < 10; i++) {
+        assert(recurrence_next_occurrence(rule, datetime, &datetime) == true);
+        assert(datetime_compare(datetime, datetime_create(1997, SEP, 2 + i, 9, 0, 0, 0)) == 0);
+    }
+    assert(recurrence_next_occurrence(rule, datetime, &datetime) == false);
+    recurrence_destroy(rule);
+
+    rule = recurrence_compile_rrule("FREQ=WEEKLY;INTERVAL=2;UNTIL=19971007T000000Z;BYDAY=TU,TH", datetime_create(1997, SEP, 2, 9, 0, 0, 0));
+    expected[0] = datetime_create(1997, SEP, 2, 9, 0, 0, 0);
+    expected[1] = datetime_create(1997, SEP, 4, 9, 0, 0, 0);
+    expected[2] = datetime_create(1997, SEP, 16, 9, 0, 0, 0);
+    expected[3] = datetime_create(1997, SEP, 18, 9, 0, 0, 0);
+    expected[4] = datetime_create(1997, SEP, 30, 9, 0, 0, 0);
+    expected[5] = datetime_create(1997, OCT, 2, 9, 0, 0, 0);
+    datetime = datetime_create(1997, SEP, 2, 8, 0, 0, 0);
+    for (i = 0; i < 6; i++) {
+        assert(recurrence_next_occurrence(rule, datetime, &datetime) == true);
+        assert(datetime_compare(datetime, expected[i]) == 0);
+    }
+    assert(recurrence_next_occurrence(rule, datetime, &datetime) == false);
+    recurrence_destroy(rule);
+
+    rule = recurrence_compile_rrule("FREQ=MONTHLY;BYMONTHDAY=-3", datetime_create(1997, SEP, 28, 9, 0, 0, 0));
+    expected[0] = datetime_create(1997, SEP, 28, 9, 0, 0, 0);
+    expected[1] = datetime_create(1997, OCT, 29, 9, 0, 0, 0);
+    expected[2] = datetime_create(1997, NOV, 28, 9, 0, 0, 0);
+    expected[3] = datetime_create(1997, DEC, 29, 9, 0, 0, 0);
+    expected[4] = datetime_create(1998, JAN, 29, 9, 0, 0, 0);
+    expected[5] = datetime_create(1998, FEB, 26, 9, 0, 0, 0);
+    datetime = datetime_create(1997, SEP, 1, 0, 0, 0, 0);
+    for (i = 0; i < 6; i++) {
+        assert(recurrence_next_occurrence(rule, datetime, &datetime) == true);
+        assert(datetime_compare(datetime, expected[i]) == 0);
+    }
+    recurrence_destroy(rule);
+
+    rule = recurrence_compile_rrule("FREQ=MONTHLY;INTERVAL=18;COUNT=10;BYMONTHDAY=10,11,12,13,14,15", datetime_create(1997, SEP, 10, 9, 0, 0, 0));
+    datetime = datetime_create(1997, SEP, 1, 0, 0, 0, 0);
+    for (i = 0; i < 10; i++) {
+        assert(recurrence_next_occurrence(rule, datetime, &datetime) == true);
+        assert(datetime_compare(datetime, i < 6 ? datetime_create(1997, SEP, 10 + i, 9, 0, 0, 0) : datetime_create(1999, MAR, 4 + i, 9, 0, 0, 0)) == 0);
+    }
+    assert(recurrence_next_occurrence(rule, datetime, &datetime) == false);
+    recurrence_destroy(rule);
+
+    rule = recurrence_compile_rrule("FREQ=YEARLY;BYMONTH=6,7;COUNT=4", datetime_create(1997, JUN, 10, 9, 0, 0, 0));
+    expected[0] = datetime_create(1997, JUN, 10, 9, 0, 0, 0);
+    expected[1] = datetime_create(1997, JUL, 10, 9, 0, 0, 0);
+    expected[2] = datetime_create(1998, JUN, 10, 9, 0, 0, 0);
+    expected[3] = datetime_create(1998, JUL, 10, 9, 0, 0, 0);
+    datetime = datetime_create(1997, JAN, 1, 0, 0, 0, 0);
+    for (i = 0; i < 4; i++) {
+        assert(recurrence_next_occurrence(rule, datetime, &datetime) == true);
+        assert(datetime_compare(datetime, expected[i]) == 0);
+    }
+    assert(recurrence_next_occurrence(rule, datetime, &datetime) == false);
+    recurrence_destroy(rule);
+
+    rule = recurrence_compile_rrule("FREQ=HOURLY;INTERVAL=3;UNTIL=19970902T170000Z", datetime_create(1997, SEP, 2, 9, 0, 0, 0));
+    datetime = datetime_create(1997, SEP, 2, 9, 0, 0, 0);
+    assert(recurrence_next_occurrence(rule, datetime, &datetime) == true);
+    assert(datetime_compare(datetime, datetime_create(1997, SEP, 2, 12, 0, 0, 0)) == 0);
+    assert(recurrence_next_occurrence(rule, datetime, &datetime) == true);
+    assert(datetime_compare(datetime, datetime_create(1997, SEP, 2, 15, 0, 0, 0)) == 0);
+    assert(recurrence_next_occurrence(rule, datetime, &datetime) == false);
+    recurrence_destroy(rule);
+
+    rule = recurrence_compile_rrule("FREQ=MINUTELY;INTERVAL=15;COUNT=6", datetime_create(1997, SEP, 2, 9, 0, 30, 500));
+    datetime = datetime_create(1997, SEP, 2, 9, 0, 30, 500);
+    for (i = 1; i < 6; i++) {
+        assert(recurrence_next_occurrence(rule, datetime, &datetime) == true);
+        assert(datetime_compare(datetime, datetime_create(1997, SEP, 2, 9 + i / 4, i % 4 * 15, 30, 500)) == 0);
+    }
+    assert(recurrence_next_occurrence(rule, datetime, &datetime) == false);
+    recurrence_destroy(rule);
+
+    /* Every Friday the 13th */
+    rule = recurrence_compile_rrule("FREQ=MONTHLY;BYDAY=FR;BYMONTHDAY=13", datetime_create(1997, SEP, 2, 9, 0, 0, 0));
+    expected[0] = datetime_create(1998, FEB, 13, 9, 0, 0, 0);
+    expected[1] = datetime_create(1998, MAR, 13, 9, 0, 0, 0);
+    expected[2] = datetime_create(1998, NOV, 13, 9, 0, 0, 0);
+    expected[3] = datetime_create(1999, AUG, 13, 9, 0, 0, 0);
+    expected[4] = datetime_create(2000, OCT, 13, 9, 0, 0, 0);
+    datetime = datetime_create(1997, SEP, 2, 9, 0, 0, 0);
+    for (i = 0; i < 5; i++) {
+        assert(recurrence_next_occurrence(rule, datetime, &datetime) == true);
+        assert(datetime_compare(datetime, expected[i]) == 0);
+    }
+    assert(recurrence_next_occurrence(rule, datetime, NULL) == false);
+    datetime.time.minute = 60;
+    assert(recurrence_next_occurrence(rule, datetime, &datetime) == false);
+    recurrence_destroy(rule);
+
+    printf("[PASS] recurrence_next_occurrence\n");
+}
+
+void test_recurrence_matches() {
+    const char *CRONS[] = {"*/7 */5 * * *", "0 9 1,15 * MON", "30 2 * FEB-APR 0,6", "15 */6 */10 * *", "0 0 29 2 *"};
+    const char *RRULES[] = {"FREQ=DAILY;INTERVAL=3;BYHOUR=6,18;BYMINUTE=0,45", "FREQ=WEEKLY;INTERVAL=2;BYDAY=MO,SU",
+                            "FREQ=MONTHLY;INTERVAL=2;BYMONTHDAY=-1,1", "FREQ=HOURLY;INTERVAL=5;BYMINUTE=10",
+                            "FREQ=MINUTELY;INTERVAL=97;UNTIL=20250301", "FREQ=YEARLY;INTERVAL=2;BYMONTH=2;BYDAY=SA"};
+    const long MINUTES = 200000; /* about 139 days */
+    Recurrence *rules[11];
+    bool matches[11];
+    size_t count;
+    DateTime starts[3];
+    DateTime datetime;
+    DateTime next;
+    DateTime expected;
+    bool found;
+    size_t i;
+    size_t j;
+    long minute;
+
+    for (i = 0; i < 5; i++) {
+        rules[i] = recurrence_compile_cron(CRONS[i]);
+        assert(rules[i] != NULL);
+    }
+    for (i = 0; i < 6; i++) {
+        rules[5 + i] = recurrence_compile_rrule(RRULES[i], datetime_create(2024, JAN, 31, 6, 0, 0, 0));
+        assert(rules[5 + i] != NULL);
+    }
+    starts[0] = datetime_create(2023, DEC, 30, 23, 58, 0, 0);
+    starts[1] = datetime_create(2024, FEB, 28, 17, 3, 0, 0);
+    starts[2] = datetime_create(2024, DEC, 31, 5, 59, 0, 0);
+
+    /* Same as stepping one minute at a time */
+    for (i = 0; i < 11; i++) {
+        for (j = 0; j < 3; j++) {
+            datetime = starts[j];
+            found = false;
+            for (minute = 0; minute < MINUTES && !found; minute++) {
+                datetime = datetime_add(datetime, 0, MILLISECONDS_PER_MINUTE);
+                found = recurrence_matches(rules[i], datetime);
+            }
+            expected = datetime;
+            if (found && i >= 5) {
+                expected.time.second = 0;
+            }
+            if (recurrence_next_occurrence(rules[i], starts[j], &next)) {
+                assert(found ? datetime_compare(next, expected) == 0 : datetime_compare(next, datetime) > 0);
+            } else {
+                assert(!found);
+            }
+        }
+    }
+
+    assert(recurrence_matches(rules[0], datetime_create(2024, JAN, 1, 5, 14, 59, 0)) == true);
+    assert(recurrence_matches(rules[0], datetime_create(2024, JAN, 1, 5, 15, 0, 0)) == false);
+    assert(recurrence_matches(rules[5], datetime_create(2024, JAN, 28, 6, 0, 0, 0)) == false); /* before start */
+    assert(recurrence_matches(NULL, datetime_create(2024, JAN, 1, 0, 0, 0, 0)) == false);
+
+    /* Same as one rule at a time */
+    datetime = datetime_create(2024, JAN, 31, 6, 0, 0, 0);
+    for (minute = 0; minute < MINUTES; minute += 7) {
+        count = recurrence_matches_many((const Recurrence *const *)rules, datetime, matches, 11);
+        for (i = 0; i < 11; i++) {
+            assert(matches[i] == recurrence_matches(rules[i], datetime));
+            count -= matches[i];
+        }
+        assert(count == 0);
+        datetime = datetime_add(datetime, 0, 7 * MILLISECONDS_PER_MINUTE);
+    }
+    datetime.time.minute = 60;
+    assert(recurrence_matches_many((const Recurrence *const *)rules, datetime, matches, 11) == 0);
+    assert(matches[0] == false && matches[10] == false);
+
+    for (i = 0; i < 11; i++) {
+        recurrence_destroy(rules[i]);
+    }
+
+    printf("[PASS] recurrence_matches\n");
+}
+
+void test_recurrence_batch_matches() {
+    const char *CRONS[] = {"*/7 */5 * * *", "0 9 1,15 * MON", "30 2 * FEB-APR 0,6", "* * 31 * *", "0 0 29 2 *"};
+    const char *RRULES[] = {"FREQ=MINUTELY;INTERVAL=3;COUNT=50", "FREQ=MINUTELY;INTERVAL=11;UNTIL=20240201T120000Z",
+                            "FREQ=HOURLY;BYMINUTE=10,40", "FREQ=MONTHLY;BYMONTHDAY=-1;BYHOUR=6,7;BYMINUTE=0,1,2"};
+    const size_t COUNT = 130; /* 2 full words and 2 bits */
+    Recurrence *compiled[9];
+    const Recurrence *rules[130];
+    bool matches[130];
+    uint64_t mask[DATETIME_MASK_WORDS(130)];
+    RecurrenceBatch *batch;
+    DateTime datetime;
+    size_t count;
+    size_t i;
+    long minute;
+
+    for (i = 0; i < 5; i++) {
+        compiled[i] = recurrence_compile_cron(CRONS[i]);
+        assert(compiled[i] != NULL);
+    }
+    for (i = 0; i < 4; i++) {
+        compiled[5 + i] = recurrence_compile_rrule(RRULES[i], datetime_create(2024, JAN, 31, 6, 0, 0, 0));
+        assert(compiled[5 + i] != NULL);
+    }
+    for (i = 0; i < COUNT; i++) {
+        rules[i] = i % 10 == 9 ? NULL : compiled[i % 10];
+    }
+
+    batch = recurrence_batch_create(rules, COUNT);
+    assert(batch != NULL);
+    assert(recurrence_batch_count(batch) == COUNT);
+
+    /* Same as recurrence_matches_many(), bounds of the RRULEs included */
+    datetime = datetime_create(2024, JAN, 31, 5, 0, 0, 0);
+    for (minute = 0; minute < 3 * 1440; minute++) {
+        mask[2] = ~(uint64_t)0;
+        count = recurrence_batch_matches(batch, datetime, mask);
+        assert(count == recurrence_matches_many(rules, datetime, matches, COUNT));
+        for (i = 0; i < COUNT; i++) {
+            assert((bool)((mask[i / 64] >> (i % 64)) & 1) == matches[i]);
+        }
+        assert(mask[2] >> (COUNT % 64) == 0);
+        datetime = datetime_add(datetime, 0, MILLISECONDS_PER_MINUTE);
+    }
+
+    /* COUNT=50 every 3 minutes from 06:00: the last occurrence is at 08:27 */
+    assert(recurrence_batch_matches(batch, datetime_create(2024, JAN, 31, 8, 27, 0, 0), mask) > 0);
+    assert((mask[0] >> 5 & 1) == 1);
+    recurrence_batch_matches(batch, datetime_create(2024, JAN, 31, 8, 30, 0, 0), mask);
+    assert((mask[0] >> 5 & 1) == 0);
+
+    datetime.time.minute = 60;
+    assert(recurrence_batch_matches(batch, datetime, mask) == 0);
+    assert(mask[0] == 0 && mask[2] == 0);
+    recurrence_batch_destroy(batch);
+
+    batch = recurrence_batch_create(rules, 0);
+    assert(batch != NULL && recurrence_batch_count(batch) == 0);
+    assert(recurrence_batch_matches(batch, datetime_create(2024, JAN, 31, 6, 0, 0, 0), mask) == 0);
+    recurrence_batch_destroy(batch);
+    recurrence_batch_destroy(NULL);
+
+    for (i = 0; i < 9; i++) {
+        recurrence_destroy(compiled[i]);
+    }
+
+    printf("[PASS] recurrence_batch_matches\n");
+}
+
+void test_recurrence_next_occurrence_many() {
+    Recurrence *rules[3];
+    DateTime results[3];
+    bool valid[3];
+
+    rules[0] = recurrence_compile_cron("@hourly");
+    rules[1] = recurrence_compile_rrule("FREQ=DAILY;COUNT=1", datetime_create(2024, JAN, 1, 9, 0, 0, 0));
+    rules[2] = recurrence_compile_cron("0 12 * * SAT");
+    results[1] = datetime_create(2000, JAN, 1, 0, 0, 0, 0);
+
+    assert(recurrence_next_occurrence_many((const Recurrence *const *)rules, datetime_create(2024, JAN, 1, 10, 30, 0, 0), results, valid, 3) == 2);
+    assert(valid[0] == true && datetime_compare(results[0], datetime_create(2024, JAN, 1, 11, 0, 0, 0)) == 0);
+    assert(valid[1] == false && datetime_compare(results[1], datetime_create(2000, JAN, 1, 0, 0, 0, 0)) == 0);
+    assert(valid[2] == true && datetime_compare(results[2], datetime_create(2024, JAN, 6, 12, 0, 0, 0)) == 0);
+    assert(recurrence_next_occurrence_many(NULL, datetime_create(2024, JAN, 1, 10, 30, 0, 0), results, NULL, 3) == 0);
+
+    recurrence_destroy(rules[0]);
+    recurrence_destroy(rules[1]);
+    recurrence_destroy(rules[2]);
+
+    printf("[PASS] recurrence_next_occurrence_many\n");
+}
+
+static Instant __wheel_now(void *context) {
+    return *(const Instant *)context;
+}
+
+/* The expiries seen by __record_expired(). */
+typedef struct WheelLog {
+    size_t count;
+    size_t batches;
+    size_t max_batch;
+    int tick_milliseconds;
+    Instant since; /* the time of the previous advance */
+    Instant last_due;
+    TimerExpiry last;
+    TimerWheel *wheel;
+    TimerId cancel;
+    Instant schedule;
+} WheelLog;
+
+static void __record_expired(const TimerExpiry *expired, size_t count, void *context) {
+    WheelLog *log = (WheelLog *)context;
+    Instant due;
+    size_t i;
+
+    /* In order of the first tick at or after the deadline, the ones already due first */
+    for (i = 0; i < count; i++) {
+        due = expired[i].deadline + (log->tick_milliseconds - (expired[i].deadline - INSTANT_MIN) % log->tick_milliseconds) % log->tick_milliseconds;
+        due = due > log->since ? due : log->since;
+        assert(due >= log->last_due);
+        log->last_due = due;
+        if (expired[i].data != NULL) {
+            *(int *)expired[i].data += 1;
+        }
+    }
+    log->count += count;
+    log->batches++;
+    log->max_batch = count > log->max_batch ? count : log->max_batch;
+    log->last = expired[count - 1];
+    if (log->wheel != NULL) {
+        assert(timer_wheel_advance(log->wheel, INSTANT_MAX, __record_expired, log) == 0);
+        if (log->cancel != 0) {
+            assert(timer_wheel_cancel(log->wheel, log->cancel) == true);
+            log->cancel = 0;
+        }
+        if (log->schedule != 0) {
+            assert(timer_wheel_schedule_instant(log->wheel, log->schedule, expired[0].data) != 0);
+            log->schedule = 0;
+        }
+    }
+}
+
+void test_timer_wheel_create() {
+    Instant now = instant_from_datetime(datetime_create(2024, JAN, 1, 0, 0, 0, 0));
+    Instant instant;
+    TimerWheel *wheel;
+
+    assert(timer_wheel_create(0, __wheel_now, &now) == NULL);
+    wheel = timer_wheel_create(1, __wheel_now, &now);
+    assert(wheel != NULL);
+    assert(timer_wheel_now(wheel) == now);
+    assert(timer_wheel_count(wheel) == 0);
+    assert(timer_wheel_next_expiry(wheel, &instant) == false);
+    assert(timer_wheel_expire(wheel, NULL, NULL) == 0);
+    timer_wheel_destroy(wheel);
+    timer_wheel_destroy(NULL);
+
+    /* datetime_now() by default */
+    wheel = timer_wheel_create(10, NULL, NULL);
+    assert(wheel != NULL);
+    instant = instant_from_datetime(datetime_now());
+    assert(instant_diff(timer_wheel_now(wheel), instant) >= -1000 && instant_diff(timer_wheel_now(wheel), instant) <= 1000);
+    timer_wheel_destroy(wheel);
+
+    printf("[PASS] timer_wheel_create\n");
+}
+
+void test_timer_wheel_schedule() {
+    Instant now = instant_from_datetime(datetime_create(2024, JAN, 1, 0, 0, 0, 0));
+    DateTime invalid = datetime_create(2024, JAN, 1, 0, 0, 0, 0);
+    TimerWheel *wheel = timer_wheel_create(1, __wheel_now, &now);
+    WheelLog log;
+    TimerId ids[5];
+    int fired[5] = {0, 0, 0, 0, 0};
+
+    memset(&log, 0, sizeof(log));
+    log.tick_milliseconds = 1;
+    log.since = INSTANT_MIN;
+    log.last_due = INSTANT_MIN;
+    invalid.date.day = 32;
+    assert(timer_wheel_schedule(wheel, invalid, NULL) == 0);
+    assert(timer_wheel_schedule_instant(wheel, INSTANT_MAX + 1, NULL) == 0);
+
+    ids[0] = timer_wheel_schedule(wheel, datetime_create(2024, JAN, 1, 0, 0, 0, 5), &fired[0]);
+    ids[1] = timer_wheel_schedule(wheel, datetime_create(2024, JAN, 1, 0, 0, 0, 300), &fired[1]);
+    ids[2] = timer_wheel_schedule(wheel, datetime_create(2024, JAN, 1, 0, 1, 10, 0), &fired[2]);
+    ids[3] = timer_wheel_schedule(wheel, datetime_create(2100, JAN, 1, 0, 0, 0, 0), &fired[3]);
+    ids[4] = timer_wheel_schedule(wheel, datetime_create(2023, DEC, 31, 23, 59, 0, 0), &fired[4]); /* passed */
+    assert(ids[0] != 0 && ids[1] != 0 && ids[2] != 0 && ids[3] != 0 && ids[4] != 0);
+    assert(ids[0] != ids[1] && ids[1] != ids[2] && ids[2] != ids[3] && ids[3] != ids[4]);
+    assert(timer_wheel_count(wheel) == 5);
+
+    assert(timer_wheel_cancel(wheel, ids[1]) == true);
+    assert(timer_wheel_cancel(wheel, ids[1]) == false);
+    assert(timer_wheel_cancel(wheel, 0) == false);
+    assert(timer_wheel_cancel(wheel, ids[3] + 1000) == false);
+    assert(timer_wheel_count(wheel) == 4);
+
+    /* The passed deadline expires on the next advance, the others on their tick */
+    assert(timer_wheel_expire(wheel, __record_expired, &log) == 1);
+    assert(fired[4] == 1 && log.last.id == ids[4]);
+    assert(timer_wheel_advance(wheel, now + 4, __record_expired, &log) == 0);
+    assert(timer_wheel_advance(wheel, now + 5, __record_expired, &log) == 1);
+    assert(fired[0] == 1 && log.last.id == ids[0] && log.last.deadline == now + 5);
+    assert(timer_wheel_cancel(wheel, ids[0]) == false);
+    assert(timer_wheel_advance(wheel, now + 69999, __record_expired, &log) == 0);
+    assert(timer_wheel_advance(wheel, now + 70000, __record_expired, &log) == 1);
+    assert(fired[2] == 1 && fired[1] == 0);
+
+    /* Going back in time expires nothing */
+    assert(timer_wheel_advance(wheel, now, __record_expired, &log) == 0);
+    assert(timer_wheel_advance(wheel, instant_from_datetime(datetime_create(2099, DEC, 31, 23, 59, 59, 999)), __record_expired, &log) == 0);
+    now = instant_from_datetime(datetime_create(2100, JAN, 1, 0, 0, 0, 0));
+    assert(timer_wheel_expire(wheel, __record_expired, &log) == 1);
+    assert(fired[3] == 1 && timer_wheel_count(wheel) == 0 && log.count == 4);
+
+    /* The TimerId of an expired timer is not reused */
+    assert(timer_wheel_schedule_instant(wheel, now + 1, NULL) != ids[3]);
+    timer_wheel_destroy(wheel);
+
+    printf("[PASS] timer_wheel_schedule\n");
+}
+
+void test_timer_wheel_advance() {
+    const int TIMERS = 20000;
+    const int TICKS[] = {1, 7, 1000};
+    Instant now = instant_from_datetime(datetime_create(2024, JAN, 1, 0, 0, 0, 0));
+    Instant start = now;
+    Instant *deadlines = (Instant *)malloc(sizeof(Instant) * (size_t)TIMERS);
+    TimerId *ids = (TimerId *)malloc(sizeof(TimerId) * (size_t)TIMERS);
+    int *fired = (int *)malloc(sizeof(int) * (size_t)TIMERS);
+    TimerWheel *wheel;
+    WheelLog log;
+    Instant due;
+    size_t pending;
+    int tick;
+    int i;
+    int t;
+
+    assert(deadlines != NULL && ids != NULL && fired != NULL);
+    srand(20);
+    for (t = 0; t < 3; t++) {
+        tick = TICKS[t];
+        now = start;
+        wheel = timer_wheel_create(tick, __wheel_now, &now);
+        memset(&log, 0, sizeof(log));
+        log.tick_milliseconds = tick;
+        pending = 0;
+        /* Deadlines from milliseconds to years away, some already passed */
+        for (i = 0; i < TIMERS; i++) {
+            deadlines[i] = now + (((Instant)(rand() % 2000000) << (rand() % 24)) >> 4);
+            deadlines[i] -= i % 50 == 0 ? 1000 : 0;
+            fired[i] = 0;
+            ids[i] = timer_wheel_schedule_instant(wheel, deadlines[i], &fired[i]);
+            assert(ids[i] != 0);
+        }
+        for (i = 0; i < TIMERS; i += 4) {
+            assert(timer_wheel_cancel(wheel, ids[i]) == true);
+            fired[i] = -1;
+        }
+        assert(timer_wheel_count(wheel) == (size_t)(TIMERS - TIMERS / 4));
+
+        while (timer_wheel_count(wheel) > 0) {
+            log.since = now;
+            log.last_due = INSTANT_MIN;
+            now += (Instant)(rand() % 1000) << (rand() % 32);
+            timer_wheel_expire(wheel, __record_expired, &log);
+            /* Expired exactly once if the first tick at or after the deadline has passed */
+            pending = 0;
+            for (i = 0; i < TIMERS; i++) {
+                if (fired[i] >= 0) {
+                    due = deadlines[i] + ((tick - (deadlines[i] - INSTANT_MIN) % tick) % tick);
+                    assert(fired[i] == (due <= now));
+                    pending += fired[i] == 0;
+                }
+            }
+            assert(pending == timer_wheel_count(wheel));
+        }
+        assert(log.count == (size_t)(TIMERS - TIMERS / 4));
+        assert(log.max_batch <= TIMER_WHEEL_BATCH);
+        timer_wheel_destroy(wheel);
+    }
+    free(deadlines);
+    free(ids);
+    free(fired);
+
+    printf("[PASS] timer_wheel_advance\n");
+}
+
+void test_timer_wheel_callback() {
+    Instant now = instant_from_datetime(datetime_create(2024, JAN, 1, 0, 0, 0, 0));
+    TimerWheel *wheel = timer_wheel_create(1, __wheel_now, &now);
+    WheelLog log;
+    TimerId cancelled;
+    int fired[3] = {0, 0, 0};
+    int i;
+
+    /* Batches of at most TIMER_WHEEL_BATCH */
+    memset(&log, 0, sizeof(log));
+    log.tick_milliseconds = 1;
+    log.since = INSTANT_MIN;
+    log.last_due = INSTANT_MIN;
+    for (i = 0; i < 1000; i++) {
+        timer_wheel_schedule_instant(wheel, now + 10, &fired[0]);
+    }
+    assert(timer_wheel_advance(wheel, now + 10, __record_expired, &log) == 1000);
+    assert(fired[0] == 1000 && log.batches == 4 && log.max_batch == TIMER_WHEEL_BATCH);
+
+    /* The callback cancels a pending timer, schedules a passed deadline and cannot advance the wheel */
+    memset(&log, 0, sizeof(log));
+    log.tick_milliseconds = 1;
+    log.since = INSTANT_MIN;
+    log.last_due = INSTANT_MIN;
+    log.wheel = wheel;
+    timer_wheel_schedule_instant(wheel, now + 20, &fired[1]);
+    cancelled = timer_wheel_schedule_instant(wheel, now + 30, &fired[2]);
+    log.cancel = cancelled;
+    log.schedule = now + 15;
+    assert(timer_wheel_advance(wheel, now + 100, __record_expired, &log) == 1);
+    assert(fired[1] == 1 && fired[2] == 0 && timer_wheel_count(wheel) == 1);
+    log.last_due = INSTANT_MIN;
+    assert(timer_wheel_advance(wheel, now + 100, __record_expired, &log) == 1);
+    assert(fired[1] == 2 && timer_wheel_count(wheel) == 0);
+
+    /* A deadline scheduled by the callback ahead of the wheel expires in the same advance */
+    log.schedule = now + 150;
+    timer_wheel_schedule_instant(wheel, now + 120, &fired[1]);
+    assert(timer_wheel_advance(wheel, now + 200, __record_expired, &log) == 2);
+    assert(fired[1] == 4 && timer_wheel_cancel(wheel, cancelled) == false);
+
+    /* No callback */
+    timer_wheel_schedule_instant(wheel, now + 300, NULL);
+    assert(timer_wheel_advance(wheel, now + 300, NULL, NULL) == 1);
+    timer_wheel_destroy(wheel);
+
+    printf("[PASS] timer_wheel_callback\n");
+}
+
+void test_timer_wheel_next_expiry() {
+    Instant now = instant_from_datetime(datetime_create(2024, JAN, 1, 0, 0, 0, 0));
+    Instant deadline = instant_from_datetime(datetime_create(2031, MAY, 17, 13, 45, 12, 345));
+    Instant next;
+    TimerWheel *wheel = timer_wheel_create(1, __wheel_now, &now);
+    WheelLog log;
+    int fired = 0;
+    int wakeups = 0;
+
+    memset(&log, 0, sizeof(log));
+    log.tick_milliseconds = 1;
+    log.since = INSTANT_MIN;
+    log.last_due = INSTANT_MIN;
+    timer_wheel_schedule_instant(wheel, now + 200, &fired);
+    assert(timer_wheel_next_expiry(wheel, &next) == true && next == now + 200);
+    timer_wheel_advance(wheel, next, __record_expired, &log);
+    assert(fired == 1);
+
+    /* Sleeping until the next expiry wakes up at most once per level */
+    timer_wheel_schedule_instant(wheel, deadline, &fired);
+    while (fired == 1) {
+        assert(timer_wheel_next_expiry(wheel, &next) == true && next <= deadline);
+        timer_wheel_advance(wheel, next, __record_expired, &log);
+        wakeups++;
+    }
+    assert(fired == 2 && wakeups <= 8 && log.last.deadline == deadline);
+
+    /* A passed deadline is due at the current tick of the wheel */
+    timer_wheel_schedule_instant(wheel, now, &fired);
+    assert(timer_wheel_next_expiry(wheel, &next) == true && next == deadline);
+    timer_wheel_destroy(wheel);
+
+    printf("[PASS] timer_wheel_next_expiry\n");
+}
+
+void test_datetime_to_timespec() {
+    struct timespec ts;
+    DateTime datetime;
+    DateTime invalid = datetime_create(2024, JAN, 1, 0, 0, 0, 0);
+    int i;
+
+    assert(datetime_to_timespec(datetime_create(1970, JAN, 1, 0, 0, 0, 0), &ts) == true);
+    assert(ts.tv_sec == 0 && ts.tv_nsec == 0);
+    assert(datetime_to_timespec(datetime_create(2024, FEB, 29, 12, 34, 56, 789), &ts) == true);
+    assert(ts.tv_sec == 1709210096 && ts.tv_nsec == 789000000);
+    assert(datetime_to_timespec(datetime_create(1969, DEC, 31, 23, 59, 59, 500), &ts) == true);
+    assert(ts.tv_sec == -1 && ts.tv_nsec == 500000000);
+    assert(datetime_to_timespec(datetime_create(1, JAN, 1, 0, 0, 0, 1), &ts) == true);
+    assert((Instant)ts.tv_sec * MILLISECONDS_PER_SECOND + ts.tv_nsec / NANOSECONDS_PER_MILLISECOND == INSTANT_MIN + 1);
+
+    /* Same seconds as datetime_to_timestamp() */
+    srand(21);
+    for (i = 0; i < 10000; i++) {
+        datetime = instant_to_datetime(INSTANT_MIN + (Instant)(rand() % 3652059) * MILLISECONDS_PER_DAY + rand() % MILLISECONDS_PER_DAY);
+        assert(datetime_to_timespec(datetime, &ts) == true);
+        assert(ts.tv_sec == datetime_to_timestamp(datetime) && ts.tv_nsec == datetime.time.millisecond * NANOSECONDS_PER_MILLISECOND);
+    }
+
+    invalid.time.millisecond = 1000;
+    ts.tv_sec = 42;
+    assert(datetime_to_timespec(invalid, &ts) == false && ts.tv_sec == 42);
+    assert(datetime_to_timespec(datetime, NULL) == false);
+
+    printf("[PASS] datetime_to_timespec\n");
+}
+
+void test_datetime_alarm() {
+    DateTimeAlarm *alarm = datetime_alarm_create(false);
+    DateTimeAlarm *local = datetime_alarm_create(true);
+    DateTime invalid = datetime_create(2024, JAN, 1, 0, 0, 0, 0);
+    DateTime deadline;
+    DateTime armed;
+    struct timespec now;
+    struct timespec later;
+    int64_t elapsed;
+    char *tz = getenv("TZ");
+    char saved[64];
+
+    assert(alarm != NULL && local != NULL);
+    assert(datetime_alarm_fd(alarm) >= 0 && datetime_alarm_fd(alarm) != datetime_alarm_fd(local));
+    assert(datetime_alarm_armed(alarm, NULL) == false);
+    assert(datetime_alarm_read(alarm) == ALARM_NONE);
+    assert(datetime_alarm_wait(alarm, 10) == ALARM_NONE);
+
+    /* UTC deadline 50 ms away */
+    clock_gettime(CLOCK_REALTIME, &now);
+    deadline = instant_to_datetime((Instant)now.tv_sec * MILLISECONDS_PER_SECOND + now.tv_nsec / NANOSECONDS_PER_MILLISECOND + 50);
+    assert(datetime_alarm_set(alarm, deadline) == true);
+    assert(datetime_alarm_armed(alarm, &armed) == true && datetime_compare(armed, deadline) == 0);
+    assert(datetime_alarm_read(alarm) == ALARM_NONE);
+    assert(datetime_alarm_wait(alarm, 5000) == ALARM_EXPIRED);
+    clock_gettime(CLOCK_REALTIME, &later);
+    assert(datetime_to_timespec(deadline, &now) == true);
+    assert(later.tv_sec > now.tv_sec || (later.tv_sec == now.tv_sec && later.tv_nsec >= now.tv_nsec));
+    assert(datetime_alarm_armed(alarm, NULL) == false);
+    assert(datetime_alarm_read(alarm) == ALARM_NONE);
+
+    /* A passed deadline expires at once, a cleared one never */
+    assert(datetime_alarm_set(alarm, datetime_create(2000, JAN, 1, 0, 0, 0, 0)) == true);
+    assert(datetime_alarm_wait(alarm, 1000) == ALARM_EXPIRED);
+
+    /* Setting the wall clock once the alarm has expired is not an error (needs CAP_SYS_TIME, skipped otherwise) */
+    clock_gettime(CLOCK_REALTIME, &now);
+    if (clock_settime(CLOCK_REALTIME, &now) == 0) {
+        assert(datetime_alarm_read(alarm) == ALARM_CLOCK_CHANGED);
+        assert(datetime_alarm_armed(alarm, NULL) == false);
+        assert(datetime_alarm_read(alarm) == ALARM_NONE);
+        clock_gettime(CLOCK_REALTIME, &now);
+        assert(clock_settime(CLOCK_REALTIME, &now) == 0);
+        assert(datetime_alarm_read(alarm) == ALARM_NONE);
+    }
+    assert(datetime_alarm_set(alarm, datetime_create(9999, DEC, 31, 0, 0, 0, 0)) == true);
+    assert(datetime_alarm_wait(alarm, 20) == ALARM_NONE);
+    assert(datetime_alarm_clear(alarm) == true);
+    assert(datetime_alarm_armed(alarm, NULL) == false);
+    invalid.date.month = 13;
+    assert(datetime_alarm_set(alarm, invalid) == false && datetime_alarm_armed(alarm, NULL) == false);
+
+    /* Local deadline 30 ms after datetime_now() */
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    assert(datetime_alarm_set(local, datetime_add(datetime_now(), 0, 30)) == true);
+    assert(datetime_alarm_wait(local, 5000) == ALARM_EXPIRED);
+    clock_gettime(CLOCK_MONOTONIC, &later);
+    elapsed = (int64_t)(later.tv_sec - now.tv_sec) * MILLISECONDS_PER_SECOND + (later.tv_nsec - now.tv_nsec) / NANOSECONDS_PER_MILLISECOND;
+    assert(elapsed >= 25 && elapsed < 2000);
+
+    /* A local deadline skipped by the change to daylight saving time */
+    saved[0] = '\0';
+    if (tz != NULL) {
+        strncat(saved, tz, sizeof(saved) - 1);
+    }
+    setenv("TZ", "EST5EDT,M3.2.0,M11.1.0", 1);
+    tzset();
+    assert(datetime_alarm_set(local, datetime_create(2024, MAR, 10, 2, 30, 0, 0)) == false);
+    assert(errno == EINVAL && datetime_alarm_armed(local, NULL) == false);
+    assert(datetime_alarm_set(local, datetime_create(2024, MAR, 10, 3, 30, 0, 0)) == true);
+    assert(datetime_alarm_set(local, datetime_create(2024, NOV, 3, 1, 30, 0, 0)) == true); /* repeated, not skipped */
+    assert(datetime_alarm_wait(local, 1000) == ALARM_EXPIRED);
+    if (tz != NULL) {
+        setenv("TZ", saved, 1);
+    } else {
+        unsetenv("TZ");
+    }
+    tzset();
+
+    datetime_alarm_destroy(alarm);
+    datetime_alarm_destroy(local);
+    datetime_alarm_destroy(NULL);
+
+    printf("[PASS] datetime_alarm\n");
+}
+
+/* The wake-ups seen by __record_sleeper(). */
+typedef struct LoopLog {
+    DateTimeLoop *loop;
+    int order[16];
+    size_t count;
+    struct LoopSleeper *cancel; /* the array of cancel_count sleepers cancelled by the next wake-up, but itself */
+    size_t cancel_count;
+    DateTimeSleeper *again;  /* registered again by the next wake-up, for 1 ms */
+    bool stop;               /* stops the loop on the next wake-up */
+} LoopLog;
+
+typedef struct LoopSleeper {
+    DateTimeSleeper sleeper;
+    LoopLog *log;
+    int index;
+} LoopSleeper;
+
+static void __record_sleeper(void *data) {
+    LoopSleeper *sleeper = (LoopSleeper *)data;
+    LoopLog *log = sleeper->log;
+    TimeInterval interval = {0, 0, 0, 0, 1};
+    size_t i;
+
+    assert(sleeper->sleeper.id == 0);
+    log->order[log->count++] = sleeper->index;
+    for (i = 0; i < log->cancel_count; i++) {
+        if (&log->cancel[i] != sleeper) {
+            assert(datetime_loop_cancel(log->loop, &log->cancel[i].sleeper) == true);
+        }
+    }
+    log->cancel_count = 0;
+    if (log->again != NULL) {
+        assert(datetime_loop_sleep_for(log->loop, log->again, interval) == true);
+        log->again = NULL;
+    }
+    if (log->stop) {
+        datetime_loop_stop(log->loop);
+        log->stop = false;
+    }
+}
+
+static void __loop_sleepers(LoopLog *log, LoopSleeper *sleepers, size_t count) {
+    size_t i;
+
+    memset(log, 0, sizeof(LoopLog));
+    log->loop = datetime_loop_create();
+    assert(log->loop != NULL);
+    for (i = 0; i < count; i++) {
+        sleepers[i].sleeper.callback = __record_sleeper;
+        sleepers[i].sleeper.data = &sleepers[i];
+        sleepers[i].sleeper.id = 0;
+        sleepers[i].log = log;
+        sleepers[i].index = (int)i;
+    }
+}
+
+void test_datetime_loop_sleep() {
+    LoopLog log;
+    LoopSleeper sleepers[5];
+    TimeInterval interval = {0, 0, 0, 0, 15};
+    DateTime now;
+    DateTime invalid = datetime_create(2024, JAN, 1, 0, 0, 0, 0);
+    struct timespec start;
+    struct timespec end;
+    int64_t elapsed;
+    size_t woken;
+    char *tz = getenv("TZ");
+    char saved[64];
+    struct tm tm;
+
+    __loop_sleepers(&log, sleepers, 5);
+    assert(datetime_loop_fd(log.loop) >= 0);
+    assert(datetime_loop_count(log.loop) == 0);
+    assert(datetime_loop_run_once(log.loop, 0, &woken) == true && woken == 0);
+    assert(datetime_loop_run(log.loop) == true);
+
+    /* Woken up in order of deadline, whatever the order of registration */
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    now = datetime_now();
+    assert(datetime_loop_sleep_until(log.loop, &sleepers[0].sleeper, datetime_add(now, 0, 40)) == true);
+    assert(datetime_loop_sleep_until(log.loop, &sleepers[1].sleeper, datetime_add(now, 0, 10)) == true);
+    assert(datetime_loop_sleep_for(log.loop, &sleepers[2].sleeper, interval) == true);
+    assert(datetime_loop_sleep_until(log.loop, &sleepers[3].sleeper, datetime_add(now, 0, 25)) == true);
+    assert(datetime_loop_sleep_until(log.loop, &sleepers[3].sleeper, now) == false);
+    assert(datetime_loop_count(log.loop) == 4);
+    assert(datetime_loop_run_once(log.loop, 0, &woken) == true && woken == 0);
+    assert(datetime_loop_run(log.loop) == true);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    elapsed = (int64_t)(end.tv_sec - start.tv_sec) * MILLISECONDS_PER_SECOND + (end.tv_nsec - start.tv_nsec) / NANOSECONDS_PER_MILLISECOND;
+    assert(elapsed >= 35 && elapsed < 2000);
+    assert(log.count == 4);
+    assert(log.order[0] == 1 && log.order[1] == 2 && log.order[2] == 3 && log.order[3] == 0);
+    assert(datetime_loop_count(log.loop) == 0);
+
+    /* A passed deadline wakes up on the next run, an invalid one is refused */
+    assert(datetime_loop_sleep_until(log.loop, &sleepers[4].sleeper, datetime_create(2000, JAN, 1, 0, 0, 0, 0)) == true);
+    assert(datetime_loop_run_once(log.loop, 1000, &woken) == true && woken == 1);
+    assert(log.count == 5 && log.order[4] == 4);
+    invalid.date.day = 32;
+    assert(datetime_loop_sleep_until(log.loop, &sleepers[4].sleeper, invalid) == false);
+    assert(sleepers[4].sleeper.id == 0);
+
+    /* A sleeper can register again from its own callback */
+    log.again = &sleepers[4].sleeper;
+    assert(datetime_loop_sleep_for(log.loop, &sleepers[4].sleeper, interval) == true);
+    assert(datetime_loop_run(log.loop) == true);
+    assert(log.count == 7 && log.order[5] == 4 && log.order[6] == 4);
+
+    /* Local deadlines are converted to UTC when registered: 1 s away in a zone 5:30 ahead of UTC, not 5:30 h */
+    saved[0] = '\0';
+    if (tz != NULL) {
+        strncat(saved, tz, sizeof(saved) - 1);
+    }
+    setenv("TZ", "IST-5:30", 1);
+    tzset();
+    clock_gettime(CLOCK_REALTIME, &start);
+    start.tv_sec += 1;
+    localtime_r(&start.tv_sec, &tm);
+    now = datetime_create(tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec, 0);
+    assert(datetime_loop_sleep_until(log.loop, &sleepers[0].sleeper, now) == true);
+    assert(datetime_loop_sleep_for(log.loop, &sleepers[1].sleeper, interval) == true);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    assert(datetime_loop_run(log.loop) == true);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    elapsed = (int64_t)(end.tv_sec - start.tv_sec) * MILLISECONDS_PER_SECOND + (end.tv_nsec - start.tv_nsec) / NANOSECONDS_PER_MILLISECOND;
+    assert(elapsed < 2000);
+    assert(log.count == 9 && log.order[7] == 1 && log.order[8] == 0);
+    if (tz != NULL) {
+        setenv("TZ", saved, 1);
+    } else {
+        unsetenv("TZ");
+    }
+    tzset();
+
+    /* Setting the wall clock once the last sleeper has woken up is not an error (needs CAP_SYS_TIME) */
+    assert(datetime_loop_sleep_until(log.loop, &sleepers[2].sleeper, datetime_create(2000, JAN, 1, 0, 0, 0, 0)) == true);
+    assert(datetime_loop_run_once(log.loop, 1000, &woken) == true && woken == 1);
+    clock_gettime(CLOCK_REALTIME, &start);
+    if (clock_settime(CLOCK_REALTIME, &start) == 0) {
+        assert(datetime_loop_run_once(log.loop, 0, &woken) == true && woken == 0);
+        clock_gettime(CLOCK_REALTIME, &start);
+        assert(clock_settime(CLOCK_REALTIME, &start) == 0);
+        assert(datetime_loop_run_once(log.loop, 0, &woken) == true && woken == 0);
+    }
+
+    datetime_loop_destroy(log.loop);
+    datetime_loop_destroy(NULL);
+
+    printf("[PASS] datetime_loop_sleep\n");
+}
+
+void test_datetime_loop_cancel() {
+    LoopLog log;
+    LoopSleeper sleepers[4];
+    DateTime now;
+    DateTime past = datetime_create(2000, JAN, 1, 0, 0, 0, 0);
+    size_t woken;
+
+    __loop_sleepers(&log, sleepers, 4);
+    now = datetime_now();
+    assert(datetime_loop_cancel(log.loop, &sleepers[0].sleeper) == false);
+    assert(datetime_loop_sleep_until(log.loop, &sleepers[0].sleeper, datetime_add(now, 0, 10)) == true);
+    assert(datetime_loop_sleep_until(log.loop, &sleepers[1].sleeper, datetime_add(now, 0, 20)) == true);
+    assert(datetime_loop_cancel(log.loop, &sleepers[0].sleeper) == true);
+    assert(sleepers[0].sleeper.id == 0 && datetime_loop_count(log.loop) == 1);
+    assert(datetime_loop_cancel(log.loop, &sleepers[0].sleeper) == false);
+    assert(datetime_loop_run(log.loop) == true);
+    assert(log.count == 1 && log.order[0] == 1);
+
+    /* Woken up together: the first one cancels the others before they are called */
+    log.count = 0;
+    assert(datetime_loop_sleep_until(log.loop, &sleepers[0].sleeper, past) == true);
+    assert(datetime_loop_sleep_until(log.loop, &sleepers[1].sleeper, past) == true);
+    assert(datetime_loop_sleep_until(log.loop, &sleepers[2].sleeper, past) == true);
+    log.cancel = sleepers;
+    log.cancel_count = 3;
+    assert(datetime_loop_run_once(log.loop, 1000, &woken) == true && woken == 3);
+    assert(log.count == 1 && datetime_loop_count(log.loop) == 0);
+    assert(sleepers[0].sleeper.id == 0 && sleepers[1].sleeper.id == 0 && sleepers[2].sleeper.id == 0);
+
+    /* Stopped from a callback, with sleepers left */
+    log.count = 0;
+    log.stop = true;
+    assert(datetime_loop_sleep_until(log.loop, &sleepers[0].sleeper, past) == true);
+    assert(datetime_loop_sleep_until(log.loop, &sleepers[3].sleeper, datetime_add(now, 1, 0)) == true);
+    assert(datetime_loop_run(log.loop) == true);
+    assert(log.count == 1 && datetime_loop_count(log.loop) == 1);
+
+    /* Destroyed with a sleeper left, which is never called */
+    datetime_loop_destroy(log.loop);
+    assert(log.count == 1);
+
+    printf("[PASS] datetime_loop_cancel\n");
+}
+
+static void __sleep_milliseconds(long milliseconds) {
+    struct timespec ts;
+
+    ts.tv_sec = milliseconds / MILLISECONDS_PER_SECOND;
+    ts.tv_nsec = milliseconds % MILLISECONDS_PER_SECOND * NANOSECONDS_PER_MILLISECOND;
+    while (nanosleep(&ts, &ts) != 0) {
+    }
+}
+
+void test_mono_now() {
+    MonoTime start = mono_now(MONO_CLOCK_MONOTONIC);
+    MonoTime raw = mono_now(MONO_CLOCK_RAW);
+    MonoTime previous = start;
+    MonoTime now;
+    TimeInterval time_interval;
+    int i;
+
+    /* Never goes backwards */
+    for (i = 0; i < 100000; i++) {
+        now = mono_now(MONO_CLOCK_MONOTONIC);
+        assert(now >= previous);
+        previous = now;
+    }
+    __sleep_milliseconds(20);
+    assert(mono_now(MONO_CLOCK_MONOTONIC) - start >= 20 * NANOSECONDS_PER_MILLISECOND);
+    assert(mono_now(MONO_CLOCK_RAW) - raw >= 19 * NANOSECONDS_PER_MILLISECOND);
+
+    time_interval = mono_to_time_interval(0);
+    assert(time_interval.days == 0 && time_interval.hours == 0 && time_interval.minutes == 0 && time_interval.seconds == 0 && time_interval.milliseconds == 0);
+    time_interval = mono_to_time_interval(-5);
+    assert(time_interval.days == 0 && time_interval.milliseconds == 0);
+    time_interval = mono_to_time_interval((int64_t)999999);
+    assert(time_interval.seconds == 0 && time_interval.milliseconds == 0);
+    time_interval = mono_to_time_interval(((((int64_t)2 * 24 + 3) * 60 + 4) * 60 + 5) * NANOSECONDS_PER_SECOND + 678 * NANOSECONDS_PER_MILLISECOND + 999);
+    assert(time_interval.days == 2 && time_interval.hours == 3 && time_interval.minutes == 4 && time_interval.seconds == 5 && time_interval.milliseconds == 678);
+
+    printf("[PASS] mono_now\n");
+}
+
+void test_stopwatch() {
+    Stopwatch stopwatch;
+    TimeInterval time_interval;
+    int64_t elapsed;
+    int64_t lap;
+
+    stopwatch_init(&stopwatch, MONO_CLOCK_MONOTONIC);
+    assert(stopwatch.running == 0 && stopwatch_elapsed(&stopwatch) == 0);
+    assert(stopwatch_stop(&stopwatch) == 0);
+
+    /* Laps add up to the split time */
+    stopwatch_start(&stopwatch);
+    __sleep_milliseconds(10);
+    lap = stopwatch_lap(&stopwatch);
+    assert(lap >= 10 * NANOSECONDS_PER_MILLISECOND);
+    __sleep_milliseconds(20);
+    elapsed = stopwatch_elapsed(&stopwatch);
+    assert(elapsed >= 30 * NANOSECONDS_PER_MILLISECOND && elapsed > lap);
+    lap += stopwatch_lap(&stopwatch);
+    assert(lap >= elapsed);
+
+    /* The time stopped does not count */
+    elapsed = stopwatch_stop(&stopwatch);
+    assert(stopwatch_stop(&stopwatch) == elapsed);
+    __sleep_milliseconds(30);
+    assert(stopwatch_elapsed(&stopwatch) == elapsed);
+    stopwatch_start(&stopwatch);
+    stopwatch_start(&stopwatch);
+    __sleep_milliseconds(5);
+    assert(stopwatch_elapsed(&stopwatch) >= elapsed + 5 * NANOSECONDS_PER_MILLISECOND);
+    assert(stopwatch_elapsed(&stopwatch) < elapsed + 30 * NANOSECONDS_PER_MILLISECOND + 1000 * NANOSECONDS_PER_MILLISECOND);
+    lap = stopwatch_lap(&stopwatch);
+    assert(lap >= 5 * NANOSECONDS_PER_MILLISECOND);
+
+    time_interval = stopwatch_interval(&stopwatch);
+    assert(time_interval.days == 0 && time_interval.hours == 0 && time_interval.minutes == 0);
+    assert(time_interval.seconds * MILLISECONDS_PER_SECOND + time_interval.milliseconds >= 35);
+
+    stopwatch_reset(&stopwatch);
+    assert(stopwatch.running == 1 && stopwatch_elapsed(&stopwatch) < 1000 * NANOSECONDS_PER_MILLISECOND);
+    assert(stopwatch_lap(&stopwatch) < 1000 * NANOSECONDS_PER_MILLISECOND);
+
+    stopwatch = stopwatch_start_new(MONO_CLOCK_RAW);
+    __sleep_milliseconds(5);
+    assert(stopwatch.running == 1 && stopwatch_elapsed(&stopwatch) >= 4 * NANOSECONDS_PER_MILLISECOND);
+
+    printf("[PASS] stopwatch\n");
+}
+
+static int64_t __realtime_nanoseconds(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (int64_t)ts.tv_sec * NANOSECONDS_PER_SECOND + ts.tv_nsec;
+}
+
+static void __check_tsc_clock(TscClock *clock) {
+    uint64_t ticks;
+    uint64_t previous;
+    int64_t before;
+    int64_t now;
+    int64_t after;
+    Instant instant;
+    DateTime datetime;
+    int i;
+
+    /* Within 1 ms of CLOCK_REALTIME, across the calibrations every 20 ms */
+    for (i = 0; i < 5; i++) {
+        before = __realtime_nanoseconds();
+        now = tsc_clock_now(clock);
+        after = __realtime_nanoseconds();
+        assert(now > before - 1000000 && now < after + 1000000);
+        __sleep_milliseconds(25);
+    }
+
+    /* The ticks only go forward, and the ticks of before the latest calibration still convert */
+    previous = tsc_clock_ticks(clock);
+    before = tsc_clock_to_nanoseconds(clock, previous);
+    for (i = 0; i < 100000; i++) {
+        ticks = tsc_clock_ticks(clock);
+        assert(ticks >= previous);
+        previous = ticks;
+    }
+    __sleep_milliseconds(25);
+    tsc_clock_calibrate(clock);
+    now = tsc_clock_to_nanoseconds(clock, previous);
+    assert(now >= before && now - before < 1000000000);
+    after = tsc_clock_to_nanoseconds(clock, tsc_clock_ticks(clock));
+    assert(after >= now + 20000000);
+
+    before = __realtime_nanoseconds() / NANOSECONDS_PER_MILLISECOND;
+    instant = tsc_clock_now_instant(clock);
+    after = __realtime_nanoseconds() / NANOSECONDS_PER_MILLISECOND;
+    assert(instant >= before - 1 && instant <= after + 1);
+    datetime = tsc_clock_now_datetime(clock);
+    assert(instant_from_datetime_checked(datetime, &instant) == DATETIME_OK && instant >= before - 1);
+}
+
+void test_tsc_clock() {
+    TscClock *clock;
+
+    assert(tsc_clock_create(0, true) == NULL);
+
+    clock = tsc_clock_create(20, true);
+    assert(clock != NULL);
+    if (tsc_clock_is_tsc(clock)) {
+        assert(tsc_clock_frequency(clock) > 100000000 && tsc_clock_frequency(clock) < (int64_t)100000000000);
+    }
+    __check_tsc_clock(clock);
+    tsc_clock_destroy(clock);
+
+    /* The fallback counts the nanoseconds of CLOCK_REALTIME */
+    clock = tsc_clock_create(20, false);
+    assert(clock != NULL && tsc_clock_is_tsc(clock) == false);
+    assert(tsc_clock_frequency(clock) == NANOSECONDS_PER_SECOND);
+    assert(tsc_clock_to_nanoseconds(clock, 123456789) == 123456789);
+    __check_tsc_clock(clock);
+    tsc_clock_destroy(clock);
+    tsc_clock_destroy(NULL);
+
+    printf("[PASS] tsc_clock\n");
+}
+
 int main() {
     test_is_leap_year();
+    test_year_table();
     test_month_name();
     test_weekday_full_name();
     test_weekday_abbr_name();
@@ -1059,10 +3908,18 @@ int main() {
     test_days_in_year();
     test_nth_day_of_year();
     test_weekday();
+    test_weekday_from_ordinal();
+    test_weekday_many();
+    test_iso_weeks_in_year();
+    test_iso_week();
+    test_date_from_iso_week();
+    test_iso_week_many();
     test_calendar();
+    test_calendar_buffer();
 
     test_time_interval_create();
     test_time_interval_to_string();
+    test_time_interval_to_string_buffer();
 
     test_date_create();
     test_date_now();
@@ -1070,7 +3927,9 @@ int main() {
     test_date_add();
     test_date_diff();
     test_date_to_string();
+    test_date_to_string_buffer();
     test_date_ascii_string();
+    test_date_ascii_string_buffer();
 
     test_time_create();
     test_time_now();
@@ -1078,10 +3937,13 @@ int main() {
     test_time_add();
     test_time_diff();
     test_time_to_string();
+    test_time_to_string_buffer();
     test_time_ascii_string();
+    test_time_ascii_string_buffer();
 
     test_datetime_create();
     test_datetime_now();
+    test_datetime_now_snapshot();
     test_datetime_from_timestamp();
     test_datetime_to_timestamp();
     test_datetime_from_ordinal();
@@ -1090,8 +3952,69 @@ int main() {
     test_datetime_add();
     test_datetime_diff();
     test_datetime_to_string();
+    test_datetime_to_string_buffer();
     test_datetime_ascii_string();
+    test_datetime_ascii_string_buffer();
     test_datetime_format_string();
+    test_datetime_format_render();
+
+    test_instant_from_datetime();
+    test_instant_to_datetime();
+    test_instant_compare();
+    test_instant_add();
+    test_instant_diff();
+    test_instant_min_max();
+
+    test_date_pack();
+    test_time_pack();
+    test_datetime_pack();
+
+    test_datetime_column_create();
+    test_datetime_column_validate();
+    test_datetime_column_validate_mask();
+    test_datetime_column_timestamp();
+    test_datetime_column_instant();
+    test_datetime_column_weekday();
+    test_datetime_column_compare();
+
+    test_datetime_parse_iso8601();
+
+    test_datetime_error();
+    test_date_checked();
+    test_time_checked();
+    test_datetime_checked();
+    test_datetime_unchecked();
+
+    test_datetime_array_timestamp();
+    test_datetime_array_string();
+    test_datetime_thread_pool_run();
+    test_datetime_parallel();
+
+    test_business_calendar_create();
+    test_business_calendar_add();
+    test_business_calendar_count();
+    test_business_calendar_image();
+
+    test_recurrence_compile_cron();
+    test_recurrence_compile_rrule();
+    test_recurrence_next_occurrence();
+    test_recurrence_matches();
+    test_recurrence_batch_matches();
+    test_recurrence_next_occurrence_many();
+
+    test_timer_wheel_create();
+    test_timer_wheel_schedule();
+    test_timer_wheel_advance();
+    test_timer_wheel_callback();
+    test_timer_wheel_next_expiry();
+
+    test_datetime_to_timespec();
+    test_datetime_alarm();
+    test_datetime_loop_sleep();
+    test_datetime_loop_cancel();
+    test_mono_now();
+    test_stopwatch();
+    test_tsc_clock();
 
     printf("[PASS] All\n");
     return 0;